@@ -34,10 +34,12 @@ let package = Package(
                 "kuzu/extension/algo/src/function/component_ids.cpp",
                 "kuzu/extension/algo/src/function/config/max_iterations_config.cpp",
                 "kuzu/extension/algo/src/function/k_core_decomposition.cpp",
+                "kuzu/extension/algo/src/function/leiden.cpp",
                 "kuzu/extension/algo/src/function/louvain.cpp",
                 "kuzu/extension/algo/src/function/page_rank.cpp",
                 "kuzu/extension/algo/src/function/strongly_connected_components.cpp",
                 "kuzu/extension/algo/src/function/strongly_connected_components_kosaraju.cpp",
+                "kuzu/extension/algo/src/function/triangle_count.cpp",
                 "kuzu/extension/algo/src/function/weakly_connected_components.cpp",
                 "kuzu/extension/algo/src/main/algo_extension.cpp",
                 "kuzu/extension/fts/src/catalog/fts_index_catalog_entry.cpp",
@@ -226,6 +228,7 @@ let package = Package(
                 "kuzu/src/common/data_chunk/sel_vector.cpp",
                 "kuzu/src/common/database_lifecycle_manager.cpp",
                 "kuzu/src/common/enums/accumulate_type.cpp",
+                "kuzu/src/common/enums/block_compression_type.cpp",
                 "kuzu/src/common/enums/conflict_action.cpp",
                 "kuzu/src/common/enums/drop_type.cpp",
                 "kuzu/src/common/enums/extend_direction_util.cpp",
@@ -405,15 +408,22 @@ let package = Package(
                 "kuzu/src/function/table/bm_info.cpp",
                 "kuzu/src/function/table/cache_column.cpp",
                 "kuzu/src/function/table/catalog_version.cpp",
+                "kuzu/src/function/table/checkpoint_info.cpp",
                 "kuzu/src/function/table/clear_warnings.cpp",
+                "kuzu/src/function/table/compact_database.cpp",
+                "kuzu/src/function/table/create_index.cpp",
                 "kuzu/src/function/table/current_setting.cpp",
                 "kuzu/src/function/table/db_version.cpp",
+                "kuzu/src/function/table/drop_index.cpp",
                 "kuzu/src/function/table/drop_project_graph.cpp",
                 "kuzu/src/function/table/file_info.cpp",
                 "kuzu/src/function/table/free_space_info.cpp",
+                "kuzu/src/function/table/mm_info.cpp",
                 "kuzu/src/function/table/project_cypher_graph.cpp",
                 "kuzu/src/function/table/project_native_graph.cpp",
                 "kuzu/src/function/table/projected_graph_info.cpp",
+                "kuzu/src/function/table/set_rel_neighbor_order.cpp",
+                "kuzu/src/function/table/set_table_compression.cpp",
                 "kuzu/src/function/table/show_attached_databases.cpp",
                 "kuzu/src/function/table/show_connection.cpp",
                 "kuzu/src/function/table/show_functions.cpp",
@@ -466,6 +476,7 @@ let package = Package(
                 "kuzu/src/main/plan_printer.cpp",
                 "kuzu/src/main/prepared_statement.cpp",
                 "kuzu/src/main/prepared_statement_manager.cpp",
+                "kuzu/src/main/query_admission_queue.cpp",
                 "kuzu/src/main/query_result.cpp",
                 "kuzu/src/main/query_summary.cpp",
                 "kuzu/src/main/settings.cpp",
@@ -732,6 +743,7 @@ let package = Package(
                 "kuzu/src/processor/operator/scan/scan_node_table.cpp",
                 "kuzu/src/processor/operator/scan/scan_rel_table.cpp",
                 "kuzu/src/processor/operator/scan/scan_table.cpp",
+                "kuzu/src/processor/operator/scan/secondary_index_scan_node_table.cpp",
                 "kuzu/src/processor/operator/semi_masker.cpp",
                 "kuzu/src/processor/operator/simple/attach_database.cpp",
                 "kuzu/src/processor/operator/simple/detach_database.cpp",
@@ -762,14 +774,20 @@ let package = Package(
                 "kuzu/src/processor/result/result_set_descriptor.cpp",
                 "kuzu/src/processor/warning_context.cpp",
                 "kuzu/src/storage/buffer_manager/buffer_manager.cpp",
+                "kuzu/src/storage/buffer_manager/buffer_pool_warmer.cpp",
+                "kuzu/src/storage/buffer_manager/decompressed_page_cache.cpp",
                 "kuzu/src/storage/buffer_manager/memory_manager.cpp",
+                "kuzu/src/storage/buffer_manager/memory_tracker.cpp",
+                "kuzu/src/storage/buffer_manager/page_prefetcher.cpp",
                 "kuzu/src/storage/buffer_manager/spiller.cpp",
                 "kuzu/src/storage/buffer_manager/vm_region.cpp",
                 "kuzu/src/storage/checkpointer.cpp",
                 "kuzu/src/storage/compression/bitpacking_int128.cpp",
                 "kuzu/src/storage/compression/bitpacking_utils.cpp",
+                "kuzu/src/storage/compression/block_compression.cpp",
                 "kuzu/src/storage/compression/compression.cpp",
                 "kuzu/src/storage/compression/float_compression.cpp",
+                "kuzu/src/storage/compression/fsst.cpp",
                 "kuzu/src/storage/disk_array.cpp",
                 "kuzu/src/storage/disk_array_collection.cpp",
                 "kuzu/src/storage/file_handle.cpp",
@@ -777,6 +795,7 @@ let package = Package(
                 "kuzu/src/storage/index/hash_index.cpp",
                 "kuzu/src/storage/index/in_mem_hash_index.cpp",
                 "kuzu/src/storage/index/index.cpp",
+                "kuzu/src/storage/index/ordered_index.cpp",
                 "kuzu/src/storage/local_storage/local_node_table.cpp",
                 "kuzu/src/storage/local_storage/local_rel_table.cpp",
                 "kuzu/src/storage/local_storage/local_storage.cpp",
@@ -791,6 +810,7 @@ let package = Package(
                 "kuzu/src/storage/stats/column_stats.cpp",
                 "kuzu/src/storage/stats/hyperloglog.cpp",
                 "kuzu/src/storage/stats/table_stats.cpp",
+                "kuzu/src/storage/storage_compactor.cpp",
                 "kuzu/src/storage/storage_manager.cpp",
                 "kuzu/src/storage/storage_utils.cpp",
                 "kuzu/src/storage/storage_version_info.cpp",
@@ -1131,9 +1151,14 @@ let package = Package(
                 .headerSearchPath("kuzu/third_party/yyjson/src"),
                 .headerSearchPath("kuzu/third_party/zstd/include"),
                 .define("ANTLR4CPP_STATIC"),
-                .define("BM_MALLOC"),
+                // Linux builds keep the buffer pool in VMRegions, which can be backed by huge
+                // pages and bound to NUMA nodes.
+                .define(
+                    "BM_MALLOC",
+                    .when(platforms: [.macOS, .macCatalyst, .iOS, .tvOS, .watchOS, .visionOS])
+                ),
                 .define("HAS_FULLFSYNC"),
-                .define("KUZU_CMAKE_VERSION", to: "\"0.11.3\""),
+                .define("KUZU_CMAKE_VERSION", to: "\"0.11.4\""),
                 .define("KUZU_EXPORTS"),
                 .define("KUZU_EXTENSION_VERSION", to: "\"0.11.3\""),
                 .define("KUZU_ROOT_DIRECTORY", to: "\"kuzu\""),
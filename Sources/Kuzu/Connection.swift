@@ -159,6 +159,34 @@ public final class Connection: @unchecked Sendable {
         kuzu_connection_set_query_timeout(&cConnection, milliseconds)
     }
 
+    /// Sets the memory limit of each query executed on the connection.
+    /// The limit counts the intermediate results a query holds, such as hash tables and sort
+    /// buffers.
+    /// A value of 0 means no limit.
+    /// - Parameters:
+    ///   - bytes: The memory limit in bytes
+    ///   - policy: What a query does when it reaches this limit or the connection memory limit
+    public func setQueryMemoryLimit(_ bytes: UInt64, policy: MemoryLimitPolicy = .fail) {
+        let cPolicy: kuzu_memory_limit_policy
+        switch policy {
+        case .fail:
+            cPolicy = KUZU_MEMORY_LIMIT_FAIL
+        case .wait:
+            cPolicy = KUZU_MEMORY_LIMIT_WAIT
+        case .spill:
+            cPolicy = KUZU_MEMORY_LIMIT_SPILL
+        }
+        kuzu_connection_set_query_memory_limit(&cConnection, bytes, cPolicy)
+    }
+
+    /// Sets the memory limit of the connection.
+    /// The limit counts the memory of all queries executed on the connection, including the
+    /// results that are not released yet. A value of 0 means no limit.
+    /// - Parameter bytes: The memory limit in bytes
+    public func setConnectionMemoryLimit(_ bytes: UInt64) {
+        kuzu_connection_set_connection_memory_limit(&cConnection, bytes)
+    }
+
     /// Interrupts the execution of the current query on the connection.
     public func interrupt() {
         kuzu_connection_interrupt(&cConnection)
@@ -22,6 +22,11 @@ public final class SystemConfig: @unchecked Sendable {
     /// - maxNumThreads: Number of CPU cores available in the system
     /// - enableCompression: true
     /// - readOnly: false
+    /// - enableDirectIO: false
+    /// - enableBufferPoolWarmup: false
+    /// - enableMemoryMappedReads: false
+    /// - enableHugePages: false
+    /// - bindBufferPoolToNumaNodes: false
     /// - threadQos: QOS_CLASS_DEFAULT (Apple platforms only)
     public init() {
         cSystemConfig = kuzu_default_system_config()
@@ -45,13 +50,23 @@ public final class SystemConfig: @unchecked Sendable {
     ///   - readOnly: A boolean flag to open the database in read-only mode. Default is false.
     ///   - autoCheckpoint: Whether to automatically create checkpoints. Default is true.
     ///   - checkpointThreshold: The threshold for creating checkpoints. If set to UInt64.max, uses default value.
+    ///   - enableDirectIO: Whether to read and write database pages bypassing the OS page cache, so that they are only cached in the buffer pool. Default is false.
+    ///   - enableBufferPoolWarmup: Whether to record the pages cached in the buffer pool and reload them in the background when the database is opened again. Default is false.
+    ///   - enableMemoryMappedReads: Whether a read-only database reads pages from a memory mapping of the database file instead of the buffer pool. Ignored unless readOnly is true. Default is false.
+    ///   - enableHugePages: Whether the buffer pool asks the OS to back its frames with transparent huge pages, which reduces TLB misses on large buffer pools. Only supported on Linux. Default is false.
+    ///   - bindBufferPoolToNumaNodes: Whether the frame groups of the buffer pool are spread round-robin across the NUMA nodes of the machine. Only supported on Linux. Default is false.
     public convenience init(
         bufferPoolSize: UInt64 = 0,
         maxNumThreads: UInt64 = 0,
         enableCompression: Bool = true,
         readOnly: Bool = false,
         autoCheckpoint: Bool = true,
-        checkpointThreshold: UInt64 = UInt64.max
+        checkpointThreshold: UInt64 = UInt64.max,
+        enableDirectIO: Bool = false,
+        enableBufferPoolWarmup: Bool = false,
+        enableMemoryMappedReads: Bool = false,
+        enableHugePages: Bool = false,
+        bindBufferPoolToNumaNodes: Bool = false
     ) {
         self.init()
         if bufferPoolSize > 0 {
@@ -66,6 +81,11 @@ public final class SystemConfig: @unchecked Sendable {
         if checkpointThreshold > 0 {
             cSystemConfig.checkpoint_threshold = checkpointThreshold
         }
+        cSystemConfig.enable_direct_io = enableDirectIO
+        cSystemConfig.enable_buffer_pool_warmup = enableBufferPoolWarmup
+        cSystemConfig.enable_memory_mapped_reads = enableMemoryMappedReads
+        cSystemConfig.enable_huge_pages = enableHugePages
+        cSystemConfig.bind_buffer_pool_to_numa_nodes = bindBufferPoolToNumaNodes
     }
 
     #if !os(Linux)
@@ -79,6 +99,11 @@ public final class SystemConfig: @unchecked Sendable {
         ///   - readOnly: A boolean flag to open the database in read-only mode. Default is false.
         ///   - autoCheckpoint: Whether to automatically create checkpoints. Default is true.
         ///   - checkpointThreshold: The threshold for creating checkpoints. If set to UInt64.max, uses default value.
+        ///   - enableDirectIO: Whether to read and write database pages bypassing the OS page cache, so that they are only cached in the buffer pool. Default is false.
+        ///   - enableBufferPoolWarmup: Whether to record the pages cached in the buffer pool and reload them in the background when the database is opened again. Default is false.
+        ///   - enableMemoryMappedReads: Whether a read-only database reads pages from a memory mapping of the database file instead of the buffer pool. Ignored unless readOnly is true. Default is false.
+        ///   - enableHugePages: Whether the buffer pool asks the OS to back its frames with transparent huge pages, which reduces TLB misses on large buffer pools. Only supported on Linux. Default is false.
+        ///   - bindBufferPoolToNumaNodes: Whether the frame groups of the buffer pool are spread round-robin across the NUMA nodes of the machine. Only supported on Linux. Default is false.
         ///   - threadQoS: The quality of service (QoS) for the worker threads. This is only available on Apple platforms. The default value is QOS_CLASS_DEFAULT.
         public convenience init(
             bufferPoolSize: UInt64 = 0,
@@ -87,6 +112,11 @@ public final class SystemConfig: @unchecked Sendable {
             readOnly: Bool = false,
             autoCheckpoint: Bool = true,
             checkpointThreshold: UInt64 = UInt64.max,
+            enableDirectIO: Bool = false,
+            enableBufferPoolWarmup: Bool = false,
+            enableMemoryMappedReads: Bool = false,
+            enableHugePages: Bool = false,
+            bindBufferPoolToNumaNodes: Bool = false,
             threadQoS: qos_class_t = QOS_CLASS_DEFAULT
 
         ) {
@@ -96,7 +126,12 @@ public final class SystemConfig: @unchecked Sendable {
                 enableCompression: enableCompression,
                 readOnly: readOnly,
                 autoCheckpoint: autoCheckpoint,
-                checkpointThreshold: checkpointThreshold
+                checkpointThreshold: checkpointThreshold,
+                enableDirectIO: enableDirectIO,
+                enableBufferPoolWarmup: enableBufferPoolWarmup,
+                enableMemoryMappedReads: enableMemoryMappedReads,
+                enableHugePages: enableHugePages,
+                bindBufferPoolToNumaNodes: bindBufferPoolToNumaNodes
             )
             self.cSystemConfig.thread_qos = threadQoS.rawValue
         }
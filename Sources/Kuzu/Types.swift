@@ -40,6 +40,16 @@ public enum KuzuError: Error {
     }
 }
 
+/// What a query does when it reaches its memory limit or the memory limit of its connection.
+public enum MemoryLimitPolicy {
+    /// The query fails. Other queries keep running.
+    case fail
+    /// The query waits for memory to be freed, and fails if that doesn't happen in time.
+    case wait
+    /// Data waiting to be spilled is written to disk to make room before the query fails.
+    case spill
+}
+
 /// Represents the internal ID of a node or relationship in Kuzu.
 /// It conforms to the Equatable protocol for easy comparison.
 public struct KuzuInternalId: Equatable {
@@ -132,6 +132,21 @@ typedef struct {
     // The threshold of the WAL file size in bytes. When the size of the
     // WAL file exceeds this threshold, the database will checkpoint if auto_checkpoint is true.
     uint64_t checkpoint_threshold;
+    // If true, pages of the data file and the shadow file are read and written bypassing the OS
+    // page cache where the file system supports it.
+    bool enable_direct_io;
+    // If true, the pages cached in the buffer pool are recorded to a side file, and reloaded in
+    // the background when the database is opened again.
+    bool enable_buffer_pool_warmup;
+    // If true and read_only is true, column scans read pages of the data file from a memory
+    // mapping instead of pinning them in the buffer pool.
+    bool enable_memory_mapped_reads;
+    // If true, the buffer pool asks the OS to back its frames with transparent huge pages. Only
+    // supported on Linux.
+    bool enable_huge_pages;
+    // If true, the frame groups of the buffer pool are spread round-robin across the NUMA nodes of
+    // the machine. Only supported on Linux.
+    bool bind_buffer_pool_to_numa_nodes;
 
 #if defined(__APPLE__)
     // The thread quality of service (QoS) for the worker threads.
@@ -329,6 +344,18 @@ typedef enum {
  */
 typedef enum { KuzuSuccess = 0, KuzuError = 1 } kuzu_state;
 
+/**
+ * @brief What a query does when it reaches its memory limit or the memory limit of its connection.
+ */
+typedef enum {
+    // The query fails.
+    KUZU_MEMORY_LIMIT_FAIL = 0,
+    // The query waits for memory to be freed, and fails if that doesn't happen in time.
+    KUZU_MEMORY_LIMIT_WAIT = 1,
+    // Data waiting to be spilled is written to disk to make room before the query fails.
+    KUZU_MEMORY_LIMIT_SPILL = 2,
+} kuzu_memory_limit_policy;
+
 // Database
 /**
  * @brief Allocates memory and creates a kuzu database instance at database_path with
@@ -422,6 +449,24 @@ KUZU_C_API void kuzu_connection_interrupt(kuzu_connection* connection);
  */
 KUZU_C_API kuzu_state kuzu_connection_set_query_timeout(kuzu_connection* connection,
     uint64_t timeout_in_ms);
+/**
+ * @brief Sets the memory limit of each query of the connection. A limit of 0 disables it.
+ * @param connection The connection instance to set the query memory limit for.
+ * @param limit_in_bytes The maximum number of bytes of intermediate results a query may hold.
+ * @param policy What a query does when it reaches the query or the connection memory limit.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_connection_set_query_memory_limit(kuzu_connection* connection,
+    uint64_t limit_in_bytes, kuzu_memory_limit_policy policy);
+/**
+ * @brief Sets the memory limit of the connection, counting all its queries and the results that
+ * are not destroyed yet. A limit of 0 disables it.
+ * @param connection The connection instance to set the memory limit for.
+ * @param limit_in_bytes The maximum number of bytes the queries of the connection may hold.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_connection_set_connection_memory_limit(kuzu_connection* connection,
+    uint64_t limit_in_bytes);
 
 // PreparedStatement
 /**
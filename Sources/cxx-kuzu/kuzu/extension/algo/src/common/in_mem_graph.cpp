@@ -1,10 +1,17 @@
 #include "common/in_mem_graph.h"
 
+#include <algorithm>
+
+#include "common/in_mem_gds_utils.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
 namespace kuzu {
 namespace algo_extension {
 
 InMemGraph::InMemGraph(const common::offset_t numNodes, storage::MemoryManager* mm)
-    : csrOffsets(mm), csrEdges(mm) {
+    : csrOffsets(mm), csrEdges(mm), scratchOffsets(mm), scratchEdges(mm) {
     reinit(numNodes);
 }
 
@@ -25,5 +32,141 @@ void InMemGraph::insertNbr(const common::offset_t to, const weight_t weight) {
     numEdges++;
 }
 
+// Sorts the neighbors in [begin, end) and merges neighbors with the same offset by summing up
+// their weights. Returns the number of distinct neighbors, which are moved to the front.
+static offset_t mergeNbrs(Neighbor* begin, Neighbor* end) {
+    if (begin == end) {
+        return 0;
+    }
+    std::sort(begin, end,
+        [](const Neighbor& a, const Neighbor& b) { return a.neighbor < b.neighbor; });
+    auto last = begin;
+    for (auto nbr = begin + 1; nbr < end; ++nbr) {
+        if (nbr->neighbor == last->neighbor) {
+            last->weight += nbr->weight;
+        } else {
+            *++last = *nbr;
+        }
+    }
+    return last - begin + 1;
+}
+
+// Replaces the neighbors of each node with their communities and merges duplicates within the
+// node's own CSR range. The number of remaining neighbors is written to `scratchOffsets`.
+class MapNbrsToCommunitiesVC final : public InMemVertexCompute {
+public:
+    MapNbrsToCommunitiesVC(InMemGraph& graph, const ObjectArray<offset_t>& communities)
+        : graph{graph}, communities{communities} {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            const auto beginCSROffset = graph.csrOffsets[nodeId];
+            const auto endCSROffset = graph.csrOffsets[nodeId + 1];
+            for (auto offset = beginCSROffset; offset < endCSROffset; ++offset) {
+                auto& nbr = graph.csrEdges[offset];
+                nbr.neighbor = communities.get(nbr.neighbor);
+            }
+            graph.scratchOffsets[nodeId] =
+                beginCSROffset == endCSROffset ?
+                    0 :
+                    mergeNbrs(&graph.csrEdges[beginCSROffset],
+                        &graph.csrEdges[beginCSROffset] + (endCSROffset - beginCSROffset));
+        }
+    }
+
+    std::unique_ptr<InMemVertexCompute> copy() override {
+        return std::make_unique<MapNbrsToCommunitiesVC>(graph, communities);
+    }
+
+private:
+    InMemGraph& graph;
+    const ObjectArray<offset_t>& communities;
+};
+
+// Merges the neighbors of each community, which have been grouped in `scratchEdges`, and writes
+// the number of distinct neighbors to `csrOffsets[commId + 1]`.
+class MergeCommunityNbrsVC final : public InMemVertexCompute {
+public:
+    explicit MergeCommunityNbrsVC(InMemGraph& graph) : graph{graph} {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset) override {
+        for (auto commId = startOffset; commId < endOffset; ++commId) {
+            const auto beginCommOffset = commId == 0 ? 0 : graph.scratchOffsets[commId - 1];
+            const auto endCommOffset = graph.scratchOffsets[commId];
+            graph.csrOffsets[commId + 1] =
+                beginCommOffset == endCommOffset ?
+                    0 :
+                    mergeNbrs(&graph.scratchEdges[beginCommOffset],
+                        &graph.scratchEdges[beginCommOffset] + (endCommOffset - beginCommOffset));
+        }
+    }
+
+    std::unique_ptr<InMemVertexCompute> copy() override {
+        return std::make_unique<MergeCommunityNbrsVC>(graph);
+    }
+
+private:
+    InMemGraph& graph;
+};
+
+void InMemGraph::coarsen(const ObjectArray<offset_t>& communities, const offset_t numCommunities,
+    processor::ExecutionContext* context) {
+    KU_ASSERT(numCommunities <= numNodes);
+    // Step 1: Map neighbors to their communities and merge duplicates per node, in parallel.
+    scratchOffsets.resize(numNodes + 1);
+    MapNbrsToCommunitiesVC mapNbrsVC(*this, communities);
+    InMemGDSUtils::runVertexCompute(mapNbrsVC, numNodes, context);
+    // Step 2: Compact the merged neighbors of all nodes to the front of `csrEdges`. Entries only
+    // move towards the front so this is done in place.
+    offset_t numCompactedEdges = 0;
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        const auto beginCSROffset = csrOffsets[nodeId];
+        const auto numNbrs = scratchOffsets[nodeId];
+        for (auto i = 0u; i < numNbrs; ++i) {
+            csrEdges[numCompactedEdges + i] = csrEdges[beginCSROffset + i];
+        }
+        csrOffsets[nodeId] = numCompactedEdges;
+        numCompactedEdges += numNbrs;
+    }
+    csrOffsets[numNodes] = numCompactedEdges;
+    // Step 3: Group the edges by the community of their source node. `scratchOffsets[c]` ends up
+    // as the end offset of community c in `scratchEdges`.
+    scratchEdges.resize(numCompactedEdges);
+    for (auto commId = 0u; commId <= numCommunities; ++commId) {
+        scratchOffsets[commId] = 0;
+    }
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        const auto numNbrs = csrOffsets[nodeId + 1] - csrOffsets[nodeId];
+        scratchOffsets[communities.get(nodeId) + 1] += numNbrs;
+    }
+    for (auto commId = 1u; commId <= numCommunities; ++commId) {
+        scratchOffsets[commId] += scratchOffsets[commId - 1];
+    }
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        auto& writeOffset = scratchOffsets[communities.get(nodeId)];
+        for (auto offset = csrOffsets[nodeId]; offset < csrOffsets[nodeId + 1]; ++offset) {
+            scratchEdges[writeOffset++] = csrEdges[offset];
+        }
+    }
+    // Step 4: Merge the edges of each community, in parallel.
+    csrOffsets.resize(numCommunities + 1);
+    MergeCommunityNbrsVC mergeNbrsVC(*this);
+    InMemGDSUtils::runVertexCompute(mergeNbrsVC, numCommunities, context);
+    // Step 5: Copy the merged edges back to `csrEdges`, which never grows.
+    numEdges = 0;
+    csrOffsets[0] = 0;
+    for (auto commId = 0u; commId < numCommunities; ++commId) {
+        const auto beginOffset = commId == 0 ? 0 : scratchOffsets[commId - 1];
+        const auto numNbrs = csrOffsets[commId + 1];
+        for (auto i = 0u; i < numNbrs; ++i) {
+            csrEdges[numEdges + i] = scratchEdges[beginOffset + i];
+        }
+        numEdges += numNbrs;
+        csrOffsets[commId + 1] = numEdges;
+    }
+    csrEdges.resize(numEdges);
+    numNodes = numCommunities;
+}
+
 } // namespace algo_extension
 } // namespace kuzu
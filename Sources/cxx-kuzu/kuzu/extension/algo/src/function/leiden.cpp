@@ -0,0 +1,691 @@
+#include "binder/binder.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/exception/runtime.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/in_mem_graph.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+#include "common/task_system/progress_bar.h"
+#include "function/algo_function.h"
+#include "function/config/leiden_config.h"
+#include "function/config/louvain_config.h"
+#include "function/config/max_iterations_config.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "processor/execution_context.h"
+
+using namespace std;
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+using namespace kuzu::function;
+
+// Leiden method for community detection: https://www.nature.com/articles/s41598-019-41695-z.
+// The quality function is the modularity with a resolution parameter gamma:
+//   quality = sum over all c in C: intraWeights_c/2m - gamma * (weightedDegree_c/2m)^2
+// Each level consists of three phases:
+//   1. Local moving: nodes are moved, in parallel, to the neighbor community with the largest
+//      quality gain until no node moves.
+//   2. Refinement: each community from (1) is split into well-connected sub-communities by
+//      merging singleton nodes into sub-communities of the same community. Communities are
+//      refined in parallel.
+//   3. Aggregation: the graph is coarsened such that each sub-community from (2) becomes a node.
+//      The communities from (1) are the initial communities of the coarsened graph.
+// All levels share a single InMemGraph that is coarsened in place. All other state is allocated
+// once from the MemoryManager for the input graph, since the number of nodes only decreases.
+
+namespace kuzu {
+namespace algo_extension {
+
+constexpr double THRESHOLD = 1e-6;
+constexpr offset_t UNASSIGNED_COMM = numeric_limits<offset_t>::max();
+
+struct LeidenOptionalParams final : public MaxIterationOptionalParams {
+    OptionalParam<MaxPhases> maxPhases;
+    OptionalParam<Resolution> resolution;
+    OptionalParam<SeedProperty> seedProperty;
+
+    explicit LeidenOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    LeidenOptionalParams(OptionalParam<MaxIterations> maxIterations,
+        OptionalParam<MaxPhases> maxPhases, OptionalParam<Resolution> resolution,
+        OptionalParam<SeedProperty> seedProperty)
+        : MaxIterationOptionalParams{maxIterations}, maxPhases{std::move(maxPhases)},
+          resolution{std::move(resolution)}, seedProperty{std::move(seedProperty)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        MaxIterationOptionalParams::evaluateParams(context);
+        maxPhases.evaluateParam(context);
+        resolution.evaluateParam(context);
+        seedProperty.evaluateParam(context);
+    }
+
+    std::unique_ptr<function::OptionalParams> copy() override {
+        return std::make_unique<LeidenOptionalParams>(maxIterations, maxPhases, resolution,
+            seedProperty);
+    }
+};
+
+LeidenOptionalParams::LeidenOptionalParams(const expression_vector& optionalParams)
+    : MaxIterationOptionalParams{constructMaxIterationParam(optionalParams)} {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == MaxPhases::NAME) {
+            maxPhases = function::OptionalParam<MaxPhases>(optionalParam);
+        } else if (paramName == Resolution::NAME) {
+            resolution = function::OptionalParam<Resolution>(optionalParam);
+        } else if (paramName == SeedProperty::NAME) {
+            seedProperty = function::OptionalParam<SeedProperty>(optionalParam);
+        } else if (paramName == MaxIterations::NAME) {
+            continue;
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct LeidenBindData final : public GDSBindData {
+    LeidenBindData(expression_vector columns, graph::NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput,
+        std::unique_ptr<LeidenOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), std::move(nodeOutput)} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<LeidenBindData>(*this);
+    }
+};
+
+struct LeidenState {
+    InMemGraph graph;
+    // Community of each node, as found by local moving.
+    AtomicObjectArray<offset_t> communities;
+    // Sum of the weighted degree of all nodes in each community.
+    AtomicObjectArray<weight_t> commDegrees;
+    // For each node, stores the sum of weights for all its edges.
+    ObjectArray<weight_t> nodeDegrees;
+    // Nodes grouped by community. The nodes of community c are in
+    // [commOffsets[c], commOffsets[c + 1]).
+    ObjectArray<offset_t> commNodes;
+    ObjectArray<offset_t> commOffsets;
+    // Sub-community of each node, as found by refinement. Each sub-community is identified by the
+    // node it started from.
+    ObjectArray<offset_t> refinedComms;
+    // Number of nodes, sum of weighted degrees and sum of weights of edges to the rest of the
+    // community, for each sub-community.
+    ObjectArray<offset_t> refinedSizes;
+    ObjectArray<weight_t> refinedDegrees;
+    ObjectArray<weight_t> refinedExternalWeights;
+    // Node of the coarsened graph that each node is merged into.
+    ObjectArray<offset_t> aggregateIds;
+    // Scratch space for renumbering.
+    ObjectArray<offset_t> idMap;
+    // Node of the current graph that each node of the input graph has been merged into.
+    ObjectArray<offset_t> origToNode;
+    // Stores 2 * sum of edge weights.
+    weight_t totalWeight = 0;
+    double resolution;
+
+    LeidenState(const offset_t numNodes, const double resolution, MemoryManager* mm)
+        : graph{InMemGraph(numNodes, mm)}, resolution{resolution} {
+        communities.reallocate(numNodes, mm);
+        commDegrees.reallocate(numNodes, mm);
+        nodeDegrees.reallocate(numNodes, mm);
+        commNodes.reallocate(numNodes, mm);
+        commOffsets.reallocate(numNodes + 1, mm);
+        refinedComms.reallocate(numNodes, mm);
+        refinedSizes.reallocate(numNodes, mm);
+        refinedDegrees.reallocate(numNodes, mm);
+        refinedExternalWeights.reallocate(numNodes, mm);
+        aggregateIds.reallocate(numNodes, mm);
+        idMap.reallocate(numNodes, mm);
+        origToNode.reallocate(numNodes, mm);
+    }
+    DELETE_BOTH_COPY(LeidenState);
+
+    offset_t numNodes() const { return graph.numNodes; }
+
+    // Quality gain of adding a node with weighted degree `degree` to a community with weighted
+    // degree `commDegree`, to which the node has edges with total weight `weightToComm`.
+    double gain(weight_t weightToComm, weight_t degree, double commDegree) const {
+        return weightToComm - resolution * degree * commDegree / totalWeight;
+    }
+
+    // A (sub-)community with weighted degree `degree` and edges with total weight
+    // `externalWeight` to the rest of its enclosing community is well-connected if
+    // externalWeight >= gamma * degree * (commDegree - degree) / 2m.
+    bool isWellConnected(weight_t externalWeight, weight_t degree, weight_t commDegree) const {
+        return externalWeight >=
+               resolution * degree * static_cast<double>(commDegree - degree) / totalWeight;
+    }
+};
+
+// Computes the weighted degree of each node, and of each community from the node degrees.
+class ComputeDegreesVC final : public InMemVertexCompute {
+public:
+    explicit ComputeDegreesVC(LeidenState& state) : state{state} {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            weight_t degree = 0;
+            for (auto offset = state.graph.csrOffsets[nodeId];
+                 offset < state.graph.csrOffsets[nodeId + 1]; ++offset) {
+                degree += state.graph.csrEdges[offset].weight;
+            }
+            state.nodeDegrees.set(nodeId, degree);
+            state.commDegrees.fetchAdd(state.communities.get(nodeId, memory_order_relaxed),
+                degree, memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<InMemVertexCompute> copy() override {
+        return std::make_unique<ComputeDegreesVC>(state);
+    }
+
+private:
+    LeidenState& state;
+};
+
+class ResetCommDegreesVC final : public InMemVertexCompute {
+public:
+    explicit ResetCommDegreesVC(LeidenState& state) : state{state} {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset) override {
+        for (auto commId = startOffset; commId < endOffset; ++commId) {
+            state.commDegrees.set(commId, 0, memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<InMemVertexCompute> copy() override {
+        return std::make_unique<ResetCommDegreesVC>(state);
+    }
+
+private:
+    LeidenState& state;
+};
+
+// Moves each node to the neighbor community that maximizes the quality gain. Moves are applied
+// immediately, so later nodes observe the moves of earlier ones.
+class LocalMovingVC final : public InMemVertexCompute {
+public:
+    LocalMovingVC(LeidenState& state, std::atomic<offset_t>& numMoves)
+        : state{state}, numMoves{numMoves} {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset) override {
+        // Sum of the weights of edges to each neighbor community.
+        unordered_map<offset_t, weight_t> commWeights;
+        offset_t numLocalMoves = 0;
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            const auto beginCSROffset = state.graph.csrOffsets[nodeId];
+            const auto endCSROffset = state.graph.csrOffsets[nodeId + 1];
+            if (beginCSROffset == endCSROffset) {
+                continue;
+            }
+            commWeights.clear();
+            for (auto offset = beginCSROffset; offset < endCSROffset; ++offset) {
+                const auto& nbr = state.graph.csrEdges[offset];
+                if (nbr.neighbor == nodeId) {
+                    // Self-loop weight remains the same when moving between communities.
+                    continue;
+                }
+                commWeights[state.communities.get(nbr.neighbor, memory_order_relaxed)] +=
+                    nbr.weight;
+            }
+            const auto currComm = state.communities.get(nodeId, memory_order_relaxed);
+            const auto degree = state.nodeDegrees.get(nodeId);
+            const auto weightToCurrComm =
+                commWeights.contains(currComm) ? commWeights.at(currComm) : 0;
+            // Quality gain of staying, compared to being removed from the current community.
+            const auto currGain = state.gain(weightToCurrComm, degree,
+                static_cast<double>(
+                    state.commDegrees.get(currComm, memory_order_relaxed) - degree));
+            auto bestComm = currComm;
+            auto bestGain = currGain + THRESHOLD;
+            for (auto [commId, weight] : commWeights) {
+                if (commId == currComm) {
+                    continue;
+                }
+                const auto gain = state.gain(weight, degree,
+                    static_cast<double>(state.commDegrees.get(commId, memory_order_relaxed)));
+                if (gain > bestGain || (gain == bestGain && commId < bestComm)) {
+                    bestComm = commId;
+                    bestGain = gain;
+                }
+            }
+            if (bestComm != currComm) {
+                state.commDegrees.fetchSub(currComm, degree, memory_order_relaxed);
+                state.commDegrees.fetchAdd(bestComm, degree, memory_order_relaxed);
+                state.communities.set(nodeId, bestComm, memory_order_relaxed);
+                numLocalMoves++;
+            }
+        }
+        numMoves.fetch_add(numLocalMoves, memory_order_relaxed);
+    }
+
+    std::unique_ptr<InMemVertexCompute> copy() override {
+        return std::make_unique<LocalMovingVC>(state, numMoves);
+    }
+
+private:
+    LeidenState& state;
+    std::atomic<offset_t>& numMoves;
+};
+
+// Puts each node into its own sub-community.
+class InitRefinementVC final : public InMemVertexCompute {
+public:
+    explicit InitRefinementVC(LeidenState& state) : state{state} {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            const auto commId = state.communities.get(nodeId, memory_order_relaxed);
+            weight_t externalWeight = 0;
+            for (auto offset = state.graph.csrOffsets[nodeId];
+                 offset < state.graph.csrOffsets[nodeId + 1]; ++offset) {
+                const auto& nbr = state.graph.csrEdges[offset];
+                if (nbr.neighbor != nodeId &&
+                    state.communities.get(nbr.neighbor, memory_order_relaxed) == commId) {
+                    externalWeight += nbr.weight;
+                }
+            }
+            state.refinedComms.set(nodeId, nodeId);
+            state.refinedSizes.set(nodeId, 1);
+            state.refinedDegrees.set(nodeId, state.nodeDegrees.get(nodeId));
+            state.refinedExternalWeights.set(nodeId, externalWeight);
+        }
+    }
+
+    std::unique_ptr<InMemVertexCompute> copy() override {
+        return std::make_unique<InitRefinementVC>(state);
+    }
+
+private:
+    LeidenState& state;
+};
+
+// Merges the singleton sub-communities of each community into well-connected sub-communities of
+// the same community. A community is refined by a single thread, so sub-community state of its
+// nodes is not shared with other threads.
+class RefineVC final : public InMemVertexCompute {
+public:
+    explicit RefineVC(LeidenState& state) : state{state} {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset) override {
+        // Sum of the weights of edges to each neighbor sub-community.
+        unordered_map<offset_t, weight_t> refinedCommWeights;
+        for (auto commId = startOffset; commId < endOffset; ++commId) {
+            const auto commDegree = state.commDegrees.get(commId, memory_order_relaxed);
+            for (auto i = state.commOffsets.get(commId); i < state.commOffsets.get(commId + 1);
+                 ++i) {
+                const auto nodeId = state.commNodes.get(i);
+                if (state.refinedSizes.get(nodeId) != 1 ||
+                    state.refinedComms.get(nodeId) != nodeId) {
+                    // Only singleton sub-communities are merged.
+                    continue;
+                }
+                const auto degree = state.nodeDegrees.get(nodeId);
+                if (!state.isWellConnected(state.refinedExternalWeights.get(nodeId), degree,
+                        commDegree)) {
+                    continue;
+                }
+                refinedCommWeights.clear();
+                for (auto offset = state.graph.csrOffsets[nodeId];
+                     offset < state.graph.csrOffsets[nodeId + 1]; ++offset) {
+                    const auto& nbr = state.graph.csrEdges[offset];
+                    if (nbr.neighbor != nodeId &&
+                        state.communities.get(nbr.neighbor, memory_order_relaxed) == commId) {
+                        refinedCommWeights[state.refinedComms.get(nbr.neighbor)] += nbr.weight;
+                    }
+                }
+                auto bestRefinedComm = nodeId;
+                double bestGain = 0;
+                for (auto [refinedCommId, weight] : refinedCommWeights) {
+                    const auto refinedDegree = state.refinedDegrees.get(refinedCommId);
+                    if (!state.isWellConnected(state.refinedExternalWeights.get(refinedCommId),
+                            refinedDegree, commDegree)) {
+                        continue;
+                    }
+                    const auto gain =
+                        state.gain(weight, degree, static_cast<double>(refinedDegree));
+                    if (gain < 0) {
+                        continue;
+                    }
+                    if (bestRefinedComm == nodeId || gain > bestGain ||
+                        (gain == bestGain && refinedCommId < bestRefinedComm)) {
+                        bestRefinedComm = refinedCommId;
+                        bestGain = gain;
+                    }
+                }
+                if (bestRefinedComm != nodeId) {
+                    merge(nodeId, bestRefinedComm, refinedCommWeights.at(bestRefinedComm));
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<InMemVertexCompute> copy() override {
+        return std::make_unique<RefineVC>(state);
+    }
+
+private:
+    void merge(offset_t nodeId, offset_t refinedCommId, weight_t weight) {
+        state.refinedComms.set(nodeId, refinedCommId);
+        state.refinedSizes.set(nodeId, 0);
+        state.refinedSizes.getUnsafe(refinedCommId)++;
+        state.refinedDegrees.getUnsafe(refinedCommId) += state.nodeDegrees.get(nodeId);
+        // Edges between the node and the sub-community are no longer external.
+        state.refinedExternalWeights.getUnsafe(refinedCommId) +=
+            state.refinedExternalWeights.get(nodeId) - 2 * weight;
+    }
+
+private:
+    LeidenState& state;
+};
+
+class UpdateOrigToNodeVC final : public InMemVertexCompute {
+public:
+    explicit UpdateOrigToNodeVC(LeidenState& state) : state{state} {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            state.origToNode.set(nodeId,
+                state.aggregateIds.get(state.origToNode.get(nodeId)));
+        }
+    }
+
+    std::unique_ptr<InMemVertexCompute> copy() override {
+        return std::make_unique<UpdateOrigToNodeVC>(state);
+    }
+
+private:
+    LeidenState& state;
+};
+
+class WriteResultsVC final : public GDSResultVertexCompute {
+public:
+    WriteResultsVC(MemoryManager* mm, GDSFuncSharedState* sharedState, LeidenState& state)
+        : GDSResultVertexCompute{mm, sharedState}, state{state} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        communityIDVector = createVector(LogicalType::INT64());
+    }
+
+    void beginOnTableInternal(table_id_t /*tableID*/) override {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset,
+        const table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            const auto nodeID = nodeID_t{i, tableID};
+            nodeIDVector->setValue<nodeID_t>(0, nodeID);
+            communityIDVector->setValue<int64_t>(0,
+                state.communities.get(state.origToNode.get(i), memory_order_relaxed));
+            localFT->append(vectors);
+        }
+    }
+
+    unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<WriteResultsVC>(mm, sharedState, state);
+    }
+
+private:
+    LeidenState& state;
+    unique_ptr<ValueVector> nodeIDVector;
+    unique_ptr<ValueVector> communityIDVector;
+};
+
+static void initInMemoryGraph(const table_id_t tableId, const offset_t numNodes, Graph* graph,
+    LeidenState& state) {
+    const auto nbrInfo = graph->getRelInfos(tableId)[0];
+    KU_ASSERT(nbrInfo.srcTableID == nbrInfo.dstTableID);
+    const auto scanState =
+        graph->prepareRelScan(*nbrInfo.relGroupEntry, nbrInfo.relTableID, nbrInfo.dstTableID, {});
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        state.graph.initNextNode();
+        const nodeID_t nextNodeId = {nodeId, tableId};
+        for (auto chunk : graph->scanFwd(nextNodeId, *scanState)) {
+            chunk.forEach(
+                [&](auto neighbors, auto, auto i) { state.graph.insertNbr(neighbors[i].offset); });
+        }
+        for (auto chunk : graph->scanBwd(nextNodeId, *scanState)) {
+            chunk.forEach([&](auto neighbors, auto, auto i) {
+                if (neighbors[i].offset != nodeId) {
+                    state.graph.insertNbr(neighbors[i].offset);
+                }
+            });
+        }
+        state.origToNode.set(nodeId, nodeId);
+    }
+    state.graph.initNextNode();
+    state.totalWeight = state.graph.numEdges * DEFAULT_WEIGHT;
+}
+
+// Assigns nodes with the same seed value to the same community, and every other node to its own
+// community.
+static void initCommunities(const std::string& seedProperty, Graph* graph, LeidenState& state) {
+    const auto numNodes = state.numNodes();
+    if (seedProperty.empty()) {
+        for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+            state.communities.set(nodeId, nodeId, memory_order_relaxed);
+        }
+        return;
+    }
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        state.communities.set(nodeId, UNASSIGNED_COMM, memory_order_relaxed);
+    }
+    unordered_map<int64_t, offset_t> seedToComm;
+    offset_t nextCommId = 0;
+    const auto nodeEntry = graph->getGraphEntry()->nodeInfos[0].entry;
+    const auto scanState = graph->prepareVertexScan(nodeEntry, {seedProperty});
+    for (auto chunk : graph->scanVertices(0, numNodes, *scanState)) {
+        const auto nodeIDs = chunk.getNodeIDs();
+        const auto seeds = chunk.getProperties<int64_t>(0);
+        for (auto i = 0u; i < chunk.size(); ++i) {
+            if (chunk.isNull(0, i)) {
+                continue;
+            }
+            auto [entry, inserted] = seedToComm.emplace(seeds[i], nextCommId);
+            if (inserted) {
+                nextCommId++;
+            }
+            state.communities.set(nodeIDs[i].offset, entry->second, memory_order_relaxed);
+        }
+    }
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        if (state.communities.get(nodeId, memory_order_relaxed) == UNASSIGNED_COMM) {
+            state.communities.set(nodeId, nextCommId++, memory_order_relaxed);
+        }
+    }
+}
+
+// Computes node and community degrees of the current graph.
+static void initLevel(LeidenState& state, ExecutionContext* context) {
+    ResetCommDegreesVC resetCommDegreesVC(state);
+    InMemGDSUtils::runVertexCompute(resetCommDegreesVC, state.numNodes(), context);
+    ComputeDegreesVC computeDegreesVC(state);
+    InMemGDSUtils::runVertexCompute(computeDegreesVC, state.numNodes(), context);
+}
+
+// Sequentially renumber the communities to [0, numCommunities) and group nodes by community.
+static offset_t renumberCommunities(LeidenState& state) {
+    const auto numNodes = state.numNodes();
+    for (auto commId = 0u; commId < numNodes; ++commId) {
+        state.idMap.set(commId, UNASSIGNED_COMM);
+    }
+    offset_t numCommunities = 0;
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        const auto commId = state.communities.get(nodeId, memory_order_relaxed);
+        if (state.idMap.get(commId) == UNASSIGNED_COMM) {
+            state.idMap.set(commId, numCommunities++);
+        }
+        state.communities.set(nodeId, state.idMap.get(commId), memory_order_relaxed);
+    }
+    for (auto commId = 0u; commId <= numCommunities; ++commId) {
+        state.commOffsets.set(commId, 0);
+    }
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        state.commOffsets.getUnsafe(state.communities.get(nodeId, memory_order_relaxed) + 1)++;
+    }
+    for (auto commId = 1u; commId <= numCommunities; ++commId) {
+        state.commOffsets.getUnsafe(commId) += state.commOffsets.get(commId - 1);
+    }
+    // Use `idMap` as the write position of each community.
+    for (auto commId = 0u; commId < numCommunities; ++commId) {
+        state.idMap.set(commId, state.commOffsets.get(commId));
+    }
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        const auto commId = state.communities.get(nodeId, memory_order_relaxed);
+        state.commNodes.set(state.idMap.getUnsafe(commId)++, nodeId);
+    }
+    return numCommunities;
+}
+
+// Sequentially renumber the sub-communities to [0, numSubCommunities), each of which becomes a
+// node in the next level. Since sub-communities are numbered in order of their first node, each
+// node is mapped to an offset not larger than its own.
+static offset_t renumberRefinedCommunities(LeidenState& state) {
+    const auto numNodes = state.numNodes();
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        state.idMap.set(nodeId, UNASSIGNED_COMM);
+    }
+    offset_t numRefinedComms = 0;
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        const auto refinedCommId = state.refinedComms.get(nodeId);
+        if (state.idMap.get(refinedCommId) == UNASSIGNED_COMM) {
+            state.idMap.set(refinedCommId, numRefinedComms++);
+        }
+        state.aggregateIds.set(nodeId, state.idMap.get(refinedCommId));
+    }
+    return numRefinedComms;
+}
+
+// Merges each sub-community into a single node. The community of each new node is the community
+// of the nodes merged into it.
+static void aggregate(const offset_t numRefinedComms, LeidenState& state,
+    ExecutionContext* context) {
+    for (auto nodeId = 0u; nodeId < state.numNodes(); ++nodeId) {
+        // Safe to do in place because aggregateIds[nodeId] <= nodeId.
+        state.communities.set(state.aggregateIds.get(nodeId),
+            state.communities.get(nodeId, memory_order_relaxed), memory_order_relaxed);
+    }
+    UpdateOrigToNodeVC updateOrigToNodeVC(state);
+    InMemGDSUtils::runVertexCompute(updateOrigToNodeVC, state.origToNode.getSize(), context);
+    state.graph.coarsen(state.aggregateIds, numRefinedComms, context);
+    initLevel(state, context);
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto clientContext = input.context->clientContext;
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto mm = clientContext->getMemoryManager();
+    const auto graph = sharedState->graph.get();
+    KU_ASSERT(graph->getNodeTableIDs().size() == 1);
+    const auto tableID = graph->getNodeTableIDs()[0];
+    const auto origNumNodes = graph->getMaxOffset(clientContext->getTransaction(), tableID);
+
+    auto leidenBindData = input.bindData->constPtrCast<LeidenBindData>();
+    auto& config = leidenBindData->optionalParams->constCast<LeidenOptionalParams>();
+    const auto maxPhases = config.maxPhases.getParamVal();
+    auto progressBar = clientContext->getProgressBar();
+
+    LeidenState state(origNumNodes, config.resolution.getParamVal(), mm);
+    initInMemoryGraph(tableID, origNumNodes, graph, state);
+    initCommunities(config.seedProperty.getParamVal(), graph, state);
+    initLevel(state, input.context);
+
+    for (auto phase = 0u; phase < maxPhases; ++phase) {
+        // Local moving.
+        for (auto iter = 0u; iter < config.maxIterations.getParamVal(); ++iter) {
+            std::atomic<offset_t> numMoves{0};
+            LocalMovingVC localMovingVC(state, numMoves);
+            InMemGDSUtils::runVertexCompute(localMovingVC, state.numNodes(), input.context);
+            if (numMoves.load() == 0) {
+                break;
+            }
+        }
+        const auto numCommunities = renumberCommunities(state);
+        if (numCommunities == state.numNodes()) {
+            // Every node is in its own community, so aggregation cannot improve the quality.
+            break;
+        }
+        // The community degrees have to follow the renumbering.
+        initLevel(state, input.context);
+
+        // Refinement.
+        InitRefinementVC initRefinementVC(state);
+        InMemGDSUtils::runVertexCompute(initRefinementVC, state.numNodes(), input.context);
+        RefineVC refineVC(state);
+        InMemGDSUtils::runVertexCompute(refineVC, numCommunities, input.context);
+        const auto numRefinedComms = renumberRefinedCommunities(state);
+        if (numRefinedComms == state.numNodes()) {
+            // No sub-community has more than one node, so the graph cannot be coarsened.
+            break;
+        }
+
+        // Aggregation.
+        aggregate(numRefinedComms, state, input.context);
+        progressBar->updateProgress(input.context->queryID,
+            static_cast<double>(phase + 1) / maxPhases);
+    }
+
+    const auto vertexCompute = make_unique<WriteResultsVC>(mm, sharedState, state);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *vertexCompute);
+
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char LEIDEN_ID_COLUMN_NAME[] = "leiden_id";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    if (graphEntry.nodeInfos.size() != 1) {
+        throw RuntimeException("Leiden only supports operations on one node table.");
+    }
+    if (graphEntry.relInfos.size() != 1) {
+        throw RuntimeException("Leiden only supports operations on one edge table.");
+    }
+    auto optionalParams = std::make_unique<LeidenOptionalParams>(input->optionalParamsLegacy);
+    if (optionalParams->seedProperty.isSet()) {
+        optionalParams->seedProperty.evaluateParam(context);
+        const auto& seedProperty = optionalParams->seedProperty.getParamVal();
+        const auto nodeEntry = graphEntry.nodeInfos[0].entry;
+        if (!nodeEntry->containsProperty(seedProperty)) {
+            throw BinderException{stringFormat("Cannot find property {} in table {}.",
+                seedProperty, nodeEntry->getName())};
+        }
+        if (nodeEntry->getProperty(seedProperty).getType().getLogicalTypeID() !=
+            LogicalTypeID::INT64) {
+            throw BinderException{
+                stringFormat("Seed property {} must be of type INT64.", seedProperty)};
+        }
+    }
+    expression_vector columns;
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    columns.push_back(nodeOutput->constPtrCast<NodeExpression>()->getInternalID());
+    columns.push_back(input->binder->createVariable(LEIDEN_ID_COLUMN_NAME, LogicalType::INT64()));
+    return std::make_unique<LeidenBindData>(std::move(columns), std::move(graphEntry), nodeOutput,
+        std::move(optionalParams));
+}
+
+function_set LeidenFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace kuzu
@@ -24,26 +24,32 @@ struct PageRankOptionalParams final : public MaxIterationOptionalParams {
     OptionalParam<DampingFactor> dampingFactor;
     OptionalParam<Tolerance> tolerance;
     OptionalParam<NormalizeInitial> normalize;
+    OptionalParam<FloatPrecision> floatPrecision;
+    OptionalParam<Sources> sources;
 
     explicit PageRankOptionalParams(const expression_vector& optionalParams);
 
     // For copy only
     PageRankOptionalParams(OptionalParam<MaxIterations> maxIterations,
         OptionalParam<DampingFactor> dampingFactor, OptionalParam<Tolerance> tolerance,
-        OptionalParam<NormalizeInitial> normalize)
+        OptionalParam<NormalizeInitial> normalize, OptionalParam<FloatPrecision> floatPrecision,
+        OptionalParam<Sources> sources)
         : MaxIterationOptionalParams{maxIterations}, dampingFactor{std::move(dampingFactor)},
-          tolerance{std::move(tolerance)}, normalize{std::move(normalize)} {}
+          tolerance{std::move(tolerance)}, normalize{std::move(normalize)},
+          floatPrecision{std::move(floatPrecision)}, sources{std::move(sources)} {}
 
     void evaluateParams(main::ClientContext* context) override {
         MaxIterationOptionalParams::evaluateParams(context);
         dampingFactor.evaluateParam(context);
         tolerance.evaluateParam(context);
         normalize.evaluateParam(context);
+        floatPrecision.evaluateParam(context);
+        sources.evaluateParam(context);
     }
 
     std::unique_ptr<function::OptionalParams> copy() override {
         return std::make_unique<PageRankOptionalParams>(maxIterations, dampingFactor, tolerance,
-            normalize);
+            normalize, floatPrecision, sources);
     }
 };
 
@@ -59,6 +65,10 @@ PageRankOptionalParams::PageRankOptionalParams(const expression_vector& optional
             tolerance = function::OptionalParam<Tolerance>(optionalParam);
         } else if (paramName == NormalizeInitial::NAME) {
             normalize = function::OptionalParam<NormalizeInitial>(optionalParam);
+        } else if (paramName == FloatPrecision::NAME) {
+            floatPrecision = function::OptionalParam<FloatPrecision>(optionalParam);
+        } else if (paramName == Sources::NAME) {
+            sources = function::OptionalParam<Sources>(optionalParam);
         } else {
             throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
         }
@@ -86,159 +96,233 @@ static void addCAS(std::atomic<double>& origin, double valToAdd) {
     }
 }
 
-// Represents PageRank value for all nodes
+// Represents a PageRank value for all nodes. Values are not atomic because every slot has a single
+// writer: edge compute only writes to the bound node, which is owned by one thread within a frontier
+// task, and vertex compute only writes to nodes of its own morsel.
+template<typename T>
 class PValues {
 public:
-    PValues(table_id_map_t<offset_t> maxOffsetMap, storage::MemoryManager* mm, double val) {
+    PValues(const table_id_map_t<offset_t>& maxOffsetMap, storage::MemoryManager* mm) {
         for (const auto& [tableID, maxOffset] : maxOffsetMap) {
             valueMap.allocate(tableID, maxOffset, mm);
-            pinTable(tableID);
-            for (auto i = 0u; i < maxOffset; ++i) {
-                values[i].store(val, std::memory_order_relaxed);
-            }
         }
     }
 
     void pinTable(table_id_t tableID) { values = valueMap.getData(tableID); }
 
-    double getValue(offset_t offset) { return values[offset].load(std::memory_order_relaxed); }
+    T getValue(offset_t offset) const { return values[offset]; }
+
+    void addValue(offset_t offset, T val) { values[offset] += val; }
+
+    void setValue(offset_t offset, T val) { values[offset] = val; }
+
+    T* getData() const { return values; }
+
+private:
+    T* values = nullptr;
+    GDSDenseObjectManager<T> valueMap;
+};
+
+// Pull-based PageRank state. Each iteration, every node sums the contributions of its in-neighbors
+// into next and then recomputes its own rank and contribution from it.
+template<typename T>
+struct PageRankState {
+    PValues<T> rank;
+    // rank / out-degree, i.e. the value a node passes along each of its out-edges.
+    PValues<T> contribution;
+    PValues<T> next;
+    // 1 / out-degree, or 0 for nodes without out-edges.
+    PValues<T> invDegree;
+
+    PageRankState(const table_id_map_t<offset_t>& maxOffsetMap, storage::MemoryManager* mm)
+        : rank{maxOffsetMap, mm}, contribution{maxOffsetMap, mm}, next{maxOffsetMap, mm},
+          invDegree{maxOffsetMap, mm} {}
+
+    void pinTable(table_id_t tableID) {
+        rank.pinTable(tableID);
+        contribution.pinTable(tableID);
+        next.pinTable(tableID);
+        invDegree.pinTable(tableID);
+    }
+};
 
-    void addValueCAS(offset_t offset, double val) { addCAS(values[offset], val); }
+// Initial rank of each node. For personalized PageRank, only source nodes have a non-zero initial
+// rank and random jumps land only on them.
+class PInitialValues {
+public:
+    PInitialValues(double value, NodeOffsetMaskMap* sourceMask)
+        : value{value}, sourceMask{sourceMask} {}
 
-    void setValue(offset_t offset, double val) {
-        values[offset].store(val, std::memory_order_relaxed);
+    void pinTable(table_id_t tableID) {
+        if (sourceMask != nullptr) {
+            sourceMask->pin(tableID);
+        }
+    }
+
+    bool isUniform() const { return sourceMask == nullptr; }
+
+    double getValue(offset_t offset) const {
+        if (sourceMask == nullptr) {
+            return value;
+        }
+        return sourceMask->hasPinnedMask() && sourceMask->valid(offset) ? value : 0;
     }
 
 private:
-    std::atomic<double>* values = nullptr;
-    GDSDenseObjectManager<std::atomic<double>> valueMap;
+    double value;
+    NodeOffsetMaskMap* sourceMask;
 };
 
+template<typename T>
 class PageRankAuxiliaryState : public GDSAuxiliaryState {
 public:
-    PageRankAuxiliaryState(Degrees& degrees, PValues& pCurrent, PValues& pNext)
-        : degrees{degrees}, pCurrent{pCurrent}, pNext{pNext} {}
+    explicit PageRankAuxiliaryState(PageRankState<T>& state) : state{state} {}
 
     void beginFrontierCompute(table_id_t fromTableID, table_id_t toTableID) override {
-        degrees.pinTable(toTableID);
-        pCurrent.pinTable(toTableID);
-        pNext.pinTable(fromTableID);
+        state.contribution.pinTable(toTableID);
+        state.next.pinTable(fromTableID);
     }
 
     void switchToDense(ExecutionContext*, Graph*) override {}
 
 private:
-    Degrees& degrees;
-    PValues& pCurrent;
-    PValues& pNext;
+    PageRankState<T>& state;
 };
 
-// Sum the weight (current rank / degree) for each incoming edge.
+// Sum the contribution (current rank / degree) of each incoming edge.
+template<typename T>
 class PNextUpdateEdgeCompute : public EdgeCompute {
 public:
-    PNextUpdateEdgeCompute(Degrees& degrees, PValues& pCurrent, PValues& pNext)
-        : degrees{degrees}, pCurrent{pCurrent}, pNext{pNext} {}
+    explicit PNextUpdateEdgeCompute(PageRankState<T>& state) : state{state} {}
 
     std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, graph::NbrScanState::Chunk& chunk,
         bool) override {
         if (chunk.size() > 0) {
-            double valToAdd = 0;
+            T valToAdd = 0;
             chunk.forEach([&](auto neighbors, auto, auto i) {
-                auto nbrNodeID = neighbors[i];
-                valToAdd +=
-                    pCurrent.getValue(nbrNodeID.offset) / degrees.getValue(nbrNodeID.offset);
+                valToAdd += state.contribution.getValue(neighbors[i].offset);
             });
-            pNext.addValueCAS(boundNodeID.offset, valToAdd);
+            state.next.addValue(boundNodeID.offset, valToAdd);
         }
         return {};
     }
 
     std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<PNextUpdateEdgeCompute>(degrees, pCurrent, pNext);
+        return std::make_unique<PNextUpdateEdgeCompute<T>>(state);
     }
 
 private:
-    Degrees& degrees;
-    PValues& pCurrent;
-    PValues& pNext;
+    PageRankState<T>& state;
 };
 
-// Evaluate rank = above result * dampingFactor + {(1 - dampingFactor) / |V|} (constant)
-class PNextUpdateVertexCompute : public GDSVertexCompute {
+template<typename T>
+class PInitVertexCompute : public GDSVertexCompute {
 public:
-    PNextUpdateVertexCompute(double dampingFactor, double constant, PValues& pNext,
+    PInitVertexCompute(PageRankState<T>& state, Degrees& degrees, PInitialValues& initialValues,
         NodeOffsetMaskMap* nodeMask)
-        : GDSVertexCompute{nodeMask}, dampingFactor{dampingFactor}, constant{constant},
-          pNext{pNext} {}
+        : GDSVertexCompute{nodeMask}, state{state}, degrees{degrees},
+          initialValues{initialValues} {}
 
-    void beginOnTableInternal(table_id_t tableID) override { pNext.pinTable(tableID); }
+    void beginOnTableInternal(table_id_t tableID) override {
+        state.pinTable(tableID);
+        degrees.pinTable(tableID);
+        initialValues.pinTable(tableID);
+    }
 
     void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t) override {
         for (auto i = startOffset; i < endOffset; ++i) {
-            if (skip(i)) {
-                continue;
-            }
-            pNext.setValue(i, pNext.getValue(i) * dampingFactor + constant);
+            auto degree = degrees.getValue(i);
+            auto invDegree = degree == 0 ? 0 : static_cast<T>(1) / degree;
+            auto rank = skip(i) ? 0 : static_cast<T>(initialValues.getValue(i));
+            state.rank.setValue(i, rank);
+            state.contribution.setValue(i, rank * invDegree);
+            state.next.setValue(i, 0);
+            state.invDegree.setValue(i, invDegree);
         }
     }
 
     std::unique_ptr<VertexCompute> copy() override {
-        return std::make_unique<PNextUpdateVertexCompute>(dampingFactor, constant, pNext, nodeMask);
+        return std::make_unique<PInitVertexCompute<T>>(state, degrees, initialValues, nodeMask);
     }
 
 private:
-    double dampingFactor;
-    double constant;
-    PValues& pNext;
+    PageRankState<T>& state;
+    Degrees& degrees;
+    PInitialValues& initialValues;
 };
 
-class PDiffVertexCompute : public GDSVertexCompute {
+// Evaluate rank = above result * dampingFactor + (1 - dampingFactor) * initial rank, add the change
+// of rank to diff and prepare contributions for the next iteration in a single pass over nodes.
+template<typename T>
+class PRankUpdateVertexCompute : public GDSVertexCompute {
 public:
-    PDiffVertexCompute(std::atomic<double>& diff, PValues& pCurrent, PValues& pNext,
-        NodeOffsetMaskMap* nodeMask)
-        : GDSVertexCompute{nodeMask}, diff{diff}, pCurrent{pCurrent}, pNext{pNext} {}
+    PRankUpdateVertexCompute(double dampingFactor, PageRankState<T>& state,
+        PInitialValues& initialValues, std::atomic<double>& diff, NodeOffsetMaskMap* nodeMask)
+        : GDSVertexCompute{nodeMask}, dampingFactor{dampingFactor}, state{state},
+          initialValues{initialValues}, diff{diff} {}
 
     void beginOnTableInternal(table_id_t tableID) override {
-        pCurrent.pinTable(tableID);
-        pNext.pinTable(tableID);
+        state.pinTable(tableID);
+        initialValues.pinTable(tableID);
     }
 
     void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t) override {
-        for (auto i = startOffset; i < endOffset; ++i) {
-            if (skip(i)) {
-                continue;
+        auto damping = static_cast<T>(dampingFactor);
+        auto teleportFactor = 1 - dampingFactor;
+        double localDiff = 0;
+        if (initialValues.isUniform() && (nodeMask == nullptr || !nodeMask->hasPinnedMask())) {
+            // No per-node checks. Keep the loop over plain arrays so that it can be vectorized.
+            auto teleport = static_cast<T>(teleportFactor * initialValues.getValue(0));
+            auto rank = state.rank.getData();
+            auto contribution = state.contribution.getData();
+            auto next = state.next.getData();
+            auto invDegree = state.invDegree.getData();
+            for (auto i = startOffset; i < endOffset; ++i) {
+                auto newRank = next[i] * damping + teleport;
+                localDiff += std::abs(static_cast<double>(newRank) - rank[i]);
+                rank[i] = newRank;
+                contribution[i] = newRank * invDegree[i];
+                next[i] = 0;
             }
-            auto next = pNext.getValue(i);
-            auto current = pCurrent.getValue(i);
-            if (next > current) {
-                addCAS(diff, next - current);
-            } else {
-                addCAS(diff, current - next);
+        } else {
+            for (auto i = startOffset; i < endOffset; ++i) {
+                if (skip(i)) {
+                    continue;
+                }
+                auto teleport = static_cast<T>(teleportFactor * initialValues.getValue(i));
+                auto newRank = state.next.getValue(i) * damping + teleport;
+                localDiff += std::abs(static_cast<double>(newRank) - state.rank.getValue(i));
+                state.rank.setValue(i, newRank);
+                state.contribution.setValue(i, newRank * state.invDegree.getValue(i));
+                state.next.setValue(i, 0);
             }
-            pCurrent.setValue(i, 0);
         }
+        addCAS(diff, localDiff);
     }
 
     std::unique_ptr<VertexCompute> copy() override {
-        return std::make_unique<PDiffVertexCompute>(diff, pCurrent, pNext, nodeMask);
+        return std::make_unique<PRankUpdateVertexCompute<T>>(dampingFactor, state, initialValues,
+            diff, nodeMask);
     }
 
 private:
+    double dampingFactor;
+    PageRankState<T>& state;
+    PInitialValues& initialValues;
     std::atomic<double>& diff;
-    PValues& pCurrent;
-    PValues& pNext;
 };
 
+template<typename T>
 class PageRankResultVertexCompute : public GDSResultVertexCompute {
 public:
     PageRankResultVertexCompute(storage::MemoryManager* mm, GDSFuncSharedState* sharedState,
-        PValues& pNext)
-        : GDSResultVertexCompute{mm, sharedState}, pNext{pNext} {
+        PValues<T>& rank)
+        : GDSResultVertexCompute{mm, sharedState}, rank{rank} {
         nodeIDVector = createVector(LogicalType::INTERNAL_ID());
         rankVector = createVector(LogicalType::DOUBLE());
     }
 
-    void beginOnTableInternal(table_id_t tableID) override { pNext.pinTable(tableID); }
+    void beginOnTableInternal(table_id_t tableID) override { rank.pinTable(tableID); }
 
     void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
         for (auto i = startOffset; i < endOffset; ++i) {
@@ -247,65 +331,61 @@ public:
             }
             auto nodeID = nodeID_t{i, tableID};
             nodeIDVector->setValue<nodeID_t>(0, nodeID);
-            rankVector->setValue<double>(0, pNext.getValue(i));
+            rankVector->setValue<double>(0, rank.getValue(i));
             localFT->append(vectors);
         }
     }
 
     std::unique_ptr<VertexCompute> copy() override {
-        return std::make_unique<PageRankResultVertexCompute>(mm, sharedState, pNext);
+        return std::make_unique<PageRankResultVertexCompute<T>>(mm, sharedState, rank);
     }
 
 private:
-    PValues& pNext;
+    PValues<T>& rank;
     std::unique_ptr<ValueVector> nodeIDVector;
     std::unique_ptr<ValueVector> rankVector;
 };
 
-static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+template<typename T>
+static void runPageRank(const TableFuncInput& input, const PageRankOptionalParams& config) {
     auto clientContext = input.context->clientContext;
     auto transaction = clientContext->getTransaction();
+    auto mm = clientContext->getMemoryManager();
     auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
     auto graph = sharedState->graph.get();
+    auto nodeMask = sharedState->getGraphNodeMaskMap();
     auto maxOffsetMap = graph->getMaxOffsetMap(transaction);
     auto numNodes = graph->getNumNodes(transaction);
-    auto pageRankBindData = input.bindData->constPtrCast<PageRankBindData>();
-    auto& config = pageRankBindData->optionalParams->constCast<PageRankOptionalParams>();
-    auto initialValue = config.normalize.getParamVal() ? (double)1 / numNodes : (double)1;
-    auto p1 = PValues(maxOffsetMap, clientContext->getMemoryManager(), initialValue);
-    auto p2 = PValues(maxOffsetMap, clientContext->getMemoryManager(), 0);
-    PValues* pCurrent = &p1;
-    PValues* pNext = &p2;
-    auto currentIter = 1u;
-    auto currentFrontier =
-        DenseFrontier::getVisitedFrontier(input.context, graph, sharedState->getGraphNodeMaskMap());
-    auto nextFrontier =
-        DenseFrontier::getVisitedFrontier(input.context, graph, sharedState->getGraphNodeMaskMap());
-    auto degrees = Degrees(maxOffsetMap, clientContext->getMemoryManager());
-    DegreesUtils::computeDegree(input.context, graph, sharedState->getGraphNodeMaskMap(), &degrees,
-        ExtendDirection::FWD);
+    auto sourceMask = sharedState->getInputNodeMaskMap();
+    auto numSources = sourceMask == nullptr ? numNodes : sourceMask->getNumMaskedNode();
+    auto initialValue = (double)1;
+    if (config.normalize.getParamVal()) {
+        initialValue = numSources == 0 ? 0 : (double)1 / numSources;
+    }
+    auto initialValues = PInitialValues(initialValue, sourceMask);
+    auto degrees = Degrees(maxOffsetMap, mm);
+    DegreesUtils::computeDegree(input.context, graph, nodeMask, &degrees, ExtendDirection::FWD);
+    auto state = PageRankState<T>(maxOffsetMap, mm);
+    auto initVC = PInitVertexCompute<T>(state, degrees, initialValues, nodeMask);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, initVC);
+    auto currentFrontier = DenseFrontier::getVisitedFrontier(input.context, graph, nodeMask);
+    auto nextFrontier = DenseFrontier::getVisitedFrontier(input.context, graph, nodeMask);
     auto frontierPair =
         std::make_unique<DenseFrontierPair>(std::move(currentFrontier), std::move(nextFrontier));
-    auto computeState = GDSComputeState(std::move(frontierPair), nullptr, nullptr);
-    auto pNextUpdateConstant = (1 - config.dampingFactor.getParamVal()) * initialValue;
+    auto computeState =
+        GDSComputeState(std::move(frontierPair), std::make_unique<PNextUpdateEdgeCompute<T>>(state),
+            std::make_unique<PageRankAuxiliaryState<T>>(state));
+    auto currentIter = 1u;
     while (currentIter < config.maxIterations.getParamVal()) {
         computeState.frontierPair->resetCurrentIter();
         computeState.frontierPair->setActiveNodesForNextIter();
-        computeState.edgeCompute =
-            std::make_unique<PNextUpdateEdgeCompute>(degrees, *pCurrent, *pNext);
-        computeState.auxiliaryState =
-            std::make_unique<PageRankAuxiliaryState>(degrees, *pCurrent, *pNext);
         GDSUtils::runAlgorithmEdgeCompute(input.context, computeState, graph, ExtendDirection::BWD,
             1);
-        auto pNextUpdateVC = PNextUpdateVertexCompute(config.dampingFactor.getParamVal(),
-            pNextUpdateConstant, *pNext, sharedState->getGraphNodeMaskMap());
-        GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, pNextUpdateVC);
         std::atomic<double> diff;
         diff.store(0);
-        auto pDiffVC =
-            PDiffVertexCompute(diff, *pCurrent, *pNext, sharedState->getGraphNodeMaskMap());
-        GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, pDiffVC);
-        std::swap(pCurrent, pNext);
+        auto updateVC = PRankUpdateVertexCompute<T>(config.dampingFactor.getParamVal(), state,
+            initialValues, diff, nodeMask);
+        GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, updateVC);
         if (diff.load() < config.tolerance.getParamVal()) { // Converged.
             break;
         }
@@ -313,10 +393,19 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
         clientContext->getProgressBar()->updateProgress(input.context->queryID, progress);
         currentIter++;
     }
-    auto outputVC = std::make_unique<PageRankResultVertexCompute>(clientContext->getMemoryManager(),
-        sharedState, *pCurrent);
+    auto outputVC = std::make_unique<PageRankResultVertexCompute<T>>(mm, sharedState, state.rank);
     GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *outputVC);
     sharedState->factorizedTablePool.mergeLocalTables();
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto pageRankBindData = input.bindData->constPtrCast<PageRankBindData>();
+    auto& config = pageRankBindData->optionalParams->constCast<PageRankOptionalParams>();
+    if (config.floatPrecision.getParamVal()) {
+        runPageRank<float>(input, config);
+    } else {
+        runPageRank<double>(input, config);
+    }
     return 0;
 }
 
@@ -330,8 +419,19 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     expression_vector columns;
     columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
     columns.push_back(input->binder->createVariable(RANK_COLUMN_NAME, LogicalType::DOUBLE()));
-    return std::make_unique<PageRankBindData>(std::move(columns), std::move(graphEntry), nodeOutput,
-        std::make_unique<PageRankOptionalParams>(input->optionalParamsLegacy));
+    auto optionalParams = std::make_unique<PageRankOptionalParams>(input->optionalParamsLegacy);
+    std::string sourcePredicate;
+    if (optionalParams->sources.isSet()) {
+        optionalParams->sources.evaluateParam(context);
+        sourcePredicate = optionalParams->sources.getParamVal();
+    }
+    auto bindData = std::make_unique<PageRankBindData>(std::move(columns), std::move(graphEntry),
+        nodeOutput, std::move(optionalParams));
+    if (!sourcePredicate.empty()) {
+        bindData->inputNodeInfos =
+            GDSFunction::bindInputNodeInfos(*context, graphName, sourcePredicate);
+    }
+    return bindData;
 }
 
 function_set PageRankFunction::getFunctionSet() {
@@ -0,0 +1,407 @@
+#include <algorithm>
+
+#include "binder/binder.h"
+#include "common/task_system/progress_bar.h"
+#include "function/algo_function.h"
+#include "function/degrees.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "processor/execution_context.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace algo_extension {
+
+// Triangles are counted on the undirected simple graph underlying the projected graph, i.e. edge
+// directions are ignored, parallel edges are merged and self-loops are dropped.
+//
+// Each undirected edge {u, v} is oriented from the lower ranked to the higher ranked endpoint,
+// where nodes are ranked by (degree, node index). Every triangle is then found exactly once from
+// its lowest ranked node u, as a common out-neighbor of u and of one of u's out-neighbors.
+// Ranking by degree bounds the out-degree of every node by O(sqrt(m)), which keeps the sorted
+// merge intersections short on graphs with high degree hubs.
+
+// Maps node IDs of all node tables of the graph to a dense index.
+class NodeIndexer {
+public:
+    explicit NodeIndexer(const table_id_map_t<offset_t>& maxOffsetMap) : numNodes{0} {
+        for (const auto& [tableID, maxOffset] : maxOffsetMap) {
+            startIndices[tableID] = numNodes;
+            numNodes += maxOffset;
+        }
+    }
+
+    offset_t getNumNodes() const { return numNodes; }
+    offset_t getStartIdx(table_id_t tableID) const { return startIndices.at(tableID); }
+    offset_t getIdx(nodeID_t nodeID) const {
+        return startIndices.at(nodeID.tableID) + nodeID.offset;
+    }
+
+private:
+    table_id_map_t<offset_t> startIndices;
+    offset_t numNodes;
+};
+
+// Degree-oriented adjacency lists in CSR format. The lists are filled in parallel, so the space of
+// each node is reserved from its (non-deduplicated) degree and only the first `lengths[idx]`
+// entries are used.
+struct TriangleCountState {
+    NodeIndexer indexer;
+    ObjectArray<degree_t> degrees;
+    ObjectArray<offset_t> csrOffsets;
+    ObjectArray<offset_t> csrLengths;
+    ObjectArray<offset_t> csrNbrs;
+    // Number of distinct neighbors excluding the node itself.
+    ObjectArray<offset_t> numDistinctNbrs;
+    AtomicObjectArray<uint64_t> triangleCounts;
+    std::atomic<uint64_t> numTriangles;
+
+    TriangleCountState(const table_id_map_t<offset_t>& maxOffsetMap, MemoryManager* mm)
+        : indexer{maxOffsetMap}, degrees{indexer.getNumNodes(), mm},
+          csrOffsets{indexer.getNumNodes() + 1, mm}, csrLengths{indexer.getNumNodes(), mm},
+          numDistinctNbrs{indexer.getNumNodes(), mm},
+          triangleCounts{indexer.getNumNodes(), mm, true /* initializeToZero */},
+          numTriangles{0} {}
+
+    void initCSR(Degrees& tableDegrees, const table_id_map_t<offset_t>& maxOffsetMap,
+        MemoryManager* mm) {
+        offset_t numEntries = 0;
+        for (const auto& [tableID, maxOffset] : maxOffsetMap) {
+            tableDegrees.pinTable(tableID);
+            const auto startIdx = indexer.getStartIdx(tableID);
+            for (auto offset = 0u; offset < maxOffset; offset++) {
+                const auto degree = tableDegrees.getValue(offset);
+                degrees.set(startIdx + offset, degree);
+                csrOffsets.set(startIdx + offset, numEntries);
+                numEntries += degree;
+            }
+        }
+        csrOffsets.set(indexer.getNumNodes(), numEntries);
+        csrNbrs.allocate(numEntries, mm, false /* initializeToZero */);
+    }
+
+    bool isOrientedEdge(offset_t fromIdx, offset_t toIdx) const {
+        const auto fromDegree = degrees.get(fromIdx);
+        const auto toDegree = degrees.get(toIdx);
+        return fromDegree < toDegree || (fromDegree == toDegree && fromIdx < toIdx);
+    }
+
+    std::span<const offset_t> getOrientedNbrs(offset_t idx) const {
+        const auto numNbrs = csrLengths.get(idx);
+        if (numNbrs == 0) {
+            return {};
+        }
+        return std::span(&csrNbrs.get(csrOffsets.get(idx)), numNbrs);
+    }
+};
+
+// Scans the neighbors of each node, deduplicates them and keeps the ones with a higher rank sorted
+// by node index.
+class OrientedNbrsVertexCompute final : public GDSVertexCompute {
+public:
+    OrientedNbrsVertexCompute(Graph* graph, NodeOffsetMaskMap* nodeMask, TriangleCountState& state)
+        : GDSVertexCompute{nodeMask}, graph{graph}, state{state} {}
+
+    void beginOnTableInternal(table_id_t tableID) override {
+        boundRelInfos = BoundRelInfo::getBoundRelInfos(graph, tableID, ExtendDirection::BOTH);
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        if (scanStates.size() != boundRelInfos.size()) {
+            scanStates.clear();
+            for (const auto& boundRelInfo : boundRelInfos) {
+                scanStates.push_back(boundRelInfo.prepareScan(graph));
+            }
+        }
+        const auto startIdx = state.indexer.getStartIdx(tableID);
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            const auto idx = startIdx + offset;
+            state.csrLengths.set(idx, 0);
+            state.numDistinctNbrs.set(idx, 0);
+            if (skip(offset)) {
+                continue;
+            }
+            nbrs.clear();
+            for (auto i = 0u; i < boundRelInfos.size(); i++) {
+                for (auto chunk : boundRelInfos[i].scan(graph, {offset, tableID}, *scanStates[i])) {
+                    chunk.forEach([&](auto neighbors, auto, auto j) {
+                        nbrs.push_back(state.indexer.getIdx(neighbors[j]));
+                    });
+                }
+            }
+            KU_ASSERT(nbrs.size() <= state.degrees.get(idx));
+            std::sort(nbrs.begin(), nbrs.end());
+            nbrs.erase(std::unique(nbrs.begin(), nbrs.end()), nbrs.end());
+            auto numDistinctNbrs = 0u;
+            auto numOrientedNbrs = 0u;
+            const auto csrOffset = state.csrOffsets.get(idx);
+            for (const auto nbrIdx : nbrs) {
+                if (nbrIdx == idx) {
+                    continue;
+                }
+                numDistinctNbrs++;
+                if (state.isOrientedEdge(idx, nbrIdx)) {
+                    state.csrNbrs.set(csrOffset + numOrientedNbrs++, nbrIdx);
+                }
+            }
+            state.numDistinctNbrs.set(idx, numDistinctNbrs);
+            state.csrLengths.set(idx, numOrientedNbrs);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        auto vc = std::make_unique<OrientedNbrsVertexCompute>(graph, nodeMask, state);
+        vc->boundRelInfos = boundRelInfos;
+        return vc;
+    }
+
+private:
+    Graph* graph;
+    TriangleCountState& state;
+    std::vector<BoundRelInfo> boundRelInfos;
+    std::vector<std::unique_ptr<NbrScanState>> scanStates;
+    std::vector<offset_t> nbrs;
+};
+
+class CountTrianglesVertexCompute final : public GDSVertexCompute {
+public:
+    CountTrianglesVertexCompute(NodeOffsetMaskMap* nodeMask, TriangleCountState& state)
+        : GDSVertexCompute{nodeMask}, state{state} {}
+
+    void beginOnTableInternal(table_id_t tableID) override {
+        startIdx = state.indexer.getStartIdx(tableID);
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t) override {
+        uint64_t numTrianglesInMorsel = 0;
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            const auto idx = startIdx + offset;
+            const auto nbrs = state.getOrientedNbrs(idx);
+            uint64_t numTrianglesOfNode = 0;
+            for (const auto nbrIdx : nbrs) {
+                const auto numCommonNbrs = intersect(nbrs, state.getOrientedNbrs(nbrIdx));
+                if (numCommonNbrs > 0) {
+                    state.triangleCounts.fetchAdd(nbrIdx, numCommonNbrs,
+                        std::memory_order_relaxed);
+                    numTrianglesOfNode += numCommonNbrs;
+                }
+            }
+            if (numTrianglesOfNode > 0) {
+                state.triangleCounts.fetchAdd(idx, numTrianglesOfNode, std::memory_order_relaxed);
+                numTrianglesInMorsel += numTrianglesOfNode;
+            }
+        }
+        state.numTriangles.fetch_add(numTrianglesInMorsel, std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<CountTrianglesVertexCompute>(nodeMask, state);
+    }
+
+private:
+    // Merges two lists sorted by node index, and adds one triangle to each common neighbor.
+    uint64_t intersect(std::span<const offset_t> left, std::span<const offset_t> right) {
+        uint64_t numCommonNbrs = 0;
+        auto leftIt = left.begin();
+        auto rightIt = right.begin();
+        while (leftIt != left.end() && rightIt != right.end()) {
+            if (*leftIt < *rightIt) {
+                ++leftIt;
+            } else if (*rightIt < *leftIt) {
+                ++rightIt;
+            } else {
+                state.triangleCounts.fetchAdd(*leftIt, 1, std::memory_order_relaxed);
+                numCommonNbrs++;
+                ++leftIt;
+                ++rightIt;
+            }
+        }
+        return numCommonNbrs;
+    }
+
+private:
+    TriangleCountState& state;
+    offset_t startIdx = 0;
+};
+
+static void countTriangles(ExecutionContext* context, GDSFuncSharedState* sharedState,
+    TriangleCountState& state, const table_id_map_t<offset_t>& maxOffsetMap) {
+    auto clientContext = context->clientContext;
+    auto mm = clientContext->getMemoryManager();
+    auto graph = sharedState->graph.get();
+    auto nodeMask = sharedState->getGraphNodeMaskMap();
+    auto degrees = Degrees(maxOffsetMap, mm);
+    DegreesUtils::computeDegree(context, graph, nodeMask, &degrees, ExtendDirection::BOTH);
+    state.initCSR(degrees, maxOffsetMap, mm);
+    auto orientedNbrsVC = OrientedNbrsVertexCompute(graph, nodeMask, state);
+    GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, orientedNbrsVC);
+    clientContext->getProgressBar()->updateProgress(context->queryID, 0.5);
+    auto countTrianglesVC = CountTrianglesVertexCompute(nodeMask, state);
+    GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, countTrianglesVC);
+    clientContext->getProgressBar()->updateProgress(context->queryID, 1);
+}
+
+static constexpr char TRIANGLE_COUNT_COLUMN_NAME[] = "triangle_count";
+static constexpr char GLOBAL_TRIANGLE_COUNT_COLUMN_NAME[] = "global_triangle_count";
+static constexpr char LOCAL_CLUSTERING_COEFFICIENT_COLUMN_NAME[] = "local_clustering_coefficient";
+
+class TriangleCountResultVertexCompute final : public GDSResultVertexCompute {
+public:
+    TriangleCountResultVertexCompute(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        TriangleCountState& state)
+        : GDSResultVertexCompute{mm, sharedState}, state{state} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        triangleCountVector = createVector(LogicalType::INT64());
+        globalTriangleCountVector = createVector(LogicalType::INT64());
+        globalTriangleCountVector->setValue<int64_t>(0, state.numTriangles.load());
+    }
+
+    void beginOnTableInternal(table_id_t tableID) override {
+        startIdx = state.indexer.getStartIdx(tableID);
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            if (skip(offset)) {
+                continue;
+            }
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{offset, tableID});
+            triangleCountVector->setValue<int64_t>(0,
+                state.triangleCounts.get(startIdx + offset, std::memory_order_relaxed));
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TriangleCountResultVertexCompute>(mm, sharedState, state);
+    }
+
+private:
+    TriangleCountState& state;
+    offset_t startIdx = 0;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> triangleCountVector;
+    std::unique_ptr<ValueVector> globalTriangleCountVector;
+};
+
+class LocalClusteringCoefficientResultVertexCompute final : public GDSResultVertexCompute {
+public:
+    LocalClusteringCoefficientResultVertexCompute(MemoryManager* mm,
+        GDSFuncSharedState* sharedState, TriangleCountState& state)
+        : GDSResultVertexCompute{mm, sharedState}, state{state} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        coefficientVector = createVector(LogicalType::DOUBLE());
+    }
+
+    void beginOnTableInternal(table_id_t tableID) override {
+        startIdx = state.indexer.getStartIdx(tableID);
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            if (skip(offset)) {
+                continue;
+            }
+            const auto idx = startIdx + offset;
+            // Fraction of pairs of distinct neighbors that are connected.
+            const auto numNbrs = static_cast<double>(state.numDistinctNbrs.get(idx));
+            const auto numTriangles =
+                static_cast<double>(state.triangleCounts.get(idx, std::memory_order_relaxed));
+            const auto coefficient =
+                numNbrs < 2 ? 0.0 : 2.0 * numTriangles / (numNbrs * (numNbrs - 1));
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{offset, tableID});
+            coefficientVector->setValue<double>(0, coefficient);
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<LocalClusteringCoefficientResultVertexCompute>(mm, sharedState,
+            state);
+    }
+
+private:
+    TriangleCountState& state;
+    offset_t startIdx = 0;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> coefficientVector;
+};
+
+template<typename RESULT_VC>
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto mm = clientContext->getMemoryManager();
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    auto maxOffsetMap = graph->getMaxOffsetMap(clientContext->getTransaction());
+    auto state = TriangleCountState(maxOffsetMap, mm);
+    countTriangles(input.context, sharedState, state, maxOffsetMap);
+    auto vertexCompute = RESULT_VC(mm, sharedState, state);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, vertexCompute);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static std::unique_ptr<TableFuncBindData> bindTriangleCountFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(
+        input->binder->createVariable(TRIANGLE_COUNT_COLUMN_NAME, LogicalType::INT64()));
+    columns.push_back(
+        input->binder->createVariable(GLOBAL_TRIANGLE_COUNT_COLUMN_NAME, LogicalType::INT64()));
+    return std::make_unique<GDSBindData>(std::move(columns), std::move(graphEntry), nodeOutput);
+}
+
+static std::unique_ptr<TableFuncBindData> bindLocalClusteringCoefficientFunc(
+    main::ClientContext* context, const TableFuncBindInput* input) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(input->binder->createVariable(LOCAL_CLUSTERING_COEFFICIENT_COLUMN_NAME,
+        LogicalType::DOUBLE()));
+    return std::make_unique<GDSBindData>(std::move(columns), std::move(graphEntry), nodeOutput);
+}
+
+static std::unique_ptr<TableFunction> getTableFunction(const char* name,
+    table_func_bind_t bindFunc, table_func_t tableFunc) {
+    auto func =
+        std::make_unique<TableFunction>(name, std::vector<LogicalTypeID>{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    return func;
+}
+
+function_set TriangleCountFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(getTableFunction(TriangleCountFunction::name, bindTriangleCountFunc,
+        tableFunc<TriangleCountResultVertexCompute>));
+    return result;
+}
+
+function_set LocalClusteringCoefficientFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(getTableFunction(LocalClusteringCoefficientFunction::name,
+        bindLocalClusteringCoefficientFunc,
+        tableFunc<LocalClusteringCoefficientResultVertexCompute>));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace kuzu
@@ -5,6 +5,10 @@
 #include "function/gds/gds_object_manager.h"
 
 namespace kuzu {
+namespace processor {
+class ExecutionContext;
+} // namespace processor
+
 namespace algo_extension {
 
 using weight_t = common::offset_t;
@@ -14,6 +18,7 @@ struct Neighbor {
     common::offset_t neighbor;
     weight_t weight;
 
+    Neighbor() : neighbor{common::INVALID_OFFSET}, weight{0} {}
     Neighbor(const common::offset_t neighbor, const weight_t weight)
         : neighbor{neighbor}, weight{weight} {}
 };
@@ -27,6 +32,10 @@ struct InMemGraph {
     function::ku_vector_t<Neighbor> csrEdges;
     common::offset_t numNodes = 0;
     common::offset_t numEdges = 0;
+    // Scratch space used by `coarsen()`. Kept across calls so that coarsening a shrinking graph
+    // repeatedly only allocates once.
+    function::ku_vector_t<common::offset_t> scratchOffsets;
+    function::ku_vector_t<Neighbor> scratchEdges;
 
     InMemGraph(const common::offset_t numNodes, storage::MemoryManager* mm);
     DELETE_BOTH_COPY(InMemGraph);
@@ -40,6 +49,13 @@ struct InMemGraph {
 
     // Inserts a neighbor of the last initialized node.
     void insertNbr(const common::offset_t to, const weight_t weight = DEFAULT_WEIGHT);
+
+    // Coarsens the graph in place such that all nodes of a community are merged into a single node
+    // whose offset is the community ID. Parallel edges are merged by summing up their weights, and
+    // edges within a community become self-loops. `communities` maps each node to a community in
+    // [0, numCommunities).
+    void coarsen(const function::ObjectArray<common::offset_t>& communities,
+        common::offset_t numCommunities, processor::ExecutionContext* context);
 };
 
 } // namespace algo_extension
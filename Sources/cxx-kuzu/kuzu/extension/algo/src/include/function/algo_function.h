@@ -65,11 +65,35 @@ struct KCoreDecompositionAliasFunction {
     static constexpr const char* name = "KCORE";
 };
 
+struct TriangleCountFunction {
+    static constexpr const char* name = "TRIANGLE_COUNT";
+
+    static function::function_set getFunctionSet();
+};
+
+struct LocalClusteringCoefficientFunction {
+    static constexpr const char* name = "LOCAL_CLUSTERING_COEFFICIENT";
+
+    static function::function_set getFunctionSet();
+};
+
+struct LocalClusteringCoefficientAliasFunction {
+    using alias = LocalClusteringCoefficientFunction;
+
+    static constexpr const char* name = "LCC";
+};
+
 struct LouvainFunction {
     static constexpr const char* name = "LOUVAIN";
 
     static function::function_set getFunctionSet();
 };
 
+struct LeidenFunction {
+    static constexpr const char* name = "LEIDEN";
+
+    static function::function_set getFunctionSet();
+};
+
 } // namespace algo_extension
 } // namespace kuzu
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "common/exception/binder.h"
+#include "common/types/types.h"
+#include "function/gds/gds.h"
+
+namespace kuzu {
+namespace function {
+
+struct Resolution {
+    // Resolution of the modularity. Higher values lead to more and smaller communities.
+    static constexpr const char* NAME = "resolution";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::DOUBLE;
+    static constexpr double DEFAULT_VALUE = 1.0;
+
+    static void validate(double resolution) {
+        if (resolution <= 0) {
+            throw common::BinderException{"resolution must be a positive number."};
+        }
+    }
+};
+
+struct SeedProperty {
+    // Name of an INT64 node property holding an initial community assignment, e.g. the output of
+    // a previous run. Nodes with the same value start in the same community and nodes with a NULL
+    // value start in their own community. If empty, every node starts in its own community.
+    static constexpr const char* NAME = "seedproperty";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::STRING;
+    static constexpr const char* DEFAULT_VALUE = "";
+};
+
+} // namespace function
+} // namespace kuzu
@@ -37,5 +37,21 @@ struct NormalizeInitial {
     static constexpr bool DEFAULT_VALUE = true;
 };
 
+struct FloatPrecision {
+    // If true, ranks are accumulated in single precision. This halves the memory traffic of each
+    // iteration at the cost of precision; results are still returned as DOUBLE.
+    static constexpr const char* NAME = "floatprecision";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::BOOL;
+    static constexpr bool DEFAULT_VALUE = false;
+};
+
+struct Sources {
+    // Predicate on node variable `n` selecting the source set of personalized PageRank, e.g.
+    // 'n.id < 10'. Random jumps only land on source nodes. If empty, all nodes are sources.
+    static constexpr const char* NAME = "sources";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::STRING;
+    static constexpr const char* DEFAULT_VALUE = "";
+};
+
 } // namespace function
 } // namespace kuzu
@@ -1,9 +1,8 @@
 #pragma once
 
-#include "function/gds/compute.h"
-#include "function/gds/gds_frontier.h"
 #include "function/gds/gds_object_manager.h"
 #include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
 #include "graph/graph.h"
 
 namespace kuzu {
@@ -44,52 +43,103 @@ private:
     function::GDSDenseObjectManager<std::atomic<degree_t>> degreeValuesMap;
 };
 
-struct DegreeEdgeCompute : public function::EdgeCompute {
-    Degrees* degrees;
+// A relationship table scanned from one of its node tables in a fixed direction.
+struct BoundRelInfo {
+    graph::GraphRelInfo relInfo;
+    common::RelDataDirection direction;
 
-    explicit DegreeEdgeCompute(Degrees* degrees) : degrees{degrees} {}
+    common::table_id_t getNbrTableID() const {
+        return direction == common::RelDataDirection::FWD ? relInfo.dstTableID :
+                                                            relInfo.srcTableID;
+    }
 
-    std::vector<common::nodeID_t> edgeCompute(common::nodeID_t boundNodeID,
-        graph::NbrScanState::Chunk& chunk, bool) override {
-        degrees->addDegree(boundNodeID.offset, chunk.size());
-        return {};
+    std::unique_ptr<graph::NbrScanState> prepareScan(graph::Graph* graph) const {
+        return graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID, getNbrTableID(),
+            {} /* relProperties */);
     }
 
-    std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<DegreeEdgeCompute>(degrees);
+    graph::Graph::EdgeIterator scan(graph::Graph* graph, common::nodeID_t boundNodeID,
+        graph::NbrScanState& state) const {
+        return direction == common::RelDataDirection::FWD ? graph->scanFwd(boundNodeID, state) :
+                                                            graph->scanBwd(boundNodeID, state);
+    }
+
+    // Returns all relationships bound to nodes of `tableID` when extending in `extendDirection`.
+    static std::vector<BoundRelInfo> getBoundRelInfos(graph::Graph* graph,
+        common::table_id_t tableID, common::ExtendDirection extendDirection) {
+        std::vector<BoundRelInfo> result;
+        for (auto srcTableID : graph->getNodeTableIDs()) {
+            for (const auto& relInfo : graph->getRelInfos(srcTableID)) {
+                if (extendDirection != common::ExtendDirection::BWD &&
+                    relInfo.srcTableID == tableID) {
+                    result.push_back({relInfo, common::RelDataDirection::FWD});
+                }
+                if (extendDirection != common::ExtendDirection::FWD &&
+                    relInfo.dstTableID == tableID) {
+                    result.push_back({relInfo, common::RelDataDirection::BWD});
+                }
+            }
+        }
+        return result;
     }
 };
 
-class DegreesGDSAuxiliaryState : public function::GDSAuxiliaryState {
+// Computes degrees of a morsel of bound nodes at once through Graph::addDegrees, which avoids
+// scanning neighbors when the graph can read list lengths from its adjacency storage.
+class DegreeVertexCompute final : public function::GDSVertexCompute {
 public:
-    explicit DegreesGDSAuxiliaryState(Degrees* degrees) : degrees{degrees} {};
+    DegreeVertexCompute(graph::Graph* graph, common::NodeOffsetMaskMap* nodeMask, Degrees* degrees,
+        common::ExtendDirection extendDirection)
+        : GDSVertexCompute{nodeMask}, graph{graph}, degrees{degrees},
+          extendDirection{extendDirection} {}
+
+    void beginOnTableInternal(common::table_id_t tableID) override {
+        degrees->pinTable(tableID);
+        boundRelInfos = BoundRelInfo::getBoundRelInfos(graph, tableID, extendDirection);
+    }
 
-    void beginFrontierCompute(common::table_id_t curTableID, common::table_id_t) override {
-        degrees->pinTable(curTableID);
+    void vertexCompute(common::offset_t startOffset, common::offset_t endOffset,
+        common::table_id_t tableID) override {
+        if (scanStates.size() != boundRelInfos.size()) {
+            scanStates.clear();
+            for (const auto& boundRelInfo : boundRelInfos) {
+                scanStates.push_back(boundRelInfo.prepareScan(graph));
+            }
+        }
+        localDegrees.assign(endOffset - startOffset, 0);
+        for (auto i = 0u; i < boundRelInfos.size(); i++) {
+            graph->addDegrees(*scanStates[i], tableID, startOffset, boundRelInfos[i].direction,
+                localDegrees);
+        }
+        for (auto i = 0u; i < localDegrees.size(); i++) {
+            if (skip(startOffset + i)) {
+                continue;
+            }
+            degrees->addDegree(startOffset + i, localDegrees[i]);
+        }
     }
 
-    void switchToDense(processor::ExecutionContext*, graph::Graph*) override {}
+    std::unique_ptr<VertexCompute> copy() override {
+        auto vc = std::make_unique<DegreeVertexCompute>(graph, nodeMask, degrees, extendDirection);
+        vc->boundRelInfos = boundRelInfos;
+        return vc;
+    }
 
 private:
+    graph::Graph* graph;
     Degrees* degrees;
+    common::ExtendDirection extendDirection;
+    std::vector<BoundRelInfo> boundRelInfos;
+    std::vector<std::unique_ptr<graph::NbrScanState>> scanStates;
+    std::vector<uint64_t> localDegrees;
 };
 
 struct DegreesUtils {
     static void computeDegree(processor::ExecutionContext* context, graph::Graph* graph,
         common::NodeOffsetMaskMap* nodeOffsetMaskMap, Degrees* degrees,
         common::ExtendDirection direction) {
-        auto currentFrontier = function::DenseFrontier::getUnvisitedFrontier(context, graph);
-        auto nextFrontier =
-            function::DenseFrontier::getVisitedFrontier(context, graph, nodeOffsetMaskMap);
-        auto frontierPair = std::make_unique<function::DenseFrontierPair>(
-            std::move(currentFrontier), std::move(nextFrontier));
-        frontierPair->setActiveNodesForNextIter();
-        auto ec = std::make_unique<DegreeEdgeCompute>(degrees);
-        auto auxiliaryState = std::make_unique<DegreesGDSAuxiliaryState>(degrees);
-        auto computeState = function::GDSComputeState(std::move(frontierPair), std::move(ec),
-            std::move(auxiliaryState));
-        function::GDSUtils::runAlgorithmEdgeCompute(context, computeState, graph, direction,
-            1 /* maxIters */);
+        auto vc = DegreeVertexCompute(graph, nodeOffsetMaskMap, degrees, direction);
+        function::GDSUtils::runVertexCompute(context, function::GDSDensityState::DENSE, graph, vc);
     }
 };
 
@@ -20,7 +20,11 @@ void AlgoExtension::load(main::ClientContext* context) {
     ExtensionUtils::addTableFuncAlias<PageRankAliasFunction>(db);
     ExtensionUtils::addTableFunc<KCoreDecompositionFunction>(db);
     ExtensionUtils::addTableFuncAlias<KCoreDecompositionAliasFunction>(db);
+    ExtensionUtils::addTableFunc<TriangleCountFunction>(db);
+    ExtensionUtils::addTableFunc<LocalClusteringCoefficientFunction>(db);
+    ExtensionUtils::addTableFuncAlias<LocalClusteringCoefficientAliasFunction>(db);
     ExtensionUtils::addTableFunc<LouvainFunction>(db);
+    ExtensionUtils::addTableFunc<LeidenFunction>(db);
 }
 
 } // namespace algo_extension
@@ -33,6 +33,14 @@ std::string BoundAlterInfo::toString() const {
         result += "Comment on Table " + tableName;
         break;
     }
+    case common::AlterType::SET_COMPRESSION: {
+        result += "Set Compression on Table " + tableName;
+        break;
+    }
+    case common::AlterType::SET_NEIGHBOR_ORDER: {
+        result += "Set Neighbor Order on Table " + tableName;
+        break;
+    }
     default:
         break;
     }
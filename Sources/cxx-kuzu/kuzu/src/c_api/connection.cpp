@@ -155,3 +155,32 @@ kuzu_state kuzu_connection_set_query_timeout(kuzu_connection* connection, uint64
     }
     return KuzuSuccess;
 }
+
+kuzu_state kuzu_connection_set_query_memory_limit(kuzu_connection* connection,
+    uint64_t limit_in_bytes, kuzu_memory_limit_policy policy) {
+    if (connection == nullptr || connection->_connection == nullptr ||
+        policy > KUZU_MEMORY_LIMIT_SPILL) {
+        return KuzuError;
+    }
+    try {
+        const auto memoryLimitPolicy = static_cast<kuzu::storage::MemoryLimitPolicy>(policy);
+        static_cast<Connection*>(connection->_connection)->setQueryMemoryLimit(limit_in_bytes,
+            memoryLimitPolicy);
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+    return KuzuSuccess;
+}
+
+kuzu_state kuzu_connection_set_connection_memory_limit(kuzu_connection* connection,
+    uint64_t limit_in_bytes) {
+    if (connection == nullptr || connection->_connection == nullptr) {
+        return KuzuError;
+    }
+    try {
+        static_cast<Connection*>(connection->_connection)->setConnectionMemoryLimit(limit_in_bytes);
+    } catch (Exception& e) {
+        return KuzuError;
+    }
+    return KuzuSuccess;
+}
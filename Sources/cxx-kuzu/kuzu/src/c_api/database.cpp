@@ -11,6 +11,11 @@ kuzu_state kuzu_database_init(const char* database_path, kuzu_system_config conf
         auto systemConfig = SystemConfig(config.buffer_pool_size, config.max_num_threads,
             config.enable_compression, config.read_only, config.max_db_size, config.auto_checkpoint,
             config.checkpoint_threshold);
+        systemConfig.enableDirectIO = config.enable_direct_io;
+        systemConfig.enableBufferPoolWarmup = config.enable_buffer_pool_warmup;
+        systemConfig.enableMemoryMappedReads = config.enable_memory_mapped_reads;
+        systemConfig.enableHugePages = config.enable_huge_pages;
+        systemConfig.bindBufferPoolToNumaNodes = config.bind_buffer_pool_to_numa_nodes;
 
 #if defined(__APPLE__)
         systemConfig.threadQos = config.thread_qos;
@@ -42,6 +47,11 @@ kuzu_system_config kuzu_default_system_config() {
     cSystemConfig.max_db_size = config.maxDBSize;
     cSystemConfig.auto_checkpoint = config.autoCheckpoint;
     cSystemConfig.checkpoint_threshold = config.checkpointThreshold;
+    cSystemConfig.enable_direct_io = config.enableDirectIO;
+    cSystemConfig.enable_buffer_pool_warmup = config.enableBufferPoolWarmup;
+    cSystemConfig.enable_memory_mapped_reads = config.enableMemoryMappedReads;
+    cSystemConfig.enable_huge_pages = config.enableHugePages;
+    cSystemConfig.bind_buffer_pool_to_numa_nodes = config.bindBufferPoolToNumaNodes;
 #if defined(__APPLE__)
     cSystemConfig.thread_qos = config.threadQos;
 #endif
@@ -1,7 +1,9 @@
 #include "catalog/catalog_entry/index_catalog_entry.h"
 
+#include "catalog/catalog.h"
 #include "common/exception/runtime.h"
 #include "common/serializer/buffer_writer.h"
+#include "main/client_context.h"
 
 namespace kuzu {
 namespace catalog {
@@ -10,6 +12,18 @@ std::shared_ptr<common::BufferWriter> IndexAuxInfo::serialize() const {
     return std::make_shared<common::BufferWriter>(0 /*maximumSize*/);
 }
 
+std::string OrderedIndexAuxInfo::toCypher(const IndexCatalogEntry& indexEntry,
+    const ToCypherInfo& info) const {
+    auto& indexToCypherInfo = info.constCast<IndexToCypherInfo>();
+    auto context = indexToCypherInfo.context;
+    auto tableEntry = context->getCatalog()->getTableCatalogEntry(context->getTransaction(),
+        indexEntry.getTableID());
+    KU_ASSERT(indexEntry.getPropertyIDs().size() == 1);
+    auto propertyName = tableEntry->getProperty(indexEntry.getPropertyIDs()[0]).getName();
+    return common::stringFormat("CALL CREATE_INDEX('{}', '{}', '{}');", tableEntry->getName(),
+        indexEntry.getIndexName(), propertyName);
+}
+
 void IndexCatalogEntry::setAuxInfo(std::unique_ptr<IndexAuxInfo> auxInfo_) {
     auxInfo = std::move(auxInfo_);
     auxBuffer = nullptr;
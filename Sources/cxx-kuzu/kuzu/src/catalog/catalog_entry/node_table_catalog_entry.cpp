@@ -21,6 +21,10 @@ void NodeTableCatalogEntry::serialize(common::Serializer& serializer) const {
     TableCatalogEntry::serialize(serializer);
     serializer.writeDebuggingInfo("primaryKeyName");
     serializer.write(primaryKeyName);
+    serializer.writeDebuggingInfo("blockCompressionType");
+    serializer.write(blockCompressionType);
+    serializer.writeDebuggingInfo("coldCheckpointThreshold");
+    serializer.write(coldCheckpointThreshold);
 }
 
 std::unique_ptr<NodeTableCatalogEntry> NodeTableCatalogEntry::deserialize(
@@ -31,17 +35,29 @@ std::unique_ptr<NodeTableCatalogEntry> NodeTableCatalogEntry::deserialize(
     deserializer.deserializeValue(primaryKeyName);
     auto nodeTableEntry = std::make_unique<NodeTableCatalogEntry>();
     nodeTableEntry->primaryKeyName = primaryKeyName;
+    deserializer.validateDebuggingInfo(debuggingInfo, "blockCompressionType");
+    deserializer.deserializeValue(nodeTableEntry->blockCompressionType);
+    deserializer.validateDebuggingInfo(debuggingInfo, "coldCheckpointThreshold");
+    deserializer.deserializeValue(nodeTableEntry->coldCheckpointThreshold);
     return nodeTableEntry;
 }
 
 std::string NodeTableCatalogEntry::toCypher(const ToCypherInfo& /*info*/) const {
-    return common::stringFormat("CREATE NODE TABLE `{}` ({} PRIMARY KEY(`{}`));", getName(),
-        propertyCollection.toCypher(), primaryKeyName);
+    auto result = common::stringFormat("CREATE NODE TABLE `{}` ({} PRIMARY KEY(`{}`));",
+        getName(), propertyCollection.toCypher(), primaryKeyName);
+    if (blockCompressionType != common::BlockCompressionType::NONE) {
+        result += common::stringFormat("\nCALL SET_TABLE_COMPRESSION('{}', '{}', {});", getName(),
+            common::BlockCompressionTypeUtils::toString(blockCompressionType),
+            coldCheckpointThreshold);
+    }
+    return result;
 }
 
 std::unique_ptr<TableCatalogEntry> NodeTableCatalogEntry::copy() const {
     auto other = std::make_unique<NodeTableCatalogEntry>();
     other->primaryKeyName = primaryKeyName;
+    other->blockCompressionType = blockCompressionType;
+    other->coldCheckpointThreshold = coldCheckpointThreshold;
     other->copyFrom(*this);
     return other;
 }
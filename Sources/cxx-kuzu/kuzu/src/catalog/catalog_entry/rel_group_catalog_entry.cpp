@@ -98,6 +98,8 @@ void RelGroupCatalogEntry::serialize(Serializer& serializer) const {
     serializer.serializeValue(storageDirection);
     serializer.writeDebuggingInfo("relTableInfos");
     serializer.serializeVector(relTableInfos);
+    serializer.writeDebuggingInfo("sortedByNeighbor");
+    serializer.write(sortedByNeighbor);
 }
 
 std::unique_ptr<RelGroupCatalogEntry> RelGroupCatalogEntry::deserialize(
@@ -115,11 +117,15 @@ std::unique_ptr<RelGroupCatalogEntry> RelGroupCatalogEntry::deserialize(
     deserializer.deserializeValue(storageDirection);
     deserializer.validateDebuggingInfo(debuggingInfo, "relTableInfos");
     deserializer.deserializeVector(relTableInfos);
+    bool sortedByNeighbor = false;
+    deserializer.validateDebuggingInfo(debuggingInfo, "sortedByNeighbor");
+    deserializer.deserializeValue(sortedByNeighbor);
     auto relGroupEntry = std::make_unique<RelGroupCatalogEntry>();
     relGroupEntry->srcMultiplicity = srcMultiplicity;
     relGroupEntry->dstMultiplicity = dstMultiplicity;
     relGroupEntry->storageDirection = storageDirection;
     relGroupEntry->relTableInfos = relTableInfos;
+    relGroupEntry->sortedByNeighbor = sortedByNeighbor;
     return relGroupEntry;
 }
 
@@ -143,6 +149,9 @@ std::string RelGroupCatalogEntry::toCypher(const ToCypherInfo& info) const {
     }
     ss << ", " << propertyCollection.toCypher() << RelMultiplicityUtils::toString(srcMultiplicity)
        << "_" << RelMultiplicityUtils::toString(dstMultiplicity) << ");";
+    if (sortedByNeighbor) {
+        ss << stringFormat("\nCALL SET_REL_NEIGHBOR_ORDER('{}', true);", getName());
+    }
     return ss.str();
 }
 
@@ -169,6 +178,7 @@ std::unique_ptr<TableCatalogEntry> RelGroupCatalogEntry::copy() const {
     other->dstMultiplicity = dstMultiplicity;
     other->storageDirection = storageDirection;
     other->relTableInfos = relTableInfos;
+    other->sortedByNeighbor = sortedByNeighbor;
     other->copyFrom(*this);
     return other;
 }
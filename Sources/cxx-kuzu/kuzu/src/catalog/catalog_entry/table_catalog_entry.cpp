@@ -37,6 +37,15 @@ std::unique_ptr<TableCatalogEntry> TableCatalogEntry::alter(transaction_t timest
         auto& commentInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraCommentInfo>();
         newEntry->setComment(commentInfo.comment);
     } break;
+    case AlterType::SET_COMPRESSION: {
+        auto& compressionInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraSetCompressionInfo>();
+        newEntry->ptrCast<NodeTableCatalogEntry>()->setBlockCompression(compressionInfo.type,
+            compressionInfo.coldCheckpointThreshold);
+    } break;
+    case AlterType::SET_NEIGHBOR_ORDER: {
+        auto& orderInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraSetNeighborOrderInfo>();
+        newEntry->ptrCast<RelGroupCatalogEntry>()->setSortedByNeighbor(orderInfo.sortedByNeighbor);
+    } break;
     case AlterType::ADD_FROM_TO_CONNECTION: {
         auto& connectionInfo =
             *alterInfo.extraInfo->constPtrCast<BoundExtraAlterFromToConnection>();
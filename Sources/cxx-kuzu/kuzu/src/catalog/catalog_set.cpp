@@ -191,6 +191,8 @@ void CatalogSet::alterTableEntry(Transaction* transaction,
         }
     } break;
     case AlterType::COMMENT:
+    case AlterType::SET_COMPRESSION:
+    case AlterType::SET_NEIGHBOR_ORDER:
     case AlterType::ADD_PROPERTY:
     case AlterType::DROP_PROPERTY:
     case AlterType::RENAME_PROPERTY:
@@ -0,0 +1,40 @@
+#include "common/enums/block_compression_type.h"
+
+#include "common/assert.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+
+namespace kuzu {
+namespace common {
+
+BlockCompressionType BlockCompressionTypeUtils::fromString(const std::string& str) {
+    auto normalizedStr = StringUtils::getUpper(str);
+    if (normalizedStr == "NONE") {
+        return BlockCompressionType::NONE;
+    }
+    if (normalizedStr == "ZSTD") {
+        return BlockCompressionType::ZSTD;
+    }
+    if (normalizedStr == "LZ4") {
+        return BlockCompressionType::LZ4;
+    }
+    throw BinderException(stringFormat(
+        "Cannot parse {} as a compression codec. Supported inputs are [NONE, ZSTD, LZ4]", str));
+}
+
+std::string BlockCompressionTypeUtils::toString(BlockCompressionType type) {
+    switch (type) {
+    case BlockCompressionType::NONE:
+        return "NONE";
+    case BlockCompressionType::ZSTD:
+        return "ZSTD";
+    case BlockCompressionType::LZ4:
+        return "LZ4";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+} // namespace common
+} // namespace kuzu
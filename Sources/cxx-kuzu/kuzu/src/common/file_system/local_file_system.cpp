@@ -1,6 +1,7 @@
 #include "common/file_system/local_file_system.h"
 
 #include "common/assert.h"
+#include "common/constants.h"
 #include "common/exception/io.h"
 #include "common/string_format.h"
 #include "common/string_utils.h"
@@ -16,11 +17,13 @@
 #include <windows.h>
 #else
 #include "sys/stat.h"
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
 #include <fcntl.h>
 
+#include <cerrno>
 #include <cstring>
 
 #include "storage/storage_utils.h"
@@ -37,8 +40,72 @@ LocalFileInfo::~LocalFileInfo() {
     if (fd != -1) {
         close(fd);
     }
+    if (directIOFD != -1) {
+        close(directIOFD);
+    }
+    if (mappedData != nullptr) {
+        munmap(mappedData, mappedSize);
+    }
+#endif
+}
+
+bool LocalFileInfo::usesDirectIO() const {
+#ifdef _WIN32
+    return false;
+#else
+    return directIOFD != -1;
+#endif
+}
+
+const uint8_t* LocalFileInfo::mapForReading(uint64_t numBytes) {
+#ifdef _WIN32
+    KU_UNUSED(numBytes);
+    return nullptr;
+#else
+    KU_ASSERT(mappedData == nullptr);
+    if (numBytes == 0) {
+        return nullptr;
+    }
+    auto data = mmap(nullptr, numBytes, PROT_READ, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    mappedData = data;
+    mappedSize = numBytes;
+    return static_cast<const uint8_t*>(mappedData);
+#endif
+}
+
+#ifndef _WIN32
+int LocalFileInfo::getFD(const void* buffer, uint64_t numBytes, uint64_t position) const {
+    constexpr auto alignment = BufferPoolConstants::DIRECT_IO_ALIGNMENT;
+    if (directIOFD != -1 && reinterpret_cast<uintptr_t>(buffer) % alignment == 0 &&
+        numBytes % alignment == 0 && position % alignment == 0) {
+        return directIOFD;
+    }
+    return fd;
+}
+
+// Opens another descriptor of an already opened file that bypasses the page cache. Returns -1 if
+// the file system doesn't support it, e.g. O_DIRECT on tmpfs.
+static int openForDirectIO(const std::string& path, int openFlags) {
+    openFlags &= ~(O_CREAT | O_TRUNC);
+#if defined(__linux__)
+    return open(path.c_str(), openFlags | O_DIRECT);
+#elif defined(__APPLE__)
+    const int fd = open(path.c_str(), openFlags);
+    if (fd != -1 && fcntl(fd, F_NOCACHE, 1) == -1) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+#else
+    KU_UNUSED(path);
+    KU_UNUSED(openFlags);
+    return -1;
 #endif
 }
+#endif
 
 static void validateFileFlags(uint8_t flags) {
     const bool isRead = flags & FileFlags::READ_ONLY;
@@ -146,7 +213,9 @@ std::unique_ptr<FileInfo> LocalFileSystem::openFile(const std::string& path, Fil
                 "See the docs: https://docs.kuzudb.com/concurrency for more information.");
         }
     }
-    return std::make_unique<LocalFileInfo>(fullPath, fd, this);
+    const auto directIOFD =
+        fileFlags & FileFlags::DIRECT_IO ? openForDirectIO(fullPath, openFlags) : -1;
+    return std::make_unique<LocalFileInfo>(fullPath, fd, this, directIOFD);
 #endif
 }
 
@@ -377,7 +446,12 @@ void LocalFileSystem::readFromFile(FileInfo& fileInfo, void* buffer, uint64_t nu
             fileInfo.path, (intptr_t)localFileInfo->handle, numBytesRead, numBytes, position));
     }
 #else
-    auto numBytesRead = pread(localFileInfo->fd, buffer, numBytes, position);
+    const auto fd = localFileInfo->getFD(buffer, numBytes, position);
+    auto numBytesRead = pread(fd, buffer, numBytes, position);
+    if (numBytesRead == -1 && errno == EINVAL && fd != localFileInfo->fd) {
+        // Some file systems accept O_DIRECT when opening but reject the reads.
+        numBytesRead = pread(localFileInfo->fd, buffer, numBytes, position);
+    }
     if (static_cast<uint64_t>(numBytesRead) != numBytes &&
         localFileInfo->getFileSize() != position + numBytesRead) {
         // LCOV_EXCL_START
@@ -425,8 +499,12 @@ void LocalFileSystem::writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint6
                     numBytesWritten, error, std::system_category().message(error)));
         }
 #else
-        auto numBytesWritten =
-            pwrite(localFileInfo->fd, buffer + bufferOffset, numBytesToWrite, offset);
+        const auto fd = localFileInfo->getFD(buffer + bufferOffset, numBytesToWrite, offset);
+        auto numBytesWritten = pwrite(fd, buffer + bufferOffset, numBytesToWrite, offset);
+        if (numBytesWritten == -1 && errno == EINVAL && fd != localFileInfo->fd) {
+            numBytesWritten =
+                pwrite(localFileInfo->fd, buffer + bufferOffset, numBytesToWrite, offset);
+        }
         if (numBytesWritten != static_cast<int64_t>(numBytesToWrite)) {
             // LCOV_EXCL_START
             throw IOException(
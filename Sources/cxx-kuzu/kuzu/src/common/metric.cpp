@@ -1,5 +1,14 @@
 #include "common/metric.h"
 
+#ifdef __linux__
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace kuzu {
 namespace common {
 
@@ -51,5 +60,52 @@ void NumericMetric::incrementByOne() {
     accumulatedValue++;
 }
 
+#ifdef __linux__
+// Opens a counter of the data TLB misses of the calling thread on first use. The counter is closed
+// when the thread exits.
+struct TLBMissCounter {
+    int fd;
+
+    TLBMissCounter() {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0 /* pid */, -1 /* cpu */,
+            -1 /* groupFD */, 0 /* flags */));
+    }
+    ~TLBMissCounter() {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+
+    uint64_t read() const {
+        uint64_t value = 0;
+        if (fd < 0 || ::read(fd, &value, sizeof(value)) != sizeof(value)) {
+            return 0;
+        }
+        return value;
+    }
+};
+#endif
+
+ThreadMemoryCounters ThreadMemoryCounters::read() {
+    ThreadMemoryCounters counters;
+#ifdef __linux__
+    rusage usage{};
+    if (getrusage(RUSAGE_THREAD, &usage) == 0) {
+        counters.numPageFaults = usage.ru_minflt + usage.ru_majflt;
+    }
+    thread_local const TLBMissCounter tlbMissCounter;
+    counters.numTLBMisses = tlbMissCounter.read();
+#endif
+    return counters;
+}
+
 } // namespace common
 } // namespace kuzu
@@ -1,4 +1,6 @@
 #include "common/task_system/task_scheduler.h"
+
+#include "storage/buffer_manager/memory_tracker.h"
 #if defined(__APPLE__)
 #include <pthread.h>
 
@@ -52,7 +54,11 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         // numThreadsRegistered field of the task, tt does not keep track of the thread ids or
         // anything specific to the thread.
         task->registerThread();
-        newWorkerThread = std::thread(runTask, task.get());
+        newWorkerThread = std::thread(
+            [memoryTracker = storage::MemoryTracker::getCurrent(), taskPtr = task.get()]() {
+                storage::MemoryTracker::Scope memoryTrackerScope{memoryTracker};
+                runTask(taskPtr);
+            });
     }
     auto scheduledTask = pushTaskIntoQueue(task);
     cv.notify_all();
@@ -134,6 +140,7 @@ void TaskScheduler::runWorkerThread() {
             return;
         }
         try {
+            storage::MemoryTracker::Scope memoryTrackerScope{scheduledTask->memoryTracker};
             scheduledTask->task->run();
         } catch (std::exception& e) {
             exceptionPtr = std::current_exception();
@@ -168,7 +175,8 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
 
 std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
     lock_t lck{taskSchedulerMtx};
-    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
+    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++,
+        storage::MemoryTracker::getCurrent());
     taskQueue.push_back(scheduledTask);
     return scheduledTask;
 }
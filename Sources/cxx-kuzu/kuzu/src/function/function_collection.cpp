@@ -226,6 +226,7 @@ FunctionCollection* FunctionCollection::getFunctions() {
         TABLE_FUNCTION(StatsInfoFunction), TABLE_FUNCTION(StorageInfoFunction),
         TABLE_FUNCTION(ShowAttachedDatabasesFunction), TABLE_FUNCTION(ShowSequencesFunction),
         TABLE_FUNCTION(ShowFunctionsFunction), TABLE_FUNCTION(BMInfoFunction),
+        TABLE_FUNCTION(CheckpointInfoFunction), TABLE_FUNCTION(MMInfoFunction),
         TABLE_FUNCTION(FileInfoFunction), TABLE_FUNCTION(ShowLoadedExtensionsFunction),
         TABLE_FUNCTION(ShowOfficialExtensionsFunction), TABLE_FUNCTION(ShowIndexesFunction),
         TABLE_FUNCTION(ShowProjectedGraphsFunction), TABLE_FUNCTION(ProjectedGraphInfoFunction),
@@ -236,6 +237,11 @@ FunctionCollection* FunctionCollection::getFunctions() {
         STANDALONE_TABLE_FUNCTION(ProjectGraphNativeFunction),
         STANDALONE_TABLE_FUNCTION(ProjectGraphCypherFunction),
         STANDALONE_TABLE_FUNCTION(DropProjectedGraphFunction),
+        STANDALONE_TABLE_FUNCTION(CreateIndexFunction),
+        STANDALONE_TABLE_FUNCTION(DropIndexFunction),
+        STANDALONE_TABLE_FUNCTION(SetTableCompressionFunction),
+        STANDALONE_TABLE_FUNCTION(SetRelNeighborOrderFunction),
+        STANDALONE_TABLE_FUNCTION(CompactDatabaseFunction),
 
         // Scan functions
         TABLE_FUNCTION(ParquetScanFunction), TABLE_FUNCTION(NpyScanFunction),
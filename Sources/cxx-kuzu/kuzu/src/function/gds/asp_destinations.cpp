@@ -34,24 +34,18 @@ public:
 
     void increaseMultiplicity(offset_t offset, multiplicity_t multiplicity) override {
         KU_ASSERT(curData);
-        if (curData->contains(offset)) {
-            curData->at(offset) += multiplicity;
-        } else {
-            curData->insert({offset, multiplicity});
-        }
+        curData->getOrInsert(offset, 0) += multiplicity;
     }
 
     multiplicity_t getMultiplicity(offset_t offset) override {
         KU_ASSERT(curData);
-        if (curData->contains(offset)) {
-            return curData->at(offset);
-        }
-        return 0;
+        const auto multiplicity = curData->find(offset);
+        return multiplicity == nullptr ? 0 : *multiplicity;
     }
 
 private:
     GDSSpareObjectManager<multiplicity_t>& spareObjects;
-    std::unordered_map<offset_t, multiplicity_t>* curData = nullptr;
+    SparseNodeMap<multiplicity_t>* curData = nullptr;
 };
 
 class DenseMultiplicitiesReference final : public Multiplicities {
@@ -154,13 +154,9 @@ void SparseBFSGraph::addParent(uint16_t iter, nodeID_t boundNodeID, relID_t edge
     nodeID_t nbrNodeID, bool fwdEdge, ObjectBlock<ParentList>* block) {
     auto parent = reserveParent(boundNodeID, edgeID, fwdEdge, block);
     parent->setIter(iter);
-    if (curData->contains(nbrNodeID.offset)) {
-        parent->setNextPtr(curData->at(nbrNodeID.offset));
-        curData->at(nbrNodeID.offset) = parent;
-    } else {
-        parent->setNextPtr(nullptr);
-        curData->insert({nbrNodeID.offset, parent});
-    }
+    auto& head = curData->getOrInsert(nbrNodeID.offset, nullptr);
+    parent->setNextPtr(head);
+    head = parent;
 }
 
 void SparseBFSGraph::addSingleParent(uint16_t iter, nodeID_t boundNodeID, relID_t edgeID,
@@ -171,7 +167,7 @@ void SparseBFSGraph::addSingleParent(uint16_t iter, nodeID_t boundNodeID, relID_
     auto parent = reserveParent(boundNodeID, edgeID, fwdEdge, block);
     parent->setIter(iter);
     parent->setNextPtr(nullptr);
-    curData->insert({nbrNodeID.offset, parent});
+    curData->set(nbrNodeID.offset, parent);
 }
 
 bool SparseBFSGraph::tryAddParentWithWeight(nodeID_t boundNodeID, relID_t edgeID,
@@ -183,8 +179,7 @@ bool SparseBFSGraph::tryAddParentWithWeight(nodeID_t boundNodeID, relID_t edgeID
         auto parent = reserveParent(boundNodeID, edgeID, fwdEdge, block);
         parent->setCost(newCost);
         parent->setNextPtr(nullptr);
-        curData->erase(nbrNodeID.offset);
-        curData->insert({nbrNodeID.offset, parent});
+        curData->set(nbrNodeID.offset, parent);
         return true;
     }
     // Append parent if newCost is the same as old cost. And the newCost comes from a different edge
@@ -193,13 +188,9 @@ bool SparseBFSGraph::tryAddParentWithWeight(nodeID_t boundNodeID, relID_t edgeID
     if (newCost == nbrCost && nbrParent->getEdgeID() != edgeID) {
         auto parent = reserveParent(boundNodeID, edgeID, fwdEdge, block);
         parent->setCost(newCost);
-        if (curData->contains(nbrNodeID.offset)) {
-            parent->setNextPtr(curData->at(nbrNodeID.offset));
-            curData->erase(nbrNodeID.offset);
-        } else {
-            parent->setNextPtr(nullptr);
-        }
-        curData->insert({nbrNodeID.offset, parent});
+        auto& head = curData->getOrInsert(nbrNodeID.offset, nullptr);
+        parent->setNextPtr(head);
+        head = parent;
         return true;
     }
     return false;
@@ -213,8 +204,7 @@ bool SparseBFSGraph::tryAddSingleParentWithWeight(nodeID_t boundNodeID, relID_t
         auto parent = reserveParent(boundNodeID, edgeID, fwdEdge, block);
         parent->setCost(newCost);
         parent->setNextPtr(nullptr);
-        curData->erase(nbrNodeID.offset);
-        curData->insert({nbrNodeID.offset, parent});
+        curData->set(nbrNodeID.offset, parent);
         return true;
     }
     if (newCost == nbrCost) {
@@ -224,30 +214,25 @@ bool SparseBFSGraph::tryAddSingleParentWithWeight(nodeID_t boundNodeID, relID_t
         auto parent = reserveParent(boundNodeID, edgeID, fwdEdge, block);
         parent->setCost(newCost);
         parent->setNextPtr(nullptr);
-        curData->insert({nbrNodeID.offset, parent});
+        curData->set(nbrNodeID.offset, parent);
     }
     return false;
 }
 
 ParentList* SparseBFSGraph::getParentListHead(offset_t offset) {
     KU_ASSERT(curData);
-    if (!curData->contains(offset)) {
-        return nullptr;
-    }
-    return curData->at(offset);
+    const auto head = curData->find(offset);
+    return head == nullptr ? nullptr : *head;
 }
 
 ParentList* SparseBFSGraph::getParentListHead(nodeID_t nodeID) {
-    auto data = sparseObjects.getData(nodeID.tableID);
-    if (!data->contains(nodeID.offset)) {
-        return nullptr;
-    }
-    return data->at(nodeID.offset);
+    const auto head = sparseObjects.getData(nodeID.tableID)->find(nodeID.offset);
+    return head == nullptr ? nullptr : *head;
 }
 
 void SparseBFSGraph::setParentList(offset_t offset, ParentList* parentList) {
     KU_ASSERT(!curData->contains(offset));
-    curData->insert({offset, parentList});
+    curData->set(offset, parentList);
 }
 
 BFSGraphManager::BFSGraphManager(table_id_map_t<offset_t> maxOffsetMap,
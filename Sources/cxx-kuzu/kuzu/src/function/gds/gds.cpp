@@ -140,6 +140,22 @@ NativeGraphEntry GDSFunction::bindGraphEntry(ClientContext& context,
     return result;
 }
 
+std::vector<NativeGraphEntryTableInfo> GDSFunction::bindInputNodeInfos(ClientContext& context,
+    const std::string& graphName, const std::string& predicate) {
+    auto& set = context.getGraphEntrySetUnsafe();
+    set.validateGraphExist(graphName);
+    auto& entry = set.getEntry(graphName)->cast<ParsedNativeGraphEntry>();
+    std::vector<NativeGraphEntryTableInfo> result;
+    for (auto& nodeInfo : entry.nodeInfos) {
+        auto nodePredicate = predicate;
+        if (!nodeInfo.predicate.empty()) {
+            nodePredicate = stringFormat("({}) AND ({})", nodeInfo.predicate, predicate);
+        }
+        result.push_back(bindNodeEntry(context, nodeInfo.tableName, nodePredicate));
+    }
+    return result;
+}
+
 std::shared_ptr<Expression> GDSFunction::bindNodeOutput(const TableFuncBindInput& bindInput,
     const std::vector<TableCatalogEntry*>& nodeEntries) {
     std::string nodeColumnName = NODE_COLUMN_NAME;
@@ -171,19 +187,27 @@ std::unique_ptr<TableFuncSharedState> GDSFunction::initSharedState(
     return std::make_unique<GDSFuncSharedState>(bindData->getResultTable(), std::move(graph));
 }
 
-std::vector<std::shared_ptr<LogicalOperator>> getNodeMaskPlanRoots(const GDSBindData& bindData,
-    Planner* planner) {
-    std::vector<std::shared_ptr<LogicalOperator>> nodeMaskPlanRoots;
-    for (auto& nodeInfo : bindData.graphEntry.nodeInfos) {
+static void appendNodeMaskPlanRoots(const std::vector<NativeGraphEntryTableInfo>& nodeInfos,
+    SemiMaskTargetType targetType, Planner* planner,
+    std::vector<std::shared_ptr<LogicalOperator>>& nodeMaskPlanRoots) {
+    for (auto& nodeInfo : nodeInfos) {
         if (nodeInfo.predicate == nullptr) {
             continue;
         }
         auto& node = nodeInfo.nodeOrRel->constCast<NodeExpression>();
         planner->getCardinliatyEstimatorUnsafe().init(node);
-        auto p = planner->getNodeSemiMaskPlan(SemiMaskTargetType::GDS_GRAPH_NODE, node,
-            nodeInfo.predicate);
+        auto p = planner->getNodeSemiMaskPlan(targetType, node, nodeInfo.predicate);
         nodeMaskPlanRoots.push_back(p.getLastOperator());
     }
+}
+
+std::vector<std::shared_ptr<LogicalOperator>> getNodeMaskPlanRoots(const GDSBindData& bindData,
+    Planner* planner) {
+    std::vector<std::shared_ptr<LogicalOperator>> nodeMaskPlanRoots;
+    appendNodeMaskPlanRoots(bindData.graphEntry.nodeInfos, SemiMaskTargetType::GDS_GRAPH_NODE,
+        planner, nodeMaskPlanRoots);
+    appendNodeMaskPlanRoots(bindData.inputNodeInfos, SemiMaskTargetType::GDS_INPUT_NODE, planner,
+        nodeMaskPlanRoots);
     return nodeMaskPlanRoots;
 };
 
@@ -231,8 +255,6 @@ std::unique_ptr<PhysicalOperator> GDSFunction::getPhysicalPlan(PlanMapper* planM
         planMapper->getOperatorID(), std::move(printInfo));
     if (logicalCall->getNumChildren() > 0u) {
         const auto funcSharedState = sharedState->ptrCast<GDSFuncSharedState>();
-        funcSharedState->setGraphNodeMask(std::make_unique<NodeOffsetMaskMap>());
-        auto maskMap = funcSharedState->getGraphNodeMaskMap();
         planMapper->addOperatorMapping(logicalOp, call.get());
         for (auto logicalRoot : logicalCall->getChildren()) {
             KU_ASSERT(logicalRoot->getNumChildren() == 1);
@@ -240,6 +262,23 @@ std::unique_ptr<PhysicalOperator> GDSFunction::getPhysicalPlan(PlanMapper* planM
             KU_ASSERT(child->getOperatorType() == LogicalOperatorType::SEMI_MASKER);
             auto logicalSemiMasker = child->ptrCast<LogicalSemiMasker>();
             logicalSemiMasker->addTarget(logicalOp);
+            NodeOffsetMaskMap* maskMap = nullptr;
+            switch (logicalSemiMasker->getTargetType()) {
+            case SemiMaskTargetType::GDS_GRAPH_NODE: {
+                if (funcSharedState->getGraphNodeMaskMap() == nullptr) {
+                    funcSharedState->setGraphNodeMask(std::make_unique<NodeOffsetMaskMap>());
+                }
+                maskMap = funcSharedState->getGraphNodeMaskMap();
+            } break;
+            case SemiMaskTargetType::GDS_INPUT_NODE: {
+                if (funcSharedState->getInputNodeMaskMap() == nullptr) {
+                    funcSharedState->setInputNodeMask(std::make_unique<NodeOffsetMaskMap>());
+                }
+                maskMap = funcSharedState->getInputNodeMaskMap();
+            } break;
+            default:
+                KU_UNREACHABLE;
+            }
             for (auto tableID : logicalSemiMasker->getNodeTableIDs()) {
                 maskMap->addMask(tableID, planMapper->createSemiMask(tableID));
             }
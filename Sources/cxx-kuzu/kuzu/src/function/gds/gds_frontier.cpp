@@ -21,11 +21,7 @@ void SparseFrontier::addNode(nodeID_t nodeID, iteration_t iter) {
 
 void SparseFrontier::addNode(offset_t offset, iteration_t iter) {
     KU_ASSERT(curData);
-    if (!curData->contains(offset)) {
-        curData->insert({offset, iter});
-    } else {
-        curData->at(offset) = iter;
-    }
+    curData->set(offset, iter);
 }
 
 void SparseFrontier::addNodes(const std::vector<nodeID_t>& nodeIDs, iteration_t iter) {
@@ -37,10 +33,8 @@ void SparseFrontier::addNodes(const std::vector<nodeID_t>& nodeIDs, iteration_t
 
 iteration_t SparseFrontier::getIteration(offset_t offset) const {
     KU_ASSERT(curData);
-    if (!curData->contains(offset)) {
-        return FRONTIER_UNVISITED;
-    }
-    return curData->at(offset);
+    const auto iter = curData->find(offset);
+    return iter == nullptr ? FRONTIER_UNVISITED : *iter;
 }
 
 void SparseFrontierReference::pinTableID(table_id_t tableID) {
@@ -49,11 +43,7 @@ void SparseFrontierReference::pinTableID(table_id_t tableID) {
 
 void SparseFrontierReference::addNode(offset_t offset, iteration_t iter) {
     KU_ASSERT(curData);
-    if (!curData->contains(offset)) {
-        curData->insert({offset, iter});
-    } else {
-        curData->at(offset) = iter;
-    }
+    curData->set(offset, iter);
 }
 
 void SparseFrontierReference::addNode(nodeID_t nodeID, iteration_t iter) {
@@ -70,10 +60,8 @@ void SparseFrontierReference::addNodes(const std::vector<nodeID_t>& nodeIDs, ite
 
 iteration_t SparseFrontierReference::getIteration(offset_t offset) const {
     KU_ASSERT(curData);
-    if (!curData->contains(offset)) {
-        return FRONTIER_UNVISITED;
-    }
-    return curData->at(offset);
+    const auto iter = curData->find(offset);
+    return iter == nullptr ? FRONTIER_UNVISITED : *iter;
 }
 
 class DenseFrontierInitVertexCompute : public VertexCompute {
@@ -308,14 +296,14 @@ offset_t SPFrontierPair::getNumActiveNodesInCurrentFrontier(NodeOffsetMaskMap& m
     return result;
 }
 
-std::unordered_set<offset_t> SPFrontierPair::getActiveNodesOnCurrentFrontier() {
+std::vector<offset_t> SPFrontierPair::getActiveNodesOnCurrentFrontier() {
     KU_ASSERT(state == GDSDensityState::SPARSE);
-    std::unordered_set<offset_t> result;
+    std::vector<offset_t> result;
     for (auto& [offset, iter] : curSparseFrontier->getCurrentData()) {
         if (iter != curIter - 1) {
             continue;
         }
-        result.insert(offset);
+        result.push_back(offset);
     }
     return result;
 }
@@ -361,14 +349,14 @@ void DenseSparseDynamicFrontierPair::beginNewIterationInternalNoLock() {
     }
 }
 
-std::unordered_set<offset_t> DenseSparseDynamicFrontierPair::getActiveNodesOnCurrentFrontier() {
+std::vector<offset_t> DenseSparseDynamicFrontierPair::getActiveNodesOnCurrentFrontier() {
     KU_ASSERT(state == GDSDensityState::SPARSE);
-    std::unordered_set<offset_t> result;
+    std::vector<offset_t> result;
     for (auto& [offset, iter] : *curSparseFrontier->curData) {
         if (iter != curIter - 1) {
             continue;
         }
-        result.insert(offset);
+        result.push_back(offset);
     }
     return result;
 }
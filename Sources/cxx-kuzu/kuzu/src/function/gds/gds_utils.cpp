@@ -100,22 +100,28 @@ void GDSUtils::runFTSEdgeCompute(ExecutionContext* context, GDSComputeState& com
     runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
 }
 
-void GDSUtils::runRecursiveJoinEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
-    Graph* graph, ExtendDirection extendDirection, uint64_t maxIteration,
-    NodeOffsetMaskMap* outputNodeMask, const std::vector<std::string>& propertiesToScan) {
+uint64_t GDSUtils::runRecursiveJoinEdgeCompute(ExecutionContext* context,
+    GDSComputeState& compState, Graph* graph, ExtendDirection extendDirection,
+    uint64_t maxIteration, NodeOffsetMaskMap* outputNodeMask,
+    const std::vector<std::string>& propertiesToScan) {
     auto frontierPair = compState.frontierPair.get();
     compState.edgeCompute->resetSingleThreadState();
+    uint64_t numSparseIterations = 0;
     while (frontierPair->continueNextIter(maxIteration)) {
         frontierPair->beginNewIteration();
         if (outputNodeMask != nullptr && compState.edgeCompute->terminate(*outputNodeMask)) {
             break;
         }
+        if (frontierPair->getState() == GDSDensityState::SPARSE) {
+            numSparseIterations++;
+        }
         runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
         if (frontierPair->needSwitchToDense(
                 context->clientContext->getClientConfig()->sparseFrontierThreshold)) {
             compState.switchToDense(context, graph);
         }
     }
+    return numSparseIterations;
 }
 
 static void runVertexComputeInternal(const TableCatalogEntry* currentEntry,
@@ -33,11 +33,7 @@ public:
 
     void setCost(offset_t offset, double cost) override {
         KU_ASSERT(curData != nullptr);
-        if (curData->contains(offset)) {
-            curData->at(offset) = cost;
-        } else {
-            curData->insert({offset, cost});
-        }
+        curData->set(offset, cost);
     }
 
     bool tryReplaceWithMinCost(offset_t offset, double newCost) override {
@@ -51,14 +47,12 @@ public:
 
     double getCost(offset_t offset) override {
         KU_ASSERT(curData != nullptr);
-        if (curData->contains(offset)) {
-            return curData->at(offset);
-        }
-        return std::numeric_limits<double>::max();
+        const auto cost = curData->find(offset);
+        return cost == nullptr ? std::numeric_limits<double>::max() : *cost;
     }
 
 private:
-    std::unordered_map<offset_t, double>* curData = nullptr;
+    SparseNodeMap<double>* curData = nullptr;
     GDSSpareObjectManager<double>& sparseObjects;
 };
 
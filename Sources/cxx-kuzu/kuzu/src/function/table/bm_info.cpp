@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "binder/binder.h"
 #include "function/table/bind_data.h"
 #include "function/table/simple_table_function.h"
@@ -9,39 +11,98 @@
 namespace kuzu {
 namespace function {
 
+struct BMFileInfo {
+    std::string path;
+    uint64_t numPageHits;
+    uint64_t numPageMisses;
+    bool usesDirectIO;
+    bool isMemoryMapped;
+};
+
+// Outputs one row per file cached by the buffer manager. The buffer pool wide columns are repeated
+// on every row. If no file is cached, e.g. in in-memory mode, a single row with null file columns
+// is output.
 struct BMInfoBindData final : TableFuncBindData {
     uint64_t memLimit;
     uint64_t memUsage;
+    uint64_t numPrefetchedPages;
+    uint64_t numPrefetchHits;
+    uint64_t numWarmedPages;
+    std::vector<BMFileInfo> files;
 
-    BMInfoBindData(uint64_t memLimit, uint64_t memUsage, binder::expression_vector columns)
-        : TableFuncBindData{std::move(columns), 1}, memLimit{memLimit}, memUsage{memUsage} {}
+    BMInfoBindData(uint64_t memLimit, uint64_t memUsage, uint64_t numPrefetchedPages,
+        uint64_t numPrefetchHits, uint64_t numWarmedPages, std::vector<BMFileInfo> files,
+        binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), std::max<uint64_t>(files.size(), 1)},
+          memLimit{memLimit},
+          memUsage{memUsage}, numPrefetchedPages{numPrefetchedPages},
+          numPrefetchHits{numPrefetchHits}, numWarmedPages{numWarmedPages},
+          files{std::move(files)} {}
 
     std::unique_ptr<TableFuncBindData> copy() const override {
-        return std::make_unique<BMInfoBindData>(memLimit, memUsage, columns);
+        return std::make_unique<BMInfoBindData>(memLimit, memUsage, numPrefetchedPages,
+            numPrefetchHits, numWarmedPages, files, columns);
     }
 };
 
-static common::offset_t internalTableFunc(const TableFuncMorsel& /*morsel*/,
+static common::offset_t internalTableFunc(const TableFuncMorsel& morsel,
     const TableFuncInput& input, common::DataChunk& output) {
-    KU_ASSERT(output.getNumValueVectors() == 2);
+    KU_ASSERT(output.getNumValueVectors() == 10);
     auto bmInfoBindData = input.bindData->constPtrCast<BMInfoBindData>();
-    output.getValueVectorMutable(0).setValue<uint64_t>(0, bmInfoBindData->memLimit);
-    output.getValueVectorMutable(1).setValue<uint64_t>(0, bmInfoBindData->memUsage);
-    return 1;
+    const auto numRowsToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numRowsToOutput; i++) {
+        output.getValueVectorMutable(0).setValue<uint64_t>(i, bmInfoBindData->memLimit);
+        output.getValueVectorMutable(1).setValue<uint64_t>(i, bmInfoBindData->memUsage);
+        output.getValueVectorMutable(2).setValue<uint64_t>(i, bmInfoBindData->numPrefetchedPages);
+        output.getValueVectorMutable(3).setValue<uint64_t>(i, bmInfoBindData->numPrefetchHits);
+        output.getValueVectorMutable(4).setValue<uint64_t>(i, bmInfoBindData->numWarmedPages);
+        if (bmInfoBindData->files.empty()) {
+            for (auto col = 5u; col < output.getNumValueVectors(); col++) {
+                output.getValueVectorMutable(col).setNull(i, true);
+            }
+            continue;
+        }
+        const auto& file = bmInfoBindData->files[morsel.startOffset + i];
+        output.getValueVectorMutable(5).setValue(i, file.path);
+        output.getValueVectorMutable(6).setValue<uint64_t>(i, file.numPageHits);
+        output.getValueVectorMutable(7).setValue<uint64_t>(i, file.numPageMisses);
+        output.getValueVectorMutable(8).setValue(i, file.usesDirectIO);
+        output.getValueVectorMutable(9).setValue(i, file.isMemoryMapped);
+    }
+    return numRowsToOutput;
 }
 
 static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
     const TableFuncBindInput* input) {
-    auto memLimit = context->getMemoryManager()->getBufferManager()->getMemoryLimit();
-    auto memUsage = context->getMemoryManager()->getBufferManager()->getUsedMemory();
+    const auto bm = context->getMemoryManager()->getBufferManager();
+    std::vector<BMFileInfo> files;
+    for (const auto fileHandle : bm->getFileHandles()) {
+        // Files in in-memory mode are read without going through the buffer pool.
+        if (fileHandle->isInMemoryMode() || fileHandle->getFileInfo() == nullptr) {
+            continue;
+        }
+        files.push_back(BMFileInfo{fileHandle->getFileInfo()->path, fileHandle->getNumPageHits(),
+            fileHandle->getNumPageMisses(), fileHandle->usesDirectIO(),
+            fileHandle->isMemoryMapped()});
+    }
     std::vector<common::LogicalType> returnTypes;
+    for (auto i = 0u; i < 5; i++) {
+        returnTypes.emplace_back(common::LogicalType::UINT64());
+    }
+    returnTypes.emplace_back(common::LogicalType::STRING());
     returnTypes.emplace_back(common::LogicalType::UINT64());
     returnTypes.emplace_back(common::LogicalType::UINT64());
-    auto returnColumnNames = std::vector<std::string>{"mem_limit", "mem_usage"};
+    returnTypes.emplace_back(common::LogicalType::BOOL());
+    returnTypes.emplace_back(common::LogicalType::BOOL());
+    auto returnColumnNames = std::vector<std::string>{"mem_limit", "mem_usage", "prefetched_pages",
+        "prefetch_hits", "warmed_pages", "file_path", "page_hits", "page_misses", "direct_io",
+        "memory_mapped"};
     returnColumnNames =
         TableFunction::extractYieldVariables(returnColumnNames, input->yieldVariables);
     auto columns = input->binder->createVariables(returnColumnNames, returnTypes);
-    return std::make_unique<BMInfoBindData>(memLimit, memUsage, columns);
+    return std::make_unique<BMInfoBindData>(bm->getMemoryLimit(), bm->getUsedMemory(),
+        bm->getNumPrefetchedPages(), bm->getNumPrefetchHits(), bm->getNumWarmedPages(),
+        std::move(files), columns);
 }
 
 function_set BMInfoFunction::getFunctionSet() {
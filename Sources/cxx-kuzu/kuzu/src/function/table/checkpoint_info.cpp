@@ -0,0 +1,59 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "storage/storage_manager.h"
+
+namespace kuzu {
+namespace function {
+
+struct CheckpointInfoBindData final : TableFuncBindData {
+    std::vector<storage::CheckpointPhaseTime> phaseTimes;
+
+    CheckpointInfoBindData(std::vector<storage::CheckpointPhaseTime> phaseTimes,
+        binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), phaseTimes.size()},
+          phaseTimes{std::move(phaseTimes)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CheckpointInfoBindData>(phaseTimes, columns);
+    }
+};
+
+static common::offset_t internalTableFunc(const TableFuncMorsel& morsel,
+    const TableFuncInput& input, common::DataChunk& output) {
+    const auto& phaseTimes = input.bindData->constPtrCast<CheckpointInfoBindData>()->phaseTimes;
+    const auto numPhasesToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numPhasesToOutput; i++) {
+        const auto& phaseTime = phaseTimes[morsel.startOffset + i];
+        output.getValueVectorMutable(0).setValue(i, phaseTime.phase);
+        output.getValueVectorMutable(1).setValue(i, phaseTime.durationInMS);
+    }
+    return numPhasesToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    std::vector<std::string> columnNames = {"phase", "duration_ms"};
+    std::vector<common::LogicalType> columnTypes;
+    columnTypes.push_back(common::LogicalType::STRING());
+    columnTypes.push_back(common::LogicalType::DOUBLE());
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    return std::make_unique<CheckpointInfoBindData>(
+        context->getStorageManager()->getLastCheckpointPhaseTimes(), columns);
+}
+
+function_set CheckpointInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<common::LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,46 @@
+#include "common/exception/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/standalone_call_function.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "transaction/transaction.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    clientContext->getStorageManager()->requestCompaction();
+    // Data is only moved by checkpointing, so we checkpoint right after the request.
+    clientContext->getTransaction()->setForceCheckpoint();
+    return 0;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput*) {
+    if (!context->getTransactionContext()->isAutoTransaction()) {
+        throw BinderException{stringFormat("{} is only supported in auto transaction mode.",
+            CompactDatabaseFunction::name)};
+    }
+    return std::make_unique<TableFuncBindData>(0);
+}
+
+function_set CompactDatabaseFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector<LogicalTypeID>{});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
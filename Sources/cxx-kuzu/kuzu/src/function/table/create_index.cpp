@@ -0,0 +1,105 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/index/ordered_index.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct CreateIndexBindData final : TableFuncBindData {
+    catalog::TableCatalogEntry* tableEntry;
+    std::string indexName;
+    property_id_t propertyID;
+
+    CreateIndexBindData(catalog::TableCatalogEntry* tableEntry, std::string indexName,
+        property_id_t propertyID)
+        : TableFuncBindData{0}, tableEntry{tableEntry}, indexName{std::move(indexName)},
+          propertyID{propertyID} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CreateIndexBindData>(tableEntry, indexName, propertyID);
+    }
+};
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = ku_dynamic_cast<CreateIndexBindData*>(input.bindData);
+    auto clientContext = input.context->clientContext;
+    auto transaction = clientContext->getTransaction();
+    const auto tableID = bindData->tableEntry->getTableID();
+    const auto columnID = bindData->tableEntry->getColumnID(bindData->propertyID);
+    auto& nodeTable =
+        clientContext->getStorageManager()->getTable(tableID)->cast<storage::NodeTable>();
+    const auto indexType = storage::OrderedIndex::getIndexType();
+    storage::IndexInfo indexInfo{bindData->indexName, indexType.typeName, tableID, {columnID},
+        {nodeTable.getColumn(columnID).getDataType().getPhysicalType()},
+        indexType.constraintType == storage::IndexConstraintType::PRIMARY,
+        indexType.definitionType == storage::IndexDefinitionType::BUILTIN};
+    auto index = storage::OrderedIndex::createNewIndex(clientContext->getMemoryManager(),
+        std::move(indexInfo));
+    index->build(clientContext, nodeTable);
+    auto indexEntry = std::make_unique<catalog::IndexCatalogEntry>(indexType.typeName, tableID,
+        bindData->indexName, std::vector{bindData->propertyID},
+        std::make_unique<catalog::OrderedIndexAuxInfo>());
+    clientContext->getCatalog()->createIndex(transaction, std::move(indexEntry));
+    nodeTable.addIndex(std::move(index));
+    // The index is only persisted by checkpointing, so we checkpoint right after creating it.
+    transaction->setForceCheckpoint();
+    return 0;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    if (!context->getTransactionContext()->isAutoTransaction()) {
+        throw BinderException{stringFormat("{} is only supported in auto transaction mode.",
+            CreateIndexFunction::name)};
+    }
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    auto indexName = input->getLiteralVal<std::string>(1);
+    const auto propertyName = input->getLiteralVal<std::string>(2);
+    binder::Binder::validateTableExistence(*context, tableName);
+    const auto tableEntry =
+        context->getCatalog()->getTableCatalogEntry(context->getTransaction(), tableName);
+    binder::Binder::validateNodeTableType(tableEntry);
+    binder::Binder::validateColumnExistence(tableEntry, propertyName);
+    if (context->getCatalog()->containsIndex(context->getTransaction(), tableEntry->getTableID(),
+            indexName)) {
+        throw BinderException{stringFormat("Index {} already exists in table {}.", indexName,
+            tableEntry->getName())};
+    }
+    const auto& property = tableEntry->getProperty(propertyName);
+    if (!storage::OrderedIndex::isKeyTypeSupported(property.getType().getPhysicalType())) {
+        throw BinderException{stringFormat("Cannot create an index on property {} of type {}.",
+            propertyName, property.getType().toString())};
+    }
+    return std::make_unique<CreateIndexBindData>(tableEntry, std::move(indexName),
+        tableEntry->getPropertyID(propertyName));
+}
+
+function_set CreateIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,84 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/index/ordered_index.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct DropIndexBindData final : TableFuncBindData {
+    table_id_t tableID;
+    std::string indexName;
+
+    DropIndexBindData(table_id_t tableID, std::string indexName)
+        : TableFuncBindData{0}, tableID{tableID}, indexName{std::move(indexName)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<DropIndexBindData>(tableID, indexName);
+    }
+};
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = ku_dynamic_cast<DropIndexBindData*>(input.bindData);
+    auto clientContext = input.context->clientContext;
+    clientContext->getCatalog()->dropIndex(clientContext->getTransaction(), bindData->tableID,
+        bindData->indexName);
+    clientContext->getStorageManager()
+        ->getTable(bindData->tableID)
+        ->cast<storage::NodeTable>()
+        .dropIndex(bindData->indexName);
+    return 0;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    if (!context->getTransactionContext()->isAutoTransaction()) {
+        throw BinderException{stringFormat("{} is only supported in auto transaction mode.",
+            DropIndexFunction::name)};
+    }
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    auto indexName = input->getLiteralVal<std::string>(1);
+    binder::Binder::validateTableExistence(*context, tableName);
+    const auto catalog = context->getCatalog();
+    const auto tableEntry = catalog->getTableCatalogEntry(context->getTransaction(), tableName);
+    binder::Binder::validateNodeTableType(tableEntry);
+    if (!catalog->containsIndex(context->getTransaction(), tableEntry->getTableID(), indexName)) {
+        throw BinderException{stringFormat("Table {} doesn't have an index with name {}.",
+            tableEntry->getName(), indexName)};
+    }
+    const auto indexEntry =
+        catalog->getIndex(context->getTransaction(), tableEntry->getTableID(), indexName);
+    if (indexEntry->getIndexType() != storage::OrderedIndex::TYPE_NAME) {
+        throw BinderException{stringFormat("Index {} of type {} cannot be dropped with {}.",
+            indexName, indexEntry->getIndexType(), DropIndexFunction::name)};
+    }
+    return std::make_unique<DropIndexBindData>(tableEntry->getTableID(), std::move(indexName));
+}
+
+function_set DropIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
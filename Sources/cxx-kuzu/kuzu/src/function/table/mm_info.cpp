@@ -0,0 +1,70 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+namespace kuzu {
+namespace function {
+
+struct MMMetric {
+    std::string name;
+    uint64_t value;
+};
+
+struct MMInfoBindData final : TableFuncBindData {
+    std::vector<MMMetric> metrics;
+
+    MMInfoBindData(std::vector<MMMetric> metrics, binder::expression_vector columns)
+        : TableFuncBindData{std::move(columns), metrics.size()}, metrics{std::move(metrics)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<MMInfoBindData>(metrics, columns);
+    }
+};
+
+static common::offset_t internalTableFunc(const TableFuncMorsel& morsel,
+    const TableFuncInput& input, common::DataChunk& output) {
+    const auto& metrics = input.bindData->constPtrCast<MMInfoBindData>()->metrics;
+    const auto numMetricsToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numMetricsToOutput; i++) {
+        const auto& metric = metrics[morsel.startOffset + i];
+        output.getValueVectorMutable(0).setValue(i, metric.name);
+        output.getValueVectorMutable(1).setValue<uint64_t>(i, metric.value);
+    }
+    return numMetricsToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto stats = context->getMemoryManager()->getStats();
+    std::vector<MMMetric> metrics;
+    metrics.push_back(MMMetric{"page_allocations", stats.numPageAllocations});
+    metrics.push_back(MMMetric{"page_cache_hits", stats.numPageCacheHits});
+    metrics.push_back(MMMetric{"global_pool_refills", stats.numGlobalPoolRefills});
+    metrics.push_back(MMMetric{"global_pool_returns", stats.numGlobalPoolReturns});
+    metrics.push_back(MMMetric{"small_allocations", stats.numSmallAllocations});
+    metrics.push_back(MMMetric{"small_allocation_cache_hits", stats.numSmallAllocationCacheHits});
+    metrics.push_back(MMMetric{"lock_contentions", stats.numLockContentions});
+    std::vector<std::string> columnNames = {"metric", "value"};
+    std::vector<common::LogicalType> columnTypes;
+    columnTypes.push_back(common::LogicalType::STRING());
+    columnTypes.push_back(common::LogicalType::UINT64());
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    return std::make_unique<MMInfoBindData>(std::move(metrics), columns);
+}
+
+function_set MMInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<common::LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
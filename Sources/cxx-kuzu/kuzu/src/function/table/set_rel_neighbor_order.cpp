@@ -0,0 +1,74 @@
+#include "binder/binder.h"
+#include "binder/ddl/bound_alter_info.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct SetRelNeighborOrderBindData final : TableFuncBindData {
+    std::string tableName;
+    bool sortedByNeighbor;
+
+    SetRelNeighborOrderBindData(std::string tableName, bool sortedByNeighbor)
+        : TableFuncBindData{0}, tableName{std::move(tableName)},
+          sortedByNeighbor{sortedByNeighbor} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<SetRelNeighborOrderBindData>(tableName, sortedByNeighbor);
+    }
+};
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = ku_dynamic_cast<SetRelNeighborOrderBindData*>(input.bindData);
+    auto clientContext = input.context->clientContext;
+    auto extraInfo =
+        std::make_unique<binder::BoundExtraSetNeighborOrderInfo>(bindData->sortedByNeighbor);
+    const binder::BoundAlterInfo alterInfo{AlterType::SET_NEIGHBOR_ORDER, bindData->tableName,
+        std::move(extraInfo)};
+    clientContext->getCatalog()->alterTableEntry(clientContext->getTransaction(), alterInfo);
+    return 0;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    if (!context->getTransactionContext()->isAutoTransaction()) {
+        throw BinderException{stringFormat("{} is only supported in auto transaction mode.",
+            SetRelNeighborOrderFunction::name)};
+    }
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    const auto sortedByNeighbor = input->getLiteralVal<bool>(1);
+    binder::Binder::validateTableExistence(*context, tableName);
+    const auto tableEntry =
+        context->getCatalog()->getTableCatalogEntry(context->getTransaction(), tableName);
+    if (tableEntry->getType() != catalog::CatalogEntryType::REL_GROUP_ENTRY) {
+        throw BinderException(stringFormat("{} is not of type REL.", tableEntry->getName()));
+    }
+    return std::make_unique<SetRelNeighborOrderBindData>(tableEntry->getName(), sortedByNeighbor);
+}
+
+function_set SetRelNeighborOrderFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::BOOL});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
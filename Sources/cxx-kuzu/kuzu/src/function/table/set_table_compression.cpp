@@ -0,0 +1,94 @@
+#include "binder/binder.h"
+#include "binder/ddl/bound_alter_info.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct SetTableCompressionBindData final : TableFuncBindData {
+    std::string tableName;
+    BlockCompressionType type;
+    uint64_t coldCheckpointThreshold;
+
+    SetTableCompressionBindData(std::string tableName, BlockCompressionType type,
+        uint64_t coldCheckpointThreshold)
+        : TableFuncBindData{0}, tableName{std::move(tableName)}, type{type},
+          coldCheckpointThreshold{coldCheckpointThreshold} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<SetTableCompressionBindData>(tableName, type,
+            coldCheckpointThreshold);
+    }
+};
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = ku_dynamic_cast<SetTableCompressionBindData*>(input.bindData);
+    auto clientContext = input.context->clientContext;
+    auto extraInfo = std::make_unique<binder::BoundExtraSetCompressionInfo>(bindData->type,
+        bindData->coldCheckpointThreshold);
+    const binder::BoundAlterInfo alterInfo{AlterType::SET_COMPRESSION, bindData->tableName,
+        std::move(extraInfo)};
+    clientContext->getCatalog()->alterTableEntry(clientContext->getTransaction(), alterInfo);
+    return 0;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    if (!context->getTransactionContext()->isAutoTransaction()) {
+        throw BinderException{stringFormat("{} is only supported in auto transaction mode.",
+            SetTableCompressionFunction::name)};
+    }
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    const auto type = BlockCompressionTypeUtils::fromString(input->getLiteralVal<std::string>(1));
+    uint64_t coldCheckpointThreshold =
+        catalog::NodeTableCatalogEntry::DEFAULT_COLD_CHECKPOINT_THRESHOLD;
+    if (input->params.size() > 2) {
+        const auto numCheckpoints = input->getLiteralVal<int64_t>(2);
+        if (numCheckpoints < 0) {
+            throw BinderException{stringFormat(
+                "The number of checkpoints before a node group is compressed must not be "
+                "negative, but got {}.",
+                numCheckpoints)};
+        }
+        coldCheckpointThreshold = numCheckpoints;
+    }
+    binder::Binder::validateTableExistence(*context, tableName);
+    const auto tableEntry =
+        context->getCatalog()->getTableCatalogEntry(context->getTransaction(), tableName);
+    binder::Binder::validateNodeTableType(tableEntry);
+    return std::make_unique<SetTableCompressionBindData>(tableEntry->getName(), type,
+        coldCheckpointThreshold);
+}
+
+static std::unique_ptr<TableFunction> getFunction(std::vector<LogicalTypeID> parameterTypes) {
+    auto func = std::make_unique<TableFunction>(SetTableCompressionFunction::name,
+        std::move(parameterTypes));
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    return func;
+}
+
+function_set SetTableCompressionFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(getFunction({LogicalTypeID::STRING, LogicalTypeID::STRING}));
+    functionSet.push_back(
+        getFunction({LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::INT64}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
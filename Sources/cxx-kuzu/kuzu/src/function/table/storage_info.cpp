@@ -164,8 +164,11 @@ static void appendStorageInfoForChunkData(StorageInfoLocalState* localState, Dat
         // types not supported by TypeUtils::visit can
         // also be ignored since we don't track statistics for them
         [](int128_t) {}, [](struct_entry_t) {}, [](interval_t) {});
-    outputChunk.getValueVectorMutable(11).setValue(vectorPos,
-        metadata.compMeta.toString(physicalType));
+    auto compression = metadata.compMeta.toString(physicalType);
+    if (metadata.blockCompression.isCompressed()) {
+        compression += "+" + BlockCompressionTypeUtils::toString(metadata.blockCompression.type);
+    }
+    outputChunk.getValueVectorMutable(11).setValue(vectorPos, compression);
     outputChunk.state->getSelVectorUnsafe().incrementSelSize();
     if (columnType.getPhysicalType() == PhysicalTypeID::INTERNAL_ID) {
         ignoreNull = true;
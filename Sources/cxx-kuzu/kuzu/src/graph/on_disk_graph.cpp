@@ -221,6 +221,19 @@ Graph::EdgeIterator OnDiskGraph::scanBwd(nodeID_t nodeID, NbrScanState& state) {
     return EdgeIterator(&onDiskScanState);
 }
 
+void OnDiskGraph::addDegrees(NbrScanState& state, table_id_t boundTableID,
+    offset_t startNodeOffset, RelDataDirection direction, std::span<uint64_t> degrees) {
+    auto& onDiskScanState = ku_dynamic_cast<OnDiskGraphNbrScanState&>(state);
+    if (!onDiskScanState.canCountWithoutScan()) {
+        Graph::addDegrees(state, boundTableID, startNodeOffset, direction, degrees);
+        return;
+    }
+    auto idx = RelDirectionUtils::relDirectionToKeyIdx(direction);
+    KU_ASSERT(idx < onDiskScanState.directedIterators.size() &&
+              onDiskScanState.directedIterators[idx].getDirection() == direction);
+    onDiskScanState.directedIterators[idx].addDegrees(startNodeOffset, degrees);
+}
+
 Graph::VertexIterator OnDiskGraph::scanVertices(offset_t beginOffset, offset_t endOffsetExclusive,
     VertexScanState& state) {
     auto& onDiskVertexScanState = ku_dynamic_cast<OnDiskGraphVertexScanState&>(state);
@@ -272,21 +285,41 @@ void OnDiskGraphNbrScanState::InnerIterator::initScan() const {
     relTable->initScanState(context->getTransaction(), *tableScanState);
 }
 
+void OnDiskGraphNbrScanState::InnerIterator::addDegrees(offset_t startNodeOffset,
+    std::span<uint64_t> degrees) const {
+    relTable->addDegrees(context->getTransaction(), tableScanState->direction, startNodeOffset,
+        degrees);
+}
+
 void OnDiskGraphNbrScanState::startScan(RelDataDirection direction) {
     auto idx = RelDirectionUtils::relDirectionToKeyIdx(direction);
     KU_ASSERT(idx < directedIterators.size() && directedIterators[idx].getDirection() == direction);
     currentIter = &directedIterators[idx];
     currentIter->initScan();
+    scanStarted = false;
 }
 
 bool OnDiskGraphNbrScanState::next() {
     KU_ASSERT(currentIter != nullptr);
+    scanStarted = true;
     if (currentIter->next(relPredicateEvaluator.get(), nbrNodeMask)) {
         return true;
     }
     return false;
 }
 
+uint64_t OnDiskGraphNbrScanState::count() {
+    KU_ASSERT(currentIter != nullptr);
+    if (scanStarted || !canCountWithoutScan()) {
+        return NbrScanState::count();
+    }
+    scanStarted = true;
+    uint64_t degree = 0;
+    currentIter->addDegrees(srcNodeIDVector->getValue<nodeID_t>(0).offset,
+        std::span(&degree, 1));
+    return degree;
+}
+
 OnDiskGraphVertexScanState::OnDiskGraphVertexScanState(ClientContext& context,
     const TableCatalogEntry* tableEntry, const std::vector<std::string>& propertyNames)
     : context{context}, nodeTable{ku_dynamic_cast<const NodeTable&>(
@@ -3,6 +3,7 @@
 #include "binder/ddl/property_definition.h"
 #include "binder/expression/expression.h"
 #include "common/enums/alter_type.h"
+#include "common/enums/block_compression_type.h"
 #include "common/enums/conflict_action.h"
 
 namespace kuzu {
@@ -110,6 +111,32 @@ struct BoundExtraCommentInfo final : BoundExtraAlterInfo {
     }
 };
 
+struct BoundExtraSetCompressionInfo final : BoundExtraAlterInfo {
+    common::BlockCompressionType type;
+    uint64_t coldCheckpointThreshold;
+
+    BoundExtraSetCompressionInfo(common::BlockCompressionType type,
+        uint64_t coldCheckpointThreshold)
+        : type{type}, coldCheckpointThreshold{coldCheckpointThreshold} {}
+    BoundExtraSetCompressionInfo(const BoundExtraSetCompressionInfo& other)
+        : type{other.type}, coldCheckpointThreshold{other.coldCheckpointThreshold} {}
+    std::unique_ptr<BoundExtraAlterInfo> copy() const override {
+        return std::make_unique<BoundExtraSetCompressionInfo>(*this);
+    }
+};
+
+struct BoundExtraSetNeighborOrderInfo final : BoundExtraAlterInfo {
+    bool sortedByNeighbor;
+
+    explicit BoundExtraSetNeighborOrderInfo(bool sortedByNeighbor)
+        : sortedByNeighbor{sortedByNeighbor} {}
+    BoundExtraSetNeighborOrderInfo(const BoundExtraSetNeighborOrderInfo& other)
+        : sortedByNeighbor{other.sortedByNeighbor} {}
+    std::unique_ptr<BoundExtraAlterInfo> copy() const override {
+        return std::make_unique<BoundExtraSetNeighborOrderInfo>(*this);
+    }
+};
+
 struct BoundExtraAlterFromToConnection final : BoundExtraAlterInfo {
     common::table_id_t fromTableID;
     common::table_id_t toTableID;
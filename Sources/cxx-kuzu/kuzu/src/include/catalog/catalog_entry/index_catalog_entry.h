@@ -48,6 +48,16 @@ struct KUZU_API IndexAuxInfo {
     }
 };
 
+// Auxiliary info of the built-in ordered secondary index, which has no extra configuration.
+struct KUZU_API OrderedIndexAuxInfo final : IndexAuxInfo {
+    std::unique_ptr<IndexAuxInfo> copy() override {
+        return std::make_unique<OrderedIndexAuxInfo>();
+    }
+
+    std::string toCypher(const IndexCatalogEntry& indexEntry,
+        const ToCypherInfo& info) const override;
+};
+
 class KUZU_API IndexCatalogEntry final : public CatalogEntry {
 public:
     static std::string getInternalIndexName(common::table_id_t tableID, std::string indexName) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/enums/block_compression_type.h"
 #include "table_catalog_entry.h"
 
 namespace kuzu {
@@ -30,6 +31,13 @@ public:
         return getProperty(primaryKeyName);
     }
 
+    common::BlockCompressionType getBlockCompressionType() const { return blockCompressionType; }
+    uint64_t getColdCheckpointThreshold() const { return coldCheckpointThreshold; }
+    void setBlockCompression(common::BlockCompressionType type, uint64_t threshold) {
+        blockCompressionType = type;
+        coldCheckpointThreshold = threshold;
+    }
+
     void renameProperty(const std::string& propertyName, const std::string& newName) override;
 
     void serialize(common::Serializer& serializer) const override;
@@ -42,8 +50,15 @@ private:
     std::unique_ptr<binder::BoundExtraCreateCatalogEntryInfo> getBoundExtraCreateInfo(
         transaction::Transaction* transaction) const override;
 
+public:
+    static constexpr uint64_t DEFAULT_COLD_CHECKPOINT_THRESHOLD = 3;
+
 private:
     std::string primaryKeyName;
+    // Node groups whose data is unchanged for more than coldCheckpointThreshold checkpoints are
+    // block compressed with this codec.
+    common::BlockCompressionType blockCompressionType = common::BlockCompressionType::NONE;
+    uint64_t coldCheckpointThreshold = DEFAULT_COLD_CHECKPOINT_THRESHOLD;
 };
 
 } // namespace catalog
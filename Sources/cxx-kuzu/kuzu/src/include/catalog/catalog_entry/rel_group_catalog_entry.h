@@ -54,6 +54,9 @@ public:
 
     common::ExtendDirection getStorageDirection() const { return storageDirection; }
 
+    bool isSortedByNeighbor() const { return sortedByNeighbor; }
+    void setSortedByNeighbor(bool sorted) { sortedByNeighbor = sorted; }
+
     common::idx_t getNumRelTables() const { return relTableInfos.size(); }
     const std::vector<RelTableCatalogInfo>& getRelEntryInfos() const { return relTableInfos; }
     const RelTableCatalogInfo& getSingleRelEntryInfo() const;
@@ -97,6 +100,9 @@ private:
     // TODO(Guodong): Avoid using extend direction for storage direction
     common::ExtendDirection storageDirection = common::ExtendDirection::BOTH;
     std::vector<RelTableCatalogInfo> relTableInfos;
+    // Whether the rels of each CSR list are kept sorted by neighbor offset when they are copied
+    // or checkpointed.
+    bool sortedByNeighbor = false;
 };
 
 } // namespace catalog
@@ -61,6 +61,8 @@ struct BufferPoolConstants {
 #else
     static constexpr uint64_t DEFAULT_VM_REGION_MAX_SIZE = static_cast<uint64_t>(1) << 43; // (8TB)
 #endif
+    // Buffers, sizes and offsets of direct I/O requests must be aligned to this.
+    static constexpr uint64_t DIRECT_IO_ALIGNMENT = 4096;
 };
 
 struct StorageConstants {
@@ -68,6 +70,7 @@ struct StorageConstants {
     static constexpr char WAL_FILE_SUFFIX[] = "wal";
     static constexpr char SHADOWING_SUFFIX[] = "shadow";
     static constexpr char TEMP_FILE_SUFFIX[] = "tmp";
+    static constexpr char WARMUP_FILE_SUFFIX[] = "warmup";
 
     // The number of pages that we add at one time when we need to grow a file.
     static constexpr uint64_t PAGE_GROUP_SIZE_LOG2 = 10;
@@ -158,6 +161,9 @@ struct CopyConstants {
 struct PlannerKnobs {
     static constexpr double NON_EQUALITY_PREDICATE_SELECTIVITY = 0.1;
     static constexpr double EQUALITY_PREDICATE_SELECTIVITY = 0.01;
+    // Maximum estimated selectivity of the bounds of a secondary index scan for the optimizer to
+    // pick it over a sequential scan.
+    static constexpr double SECONDARY_INDEX_SCAN_MAX_SELECTIVITY = 0.05;
     static constexpr uint64_t BUILD_PENALTY = 2;
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
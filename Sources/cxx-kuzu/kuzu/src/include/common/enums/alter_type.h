@@ -15,6 +15,8 @@ enum class AlterType : uint8_t {
     DROP_FROM_TO_CONNECTION = 14,
 
     COMMENT = 201,
+    SET_COMPRESSION = 202,
+    SET_NEIGHBOR_ORDER = 203,
     INVALID = 255
 };
 
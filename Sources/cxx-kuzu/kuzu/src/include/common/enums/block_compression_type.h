@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace kuzu {
+namespace common {
+
+// General-purpose codec applied to whole column chunks of cold node groups.
+enum class BlockCompressionType : uint8_t {
+    NONE = 0,
+    ZSTD = 1,
+    LZ4 = 2,
+};
+
+struct BlockCompressionTypeUtils {
+    static BlockCompressionType fromString(const std::string& str);
+    static std::string toString(BlockCompressionType type);
+};
+
+} // namespace common
+} // namespace kuzu
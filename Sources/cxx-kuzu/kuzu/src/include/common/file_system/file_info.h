@@ -36,6 +36,12 @@ struct KUZU_API FileInfo {
 
     bool canPerformSeek() const;
 
+    virtual bool usesDirectIO() const { return false; }
+
+    // Maps the first numBytes of the file into memory for reading. The mapping lives as long as
+    // the FileInfo. Returns nullptr if the file system doesn't support it.
+    virtual const uint8_t* mapForReading(uint64_t /*numBytes*/) { return nullptr; }
+
     virtual function::TableFunction getHandleFunction() const { KU_UNREACHABLE; }
 
     template<class TARGET>
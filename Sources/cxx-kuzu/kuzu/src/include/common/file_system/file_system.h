@@ -28,6 +28,8 @@ struct FileFlags {
     static constexpr uint8_t CREATE_AND_TRUNCATE_IF_EXISTS = 1 << 4;
     // Temporary file that is not persisted to disk.
     static constexpr uint8_t TEMPORARY = 1 << 5;
+    // Bypass the OS page cache for aligned reads and writes, if the file system supports it.
+    static constexpr uint8_t DIRECT_IO = 1 << 6;
 #ifdef _WIN32
     // Only used in windows to open files in binary mode.
     static constexpr uint8_t BINARY = 1 << 5;
@@ -12,17 +12,29 @@ struct LocalFileInfo final : FileInfo {
     LocalFileInfo(std::string path, const void* handle, FileSystem* fileSystem)
         : FileInfo{std::move(path), fileSystem}, handle{handle} {}
 #else
-    LocalFileInfo(std::string path, const int fd, FileSystem* fileSystem)
-        : FileInfo{std::move(path), fileSystem}, fd{fd} {}
+    LocalFileInfo(std::string path, const int fd, FileSystem* fileSystem, const int directIOFD = -1)
+        : FileInfo{std::move(path), fileSystem}, fd{fd}, directIOFD{directIOFD} {}
 #endif
 
     ~LocalFileInfo() override;
 
+    bool usesDirectIO() const override;
+
+    const uint8_t* mapForReading(uint64_t numBytes) override;
+
 #ifdef _WIN32
     const void* handle;
 #else
     const int fd;
+    // A second descriptor of the file that bypasses the OS page cache. Requests whose buffer, size
+    // and offset are aligned to DIRECT_IO_ALIGNMENT go through it, others through fd. -1 if direct
+    // I/O wasn't requested or isn't supported by the file system.
+    const int directIOFD;
+
+    int getFD(const void* buffer, uint64_t numBytes, uint64_t position) const;
 #endif
+    void* mappedData = nullptr;
+    uint64_t mappedSize = 0;
 };
 
 class KUZU_API LocalFileSystem final : public FileSystem {
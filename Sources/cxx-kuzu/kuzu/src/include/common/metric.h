@@ -48,5 +48,15 @@ public:
     uint64_t accumulatedValue;
 };
 
+// Memory access counters of the calling thread, read from the OS. Page faults are only counted on
+// Linux, and TLB misses additionally need access to hardware performance counters. Counters that
+// aren't available stay zero.
+struct ThreadMemoryCounters {
+    uint64_t numPageFaults = 0;
+    uint64_t numTLBMisses = 0;
+
+    static ThreadMemoryCounters read();
+};
+
 } // namespace common
 } // namespace kuzu
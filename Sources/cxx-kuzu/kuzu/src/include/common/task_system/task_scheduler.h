@@ -10,12 +10,20 @@
 #include "processor/execution_context.h"
 
 namespace kuzu {
+namespace storage {
+class MemoryTracker;
+} // namespace storage
+
 namespace common {
 
 struct ScheduledTask {
-    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID) : task{std::move(task)}, ID{ID} {};
+    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID,
+        std::shared_ptr<storage::MemoryTracker> memoryTracker)
+        : task{std::move(task)}, ID{ID}, memoryTracker{std::move(memoryTracker)} {};
     std::shared_ptr<Task> task;
     uint64_t ID;
+    // The memory tracker of the scheduling thread, which workers charge their allocations to.
+    std::shared_ptr<storage::MemoryTracker> memoryTracker;
 };
 
 /**
@@ -151,13 +151,13 @@ public:
 
     void setParentList(common::offset_t offset, ParentList* parentList) override;
 
-    const std::unordered_map<common::offset_t, ParentList*>& getCurrentData() const {
+    const SparseNodeMap<ParentList*>& getCurrentData() const {
         return *curData;
     }
 
 private:
     GDSSpareObjectManager<ParentList*> sparseObjects;
-    std::unordered_map<common::offset_t, ParentList*>* curData = nullptr;
+    SparseNodeMap<ParentList*>* curData = nullptr;
 };
 
 class BFSGraphManager {
@@ -27,6 +27,9 @@ struct KUZU_API GDSConfig {
 struct KUZU_API GDSBindData : public TableFuncBindData {
     graph::NativeGraphEntry graphEntry;
     std::shared_ptr<binder::Expression> nodeOutput;
+    // Per node table predicates selecting the input (e.g. source) nodes of an algorithm. Empty if
+    // the algorithm runs on all nodes of the projected graph.
+    std::vector<graph::NativeGraphEntryTableInfo> inputNodeInfos;
 
     GDSBindData(binder::expression_vector columns, graph::NativeGraphEntry graphEntry,
         std::shared_ptr<binder::Expression> nodeOutput)
@@ -35,7 +38,8 @@ struct KUZU_API GDSBindData : public TableFuncBindData {
 
     GDSBindData(const GDSBindData& other)
         : TableFuncBindData{other}, graphEntry{other.graphEntry.copy()},
-          nodeOutput{other.nodeOutput}, resultTable{other.resultTable} {}
+          nodeOutput{other.nodeOutput}, inputNodeInfos{other.inputNodeInfos},
+          resultTable{other.resultTable} {}
 
     void setResultFTable(std::shared_ptr<processor::FactorizedTable> table) {
         resultTable = std::move(table);
@@ -59,12 +63,17 @@ struct KUZU_API GDSFuncSharedState : public TableFuncSharedState {
 
     void setGraphNodeMask(std::unique_ptr<common::NodeOffsetMaskMap> maskMap);
     common::NodeOffsetMaskMap* getGraphNodeMaskMap() const { return graphNodeMask.get(); }
+    void setInputNodeMask(std::unique_ptr<common::NodeOffsetMaskMap> maskMap) {
+        inputNodeMask = std::move(maskMap);
+    }
+    common::NodeOffsetMaskMap* getInputNodeMaskMap() const { return inputNodeMask.get(); }
 
 public:
     processor::FactorizedTablePool factorizedTablePool;
 
 private:
     std::unique_ptr<common::NodeOffsetMaskMap> graphNodeMask = nullptr;
+    std::unique_ptr<common::NodeOffsetMaskMap> inputNodeMask = nullptr;
 };
 
 // Base class for every graph data science algorithm.
@@ -76,6 +85,10 @@ public:
         const std::string& name);
     static graph::NativeGraphEntry bindGraphEntry(main::ClientContext& context,
         const graph::ParsedNativeGraphEntry& parsedGraphEntry);
+    // Binds a node predicate on variable `n` against every node table of the projected graph. The
+    // predicate is conjuncted with the node filter of the projection, if any.
+    static std::vector<graph::NativeGraphEntryTableInfo> bindInputNodeInfos(
+        main::ClientContext& context, const std::string& graphName, const std::string& predicate);
     static std::shared_ptr<binder::Expression> bindNodeOutput(const TableFuncBindInput& bindInput,
         const std::vector<catalog::TableCatalogEntry*>& nodeEntries);
     static std::string bindColumnName(const parser::YieldVariable& yieldVariable,
@@ -40,7 +40,7 @@ public:
 };
 
 // Sparse frontier implementation assuming the number of nodes is small.
-// Use an STL hash map to maintain node offset-> iteration number
+// Use a flat hash map to maintain node offset-> iteration number
 class KUZU_API SparseFrontier : public Frontier {
     friend class SparseFrontierReference;
     friend class SPFrontierPair;
@@ -60,13 +60,13 @@ public:
 
     uint64_t size() const { return sparseObjects.size(); }
 
-    const std::unordered_map<common::offset_t, iteration_t>& getCurrentData() const {
+    const SparseNodeMap<iteration_t>& getCurrentData() const {
         return *curData;
     }
 
 private:
     GDSSpareObjectManager<iteration_t> sparseObjects;
-    std::unordered_map<common::offset_t, iteration_t>* curData = nullptr;
+    SparseNodeMap<iteration_t>* curData = nullptr;
 };
 
 // Sparse frontier implementation that refers to the data owned by another sparse frontier.
@@ -85,13 +85,13 @@ public:
 
     iteration_t getIteration(common::offset_t offset) const override;
 
-    const std::unordered_map<common::offset_t, iteration_t>& getCurrentData() const {
+    const SparseNodeMap<iteration_t>& getCurrentData() const {
         return *curData;
     }
 
 private:
     GDSSpareObjectManager<iteration_t>& sparseObjects;
-    std::unordered_map<common::offset_t, iteration_t>* curData = nullptr;
+    SparseNodeMap<iteration_t>* curData = nullptr;
 };
 
 // Dense frontier implementation assuming the number of nodes is large.
@@ -191,7 +191,7 @@ public:
 
     iteration_t getNextFrontierValue(common::offset_t offset);
     bool isActiveOnCurrentFrontier(common::offset_t offset);
-    virtual std::unordered_set<common::offset_t> getActiveNodesOnCurrentFrontier() = 0;
+    virtual std::vector<common::offset_t> getActiveNodesOnCurrentFrontier() = 0;
 
     virtual GDSDensityState getState() const = 0;
     virtual bool needSwitchToDense(uint64_t threshold) const = 0;
@@ -230,7 +230,7 @@ public:
     // Get number of active nodes in current frontier. Used for shortest path early termination.
     common::offset_t getNumActiveNodesInCurrentFrontier(common::NodeOffsetMaskMap& mask);
 
-    std::unordered_set<common::offset_t> getActiveNodesOnCurrentFrontier() override;
+    std::vector<common::offset_t> getActiveNodesOnCurrentFrontier() override;
 
     GDSDensityState getState() const override { return state; }
     bool needSwitchToDense(uint64_t threshold) const override {
@@ -256,7 +256,7 @@ public:
 
     void beginNewIterationInternalNoLock() override;
 
-    std::unordered_set<common::offset_t> getActiveNodesOnCurrentFrontier() override;
+    std::vector<common::offset_t> getActiveNodesOnCurrentFrontier() override;
 
     GDSDensityState getState() const override { return state; }
     bool needSwitchToDense(uint64_t threshold) const override {
@@ -281,7 +281,7 @@ public:
 
     void beginNewIterationInternalNoLock() override;
 
-    std::unordered_set<common::offset_t> getActiveNodesOnCurrentFrontier() override {
+    std::vector<common::offset_t> getActiveNodesOnCurrentFrontier() override {
         KU_UNREACHABLE;
     }
 
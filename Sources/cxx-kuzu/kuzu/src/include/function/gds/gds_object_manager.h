@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <bit>
 #include <vector>
 
 #include "storage/buffer_manager/memory_manager.h"
@@ -118,6 +119,12 @@ public:
         array.data[pos].fetch_add(value, order);
     }
 
+    void fetchSub(common::offset_t pos, const T& value,
+        std::memory_order order = std::memory_order_seq_cst) {
+        KU_ASSERT_UNCONDITIONAL(pos < array.size);
+        array.data[pos].fetch_sub(value, order);
+    }
+
     bool compareExchangeMax(const common::offset_t src, const common::offset_t dest,
         std::memory_order order = std::memory_order_seq_cst) {
         auto srcValue = get(src, order);
@@ -191,6 +198,139 @@ private:
     common::table_id_map_t<std::unique_ptr<storage::MemoryBuffer>> bufferPerTable;
 };
 
+// Open-addressing hash map from node offsets to objects for sparse GDS states. Entries are
+// stored inline in a single power-of-two sized array and probed linearly, so inserts and lookups
+// do not allocate per entry as std::unordered_map does. Entries cannot be removed.
+template<typename T>
+class SparseNodeMap {
+public:
+    using entry_t = std::pair<common::offset_t, T>;
+
+    template<typename ENTRY>
+    class EntryIterator {
+    public:
+        EntryIterator(ENTRY* cur, ENTRY* end) : cur{cur}, end{end} { skipEmptyEntries(); }
+
+        ENTRY& operator*() const { return *cur; }
+        EntryIterator& operator++() {
+            ++cur;
+            skipEmptyEntries();
+            return *this;
+        }
+        bool operator==(const EntryIterator& other) const { return cur == other.cur; }
+
+    private:
+        void skipEmptyEntries() {
+            while (cur != end && cur->first == EMPTY_KEY) {
+                ++cur;
+            }
+        }
+
+    private:
+        ENTRY* cur;
+        ENTRY* end;
+    };
+
+    uint64_t size() const { return numEntries; }
+
+    bool contains(common::offset_t offset) const { return find(offset) != nullptr; }
+
+    // Returns nullptr if there is no entry for `offset`.
+    T* find(common::offset_t offset) {
+        if (numEntries == 0) {
+            return nullptr;
+        }
+        for (auto idx = getSlot(offset);; idx = (idx + 1) & mask) {
+            auto& entry = entries[idx];
+            if (entry.first == offset) {
+                return &entry.second;
+            }
+            if (entry.first == EMPTY_KEY) {
+                return nullptr;
+            }
+        }
+    }
+    const T* find(common::offset_t offset) const {
+        return const_cast<SparseNodeMap*>(this)->find(offset);
+    }
+
+    T& at(common::offset_t offset) {
+        auto value = find(offset);
+        KU_ASSERT(value != nullptr);
+        return *value;
+    }
+
+    // Returns the value of `offset`, inserting `defaultValue` if there is no entry for it.
+    T& getOrInsert(common::offset_t offset, const T& defaultValue) {
+        KU_ASSERT(offset != EMPTY_KEY);
+        if ((numEntries + 1) * 2 > entries.size()) {
+            grow();
+        }
+        for (auto idx = getSlot(offset);; idx = (idx + 1) & mask) {
+            auto& entry = entries[idx];
+            if (entry.first == offset) {
+                return entry.second;
+            }
+            if (entry.first == EMPTY_KEY) {
+                entry = {offset, defaultValue};
+                numEntries++;
+                return entry.second;
+            }
+        }
+    }
+
+    void set(common::offset_t offset, const T& value) { getOrInsert(offset, value) = value; }
+
+    EntryIterator<entry_t> begin() {
+        return EntryIterator<entry_t>(entries.data(), entries.data() + entries.size());
+    }
+    EntryIterator<entry_t> end() {
+        auto end = entries.data() + entries.size();
+        return EntryIterator<entry_t>(end, end);
+    }
+    EntryIterator<const entry_t> begin() const {
+        return EntryIterator<const entry_t>(entries.data(), entries.data() + entries.size());
+    }
+    EntryIterator<const entry_t> end() const {
+        auto end = entries.data() + entries.size();
+        return EntryIterator<const entry_t>(end, end);
+    }
+
+private:
+    uint64_t getSlot(common::offset_t offset) const {
+        // Fibonacci hashing spreads consecutive offsets over the whole table.
+        return (offset * 0x9E3779B97F4A7C15ULL) >> shift;
+    }
+
+    // Doubles the capacity, keeping the load factor at most 1/2.
+    void grow() {
+        auto oldEntries = std::move(entries);
+        const auto capacity = oldEntries.empty() ? INITIAL_CAPACITY : oldEntries.size() * 2;
+        entries.assign(capacity, entry_t{EMPTY_KEY, T{}});
+        mask = capacity - 1;
+        shift = 64 - std::countr_zero(capacity);
+        for (auto& entry : oldEntries) {
+            if (entry.first == EMPTY_KEY) {
+                continue;
+            }
+            auto idx = getSlot(entry.first);
+            while (entries[idx].first != EMPTY_KEY) {
+                idx = (idx + 1) & mask;
+            }
+            entries[idx] = std::move(entry);
+        }
+    }
+
+private:
+    static constexpr common::offset_t EMPTY_KEY = common::INVALID_OFFSET;
+    static constexpr uint64_t INITIAL_CAPACITY = 16;
+
+    std::vector<entry_t> entries;
+    uint64_t numEntries = 0;
+    uint64_t mask = 0;
+    uint64_t shift = 64;
+};
+
 template<typename T>
 class GDSSpareObjectManager {
 public:
@@ -206,16 +346,14 @@ public:
         mapPerTable.insert({tableID, {}});
     }
 
-    const common::table_id_map_t<std::unordered_map<common::offset_t, T>>& getData() {
-        return mapPerTable;
-    }
+    const common::table_id_map_t<SparseNodeMap<T>>& getData() { return mapPerTable; }
 
-    std::unordered_map<common::offset_t, T>* getMap(common::table_id_t tableID) {
+    SparseNodeMap<T>* getMap(common::table_id_t tableID) {
         KU_ASSERT(mapPerTable.contains(tableID));
         return &mapPerTable.at(tableID);
     }
 
-    std::unordered_map<common::offset_t, T>* getData(common::table_id_t tableID) {
+    SparseNodeMap<T>* getData(common::table_id_t tableID) {
         if (!mapPerTable.contains(tableID)) {
             mapPerTable.insert({tableID, {}});
         }
@@ -225,14 +363,14 @@ public:
 
     uint64_t size() const {
         uint64_t result = 0;
-        for (auto [_, map] : mapPerTable) {
+        for (auto& [_, map] : mapPerTable) {
             result += map.size();
         }
         return result;
     }
 
 private:
-    common::table_id_map_t<std::unordered_map<common::offset_t, T>> mapPerTable;
+    common::table_id_map_t<SparseNodeMap<T>> mapPerTable;
 };
 
 } // namespace function
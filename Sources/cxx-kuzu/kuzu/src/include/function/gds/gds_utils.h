@@ -17,8 +17,9 @@ public:
     static void runFTSEdgeCompute(processor::ExecutionContext* context, GDSComputeState& compState,
         graph::Graph* graph, common::ExtendDirection extendDirection,
         const std::vector<std::string>& propertiesToScan);
-    // Run edge compute for recursive join.
-    static void runRecursiveJoinEdgeCompute(processor::ExecutionContext* context,
+    // Run edge compute for recursive join. Returns the number of iterations run on a sparse
+    // frontier.
+    static uint64_t runRecursiveJoinEdgeCompute(processor::ExecutionContext* context,
         GDSComputeState& compState, graph::Graph* graph, common::ExtendDirection extendDirection,
         uint64_t maxIteration, common::NodeOffsetMaskMap* outputNodeMask,
         const std::vector<std::string>& propertiesToScan);
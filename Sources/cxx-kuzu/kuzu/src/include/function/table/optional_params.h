@@ -25,6 +25,10 @@ template<>
 struct LogicalTypeMapping<common::LogicalTypeID::INT64> {
     using type = int64_t;
 };
+template<>
+struct LogicalTypeMapping<common::LogicalTypeID::STRING> {
+    using type = std::string;
+};
 
 template<typename PARAM>
 struct OptionalParam {
@@ -122,6 +122,18 @@ struct BMInfoFunction final {
     static function_set getFunctionSet();
 };
 
+struct CheckpointInfoFunction final {
+    static constexpr const char* name = "CHECKPOINT_INFO";
+
+    static function_set getFunctionSet();
+};
+
+struct MMInfoFunction final {
+    static constexpr const char* name = "MM_INFO";
+
+    static function_set getFunctionSet();
+};
+
 struct FileInfoFunction final {
     static constexpr const char* name = "FILE_INFO";
 
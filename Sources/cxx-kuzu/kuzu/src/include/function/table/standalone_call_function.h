@@ -29,5 +29,36 @@ struct DropProjectedGraphFunction {
     static function_set getFunctionSet();
 };
 
+struct CreateIndexFunction {
+    static constexpr const char* name = "CREATE_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct DropIndexFunction {
+    static constexpr const char* name = "DROP_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct SetTableCompressionFunction {
+    static constexpr const char* name = "SET_TABLE_COMPRESSION";
+
+    static function_set getFunctionSet();
+};
+
+struct SetRelNeighborOrderFunction {
+    static constexpr const char* name = "SET_REL_NEIGHBOR_ORDER";
+
+    static function_set getFunctionSet();
+};
+
+// Moves data toward the head of the data file and truncates the free space at its tail.
+struct CompactDatabaseFunction {
+    static constexpr const char* name = "COMPACT_DATABASE";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
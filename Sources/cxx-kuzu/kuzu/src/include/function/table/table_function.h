@@ -46,6 +46,9 @@ struct KUZU_API TableFuncSharedState {
     explicit TableFuncSharedState(common::row_idx_t numRows) : numRows{numRows} {}
     virtual ~TableFuncSharedState() = default;
     virtual uint64_t getNumRows() const { return numRows; }
+    // Expected number of output rows when the exact number isn't known up front. Only meant for
+    // pre-sizing data structures.
+    virtual uint64_t getEstimatedNumRows() const { return getNumRows(); }
 
     common::table_id_map_t<common::SemiMask*> getSemiMasks() const { return semiMasks.getMasks(); }
 
@@ -5,6 +5,7 @@
 
 #include "common/copy_constructors.h"
 #include "common/data_chunk/sel_vector.h"
+#include "common/enums/rel_direction.h"
 #include "common/types/types.h"
 #include "common/vector/value_vector.h"
 #include <span>
@@ -74,6 +75,16 @@ public:
     // Returns true if there are more values after the current batch
     virtual bool next() = 0;
 
+    // Counts and consumes the remaining neighbors, including the current batch. Implementations
+    // may override this to avoid scanning neighbors when only the count is needed.
+    virtual uint64_t count() {
+        uint64_t result = 0;
+        do {
+            result += getChunk().size();
+        } while (next());
+        return result;
+    }
+
 protected:
     static Chunk createChunk(std::span<const common::nodeID_t> nbrNodes,
         common::SelectionVector& selVector, std::vector<common::ValueVector*> propertyVectors) {
@@ -93,6 +104,9 @@ public:
             return std::span(reinterpret_cast<const T*>(propertyVectors[propertyIndex]->getData()),
                 nodeIDs.size());
         }
+        bool isNull(size_t propertyIndex, size_t pos) const {
+            return propertyVectors[propertyIndex]->isNull(pos);
+        }
 
     private:
         KUZU_API Chunk(std::span<const common::nodeID_t> nodeIDs,
@@ -148,14 +162,7 @@ public:
             return scanState == nullptr && other.scanState == nullptr;
         }
         // Counts and consumes the iterator
-        uint64_t count() const {
-            // TODO(bmwinger): avoid scanning if all that's necessary is to count the results
-            uint64_t result = 0;
-            do {
-                result += scanState->getChunk().size();
-            } while (scanState->next());
-            return result;
-        }
+        uint64_t count() const { return scanState->count(); }
 
         std::vector<common::nodeID_t> collectNbrNodes() {
             std::vector<common::nodeID_t> nbrNodes;
@@ -208,6 +215,20 @@ public:
     // Get dst nodeIDs for given src nodeID tables using backward adjList.
     virtual EdgeIterator scanBwd(common::nodeID_t nodeID, NbrScanState& state) = 0;
 
+    // Adds the number of edges of each node in [startNodeOffset, startNodeOffset + degrees.size())
+    // of the bound node table in the given direction to `degrees`. The state must have been
+    // prepared for the relationship table to count. By default, neighbors are scanned and counted.
+    virtual void addDegrees(NbrScanState& state, common::table_id_t boundTableID,
+        common::offset_t startNodeOffset, common::RelDataDirection direction,
+        std::span<uint64_t> degrees) {
+        for (auto i = 0u; i < degrees.size(); i++) {
+            const common::nodeID_t nodeID{startNodeOffset + i, boundTableID};
+            degrees[i] += direction == common::RelDataDirection::FWD ?
+                              scanFwd(nodeID, state).count() :
+                              scanBwd(nodeID, state).count();
+        }
+    }
+
     class VertexIterator {
     public:
         explicit constexpr VertexIterator(VertexScanState* scanState) : scanState{scanState} {}
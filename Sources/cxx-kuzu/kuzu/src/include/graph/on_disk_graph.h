@@ -41,8 +41,14 @@ public:
         return createChunk(currentIter->getNbrNodes(), currentIter->getSelVectorUnsafe(), vectors);
     }
     bool next() override;
+    uint64_t count() override;
 
     void startScan(common::RelDataDirection direction);
+    // Degrees can be read from the CSR header only if no rel predicate or nbr mask needs to be
+    // evaluated on the scanned rels.
+    bool canCountWithoutScan() const {
+        return relPredicateEvaluator == nullptr && nbrNodeMask == nullptr;
+    }
 
     class InnerIterator : public processor::SelVectorOverWriter {
     public:
@@ -70,6 +76,7 @@ public:
 
         bool next(evaluator::ExpressionEvaluator* predicate, common::SemiMask* nbrNodeMask);
         void initScan() const;
+        void addDegrees(common::offset_t startNodeOffset, std::span<uint64_t> degrees) const;
 
         common::RelDataDirection getDirection() const { return tableScanState->direction; }
 
@@ -91,6 +98,8 @@ private:
 
     std::vector<InnerIterator> directedIterators;
     InnerIterator* currentIter = nullptr;
+    // Whether next() has been called since the last startScan().
+    bool scanStarted = false;
 };
 
 class OnDiskGraphVertexScanState final : public VertexScanState {
@@ -150,6 +159,10 @@ public:
     EdgeIterator scanFwd(common::nodeID_t nodeID, NbrScanState& state) override;
     EdgeIterator scanBwd(common::nodeID_t nodeID, NbrScanState& state) override;
 
+    void addDegrees(NbrScanState& state, common::table_id_t boundTableID,
+        common::offset_t startNodeOffset, common::RelDataDirection direction,
+        std::span<uint64_t> degrees) override;
+
     std::unique_ptr<VertexScanState> prepareVertexScan(catalog::TableCatalogEntry* tableEntry,
         const std::vector<std::string>& propertiesToScan) override;
     VertexIterator scanVertices(common::offset_t beginOffset, common::offset_t endOffsetExclusive,
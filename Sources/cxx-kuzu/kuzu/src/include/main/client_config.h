@@ -4,6 +4,7 @@
 #include <string>
 
 #include "common/enums/path_semantic.h"
+#include "storage/enums/memory_limit_policy.h"
 
 namespace kuzu {
 namespace main {
@@ -23,6 +24,11 @@ struct ClientConfigDefault {
     static constexpr uint64_t WARNING_LIMIT = 8 * 1024;
     static constexpr bool ENABLE_PLAN_OPTIMIZER = true;
     static constexpr bool ENABLE_INTERNAL_CATALOG = false;
+    // 0 means memory limits are disabled by default.
+    static constexpr uint64_t QUERY_MEMORY_LIMIT = 0;
+    static constexpr uint64_t CONNECTION_MEMORY_LIMIT = 0;
+    static constexpr storage::MemoryLimitPolicy MEMORY_LIMIT_POLICY =
+        storage::MemoryLimitPolicy::FAIL;
 };
 
 struct ClientConfig {
@@ -57,6 +63,12 @@ struct ClientConfig {
     bool enablePlanOptimizer = ClientConfigDefault::ENABLE_PLAN_OPTIMIZER;
     // If use internal catalog during binding
     bool enableInternalCatalog = ClientConfigDefault::ENABLE_INTERNAL_CATALOG;
+    // Memory limit of a query in bytes.
+    uint64_t queryMemoryLimit = ClientConfigDefault::QUERY_MEMORY_LIMIT;
+    // Memory limit of the connection in bytes, counting all its queries and unfreed results.
+    uint64_t connectionMemoryLimit = ClientConfigDefault::CONNECTION_MEMORY_LIMIT;
+    // What a query does when it reaches a memory limit.
+    storage::MemoryLimitPolicy memoryLimitPolicy = ClientConfigDefault::MEMORY_LIMIT_POLICY;
 };
 
 } // namespace main
@@ -45,6 +45,10 @@ namespace graph {
 class GraphEntrySet;
 }
 
+namespace storage {
+class MemoryTracker;
+} // namespace storage
+
 namespace main {
 struct DBConfig;
 class Database;
@@ -104,6 +108,13 @@ public:
     void setMaxNumThreadForExec(uint64_t numThreads);
     uint64_t getMaxNumThreadForExec() const;
 
+    // Memory limits
+    void setQueryMemoryLimit(uint64_t limitInBytes, storage::MemoryLimitPolicy policy);
+    void setConnectionMemoryLimit(uint64_t limitInBytes);
+    const storage::MemoryTracker& getConnectionMemoryTracker() const {
+        return *connectionMemoryTracker;
+    }
+
     // Transaction.
     transaction::Transaction* getTransaction() const;
     transaction::TransactionContext* getTransactionContext() const;
@@ -237,6 +248,8 @@ private:
     ClientConfig clientConfig;
     // Current query.
     ActiveQuery activeQuery;
+    // Memory charged to the connection. The trackers of its queries are children of it.
+    std::shared_ptr<storage::MemoryTracker> connectionMemoryTracker;
     // Cache prepare statement.
     CachedPreparedStatementManager cachedPreparedStatementManager;
     // Transaction context.
@@ -99,6 +99,21 @@ public:
      */
     KUZU_API void setQueryTimeOut(uint64_t timeoutInMS);
 
+    /**
+     * @brief sets the memory limit of each query of the current connection. A value of zero (the
+     * default) disables the limit.
+     * @param limitInBytes The maximum number of bytes of intermediate results a query may hold.
+     * @param policy What a query does when it reaches the limit, or the connection memory limit.
+     */
+    KUZU_API void setQueryMemoryLimit(uint64_t limitInBytes,
+        storage::MemoryLimitPolicy policy = storage::MemoryLimitPolicy::FAIL);
+    /**
+     * @brief sets the memory limit of the current connection, which counts the memory of all its
+     * queries, including results that are not freed yet. A value of zero (the default) disables
+     * the limit.
+     */
+    KUZU_API void setConnectionMemoryLimit(uint64_t limitInBytes);
+
     template<typename TR, typename... Args>
     void createScalarFunction(std::string name, TR (*udfFunc)(Args...)) {
         addScalarFunction(name, function::UDF::getFunction<TR, Args...>(name, udfFunc));
@@ -36,12 +36,14 @@ class MapperExtension;
 } // namespace extension
 
 namespace storage {
+class BufferPoolWarmer;
 class StorageExtension;
 } // namespace storage
 
 namespace main {
 struct ExtensionOption;
 class DatabaseManager;
+class QueryAdmissionQueue;
 
 /**
  * @brief Stores runtime configuration for creating or opening a Database
@@ -90,6 +92,27 @@ struct KUZU_API SystemConfig {
 #if defined(__APPLE__)
     uint32_t threadQos;
 #endif
+    // If true, the buffer pool asks the OS to back its frames with transparent huge pages, which
+    // reduces TLB misses on large buffer pools. Only supported on Linux.
+    bool enableHugePages = false;
+    // If true, the frame groups of the buffer pool are spread round-robin across the NUMA nodes of
+    // the machine instead of being placed on the node of the thread that first touches them. Only
+    // supported on Linux.
+    bool bindBufferPoolToNumaNodes = false;
+    // If true, pages of the data file and the shadow file are read and written bypassing the OS
+    // page cache, so that they are only cached once, in the buffer pool. Files on file systems
+    // that don't support direct I/O are accessed through the page cache.
+    bool enableDirectIO = false;
+    // If true, the pages of the data file cached in the buffer pool are periodically recorded to a
+    // side file, and reloaded in the background when the database is opened again, so that it
+    // doesn't start with a cold buffer pool. Not supported for in-memory databases.
+    bool enableBufferPoolWarmup = false;
+    // Interval between two recordings of the cached pages. They are also recorded on close.
+    uint64_t bufferPoolWarmupIntervalInMS = 60000;
+    // If true and the database is opened read-only, the data file is mapped into memory and
+    // column scans read pages from the mapping without pinning them in the buffer pool, leaving
+    // residency to the OS page cache. Ignored for read-write databases.
+    bool enableMemoryMappedReads = false;
 };
 
 /**
@@ -181,10 +204,13 @@ private:
     std::unique_ptr<processor::QueryProcessor> queryProcessor;
     std::unique_ptr<catalog::Catalog> catalog;
     std::unique_ptr<storage::StorageManager> storageManager;
+    // Declared after the storage manager, so that it is destroyed while the data file is open.
+    std::unique_ptr<storage::BufferPoolWarmer> bufferPoolWarmer;
     std::unique_ptr<transaction::TransactionManager> transactionManager;
     std::unique_ptr<common::FileInfo> lockFile;
     std::unique_ptr<DatabaseManager> databaseManager;
     std::unique_ptr<extension::ExtensionManager> extensionManager;
+    std::unique_ptr<QueryAdmissionQueue> admissionQueue;
     QueryIDGenerator queryIDGenerator;
     std::shared_ptr<common::DatabaseLifeCycleManager> dbLifeCycleManager;
     std::vector<std::unique_ptr<extension::TransformerExtension>> transformerExtensions;
@@ -3,6 +3,7 @@
 #include <string>
 
 #include "common/types/value/value.h"
+#include "storage/enums/eviction_policy.h"
 
 namespace kuzu {
 namespace common {
@@ -65,6 +66,17 @@ struct DBConfig {
     uint64_t checkpointThreshold;
     bool forceCheckpointOnClose;
     bool enableSpillingToDisk;
+    storage::EvictionPolicy evictionPolicy;
+    bool enableHugePages;
+    bool bindBufferPoolToNumaNodes;
+    bool enableDirectIO;
+    bool enableBufferPoolWarmup;
+    uint64_t bufferPoolWarmupIntervalInMS;
+    bool enableMemoryMappedReads;
+    // Fraction of the data file that may be free before a checkpoint compacts it.
+    double compactionThreshold;
+    // Estimated memory of the heavy queries that may run at once. 0 disables admission control.
+    uint64_t admissionMemoryBudget;
 #if defined(__APPLE__)
     uint32_t threadQos;
 #endif
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "common/copy_constructors.h"
+
+namespace kuzu {
+namespace planner {
+class LogicalOperator;
+class LogicalPlan;
+} // namespace planner
+
+namespace main {
+
+class ClientContext;
+
+/*
+ * Limits the heavy queries running at once across connections by their estimated memory. A query
+ * is heavy if the hash tables, sort buffers and other intermediate results of its plan are
+ * estimated to take at least MIN_HEAVY_QUERY_MEMORY. Heavy queries are admitted in arrival order
+ * while the sum of their estimates fits into the admission_memory_budget setting, so that
+ * concurrent heavy queries don't push each other out of memory. A query estimated to exceed the
+ * budget on its own is admitted once no other heavy query runs. Light queries aren't queued.
+ */
+class QueryAdmissionQueue {
+public:
+    // Keeps a query admitted until it is destroyed.
+    class Ticket {
+    public:
+        Ticket(QueryAdmissionQueue& queue, uint64_t estimatedMemory)
+            : queue{queue}, estimatedMemory{estimatedMemory} {}
+        DELETE_COPY_AND_MOVE(Ticket);
+        ~Ticket() { queue.release(estimatedMemory); }
+
+    private:
+        QueryAdmissionQueue& queue;
+        uint64_t estimatedMemory;
+    };
+
+    static constexpr uint64_t MIN_HEAVY_QUERY_MEMORY = 16 * 1024 * 1024;
+    // Estimated bytes per value of a materialized tuple, including hash table overheads.
+    static constexpr uint64_t NUM_BYTES_PER_VALUE = 16;
+
+    QueryAdmissionQueue() = default;
+    DELETE_COPY_AND_MOVE(QueryAdmissionQueue);
+
+    // Blocks until the query of the plan can run, and returns the ticket that keeps it admitted,
+    // or nullptr if admission control is disabled or the query isn't heavy. Throws an
+    // InterruptException if the query is interrupted or times out while waiting.
+    std::unique_ptr<Ticket> admit(const planner::LogicalPlan& plan, ClientContext& context);
+
+    // Estimates the memory taken by the operators of the plan that materialize their input.
+    static uint64_t estimateMemory(const planner::LogicalPlan& plan);
+
+private:
+    static double estimateOperatorMemory(const planner::LogicalOperator& op);
+    void release(uint64_t estimatedMemory);
+
+private:
+    std::mutex mtx;
+    std::condition_variable queryReleased;
+    // IDs of the queries waiting for admission, in arrival order.
+    std::deque<uint64_t> waitingQueries;
+    uint64_t nextQueryID = 0;
+    uint64_t numAdmittedQueries = 0;
+    uint64_t admittedMemory = 0;
+};
+
+} // namespace main
+} // namespace kuzu
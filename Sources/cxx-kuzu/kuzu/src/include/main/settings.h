@@ -229,6 +229,72 @@ struct SpillToDiskSetting {
     }
 };
 
+struct ScanPrefetchDepthSetting {
+    static constexpr auto name = "scan_prefetch_depth";
+    static constexpr auto inputType = common::LogicalTypeID::UINT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct CompactionThresholdSetting {
+    static constexpr auto name = "compaction_threshold";
+    static constexpr auto inputType = common::LogicalTypeID::DOUBLE;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getDBConfig()->compactionThreshold);
+    }
+};
+
+struct EvictionPolicySetting {
+    static constexpr auto name = "eviction_policy";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct QueryMemoryLimitSetting {
+    static constexpr auto name = "query_memory_limit";
+    static constexpr auto inputType = common::LogicalTypeID::UINT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->queryMemoryLimit = parameter.getValue<uint64_t>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->queryMemoryLimit);
+    }
+};
+
+struct ConnectionMemoryLimitSetting {
+    static constexpr auto name = "connection_memory_limit";
+    static constexpr auto inputType = common::LogicalTypeID::UINT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->connectionMemoryLimit = parameter.getValue<uint64_t>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->connectionMemoryLimit);
+    }
+};
+
+struct MemoryLimitPolicySetting {
+    static constexpr auto name = "memory_limit_policy";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct AdmissionMemoryBudgetSetting {
+    static constexpr auto name = "admission_memory_budget";
+    static constexpr auto inputType = common::LogicalTypeID::UINT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getDBConfigUnsafe()->admissionMemoryBudget = parameter.getValue<uint64_t>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getDBConfig()->admissionMemoryBudget);
+    }
+};
+
 struct EnableOptimizerSetting {
     static constexpr auto name = "enable_plan_optimizer";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -6,6 +6,9 @@ namespace kuzu {
 namespace main {
 class ClientContext;
 }
+namespace planner {
+class CardinalityEstimator;
+}
 namespace optimizer {
 
 struct PredicateSet {
@@ -34,11 +37,15 @@ private:
 
 class FilterPushDownOptimizer {
 public:
-    explicit FilterPushDownOptimizer(main::ClientContext* context) : context{context} {
+    FilterPushDownOptimizer(main::ClientContext* context,
+        const planner::CardinalityEstimator& cardinalityEstimator)
+        : context{context}, cardinalityEstimator{cardinalityEstimator} {
         predicateSet = PredicateSet();
     }
-    explicit FilterPushDownOptimizer(main::ClientContext* context, PredicateSet predicateSet)
-        : predicateSet{std::move(predicateSet)}, context{context} {}
+    FilterPushDownOptimizer(main::ClientContext* context,
+        const planner::CardinalityEstimator& cardinalityEstimator, PredicateSet predicateSet)
+        : predicateSet{std::move(predicateSet)}, context{context},
+          cardinalityEstimator{cardinalityEstimator} {}
 
     void rewrite(planner::LogicalPlan* plan);
 
@@ -87,6 +94,7 @@ private:
 private:
     PredicateSet predicateSet;
     main::ClientContext* context;
+    const planner::CardinalityEstimator& cardinalityEstimator;
 };
 
 } // namespace optimizer
@@ -42,6 +42,9 @@ public:
     std::string getExpressionsForPrinting() const final;
 
     f_group_pos_set getGroupsPosToFlatten();
+    // The unFlat group of the child whose tuples are inserted one at a time, or
+    // INVALID_F_GROUP_POS.
+    f_group_pos getUnFlatGroupPos() const;
 
     const std::vector<LogicalInsertInfo>& getInfos() const { return infos; }
 
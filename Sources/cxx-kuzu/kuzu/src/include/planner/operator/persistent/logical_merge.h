@@ -22,6 +22,8 @@ public:
     std::string getExpressionsForPrinting() const override { return {}; }
 
     f_group_pos_set getGroupsPosToFlatten();
+    // The unFlat group of the child whose tuples are merged one at a time, or INVALID_F_GROUP_POS.
+    f_group_pos getUnFlatGroupPos() const;
 
     std::shared_ptr<binder::Expression> getExistenceMark() const { return existenceMark; }
 
@@ -10,6 +10,7 @@ namespace planner {
 enum class LogicalScanNodeTableType : uint8_t {
     SCAN = 0,
     PRIMARY_KEY_SCAN = 1,
+    SECONDARY_INDEX_SCAN = 2,
 };
 
 struct ExtraScanNodeTableInfo {
@@ -32,6 +33,27 @@ struct PrimaryKeyScanInfo final : ExtraScanNodeTableInfo {
     }
 };
 
+// Scans the nodes whose key in a secondary index falls in [lowerBound, upperBound]. A null bound
+// is unbounded.
+struct SecondaryIndexScanInfo final : ExtraScanNodeTableInfo {
+    std::string indexName;
+    std::shared_ptr<binder::Expression> lowerBound;
+    bool lowerInclusive;
+    std::shared_ptr<binder::Expression> upperBound;
+    bool upperInclusive;
+
+    SecondaryIndexScanInfo(std::string indexName, std::shared_ptr<binder::Expression> lowerBound,
+        bool lowerInclusive, std::shared_ptr<binder::Expression> upperBound, bool upperInclusive)
+        : indexName{std::move(indexName)}, lowerBound{std::move(lowerBound)},
+          lowerInclusive{lowerInclusive}, upperBound{std::move(upperBound)},
+          upperInclusive{upperInclusive} {}
+
+    std::unique_ptr<ExtraScanNodeTableInfo> copy() const override {
+        return std::make_unique<SecondaryIndexScanInfo>(indexName, lowerBound, lowerInclusive,
+            upperBound, upperInclusive);
+    }
+};
+
 struct LogicalScanNodeTablePrintInfo final : OPPrintInfo {
     std::shared_ptr<binder::Expression> nodeID;
     binder::expression_vector properties;
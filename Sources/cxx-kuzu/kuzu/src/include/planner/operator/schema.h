@@ -137,6 +137,10 @@ public:
     static f_group_pos getLeadingGroupPos(const std::unordered_set<f_group_pos>& groupPositions,
         const Schema& schema);
 
+    // Returns the unFlat group among the given groups, or INVALID_F_GROUP_POS if all are flat.
+    static f_group_pos getUnFlatGroupPos(const std::unordered_set<f_group_pos>& groupPositions,
+        const Schema& schema);
+
     static void validateAtMostOneUnFlatGroup(const std::unordered_set<f_group_pos>& groupPositions,
         const Schema& schema);
     static void validateNoUnFlatGroup(const std::unordered_set<f_group_pos>& groupPositions,
@@ -11,6 +11,7 @@ enum class SemiMaskTargetType : uint8_t {
     RECURSIVE_EXTEND_OUTPUT_NODE = 3,
     RECURSIVE_EXTEND_PATH_NODE = 4,
     GDS_GRAPH_NODE = 5,
+    GDS_INPUT_NODE = 6,
 };
 
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include "common/data_chunk/sel_vector.h"
 
 namespace kuzu {
@@ -26,5 +28,22 @@ protected:
     std::shared_ptr<common::SelectionVector> prevSelVector;
     std::shared_ptr<common::SelectionVector> currentSelVector;
 };
+
+// Runs a function on each tuple of an unflat data chunk within a single getNextTuple call by
+// temporarily flattening the chunk, the same way Flatten does across calls. Operators whose
+// executors only work on flat tuples use it to consume and produce whole vectors.
+class UnFlatTupleIterator {
+public:
+    UnFlatTupleIterator();
+
+    // A null state means the input is already flat, and the function is run once.
+    void init(common::DataChunkState* state_) { state = state_; }
+
+    void iterate(const std::function<void()>& func);
+
+private:
+    common::DataChunkState* state = nullptr;
+    std::shared_ptr<common::SelectionVector> flatSelVector;
+};
 } // namespace processor
 } // namespace kuzu
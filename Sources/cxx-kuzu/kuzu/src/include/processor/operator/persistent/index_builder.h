@@ -55,7 +55,8 @@ public:
         maybeConsumeIndex(index, errorHandler);
     }
 
-    void consume(NodeBatchInsertErrorHandler& errorHandler);
+    // Consumes the queues of all sub-indexes whose lock is free, starting from the given one.
+    void consume(NodeBatchInsertErrorHandler& errorHandler, size_t firstIndex);
 
     common::PhysicalTypeID pkTypeID() const;
 
@@ -139,8 +140,14 @@ public:
     explicit IndexBuilderSharedState(transaction::Transaction* transaction,
         storage::NodeTable* nodeTable)
         : globalQueues{transaction, nodeTable}, nodeTable(nodeTable) {}
-    void consume(NodeBatchInsertErrorHandler& errorHandler) {
-        return globalQueues.consume(errorHandler);
+    void consume(NodeBatchInsertErrorHandler& errorHandler, size_t firstIndex) {
+        return globalQueues.consume(errorHandler, firstIndex);
+    }
+    // Consumers start at different sub-indexes, so that concurrent consumers mostly work on
+    // disjoint sub-indexes instead of contending for the same locks.
+    size_t getNextConsumerStartIndex() {
+        return nextConsumer.fetch_add(1, std::memory_order_relaxed) * CONSUMER_STRIDE %
+               storage::NUM_HASH_INDEXES;
     }
 
     void addProducer() { producers.fetch_add(1, std::memory_order_relaxed); }
@@ -151,8 +158,12 @@ private:
     IndexBuilderGlobalQueues globalQueues;
     storage::NodeTable* nodeTable;
 
+    // Odd, so that the start indexes of the first NUM_HASH_INDEXES consumers are distinct.
+    static constexpr size_t CONSUMER_STRIDE = 97;
+
     std::atomic<size_t> producers;
     std::atomic<bool> done;
+    std::atomic<size_t> nextConsumer;
 };
 
 // RAII for producer counting.
@@ -202,6 +213,7 @@ private:
     std::shared_ptr<IndexBuilderSharedState> sharedState;
 
     IndexBuilderLocalBuffers localBuffers;
+    size_t consumerStartIndex;
 };
 
 } // namespace processor
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "insert_executor.h"
+#include "processor/operator/filtering_operator.h"
 #include "processor/operator/physical_operator.h"
 
 namespace kuzu {
@@ -24,15 +25,20 @@ private:
         : OPPrintInfo(other), expressions(other.expressions), action(other.action) {}
 };
 
+// Consumes and produces whole vectors. If possible, the nodes of all tuples in an unFlat input are
+// inserted together, with one batched insert per node table. Rels are inserted one tuple at a
+// time.
 class Insert final : public PhysicalOperator {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::INSERT;
 
 public:
     Insert(std::vector<NodeInsertExecutor> nodeExecutors,
-        std::vector<RelInsertExecutor> relExecutors, std::unique_ptr<PhysicalOperator> child,
-        uint32_t id, std::unique_ptr<OPPrintInfo> printInfo)
+        std::vector<RelInsertExecutor> relExecutors, data_chunk_pos_t unFlatChunkPos,
+        std::unique_ptr<PhysicalOperator> child, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)},
-          nodeExecutors{std::move(nodeExecutors)}, relExecutors{std::move(relExecutors)} {}
+          nodeExecutors{std::move(nodeExecutors)}, relExecutors{std::move(relExecutors)},
+          unFlatChunkPos{unFlatChunkPos} {}
 
     bool isParallel() const override { return false; }
 
@@ -42,12 +48,20 @@ public:
 
     std::unique_ptr<PhysicalOperator> copy() override {
         return std::make_unique<Insert>(copyVector(nodeExecutors), copyVector(relExecutors),
-            children[0]->copy(), id, printInfo->copy());
+            unFlatChunkPos, children[0]->copy(), id, printInfo->copy());
     }
 
+private:
+    void insertNodes(ExecutionContext* context);
+    void insertRels(ExecutionContext* context);
+
 private:
     std::vector<NodeInsertExecutor> nodeExecutors;
     std::vector<RelInsertExecutor> relExecutors;
+    // Position of the unFlat input chunk, or INVALID_DATA_CHUNK_POS if the input is flat.
+    data_chunk_pos_t unFlatChunkPos;
+    UnFlatTupleIterator tupleIterator;
+    bool insertNodesInBatch = false;
 };
 } // namespace processor
 } // namespace kuzu
@@ -28,6 +28,7 @@ struct NodeInsertInfo {
 
     void updateNodeID(common::nodeID_t nodeID) const;
     common::nodeID_t getNodeID() const;
+    common::nodeID_t getNodeID(common::sel_t pos) const;
 
 private:
     NodeInsertInfo(const NodeInsertInfo& other)
@@ -42,6 +43,10 @@ struct NodeTableInsertInfo {
 
     common::ValueVector* pkVector;
     std::vector<common::ValueVector*> columnDataVectors;
+    // Column data of batched inserts. Flat column data is broadcast into owned vectors that share
+    // the state of the batch, so that all columns have one row per inserted tuple.
+    std::vector<common::ValueVector*> batchDataVectors;
+    std::vector<std::unique_ptr<common::ValueVector>> broadcastVectors;
 
     NodeTableInsertInfo(storage::NodeTable* table,
         evaluator::evaluator_vector_t columnDataEvaluators)
@@ -49,6 +54,8 @@ struct NodeTableInsertInfo {
     EXPLICIT_COPY_DEFAULT_MOVE(NodeTableInsertInfo);
 
     void init(const ResultSet& resultSet, main::ClientContext* context);
+    bool initBatch(const std::shared_ptr<common::DataChunkState>& state,
+        storage::MemoryManager* mm);
 
 private:
     NodeTableInsertInfo(const NodeTableInsertInfo& other)
@@ -56,6 +63,9 @@ private:
           pkVector{nullptr} {}
 };
 
+// Node insert executors either insert one flat tuple at a time, or all tuples selected by the
+// state of an unFlat input at once. A batched insert probes the primary key index once and
+// appends all rows to local storage together.
 class NodeInsertExecutor {
 public:
     NodeInsertExecutor(NodeInsertInfo info, NodeTableInsertInfo tableInfo)
@@ -67,6 +77,14 @@ public:
     void setNodeIDVectorToNonNull() const;
     common::nodeID_t insert(main::ClientContext* context);
 
+    // Prepares inserting the tuples selected by the given unFlat state at once. Returns false if
+    // the output or the conflict action of this executor requires inserting one tuple at a time.
+    bool initBatch(const std::shared_ptr<common::DataChunkState>& state,
+        storage::MemoryManager* mm);
+    // Inserts the tuples currently selected by the state passed to initBatch().
+    void insertBatch(main::ClientContext* context);
+    common::nodeID_t getNodeID(common::sel_t pos) const { return info.getNodeID(pos); }
+
     // For MERGE, we might need to skip the insert for duplicate input. But still, we need to write
     // the output vector for later usage.
     void skipInsert() const;
@@ -80,6 +98,7 @@ private:
 private:
     NodeInsertInfo info;
     NodeTableInsertInfo tableInfo;
+    std::shared_ptr<common::DataChunkState> batchState;
 };
 
 struct RelInsertInfo {
@@ -122,6 +141,8 @@ private:
         : table{other.table}, columnDataEvaluators(copyVector(other.columnDataEvaluators)) {}
 };
 
+// Rel insert executors work on one flat tuple at a time. Operators with an unFlat input run them
+// per tuple through UnFlatTupleIterator.
 class RelInsertExecutor {
 public:
     RelInsertExecutor(RelInsertInfo info, RelTableInsertInfo tableInfo)
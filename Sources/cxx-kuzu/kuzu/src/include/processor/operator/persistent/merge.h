@@ -1,6 +1,7 @@
 #pragma once
 
 #include "insert_executor.h"
+#include "processor/operator/filtering_operator.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/result/pattern_creation_info_table.h"
 #include "set_executor.h"
@@ -13,18 +14,22 @@ struct MergeInfo {
     FactorizedTableSchema tableSchema;
     common::executor_info executorInfo;
     DataPos existenceMark;
+    // Position of the unFlat input chunk, or INVALID_DATA_CHUNK_POS if the input is flat.
+    data_chunk_pos_t unFlatChunkPos;
 
     MergeInfo(std::vector<std::unique_ptr<evaluator::ExpressionEvaluator>> keyEvaluators,
         FactorizedTableSchema tableSchema, common::executor_info executorInfo,
-        DataPos existenceMark)
+        DataPos existenceMark, data_chunk_pos_t unFlatChunkPos)
         : keyEvaluators{std::move(keyEvaluators)}, tableSchema{std::move(tableSchema)},
-          executorInfo{std::move(executorInfo)}, existenceMark{existenceMark} {}
+          executorInfo{std::move(executorInfo)}, existenceMark{existenceMark},
+          unFlatChunkPos{unFlatChunkPos} {}
     EXPLICIT_COPY_DEFAULT_MOVE(MergeInfo);
 
 private:
     MergeInfo(const MergeInfo& other)
         : keyEvaluators{copyVector(other.keyEvaluators)}, tableSchema{other.tableSchema.copy()},
-          executorInfo{other.executorInfo}, existenceMark{other.existenceMark} {}
+          executorInfo{other.executorInfo}, existenceMark{other.existenceMark},
+          unFlatChunkPos{other.unFlatChunkPos} {}
 };
 
 struct MergePrintInfo final : OPPrintInfo {
@@ -60,8 +65,16 @@ struct MergeLocalState {
     PatternCreationInfo getPatternCreationInfo() const {
         return hashTable->getPatternCreationInfo(keyVectors);
     }
+    std::vector<PatternCreationInfo> getPatternCreationInfos(
+        const common::DataChunkState& state) const {
+        return hashTable->getPatternCreationInfos(keyVectors, state);
+    }
 };
 
+// Consumes and produces whole vectors. For an unFlat input of node patterns, the keys of all
+// tuples whose pattern doesn't exist are deduplicated with one lookup in the pattern creation info
+// table, and the new nodes are inserted with one batched insert per node table. The set executors
+// then run per tuple in input order. Rel patterns are merged one tuple at a time.
 class Merge final : public PhysicalOperator {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::MERGE;
 
@@ -97,12 +110,18 @@ public:
     }
 
 private:
+    void executeTuple(ExecutionContext* context);
+
+    void executeBatch(ExecutionContext* context);
+
     void executeOnMatch(ExecutionContext* context);
 
     void executeOnCreatedPattern(PatternCreationInfo& info, ExecutionContext* context);
 
     void executeOnNewPattern(PatternCreationInfo& info, ExecutionContext* context);
 
+    void executeOnCreate(ExecutionContext* context);
+
     void executeNoMatch(ExecutionContext* context);
 
 private:
@@ -117,6 +136,12 @@ private:
 
     MergeInfo info;
     MergeLocalState localState;
+    UnFlatTupleIterator tupleIterator;
+    bool mergeInBatch = false;
+    std::shared_ptr<common::DataChunkState> batchState;
+    // Tuples whose pattern doesn't exist, and the ones among them that create a new pattern.
+    std::shared_ptr<common::SelectionVector> noMatchSelVector;
+    std::shared_ptr<common::SelectionVector> newPatternSelVector;
 };
 
 } // namespace processor
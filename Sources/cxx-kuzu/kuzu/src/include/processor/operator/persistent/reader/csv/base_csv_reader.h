@@ -67,6 +67,9 @@ public:
     }
     bool isEOF() const;
     uint64_t getFileSize();
+    // Extrapolates the number of lines in the first buffer to the whole file. Quoted newlines and
+    // headers are counted as rows, so this is only suitable for pre-sizing.
+    uint64_t estimateNumRows();
     // Get the file offset of the current buffer position.
     uint64_t getFileOffset() const;
 
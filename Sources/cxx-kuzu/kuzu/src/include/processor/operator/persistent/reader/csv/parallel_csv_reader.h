@@ -44,12 +44,15 @@ struct ParallelCSVScanSharedState final : public function::ScanFileWithProgressS
     common::CSVOption csvOption;
     CSVColumnInfo columnInfo;
     std::atomic<uint64_t> numBlocksReadByFiles = 0;
+    uint64_t estimatedNumRows = 0;
     std::vector<SharedFileErrorHandler> errorHandlers;
     populate_func_t populateErrorFunc;
 
     ParallelCSVScanSharedState(common::FileScanInfo fileScanInfo, uint64_t numRows,
         main::ClientContext* context, common::CSVOption csvOption, CSVColumnInfo columnInfo);
 
+    uint64_t getEstimatedNumRows() const override { return estimatedNumRows; }
+
     void setFileComplete(uint64_t completedFileIdx);
     populate_func_t constructPopulateFunc();
 };
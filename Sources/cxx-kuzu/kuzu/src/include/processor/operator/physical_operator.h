@@ -58,6 +58,7 @@ enum class PhysicalOperatorType : uint8_t {
     RESULT_COLLECTOR,
     SCAN_NODE_TABLE,
     SCAN_REL_TABLE,
+    SECONDARY_INDEX_SCAN_NODE_TABLE,
     SEMI_MASKER,
     SET_PROPERTY,
     SKIP,
@@ -84,9 +85,13 @@ struct PhysicalOperatorUtils {
 struct OperatorMetrics {
     common::TimeMetric& executionTime;
     common::NumericMetric& numOutputTuple;
+    common::NumericMetric& numPageFaults;
+    common::NumericMetric& numTLBMisses;
 
-    OperatorMetrics(common::TimeMetric& executionTime, common::NumericMetric& numOutputTuple)
-        : executionTime{executionTime}, numOutputTuple{numOutputTuple} {}
+    OperatorMetrics(common::TimeMetric& executionTime, common::NumericMetric& numOutputTuple,
+        common::NumericMetric& numPageFaults, common::NumericMetric& numTLBMisses)
+        : executionTime{executionTime}, numOutputTuple{numOutputTuple},
+          numPageFaults{numPageFaults}, numTLBMisses{numTLBMisses} {}
 };
 
 using physical_op_vector_t = std::vector<std::unique_ptr<PhysicalOperator>>;
@@ -131,7 +136,7 @@ public:
 
     virtual void finalize(ExecutionContext* context);
 
-    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+    virtual std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
         common::Profiler& profiler) const;
     std::vector<std::string> getProfilerAttributes(common::Profiler& profiler) const;
 
@@ -158,11 +163,16 @@ protected:
 
     std::string getTimeMetricKey() const { return "time-" + std::to_string(id); }
     std::string getNumTupleMetricKey() const { return "numTuple-" + std::to_string(id); }
+    std::string getPageFaultMetricKey() const { return "pageFaults-" + std::to_string(id); }
+    std::string getTLBMissMetricKey() const { return "tlbMisses-" + std::to_string(id); }
 
     void registerProfilingMetrics(common::Profiler* profiler);
 
     double getExecutionTime(common::Profiler& profiler) const;
     uint64_t getNumOutputTuples(common::Profiler& profiler) const;
+    // Page faults and TLB misses are counted including children, like the execution time.
+    uint64_t getExclusiveCount(common::Profiler& profiler,
+        std::string (PhysicalOperator::*getMetricKey)() const) const;
 
     virtual void finalizeInternal(ExecutionContext* /*context*/) {}
 
@@ -38,8 +38,14 @@ public:
 
     bool isParallel() const override { return false; }
 
+    void initLocalStateInternal(ResultSet* resultSet_, ExecutionContext* context) override;
+
     void executeInternal(ExecutionContext* context) override;
 
+    // Adds the number of iterations the recursive join ran on a sparse frontier.
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     std::unique_ptr<PhysicalOperator> copy() override {
         return std::make_unique<RecursiveExtend>(function->copy(), bindData, sharedState, id,
             printInfo->copy());
@@ -49,6 +55,11 @@ private:
     std::unique_ptr<function::RJAlgorithm> function;
     function::RJBindData bindData;
     std::shared_ptr<RecursiveExtendSharedState> sharedState;
+    common::NumericMetric* numSparseIterations = nullptr;
+
+    std::string getSparseIterationMetricKey() const {
+        return "sparseIterations-" + std::to_string(id);
+    }
 };
 
 } // namespace processor
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "expression_evaluator/expression_evaluator.h"
+#include "processor/operator/scan/scan_node_table.h"
+
+namespace kuzu {
+namespace storage {
+class OrderedIndex;
+} // namespace storage
+
+namespace processor {
+
+struct SecondaryIndexScanPrintInfo final : OPPrintInfo {
+    binder::expression_vector expressions;
+    std::string indexName;
+    std::string range;
+    std::string alias;
+
+    SecondaryIndexScanPrintInfo(binder::expression_vector expressions, std::string indexName,
+        std::string range, std::string alias)
+        : expressions(std::move(expressions)), indexName{std::move(indexName)},
+          range{std::move(range)}, alias{std::move(alias)} {}
+
+    std::string toString() const override;
+
+    std::unique_ptr<OPPrintInfo> copy() const override {
+        return std::unique_ptr<SecondaryIndexScanPrintInfo>(new SecondaryIndexScanPrintInfo(*this));
+    }
+
+private:
+    SecondaryIndexScanPrintInfo(const SecondaryIndexScanPrintInfo& other)
+        : OPPrintInfo(other), expressions(other.expressions), indexName{other.indexName},
+          range{other.range}, alias(other.alias) {}
+};
+
+// A bound of the index range. The evaluator is null if the range is unbounded on that side.
+struct SecondaryIndexScanBound {
+    std::unique_ptr<evaluator::ExpressionEvaluator> evaluator;
+    bool inclusive;
+
+    SecondaryIndexScanBound(std::unique_ptr<evaluator::ExpressionEvaluator> evaluator,
+        bool inclusive)
+        : evaluator{std::move(evaluator)}, inclusive{inclusive} {}
+    EXPLICIT_COPY_DEFAULT_MOVE(SecondaryIndexScanBound);
+
+private:
+    SecondaryIndexScanBound(const SecondaryIndexScanBound& other)
+        : evaluator{other.evaluator == nullptr ? nullptr : other.evaluator->copy()},
+          inclusive{other.inclusive} {}
+};
+
+// Scans the nodes of a single table whose key in an ordered secondary index falls in a range.
+// The index returns candidates only, so the predicates are re-evaluated by a filter on top.
+class SecondaryIndexScanNodeTable final : public ScanTable {
+    static constexpr PhysicalOperatorType type_ =
+        PhysicalOperatorType::SECONDARY_INDEX_SCAN_NODE_TABLE;
+
+public:
+    SecondaryIndexScanNodeTable(ScanOpInfo opInfo, ScanNodeTableInfo tableInfo,
+        std::string indexName, SecondaryIndexScanBound lowerBound,
+        SecondaryIndexScanBound upperBound, physical_op_id id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : ScanTable{type_, std::move(opInfo), id, std::move(printInfo)},
+          tableInfo{std::move(tableInfo)}, indexName{std::move(indexName)},
+          lowerBound{std::move(lowerBound)}, upperBound{std::move(upperBound)}, index{nullptr},
+          scanState{nullptr}, lookedUp{false}, cursor{0} {}
+
+    bool isSource() const override { return true; }
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    bool isParallel() const override { return false; }
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        return std::make_unique<SecondaryIndexScanNodeTable>(opInfo.copy(), tableInfo.copy(),
+            indexName, lowerBound.copy(), upperBound.copy(), id, printInfo->copy());
+    }
+
+private:
+    void lookupIndex(const transaction::Transaction* transaction);
+
+private:
+    ScanNodeTableInfo tableInfo;
+    std::string indexName;
+    SecondaryIndexScanBound lowerBound;
+    SecondaryIndexScanBound upperBound;
+
+    storage::OrderedIndex* index;
+    std::unique_ptr<storage::NodeTableScanState> scanState;
+    bool lookedUp;
+    std::vector<common::offset_t> offsets;
+    common::idx_t cursor;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -24,11 +24,13 @@ public:
         std::vector<common::LogicalType> keyTypes, FactorizedTableSchema tableSchema);
 
     PatternCreationInfo getPatternCreationInfo(const std::vector<common::ValueVector*>& keyVectors);
-
-    uint64_t matchFTEntries(std::span<const common::ValueVector*> keyVectors,
-        uint64_t numMayMatches, uint64_t numNoMatches) override;
+    // Looks up the keys of all tuples selected by the unFlat state in one pass. Only the first
+    // tuple of a key that has not been seen before gets hasCreated set to false.
+    std::vector<PatternCreationInfo> getPatternCreationInfos(
+        const std::vector<common::ValueVector*>& keyVectors, const common::DataChunkState& state);
 
 private:
+    // Only used for constant keys.
     uint8_t* tuple;
     ft_col_offset_t idColOffset;
 };
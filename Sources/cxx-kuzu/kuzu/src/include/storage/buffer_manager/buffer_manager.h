@@ -7,8 +7,12 @@
 #include <vector>
 
 #include "common/types/types.h"
+#include "storage/buffer_manager/decompressed_page_cache.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/page_prefetcher.h"
 #include "storage/buffer_manager/page_state.h"
+#include "storage/buffer_manager/vm_region.h"
+#include "storage/enums/eviction_policy.h"
 #include "storage/enums/page_read_policy.h"
 #include "storage/file_handle.h"
 
@@ -26,6 +30,7 @@ class CopyTestHelper;
 }; // namespace testing
 namespace storage {
 class ChunkedNodeGroup;
+class MemoryTracker;
 class Spiller;
 
 // This class keeps state info for pages potentially can be evicted.
@@ -178,6 +183,12 @@ private:
  * 7. During eviction, if the page is in the MARKED state, it will be LOCKED first (7.1), then
  * removed from its frame, and set to EVICTED (7.2).
  *
+ * Under the SCAN_RESISTANT eviction policy, pages that sequential scans load (directly or through
+ * the prefetcher) are unpinned straight into MARKED, and scans read MARKED pages without clearing
+ * the mark. Such pages are evicted by the next sweep unless a non-scan access promotes them (3.),
+ * so that a large scan cycles through its own pages instead of flushing the working set of point
+ * lookups.
+ *
  * The design is inspired by vmcache in the paper "Virtual-Memory Assisted Buffer Management"
  * (https://www.cs.cit.tum.de/fileadmin/w00cfj/dis/_my_direct_uploads/vmcache.pdf).
  * We would also like to thank Fadhil Abubaker for doing the initial research and prototyping of
@@ -191,10 +202,17 @@ class BufferManager {
 
     friend class FileHandle;
     friend class MemoryManager;
+    friend class DecompressedPageCache;
+    friend class PagePrefetcher;
+    friend class BufferPoolWarmer;
 
 public:
+    // Number of pages sequential scans request ahead of the page they read.
+    static constexpr uint64_t DEFAULT_PREFETCH_DEPTH = 16;
+
     BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
-        uint64_t bufferPoolSize, uint64_t maxDBSize, common::VirtualFileSystem* vfs, bool readOnly);
+        uint64_t bufferPoolSize, uint64_t maxDBSize, common::VirtualFileSystem* vfs, bool readOnly,
+        VMRegionConfig vmRegionConfig = {});
     virtual ~BufferManager();
 
     // Currently, these functions are specifically used only for WAL files.
@@ -212,6 +230,8 @@ public:
 
     uint64_t getMemoryLimit() const { return bufferPoolSize; }
     uint64_t getUsedMemory() const { return usedMemory; }
+    // Whether memory that can't be evicted takes up more than half of the buffer pool.
+    bool isUnderMemoryPressure() const { return nonEvictableMemory > bufferPoolSize / 2; }
 
     void getSpillerOrSkip(std::function<void(Spiller&)> func) {
         if (spiller) {
@@ -220,6 +240,33 @@ public:
     }
 
     void resetSpiller(std::string spillPath);
+    // Spills the next group of chunks waiting in the spiller whose memory is charged to the given
+    // tracker. Returns the number of bytes that are no longer pinned, which is zero if there is
+    // nothing to spill.
+    uint64_t spillNextGroup(const MemoryTracker& owner);
+
+    DecompressedPageCache& getDecompressedPageCache() { return *decompressedPageCache; }
+
+    // Asynchronously loads the pages that aren't cached yet.
+    void prefetch(FileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages) {
+        prefetcher->prefetch(fileHandle, startPageIdx, numPages);
+    }
+    PagePrefetcher& getPrefetcher() { return *prefetcher; }
+    uint64_t getPrefetchDepth() const { return prefetchDepth; }
+    void setPrefetchDepth(uint64_t depth) { prefetchDepth = depth; }
+    uint64_t getNumPrefetchedPages() const { return numPrefetchedPages; }
+    // Number of prefetched pages that were accessed before being evicted.
+    uint64_t getNumPrefetchHits() const { return numPrefetchHits; }
+    // Number of pages loaded by the buffer pool warmer after the database was opened.
+    uint64_t getNumWarmedPages() const { return numWarmedPages; }
+
+    EvictionPolicy getEvictionPolicy() const { return evictionPolicy; }
+    void setEvictionPolicy(EvictionPolicy policy) { evictionPolicy = policy; }
+    // File handles in registration order, for reporting per-file statistics.
+    std::vector<const FileHandle*> getFileHandles() const;
+    // Whether the frames of the page size class are backed by huge pages.
+    bool usesHugePages(common::PageSizeClass pageSizeClass) const;
 
     // This function only works when run in a single-threaded context
     // Iterates through the eviction queue and removes any elements that have already been evicted
@@ -235,7 +282,8 @@ private:
     uint8_t* pin(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy = PageReadPolicy::READ_PAGE);
     void optimisticRead(FileHandle& fileHandle, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& func);
+        const std::function<void(uint8_t*)>& func,
+        PageAccessType accessType = PageAccessType::RANDOM);
     // The function assumes that the requested page is already pinned.
     void unpin(FileHandle& fileHandle, common::page_idx_t pageIdx);
     uint8_t* getFrame(FileHandle& fileHandle, common::page_idx_t pageIdx) const {
@@ -279,6 +327,25 @@ private:
 
     uint64_t evictPages();
 
+    // Caches a page locked by the caller from the given data, or by reading it from disk if data is
+    // null. On failure the page is reset to evicted and false is returned; on success it is left
+    // locked.
+    bool cacheLockedPage(FileHandle& fileHandle, common::page_idx_t pageIdx, const uint8_t* data);
+    // Returns false if the page removal version of the file differs from the given one, in which
+    // case the page is left evicted, as it may have been read before it was freed or rewritten.
+    bool prefetchPage(FileHandle& fileHandle, common::page_idx_t pageIdx,
+        uint64_t pageRemovalVersion);
+    // Reads the evicted pages of the range with a single read into the buffer, which must hold
+    // numPages pages, and caches them. Returns the number of pages cached. Nothing is cached if the
+    // page removal version of the file differs from the given one once the pages are read.
+    common::page_idx_t warmPages(FileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages, uint8_t* buffer, uint64_t pageRemovalVersion);
+    void recordPrefetchHit(PageState& pageState) {
+        if (pageState.tryClearPrefetched()) {
+            numPrefetchHits++;
+        }
+    }
+
 private:
     std::atomic<uint64_t> bufferPoolSize;
     EvictionQueue evictionQueue;
@@ -292,6 +359,15 @@ private:
     std::vector<std::unique_ptr<FileHandle>> fileHandles;
     std::unique_ptr<Spiller> spiller;
     common::VirtualFileSystem* vfs;
+    // Declared last, since releasing cached pages updates the memory counters above.
+    std::unique_ptr<DecompressedPageCache> decompressedPageCache;
+    std::atomic<uint64_t> prefetchDepth;
+    std::atomic<uint64_t> numPrefetchedPages;
+    std::atomic<uint64_t> numPrefetchHits;
+    std::atomic<uint64_t> numWarmedPages;
+    std::atomic<EvictionPolicy> evictionPolicy;
+    // Destroyed first, so that its workers stop before the file handles go away.
+    std::unique_ptr<PagePrefetcher> prefetcher;
 };
 
 } // namespace storage
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/copy_constructors.h"
+#include "common/types/types.h"
+#include "storage/page_range.h"
+
+namespace kuzu {
+namespace common {
+class VirtualFileSystem;
+} // namespace common
+
+namespace storage {
+
+class BufferManager;
+class FileHandle;
+
+// Keeps the buffer pool warm across restarts. When the database is opened, a background thread
+// reloads the pages of the data file recorded by the last run with large sequential reads,
+// throttled so that foreground queries still get most of the I/O bandwidth. Loading stops early
+// when the buffer pool is close to full, so that it doesn't evict pages queries brought in. Once
+// done, the thread periodically records the pages that are cached to a side file, which is also
+// rewritten on close. Read-only opens only reload pages, since other processes may have the
+// database open as well. The side file is checksummed, and a recording that doesn't match its
+// checksum, e.g. one torn by a crash, is ignored.
+//
+// Pages written to the file without going through the buffer pool must not be reloaded, as the
+// stale copy would stay cached. Only pages in use when the database was opened are reloaded,
+// loading pauses while checkpoints rewrite pages in place, and it stops once a page is freed,
+// since freed pages are reused and written directly.
+class BufferPoolWarmer {
+public:
+    static constexpr uint64_t FILE_MAGIC = 0x4B555A5557524D55; // "KUZUWRMU"
+    static constexpr uint64_t FILE_VERSION = 2;
+    // Maximum number of consecutive pages read at once.
+    static constexpr common::page_idx_t MAX_NUM_PAGES_PER_READ = 64;
+    static constexpr uint64_t MAX_RESTORE_BYTES_PER_SEC = 256 * 1024 * 1024;
+    // Fraction of the buffer pool that restored pages may fill.
+    static constexpr double MAX_BUFFER_POOL_USAGE_RATIO = 0.9;
+
+    BufferPoolWarmer(BufferManager& bm, FileHandle& dataFH, common::VirtualFileSystem* vfs,
+        std::string warmupFilePath, uint64_t recordIntervalInMS, bool readOnly);
+    DELETE_COPY_AND_MOVE(BufferPoolWarmer);
+    // Stops the background thread and records the cached pages a last time, unless reloading was
+    // interrupted, in which case the previous recording is kept.
+    ~BufferPoolWarmer();
+
+    // Starts the background thread.
+    void start();
+    // Blocks until the pages of the last recording are reloaded.
+    void waitForRestore();
+    // Writes the ranges of pages that are currently cached to the side file. Does nothing if the
+    // database is opened read-only.
+    void record();
+
+private:
+    static uint64_t computeChecksum(const std::vector<common::page_idx_t>& startPageIdxes,
+        const std::vector<common::page_idx_t>& numPages);
+    std::vector<PageRange> getCachedPageRanges();
+    std::vector<PageRange> readPageRanges() const;
+    // Drops the pages that weren't in use when the database was opened from the ranges.
+    std::vector<PageRange> removePagesNotInUseAtOpen(const std::vector<PageRange>& ranges) const;
+    void restore();
+    void run();
+    // Waits for the given duration, returning false if the warmer is stopped meanwhile.
+    bool sleepFor(std::chrono::microseconds duration);
+
+private:
+    BufferManager& bm;
+    FileHandle& dataFH;
+    common::VirtualFileSystem* vfs;
+    std::string warmupFilePath;
+    uint64_t recordIntervalInMS;
+    bool readOnly;
+    common::page_idx_t numPagesAtOpen;
+    // Sorted by start page.
+    std::vector<PageRange> freePageRangesAtOpen;
+    uint64_t pageRemovalVersionAtOpen;
+    std::mutex mtx;
+    std::condition_variable stopRequested;
+    std::condition_variable restoreFinished;
+    bool stopped;
+    bool restoreDone;
+    bool restoreInterrupted;
+    std::thread worker;
+};
+
+} // namespace storage
+} // namespace kuzu
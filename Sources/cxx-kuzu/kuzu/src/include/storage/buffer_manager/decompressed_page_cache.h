@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "storage/compression/block_compression.h"
+
+namespace kuzu {
+namespace storage {
+
+class BufferManager;
+class FileHandle;
+
+// Caches the decompressed pages of block compressed column chunks, so that scans and lookups of
+// cold node groups don't decompress a chunk for every page they read. Entries are keyed by the
+// first page of the chunk and dropped once that page is freed. The cache's memory is reserved
+// from the buffer manager, which evicts cached chunks before giving up on a reservation.
+class DecompressedPageCache {
+public:
+    // The cache holds at most 1/CAPACITY_RATIO of the buffer pool.
+    static constexpr uint64_t CAPACITY_RATIO = 8;
+
+    explicit DecompressedPageCache(BufferManager& bm) : bm{bm}, memoryUsage{0}, numEntries{0} {}
+
+    // Returns the decompressed pages of the chunk starting at the first page of the range.
+    std::shared_ptr<const uint8_t[]> getPages(FileHandle& fileHandle, PageRange pageRange,
+        const BlockCompressionMetadata& metadata);
+
+    void invalidate(common::file_idx_t fileIdx, common::page_idx_t pageIdx);
+    // Drops least recently used entries until the given number of bytes is released, and returns
+    // the number of bytes released. Entries still held by readers are dropped, but their memory is
+    // only released once the readers are done.
+    uint64_t evict(uint64_t sizeToEvict);
+
+    uint64_t getMemoryUsage() const { return memoryUsage; }
+
+private:
+    struct Entry {
+        uint64_t key;
+        uint64_t size;
+        std::shared_ptr<const uint8_t[]> pages;
+    };
+
+    static uint64_t getKey(common::file_idx_t fileIdx, common::page_idx_t pageIdx) {
+        return static_cast<uint64_t>(fileIdx) << 32 | pageIdx;
+    }
+
+    uint64_t evictNoLock(uint64_t sizeToEvict);
+    void releaseMemory(uint64_t size);
+
+private:
+    BufferManager& bm;
+    std::mutex mtx;
+    // Most recently used entries are at the front.
+    std::list<Entry> lruList;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> entries;
+    // Size of all decompressed pages alive, including those of dropped entries readers still hold.
+    std::atomic<uint64_t> memoryUsage;
+    std::atomic<uint64_t> numEntries;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <stack>
+#include <vector>
 
 #include "common/system_config.h"
 #include "common/types/types.h"
@@ -19,6 +22,7 @@ class VirtualFileSystem;
 namespace storage {
 
 class MemoryManager;
+class MemoryTracker;
 class FileHandle;
 class BufferManager;
 class ChunkedNodeGroup;
@@ -27,6 +31,7 @@ class MmAllocator;
 
 class MemoryBuffer {
     friend class Spiller;
+    friend class MemoryManager;
 
 public:
     KUZU_API MemoryBuffer(MemoryManager* mm, common::page_idx_t blockIdx, uint8_t* buffer,
@@ -58,6 +63,8 @@ private:
     MemoryManager* mm;
     common::page_idx_t pageIdx;
     bool evicted;
+    // The tracker of the query that allocated the buffer, if any.
+    std::shared_ptr<MemoryTracker> tracker;
 };
 
 /*
@@ -74,6 +81,19 @@ private:
  *
  * MM will return a MemoryBuffer to the caller, which is a wrapper of the allocated memory block,
  * and it will automatically call its allocator to reclaim the memory block when it is destroyed.
+ *
+ * To keep threads from contending on the global free page stack, each thread is assigned one of
+ * NUM_CACHE_SLOTS cache slots, which keep a small number of free pages and move them to and from
+ * the global stack in batches. Allocations smaller than a page are rounded up to a power of two
+ * size class, and freed blocks are kept in the slot of the freeing thread so that later
+ * allocations of the same class can reuse them instead of calling malloc. Small allocations are
+ * charged the size of their class. Cached blocks stay counted as used memory of the buffer manager,
+ * so the number of bytes a slot caches is capped, and all cached blocks are freed when the buffer
+ * pool can't make room for a new block.
+ *
+ * Buffers allocated on a thread working on a query are charged to the query's MemoryTracker
+ * before any memory is taken from the buffer pool, so that a query over its limit fails, waits or
+ * spills without evicting the pages of other queries.
  */
 class KUZU_API MemoryManager {
     friend class MemoryBuffer;
@@ -81,9 +101,28 @@ class KUZU_API MemoryManager {
     friend class MmAllocator;
 
 public:
+    static constexpr uint64_t NUM_CACHE_SLOTS = 32;
+    // Number of pages moved between a cache slot and the global free page stack at a time. A slot
+    // holds at most twice as many pages.
+    static constexpr uint64_t PAGE_CACHE_BATCH_SIZE = 8;
+    static constexpr uint64_t MIN_SIZE_CLASS_LOG2 = 6;
+    static constexpr uint64_t MAX_SIZE_CLASS_LOG2 = 17;
+    static constexpr uint64_t NUM_SIZE_CLASSES = MAX_SIZE_CLASS_LOG2 - MIN_SIZE_CLASS_LOG2 + 1;
+    static constexpr uint64_t MAX_CACHED_BYTES_PER_SLOT = 512 * 1024;
+
+    struct Stats {
+        uint64_t numPageAllocations;
+        uint64_t numPageCacheHits;
+        uint64_t numGlobalPoolRefills;
+        uint64_t numGlobalPoolReturns;
+        uint64_t numSmallAllocations;
+        uint64_t numSmallAllocationCacheHits;
+        uint64_t numLockContentions;
+    };
+
     MemoryManager(BufferManager* bm, common::VirtualFileSystem* vfs);
 
-    ~MemoryManager() = default;
+    ~MemoryManager();
 
     std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false,
         uint64_t size = common::TEMP_PAGE_SIZE);
@@ -91,10 +130,34 @@ public:
 
     BufferManager* getBufferManager() const { return bm; }
 
+    Stats getStats() const;
+
 private:
+    struct CacheSlot {
+        std::mutex mtx;
+        std::vector<common::page_idx_t> freePages;
+        std::array<std::vector<uint8_t*>, NUM_SIZE_CLASSES> freeBlocks;
+        uint64_t numCachedBytes = 0;
+    };
+
+    // Returns the memory an allocation of the given size is charged, i.e. the size of its class.
+    static uint64_t getAllocationSize(uint64_t size);
+
+    std::unique_ptr<MemoryBuffer> allocateUntrackedBuffer(bool initializeToZero, uint64_t size);
+    // Frees the block and its used memory. Small blocks may be cached instead.
     void freeBlock(common::page_idx_t pageIdx, std::span<uint8_t> buffer);
-    void updateUsedMemoryForFreedBlock(common::page_idx_t pageIdx, std::span<uint8_t> buffer);
+    // Frees the block without caching it or releasing its used memory, which the caller releases.
+    void freeBlockUncached(common::page_idx_t pageIdx, std::span<uint8_t> buffer);
     std::span<uint8_t> mallocBuffer(bool initializeToZero, uint64_t size);
+    void reserveMemory(uint64_t size);
+    // Frees the cached blocks of all slots, and returns the number of bytes freed.
+    uint64_t freeCachedBlocks();
+
+    common::page_idx_t allocatePage();
+    void freePage(common::page_idx_t pageIdx);
+    CacheSlot& getCacheSlot();
+    // Locks allocatorLock, counting the times it is held by another thread.
+    std::unique_lock<std::mutex> lockAllocator();
 
 private:
     FileHandle* fh;
@@ -102,6 +165,15 @@ private:
     common::page_offset_t pageSize;
     std::stack<common::page_idx_t> freePages;
     std::mutex allocatorLock;
+    std::array<CacheSlot, NUM_CACHE_SLOTS> cacheSlots;
+
+    std::atomic<uint64_t> numPageAllocations;
+    std::atomic<uint64_t> numPageCacheHits;
+    std::atomic<uint64_t> numGlobalPoolRefills;
+    std::atomic<uint64_t> numGlobalPoolReturns;
+    std::atomic<uint64_t> numSmallAllocations;
+    std::atomic<uint64_t> numSmallAllocationCacheHits;
+    std::atomic<uint64_t> numLockContentions;
 };
 
 } // namespace storage
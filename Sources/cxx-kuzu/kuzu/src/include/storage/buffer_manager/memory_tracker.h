@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "common/api.h"
+#include "common/copy_constructors.h"
+#include "storage/enums/memory_limit_policy.h"
+
+namespace kuzu {
+namespace storage {
+
+class BufferManager;
+
+/*
+ * Counts the memory allocated through MemoryBuffers on behalf of a query or a connection, and
+ * enforces a limit on it. A query's tracker has the tracker of its connection as parent, so that
+ * an allocation is counted against both limits.
+ *
+ * The tracker of the running query is installed as the current tracker of the threads working on
+ * it, which MemoryManager charges on allocation. Each MemoryBuffer keeps the tracker it was charged
+ * to, so that the memory is released correctly no matter which thread frees the buffer, or whether
+ * the query has finished by then, e.g. for the buffers holding its result.
+ *
+ * Memory that tables take ownership of, e.g. the node groups appended by COPY or at commit and
+ * the values of updates, outlives the query and its connection. Tables allocate it in a Scope
+ * without tracker, so that it is never charged to them.
+ */
+class KUZU_API MemoryTracker {
+public:
+    // Installs a tracker as the current tracker of the thread for the lifetime of the scope. With
+    // a null tracker, allocations in the scope are untracked.
+    class KUZU_API Scope {
+    public:
+        explicit Scope(std::shared_ptr<MemoryTracker> tracker);
+        DELETE_COPY_AND_MOVE(Scope);
+        ~Scope();
+
+    private:
+        std::shared_ptr<MemoryTracker> prevTracker;
+    };
+
+    // Time a WAIT allocation blocks before it fails, if the query has no timeout.
+    static constexpr uint64_t DEFAULT_MAX_WAIT_TIME_IN_MS = 10000;
+
+    // A limit of zero means there is no limit.
+    MemoryTracker(std::string name, uint64_t limit, MemoryLimitPolicy policy,
+        uint64_t maxWaitTimeInMS = DEFAULT_MAX_WAIT_TIME_IN_MS,
+        std::shared_ptr<MemoryTracker> parent = nullptr);
+    DELETE_COPY_AND_MOVE(MemoryTracker);
+
+    static std::shared_ptr<MemoryTracker> getCurrent();
+
+    // Counts the memory against this tracker and its ancestors. If a limit would be exceeded, the
+    // policy is applied, and a BufferManagerException is thrown if it can't make room.
+    void reserve(uint64_t size, BufferManager& bm);
+    // Counts the memory without checking the limits, e.g. for spilled data that is loaded back.
+    void forceReserve(uint64_t size);
+    void release(uint64_t size);
+
+    void setLimit(uint64_t limit_) { limit = limit_; }
+    uint64_t getLimit() const { return limit; }
+    uint64_t getUsedMemory() const { return usedMemory; }
+    uint64_t getPeakMemory() const { return peakMemory; }
+
+private:
+    // Returns the tracker whose limit would be exceeded, or nullptr if the memory is reserved.
+    MemoryTracker* tryReserve(uint64_t size);
+    void updatePeakMemory(uint64_t used);
+    // Waits until memory is released or the deadline passes. Returns false in the latter case.
+    bool waitForRelease(std::chrono::steady_clock::time_point deadline);
+
+private:
+    std::string name;
+    std::atomic<uint64_t> limit;
+    MemoryLimitPolicy policy;
+    uint64_t maxWaitTimeInMS;
+    std::shared_ptr<MemoryTracker> parent;
+    std::atomic<uint64_t> usedMemory;
+    std::atomic<uint64_t> peakMemory;
+    std::mutex mtx;
+    std::condition_variable memoryReleased;
+    std::atomic<uint64_t> numWaiters;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -13,8 +13,10 @@ public:
     explicit MmAllocator(MemoryManager* mm) : mm{mm} {}
 
     MmAllocator(const MmAllocator& other) : mm{other.mm} {}
+    // Node-based containers allocate their nodes through a copy rebound to the node type.
+    template<class U>
+    MmAllocator(const MmAllocator<U>& other) : mm{other.getMemoryManager()} {}
     MmAllocator& operator=(const MmAllocator& other) = default;
-    DELETE_BOTH_MOVE(MmAllocator);
 
     [[nodiscard]] T* allocate(const std::size_t size) {
         KU_ASSERT_UNCONDITIONAL(mm != nullptr);
@@ -41,13 +43,15 @@ public:
         }
     }
 
+    MemoryManager* getMemoryManager() const { return mm; }
+
 private:
     MemoryManager* mm;
 };
 
 template<class T, class U>
 bool operator==(const MmAllocator<T>& a, const MmAllocator<U>& b) {
-    return a.mm == b.mm;
+    return a.getMemoryManager() == b.getMemoryManager();
 }
 
 } // namespace storage
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/copy_constructors.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace storage {
+
+class BufferManager;
+class FileHandle;
+
+// Loads pages into the buffer pool on background threads ahead of sequential scans, so that a
+// scan finds the pages it reaches next already cached instead of reading them one at a time.
+// Requests are hints: they are dropped when the queue is full, and pages that are already cached
+// or can't get a frame are skipped. A request is dropped as well once pages of its file are freed
+// or rewritten in place, since its pages may have been read before the change.
+class PagePrefetcher {
+public:
+    // Drops the queued requests and keeps new ones from being queued for its lifetime, e.g. while
+    // a checkpoint writes pages in place. Requests being loaded are waited for.
+    class PauseScope {
+    public:
+        explicit PauseScope(PagePrefetcher& prefetcher) : prefetcher{prefetcher} {
+            prefetcher.pause();
+        }
+        DELETE_COPY_AND_MOVE(PauseScope);
+        ~PauseScope() { prefetcher.resume(); }
+
+    private:
+        PagePrefetcher& prefetcher;
+    };
+
+    static constexpr uint64_t NUM_THREADS = 2;
+    static constexpr uint64_t MAX_NUM_PENDING_REQUESTS = 256;
+
+    explicit PagePrefetcher(BufferManager& bm)
+        : bm{bm}, numActiveWorkers{0}, numPauses{0}, stopped{false} {}
+    DELETE_COPY_AND_MOVE(PagePrefetcher);
+    ~PagePrefetcher();
+
+    void prefetch(FileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages);
+    // Drops the queued requests and joins the workers. Later requests are ignored. Called before
+    // the files the requests point to are closed.
+    void stop();
+    // Runs a load of pages that doesn't go through the queue, e.g. by the buffer pool warmer, as if
+    // it were a request being loaded, so that pausing waits for it. Returns false without running
+    // it if prefetching is paused or stopped.
+    bool runUnlessPaused(const std::function<void()>& load);
+
+private:
+    struct Request {
+        FileHandle* fileHandle;
+        common::page_idx_t startPageIdx;
+        common::page_idx_t numPages;
+        // The page removal version of the file when the request was queued.
+        uint64_t pageRemovalVersion;
+    };
+
+    void pause();
+    void resume();
+    void runWorker();
+
+private:
+    BufferManager& bm;
+    std::mutex mtx;
+    std::condition_variable hasRequests;
+    std::condition_variable isIdle;
+    std::deque<Request> requests;
+    uint64_t numActiveWorkers;
+    uint64_t numPauses;
+    bool stopped;
+    // Workers are started by the first request.
+    std::vector<std::thread> workers;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -7,7 +7,11 @@
 // Alternative variant of the buffer manager which doesn't rely on MADV_DONTNEED (on Unix) for
 // evicting pages (which is unavailable in Webassembly runtimes)
 #if BM_MALLOC
+#include <cstring>
 #include <memory>
+#include <new>
+
+#include "common/constants.h"
 #endif
 
 namespace kuzu {
@@ -16,6 +20,8 @@ namespace storage {
 // Keeps the state information of a page in a file.
 class PageState {
     static constexpr uint64_t DIRTY_MASK = 0x0080000000000000;
+    // Set on pages loaded by the prefetcher until they are first accessed.
+    static constexpr uint64_t PREFETCHED_MASK = 0x0040000000000000;
     static constexpr uint64_t STATE_MASK = 0xFF00000000000000;
     static constexpr uint64_t VERSION_MASK = 0x00FFFFFFFFFFFFFF;
     static constexpr uint64_t NUM_BITS_TO_SHIFT_FOR_STATE = 56;
@@ -55,6 +61,11 @@ public:
         // KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
         stateAndVersion.store(updateStateAndIncrementVersion(stateAndVersion.load(), UNLOCKED));
     }
+    // Unlocks the page straight into MARKED, so that the next eviction sweep evicts it unless it
+    // is accessed by then.
+    void unlockAsMarked() {
+        stateAndVersion.store(updateStateAndIncrementVersion(stateAndVersion.load(), MARKED));
+    }
     void unlockUnchanged() {
         // TODO(Keenan / Guodong): Track down this rare bug and re-enable the assert. Ref #2289.
         // KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
@@ -83,6 +94,15 @@ public:
     // Should not be used if other threads are modifying the page state
     void clearDirtyWithoutLock() { stateAndVersion &= ~DIRTY_MASK; }
     bool isDirty() const { return stateAndVersion & DIRTY_MASK; }
+    void setPrefetched() {
+        KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
+        stateAndVersion |= PREFETCHED_MASK;
+    }
+    static bool isPrefetched(uint64_t stateAndVersion) { return stateAndVersion & PREFETCHED_MASK; }
+    // Returns true if this call cleared the prefetched bit.
+    bool tryClearPrefetched() {
+        return stateAndVersion.fetch_and(~PREFETCHED_MASK) & PREFETCHED_MASK;
+    }
     uint64_t getStateAndVersion() const { return stateAndVersion.load(); }
 
     void resetToEvicted() {
@@ -94,8 +114,12 @@ public:
 
 #if BM_MALLOC
     uint8_t* getPage() const { return page.get(); }
+    // Pages are aligned so that they can be read and written with direct I/O, and zeroed like
+    // freshly released VMRegion frames.
     uint8_t* allocatePage(uint64_t pageSize) {
-        page = std::make_unique<uint8_t[]>(pageSize);
+        page.reset(static_cast<uint8_t*>(::operator new[](pageSize,
+            std::align_val_t{common::BufferPoolConstants::DIRECT_IO_ALIGNMENT})));
+        std::memset(page.get(), 0, pageSize);
         return page.get();
     }
     uint16_t getReaderCount() const { return readerCount; }
@@ -104,11 +128,21 @@ public:
 #endif
 
 private:
-    // Highest 1 bit is dirty bit, and the rest are page state and version bits.
+#if BM_MALLOC
+    struct AlignedPageDeleter {
+        void operator()(uint8_t* page) const {
+            ::operator delete[](page,
+                std::align_val_t{common::BufferPoolConstants::DIRECT_IO_ALIGNMENT});
+        }
+    };
+#endif
+
+    // Highest 1 bit is dirty bit, the next one is prefetched bit, and the rest are page state and
+    // version bits.
     // In the rest bits, the lowest 1 byte is state, and the rest are version.
     std::atomic<uint64_t> stateAndVersion;
 #if BM_MALLOC
-    std::unique_ptr<uint8_t[]> page;
+    std::unique_ptr<uint8_t[], AlignedPageDeleter> page;
     std::atomic<uint16_t> readerCount;
 #endif
 };
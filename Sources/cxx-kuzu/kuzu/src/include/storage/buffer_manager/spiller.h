@@ -1,5 +1,7 @@
 #pragma once
 
+#include <unordered_map>
+
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/file_handle.h"
 
@@ -12,6 +14,7 @@ class ChunkedNodeGroup;
 
 class BufferManager;
 class ColumnChunkData;
+class MemoryTracker;
 
 // This should only be used with a LocalFileSystem
 class Spiller {
@@ -24,7 +27,8 @@ public:
     // reclaims memory from the next full partitioner group in the set
     // and returns the amount of memory reclaimed
     // If the set is empty, returns zero
-    SpillResult claimNextGroup();
+    // If an owner is given, only groups whose memory is charged to it are considered
+    SpillResult claimNextGroup(const MemoryTracker* owner = nullptr);
     // Must only be used once all chunks have been loaded from disk.
     void clearFile();
     ~Spiller();
@@ -37,7 +41,8 @@ private:
     std::string tmpFilePath;
     BufferManager& bufferManager;
     common::VirtualFileSystem* vfs;
-    std::unordered_set<ChunkedNodeGroup*> fullPartitionerGroups;
+    // Maps each group to the tracker of the query it was filled by, if any.
+    std::unordered_map<ChunkedNodeGroup*, const MemoryTracker*> fullPartitionerGroups;
     std::atomic<FileHandle*> dataFH;
     std::mutex partitionerGroupsMtx;
     mutable std::mutex fileCreationMutex;
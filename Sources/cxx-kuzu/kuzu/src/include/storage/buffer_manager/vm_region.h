@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mutex>
+#include <vector>
 
 #include "common/constants.h"
 #include "common/types/types.h"
@@ -8,16 +9,31 @@
 namespace kuzu {
 namespace storage {
 
+struct VMRegionConfig {
+    // Ask the OS to back the region with transparent huge pages.
+    bool useHugePages = false;
+    // Spread the frame groups of the region round-robin across the NUMA nodes of the machine.
+    bool bindToNumaNodes = false;
+};
+
 // A VMRegion holds a virtual memory region of a certain size allocated through mmap.
 // The region is divided into frame groups, each of which is a group of frames of the same size.
 // Each FileHandle should grab a frame group each time when they add a new file page group (see
 // `FileHandle::addNewPageGroupWithoutLock`). In this way, each file page group uniquely
 // corresponds to a frame group, thus, a page also uniquely corresponds to a frame in a VMRegion.
+//
+// With huge pages, the region is aligned to HUGE_PAGE_SIZE so that every frame group covers whole
+// huge pages. Releasing a frame smaller than a huge page makes the OS split that huge page.
+// Huge pages and NUMA binding are only supported on Linux and are ignored elsewhere, or if the
+// kernel rejects them.
 class VMRegion {
     friend class BufferManager;
 
 public:
-    explicit VMRegion(common::PageSizeClass pageSizeClass, uint64_t maxRegionSize);
+    static constexpr uint64_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    VMRegion(common::PageSizeClass pageSizeClass, uint64_t maxRegionSize,
+        VMRegionConfig config = {});
     ~VMRegion();
 
     common::frame_group_idx_t addNewFrameGroup();
@@ -33,14 +49,26 @@ public:
         return region + (static_cast<std::uint64_t>(frameIdx) * frameSize);
     }
 
+    bool usesHugePages() const { return hugePagesEnabled; }
+    uint64_t getNumNumaNodes() const { return numaNodeIDs.size(); }
+
 private:
     inline uint64_t getMaxRegionSize() const {
         return maxNumFrameGroups * frameSize * common::StorageConstants::PAGE_GROUP_SIZE;
     }
 
+    void bindFrameGroupToNumaNode(common::frame_group_idx_t frameGroupIdx) const;
+
 private:
     std::mutex mtx;
     uint8_t* region;
+    // The start and size of the mapping, which is larger than the region when the region is
+    // aligned for huge pages.
+    uint8_t* mappedRegion;
+    uint64_t mappedSize;
+    bool hugePagesEnabled;
+    // Empty if frame groups are not bound to NUMA nodes.
+    std::vector<uint32_t> numaNodeIDs;
     uint32_t frameSize;
     uint64_t numFrameGroups;
     uint64_t maxNumFrameGroups;
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "common/enums/block_compression_type.h"
+#include "common/types/types.h"
+#include "storage/page_range.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+class FileHandle;
+
+// Describes the pages of a column chunk which have been compressed as a single block with a
+// general-purpose codec. The compressed block starts at the first page of the chunk's page range.
+struct BlockCompressionMetadata {
+    common::BlockCompressionType type = common::BlockCompressionType::NONE;
+    uint64_t compressedSize = 0;
+    // Number of pages the chunk takes up once decompressed. Page cursors into the chunk are
+    // relative to the decompressed pages.
+    common::page_idx_t numDecompressedPages = 0;
+
+    bool isCompressed() const { return type != common::BlockCompressionType::NONE; }
+
+    void serialize(common::Serializer& serializer) const;
+    static BlockCompressionMetadata deserialize(common::Deserializer& deserializer);
+};
+
+struct BlockCompression {
+    // Compresses the given pages. Returns an empty buffer if the codec failed.
+    static std::vector<uint8_t> compress(common::BlockCompressionType type,
+        std::span<const uint8_t> data);
+    static void decompress(const BlockCompressionMetadata& metadata, std::span<const uint8_t> src,
+        std::span<uint8_t> dst);
+
+    // Copies the pages of the given range out of the buffer manager.
+    static std::vector<uint8_t> readPages(FileHandle& fileHandle, PageRange pageRange,
+        uint64_t numBytes);
+    // Reads the pages of a column chunk, decompressing them if they are block compressed.
+    static std::vector<uint8_t> readDecompressedPages(FileHandle& fileHandle, PageRange pageRange,
+        const BlockCompressionMetadata& metadata);
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -109,6 +109,9 @@ enum class CompressionType : uint8_t {
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
     ALP = 4,
+    DELTA_BITPACKING = 5,
+    RLE = 6,
+    FSST = 7,
 };
 
 struct ExtraMetadata {
@@ -132,6 +135,38 @@ struct ALPMetadata : ExtraMetadata {
     std::unique_ptr<ExtraMetadata> copy() override;
 };
 
+// used only for run-length encoded integers
+struct RLEMetadata : ExtraMetadata {
+    RLEMetadata() : numValuesPerPage(0) {}
+    explicit RLEMetadata(uint64_t numValuesPerPage) : numValuesPerPage(numValuesPerPage) {}
+
+    // Each page stores a fixed number of values so that the page of a value can be computed from
+    // its offset. The number is chosen when compressing so that the runs of every page fit.
+    uint64_t numValuesPerPage;
+
+    void serialize(common::Serializer& serializer) const;
+    static RLEMetadata deserialize(common::Deserializer& deserializer);
+
+    std::unique_ptr<ExtraMetadata> copy() override;
+};
+
+class FSSTSymbolTable;
+
+// used only for FSST-encoded string dictionary data
+struct FSSTMetadata : ExtraMetadata {
+    FSSTMetadata() = default;
+    explicit FSSTMetadata(std::shared_ptr<const FSSTSymbolTable> symbolTable)
+        : symbolTable(std::move(symbolTable)) {}
+
+    // The table is immutable once built, so copies of the metadata share it.
+    std::shared_ptr<const FSSTSymbolTable> symbolTable;
+
+    void serialize(common::Serializer& serializer) const;
+    static FSSTMetadata deserialize(common::Deserializer& deserializer);
+
+    std::unique_ptr<ExtraMetadata> copy() override;
+};
+
 struct InPlaceUpdateLocalState {
     struct FloatState {
         size_t newExceptionCount;
@@ -184,6 +219,12 @@ struct KUZU_API CompressionMetadata {
     inline ALPMetadata* floatMetadata() {
         return common::ku_dynamic_cast<ALPMetadata*>(getExtraMetadata());
     }
+    inline const RLEMetadata* rleMetadata() const {
+        return common::ku_dynamic_cast<const RLEMetadata*>(getExtraMetadata());
+    }
+    inline const FSSTMetadata* fsstMetadata() const {
+        return common::ku_dynamic_cast<const FSSTMetadata*>(getExtraMetadata());
+    }
 
     void serialize(common::Serializer& serializer) const;
     static CompressionMetadata deserialize(common::Deserializer& deserializer);
@@ -411,6 +452,87 @@ protected:
         const BitpackInfo<T>& header) const;
 };
 
+template<typename T>
+concept IntegerEncodingType = (std::integral<T> && !std::same_as<T, bool>);
+
+// Bitpacks the differences between consecutive values, which is much narrower than the values
+// themselves for sorted data such as CSR offsets or serial keys.
+// Each page starts with the first value of the page, followed by the bitpacked deltas (the first
+// delta of a page is always 0). The deltas are bitpacked with the child metadata of the chunk.
+// Reading a value requires summing the deltas from the start of its page, so chunks using this
+// compression are never updated in place.
+template<IntegerEncodingType T>
+class IntegerDeltaBitpacking : public CompressionAlg {
+    using U = common::numeric_utils::MakeUnSignedT<T>;
+
+public:
+    // Keeps the bitpacked deltas aligned for fastpfor
+    static constexpr uint64_t HEADER_SIZE = sizeof(uint64_t);
+    static constexpr common::idx_t DELTA_CHILD_IDX = 0;
+
+    IntegerDeltaBitpacking() = default;
+    IntegerDeltaBitpacking(const IntegerDeltaBitpacking&) = default;
+
+    // Returns nullopt if the deltas are not narrower than the values
+    static std::optional<CompressionMetadata> analyze(std::span<const T> values, StorageValue min,
+        StorageValue max);
+
+    static uint64_t numValues(uint64_t dataSize, const CompressionMetadata& metadata);
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata, const common::NullMask* nullMask) const final;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    CompressionType getCompressionType() const override {
+        return CompressionType::DELTA_BITPACKING;
+    }
+};
+
+// Stores runs of identical values as (run end, value) pairs.
+// Each page stores the number of runs, followed by the end offsets (exclusive, relative to the
+// start of the page) of the runs and then the values of the runs. The number of values per page is
+// stored in the RLEMetadata of the chunk. Like delta bitpacking, chunks using this compression
+// are never updated in place.
+template<IntegerEncodingType T>
+class RunLengthEncoding : public CompressionAlg {
+public:
+    // Runs are only worth encoding if they are at least this long on average
+    static constexpr uint64_t MIN_AVERAGE_RUN_LENGTH = 4;
+
+    RunLengthEncoding() = default;
+    RunLengthEncoding(const RunLengthEncoding&) = default;
+
+    // Returns nullopt if the runs are too short
+    static std::optional<CompressionMetadata> analyze(std::span<const T> values, StorageValue min,
+        StorageValue max);
+
+    static uint64_t getMaxNumRunsPerPage(uint64_t dataSize) {
+        return (dataSize - sizeof(uint32_t)) / (sizeof(uint32_t) + sizeof(T));
+    }
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata, const common::NullMask* nullMask) const final;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    CompressionType getCompressionType() const override { return CompressionType::RLE; }
+};
+
 class BooleanBitpacking : public CompressionAlg {
 public:
     BooleanBitpacking() = default;
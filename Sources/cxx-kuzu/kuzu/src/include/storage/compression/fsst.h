@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+struct FSSTSymbol {
+    // Symbol bytes in memory order, padded with zeros
+    uint64_t value;
+    uint8_t length;
+};
+
+// Static symbol table for FSST (Fast Static Symbol Table) string compression.
+// Strings are encoded as a sequence of one-byte codes, each of which stands for a symbol of up to
+// 8 bytes. Bytes that are not covered by any symbol are written as an escape code followed by the
+// byte itself. Strings are encoded independently, so each one can be decoded on its own.
+class FSSTSymbolTable {
+public:
+    static constexpr uint8_t ESCAPE_CODE = 255;
+    static constexpr uint64_t MAX_NUM_SYMBOLS = 255;
+    static constexpr uint64_t MAX_SYMBOL_LENGTH = 8;
+    // Escaped bytes take two bytes, so encoding at most doubles the size of a string.
+    static constexpr uint64_t MAX_ENCODED_SIZE_FACTOR = 2;
+
+    FSSTSymbolTable() = default;
+
+    // Builds a symbol table which minimizes the encoded size of the sample strings.
+    static FSSTSymbolTable build(std::span<const std::string_view> sample);
+
+    // Appends the encoded string to the result.
+    void encode(std::string_view value, std::vector<uint8_t>& result) const;
+    uint64_t getDecodedLength(std::span<const uint8_t> encoded) const;
+    // dst must have space for getDecodedLength(encoded) bytes. Returns the number of bytes written.
+    uint64_t decode(std::span<const uint8_t> encoded, uint8_t* dst) const;
+
+    uint64_t getNumSymbols() const { return symbols.size(); }
+
+    void serialize(common::Serializer& serializer) const;
+    static FSSTSymbolTable deserialize(common::Deserializer& deserializer);
+
+private:
+    explicit FSSTSymbolTable(std::vector<FSSTSymbol> symbols);
+
+    // Returns the code of the longest symbol matching the start of the value, or ESCAPE_CODE.
+    uint8_t findLongestSymbol(std::string_view value) const;
+
+private:
+    std::vector<FSSTSymbol> symbols;
+    // Codes of the symbols starting with each byte, longest symbols first.
+    std::array<std::vector<uint8_t>, 256> codesByFirstByte;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -20,6 +20,7 @@ namespace storage {
 class PageAllocator;
 class FileHandle;
 class BufferManager;
+class StorageCompactor;
 
 static constexpr uint64_t NUM_PAGE_IDXS_PER_PIP =
     (common::KUZU_PAGE_SIZE - sizeof(common::page_idx_t)) / sizeof(common::page_idx_t);
@@ -113,6 +114,11 @@ public:
         transaction::TransactionType trxType = transaction::TransactionType::READ_ONLY);
 
     void get(uint64_t idx, const transaction::Transaction* transaction, std::span<std::byte> val);
+    // Reads the elements at the given indices, which must be sorted in ascending order, into
+    // consecutive elementSize-byte chunks of vals. Elements on the same array page are copied
+    // within a single page access instead of one access per element.
+    void getBatch(std::span<const uint64_t> idxs, const transaction::Transaction* transaction,
+        uint64_t elementSize, std::span<std::byte> vals);
 
     // Note: This function is to be used only by the WRITE trx.
     void update(const transaction::Transaction* transaction, uint64_t idx,
@@ -134,6 +140,10 @@ public:
     void checkpoint();
 
     void reclaimStorage(PageAllocator& pageAllocator) const;
+    // Moves the array pages toward the head of the file and rewrites the PIPs pointing to them
+    // through the shadow file. PIPs themselves stay where they are. Arrays with updates that
+    // aren't checkpointed in memory yet are skipped.
+    void compactStorage(StorageCompactor& compactor);
 
     // Write WriteIterator for making fast bulk changes to the disk array
     // The pages are cached while the elements are stored on the same page
@@ -282,6 +292,13 @@ public:
         return val;
     }
 
+    // See DiskArrayInternal::getBatch. `idxs` must be sorted in ascending order.
+    inline void getBatch(std::span<const uint64_t> idxs,
+        const transaction::Transaction* transaction, std::span<U> vals) {
+        KU_ASSERT(idxs.size() == vals.size());
+        diskArray.getBatch(idxs, transaction, sizeof(U), std::as_writable_bytes(vals));
+    }
+
     // Note: Currently, this function doesn't support shrinking the size of the array.
     inline uint64_t resize(PageAllocator& pageAllocator,
         const transaction::Transaction* transaction, uint64_t newNumElements) {
@@ -300,6 +317,7 @@ public:
     inline void reclaimStorage(PageAllocator& pageAllocator) const {
         diskArray.reclaimStorage(pageAllocator);
     }
+    inline void compactStorage(StorageCompactor& compactor) { diskArray.compactStorage(compactor); }
 
     class WriteIterator {
     public:
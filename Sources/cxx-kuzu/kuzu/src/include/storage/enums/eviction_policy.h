@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace storage {
+
+enum class EvictionPolicy : uint8_t {
+    // The eviction sweep marks pages and evicts those that weren't accessed before it came back.
+    SECOND_CHANCE = 0,
+    // Like SECOND_CHANCE, but pages loaded by sequential scans enter the buffer pool marked, so
+    // that they are evicted first unless a non-scan access promotes them.
+    SCAN_RESISTANT = 1,
+};
+
+// Tells the buffer manager whether a read is part of a sequential scan.
+enum class PageAccessType : uint8_t { RANDOM = 0, SEQUENTIAL_SCAN = 1 };
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace storage {
+
+// What an allocation does when it would take its query or connection over the memory limit.
+enum class MemoryLimitPolicy : uint8_t {
+    // The allocation fails, which fails the query but leaves other queries running.
+    FAIL = 0,
+    // The allocation waits for memory of the query or the connection to be freed, and fails if
+    // that doesn't happen in time.
+    WAIT = 1,
+    // Data waiting in the spiller is written to disk to make room before failing.
+    SPILL = 2,
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
@@ -15,6 +16,7 @@
 #include "common/types/types.h"
 #include "storage/buffer_manager/page_state.h"
 #include "storage/buffer_manager/vm_region.h"
+#include "storage/enums/eviction_policy.h"
 #include "storage/enums/page_read_policy.h"
 #include "storage/page_manager.h"
 
@@ -48,6 +50,8 @@ public:
     // createIfNotExistsMask only applies to existing db files; tmp i-memory files are not created
     constexpr static uint8_t createIfNotExistsMask{0b0000'0100}; // represents 3rd LSB
     constexpr static uint8_t isReadOnlyMask{0b0000'1000};        // represents 4th LSB
+    constexpr static uint8_t isDirectIOMask{0b0001'0000};        // represents 5th LSB
+    constexpr static uint8_t isMemoryMappedMask{0b0010'0000};    // represents 6th LSB
     constexpr static uint8_t isLockRequiredMask{0b1000'0000};    // represents 8th LSB
 
     // READ_ONLY subsumes DEFAULT_PAGED, PERSISTENT, and NO_CREATE.
@@ -56,6 +60,11 @@ public:
     constexpr static uint8_t O_IN_MEM_TEMP_FILE{0b0000'0011};
     constexpr static uint8_t O_PERSISTENT_FILE_IN_MEM{0b0000'0010};
     constexpr static uint8_t O_LOCKED_PERSISTENT_FILE{0b1000'0000};
+    // Reads and writes pages bypassing the OS page cache where the file system supports it.
+    constexpr static uint8_t O_DIRECT_IO{0b0001'0000};
+    // Only applies to read-only files: the file is mapped into memory and optimistic reads of its
+    // pages are served from the mapping, bypassing the buffer manager.
+    constexpr static uint8_t O_MEMORY_MAPPED{0b0010'0000};
 
     FileHandle(const std::string& path, uint8_t fhFlags, BufferManager* bm, uint32_t fileIndex,
         common::VirtualFileSystem* vfs, main::ClientContext* context);
@@ -64,7 +73,8 @@ public:
 
     uint8_t* pinPage(common::page_idx_t pageIdx, PageReadPolicy readPolicy);
     void optimisticReadPage(common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readOp);
+        const std::function<void(uint8_t*)>& readOp,
+        PageAccessType accessType = PageAccessType::RANDOM);
     // The function assumes that the requested page is already pinned.
     void unpinPage(common::page_idx_t pageIdx);
 
@@ -99,6 +109,10 @@ public:
     void writePagesToFile(const uint8_t* buffer, uint64_t size, common::page_idx_t startPageIdx);
 
     bool isInMemoryMode() const { return !isLargePaged() && isNewTmpFile(); }
+    // Whether pages are read and written bypassing the OS page cache.
+    bool usesDirectIO() const { return fileInfo != nullptr && fileInfo->usesDirectIO(); }
+    // Whether optimistic reads are served from a read-only mapping of the file.
+    bool isMemoryMapped() const { return mappedData != nullptr; }
 
     common::page_idx_t getNumPages() const { return numPages; }
     common::FileInfo* getFileInfo() const { return fileInfo.get(); }
@@ -110,12 +124,23 @@ public:
 
     PageManager* getPageManager() { return pageManager.get(); }
 
+    // Number of page accesses served from the buffer pool, and of those that had to load the page.
+    uint64_t getNumPageHits() const { return numPageHits.load(std::memory_order_relaxed); }
+    uint64_t getNumPageMisses() const { return numPageMisses.load(std::memory_order_relaxed); }
+    void recordPageHit() { numPageHits.fetch_add(1, std::memory_order_relaxed); }
+    void recordPageMiss() { numPageMisses.fetch_add(1, std::memory_order_relaxed); }
+    // Incremented whenever pages are removed from the buffer pool because they are freed or
+    // rewritten on disk. Background loads check it to drop pages read before the change.
+    uint64_t getPageRemovalVersion() const { return pageRemovalVersion.load(); }
+
 private:
     bool isLargePaged() const { return fhFlags & isLargePagedMask; }
     bool isNewTmpFile() const { return fhFlags & isNewInMemoryTmpFileMask; }
     bool isReadOnlyFile() const { return fhFlags & isReadOnlyMask; }
     bool createFileIfNotExists() const { return fhFlags & createIfNotExistsMask; }
     bool isLockRequired() const { return fhFlags & isLockRequiredMask; }
+    bool isDirectIORequested() const { return fhFlags & isDirectIOMask; }
+    bool isMemoryMappingRequested() const { return fhFlags & isMemoryMappedMask; }
 
     common::page_idx_t addNewPageWithoutLock();
     void constructPersistentFileHandle(const std::string& path, common::VirtualFileSystem* vfs,
@@ -166,6 +191,15 @@ private:
     common::ConcurrentVector<common::page_group_idx_t> frameGroupIdxes;
 
     std::unique_ptr<PageManager> pageManager;
+
+    // Read-only mapping of the file, owned by fileInfo. Only the pages that are fully in the file
+    // when it is opened are mapped.
+    const uint8_t* mappedData;
+    common::page_idx_t numMappedPages;
+
+    std::atomic<uint64_t> numPageHits;
+    std::atomic<uint64_t> numPageMisses;
+    std::atomic<uint64_t> pageRemovalVersion;
 };
 
 } // namespace storage
@@ -20,7 +20,9 @@ class FileHandle;
 class FreeSpaceManager {
 public:
     static bool entryCmp(const PageRange& a, const PageRange& b);
+    static bool startPageCmp(const PageRange& a, const PageRange& b);
     using sorted_free_list_t = std::set<PageRange, decltype(&entryCmp)>;
+    using start_sorted_free_list_t = std::set<PageRange, decltype(&startPageCmp)>;
     using free_list_t = std::vector<PageRange>;
 
     FreeSpaceManager();
@@ -28,6 +30,10 @@ public:
     void addFreePages(PageRange entry);
     void evictAndAddFreePages(FileHandle* fileHandle, PageRange entry);
     std::optional<PageRange> popFreePages(common::page_idx_t numPages);
+    // Like popFreePages(), but takes the fitting entry closest to the head of the file, and only
+    // if it starts before endPageIdx.
+    std::optional<PageRange> popLowestFreePages(common::page_idx_t numPages,
+        common::page_idx_t endPageIdx);
 
     // These pages are not reusable until the end of the next checkpoint
     void addUncheckpointedFreePages(PageRange entry);
@@ -35,10 +41,13 @@ public:
 
     common::page_idx_t getMaxNumPagesForSerialization() const;
     void serialize(common::Serializer& serializer) const;
-    void deserialize(common::Deserializer& deSer);
+    // Entries past the end of the file are dropped. The free range at the tail of the file is
+    // serialized before finalizeCheckpoint() truncates it, so it may be past the end on reload.
+    void deserialize(common::Deserializer& deSer, common::page_idx_t numPagesInFile);
     void finalizeCheckpoint(FileHandle* fileHandle);
 
     common::row_idx_t getNumEntries() const;
+    common::page_idx_t getNumFreePages() const;
     std::vector<PageRange> getEntries(common::row_idx_t startOffset,
         common::row_idx_t endOffset) const;
 
@@ -52,6 +61,7 @@ private:
     PageRange splitPageRange(PageRange chunk, common::page_idx_t numRequiredPages);
     void mergePageRanges(free_list_t newInitialEntries, FileHandle* fileHandle);
     void handleLastPageRange(PageRange pageRange, FileHandle* fileHandle);
+    void removeFreePages(const PageRange& entry);
     void resetFreeLists();
     static common::idx_t getLevel(common::page_idx_t numPages);
     void evictPages(FileHandle* fileHandle, const PageRange& entry);
@@ -60,6 +70,8 @@ private:
     void serializeInternal(ValueProcessor& serializer) const;
 
     std::vector<sorted_free_list_t> freeLists;
+    // The same entries per level ordered by start page, to find the lowest entry when compacting.
+    std::vector<start_sorted_free_list_t> freeListsByStartPage;
     free_list_t uncheckpointedFreePageRanges;
     common::row_idx_t numEntries;
     bool needClearEvictedEntries;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <span>
 #include <string_view>
 #include <type_traits>
 
@@ -35,16 +36,26 @@ class OverflowFileHandle;
 template<typename T>
 class DiskArray;
 class PageManager;
+class StorageCompactor;
 
 class OnDiskHashIndex {
 public:
     virtual ~OnDiskHashIndex() = default;
+    // Checkpointing is split into three steps. Reserving and merging allocate pages and must be
+    // run serially, while sorting only reads the local storage and can run concurrently for
+    // different sub-indexes.
+    // Resizes the on-disk index for the local insertions and returns the number of insertions.
+    virtual uint64_t reserveForCheckpoint(PageAllocator& pageAllocator) = 0;
+    // Sorts the local insertions by the disk slot they will be merged into.
+    virtual void sortInsertionsForCheckpoint() = 0;
+    // Merges the sorted insertions into the on-disk slots in ascending slot order.
     virtual bool checkpoint(PageAllocator& pageAllocator) = 0;
     virtual bool checkpointInMemory() = 0;
     virtual bool rollbackInMemory() = 0;
     virtual void rollbackCheckpoint() = 0;
     virtual void bulkReserve(uint64_t numValuesToAppend) = 0;
     virtual void reclaimStorage(PageAllocator& pageAllocator) = 0;
+    virtual void compactStorage(StorageCompactor& compactor) = 0;
     virtual bool tryLock() = 0;
     virtual std::unique_lock<std::shared_mutex> adoptLock() = 0;
 };
@@ -111,6 +122,14 @@ public:
         return lookupInPersistentIndex(transaction, key, result, isVisible);
     }
 
+    // Looks up a batch of keys which all belong to this index, given their precomputed hashes.
+    // results[i] is set to the value of keys[i], or INVALID_OFFSET if the key is not found.
+    // Keys not resolved by the local storage are sorted by their primary slot, so that each
+    // primary slot is read once and slots on the same disk array page are read together.
+    void lookupBatch(const transaction::Transaction* transaction, std::span<const Key> keys,
+        std::span<const common::hash_t> hashes, std::span<common::offset_t> results,
+        const visible_func& isVisible);
+
     // For deletions, we don't check if the deleted keys exist or not. Thus, we don't need to check
     // in the persistent storage and directly delete keys in the local storage.
     void deleteInternal(Key key) const { localStorage->deleteKey(key); }
@@ -169,11 +188,14 @@ public:
     bool tryLock() override { return localStorage->tryLock(); }
     std::unique_lock<std::shared_mutex> adoptLock() override { return localStorage->adoptLock(); }
 
+    uint64_t reserveForCheckpoint(PageAllocator& pageAllocator) override;
+    void sortInsertionsForCheckpoint() override;
     bool checkpoint(PageAllocator& pageAllocator) override;
     bool checkpointInMemory() override;
     bool rollbackInMemory() override;
     void rollbackCheckpoint() override;
     void reclaimStorage(PageAllocator& pageAllocator) override;
+    void compactStorage(StorageCompactor& compactor) override;
 
 private:
     bool lookupInPersistentIndex(const transaction::Transaction* transaction, Key key,
@@ -244,15 +266,15 @@ private:
         const SlotEntry<typename InMemHashIndex<T>::OwnedType>* entry;
     };
 
-    void sortEntries(const transaction::Transaction* transaction,
+    void collectEntries(const transaction::Transaction* transaction,
         const InMemHashIndex<T>& insertLocalStorage,
         typename InMemHashIndex<T>::SlotIterator& slotToMerge,
-        std::vector<HashIndexEntryView>& entries);
-    void mergeBulkInserts(PageAllocator& pageAllocator, const transaction::Transaction* transaction,
-        const InMemHashIndex<T>& insertLocalStorage);
+        std::vector<HashIndexEntryView>& entries) const;
+    void mergeBulkInserts(PageAllocator& pageAllocator,
+        const transaction::Transaction* transaction);
     // Returns the number of elements merged which matched the given slot id
     size_t mergeSlot(PageAllocator& pageAllocator, const transaction::Transaction* transaction,
-        const std::vector<HashIndexEntryView>& slotToMerge,
+        std::span<const HashIndexEntryView> slotToMerge,
         typename DiskArray<OnDiskSlotType>::WriteIterator& diskSlotIterator,
         typename DiskArray<OnDiskSlotType>::WriteIterator& diskOverflowSlotIterator,
         slot_id_t diskSlotId);
@@ -307,6 +329,8 @@ private:
     const HashIndexHeader& indexHeaderForReadTrx;
     HashIndexHeader& indexHeaderForWriteTrx;
     MemoryManager& memoryManager;
+    // Local insertions sorted by their disk slot id, only populated during checkpoint.
+    std::vector<HashIndexEntryView> sortedInsertions;
 };
 
 template<>
@@ -388,6 +412,12 @@ public:
 
     bool lookup(const transaction::Transaction* trx, common::ValueVector* keyVector,
         uint64_t vectorPos, common::offset_t& result, visible_func isVisible);
+    // Looks up the non-null keys at the given positions of keyVector. results[i] is set to the
+    // offset of the key at positions[i], or INVALID_OFFSET if the key doesn't exist. Keys are
+    // hashed once and grouped by sub-index, so each sub-index resolves its keys in one batch.
+    void lookupBatch(const transaction::Transaction* trx, const common::ValueVector& keyVector,
+        std::span<const common::sel_t> positions, std::span<common::offset_t> results,
+        const visible_func& isVisible);
 
     std::unique_ptr<Index::InsertState> initInsertState(main::ClientContext*,
         visible_func isVisible) override {
@@ -473,7 +503,10 @@ public:
         KU_ASSERT(indexInfo.keyDataTypes.size() == 1);
         return indexInfo.keyDataTypes[0];
     }
-    void reclaimStorage(PageAllocator& pageAllocator) const;
+    void reclaimStorage(PageAllocator& pageAllocator) const override;
+    // Moves the slot pages of the sub-indexes toward the head of the data file. Headers, PIPs and
+    // the overflow file are left in place.
+    void compactStorage(StorageCompactor& compactor) override;
 
     static KUZU_API std::unique_ptr<Index> load(main::ClientContext* context,
         StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer);
@@ -487,6 +520,9 @@ public:
 private:
     void writeHeaders(PageAllocator& pageAllocator) const;
 
+    void sortInsertionsForCheckpoint(main::ClientContext* context, uint64_t startIndex,
+        uint64_t endIndex);
+
     void initOverflowAndSubIndices(bool inMemMode, MemoryManager& mm, PageAllocator& pageAllocator,
         PrimaryKeyIndexStorageInfo& storageInfo);
 
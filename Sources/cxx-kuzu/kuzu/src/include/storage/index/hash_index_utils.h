@@ -75,7 +75,11 @@ public:
     }
 
     static uint64_t getHashIndexPosition(common::IndexHashable auto key) {
-        return (HashIndexUtils::hash(key) >> (64 - NUM_HASH_INDEXES_LOG2)) & (NUM_HASH_INDEXES - 1);
+        return getHashIndexPositionForHash(HashIndexUtils::hash(key));
+    }
+
+    static uint64_t getHashIndexPositionForHash(common::hash_t hash) {
+        return (hash >> (64 - NUM_HASH_INDEXES_LOG2)) & (NUM_HASH_INDEXES - 1);
     }
 
     static uint64_t getNumRequiredEntries(uint64_t numEntries) {
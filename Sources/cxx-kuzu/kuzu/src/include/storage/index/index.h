@@ -9,8 +9,9 @@
 #include <span>
 
 namespace kuzu::storage {
+class StorageCompactor;
 class StorageManager;
-}
+} // namespace kuzu::storage
 namespace kuzu {
 namespace transaction {
 class Transaction;
@@ -150,6 +151,19 @@ public:
         const std::vector<common::ValueVector*>&, InsertState&) {
         // DO NOTHING.
     }
+    // Undoes the insertion of the rows in [startOffset, startOffset + numRows) when the
+    // transaction inserting them rolls back.
+    virtual void rollbackInsert(common::offset_t /*startOffset*/, common::row_idx_t /*numRows*/) {
+        // DO NOTHING.
+    }
+    // Called at the end of a transaction that registered itself in its undo buffer through
+    // Transaction::pushIndexUpdateInfo().
+    virtual void commitUpdate(common::transaction_t /*transactionID*/) {
+        // DO NOTHING.
+    }
+    virtual void rollbackUpdate(common::transaction_t /*transactionID*/) {
+        // DO NOTHING.
+    }
 
     virtual void checkpointInMemory() {
         // DO NOTHING.
@@ -163,6 +177,14 @@ public:
     virtual void finalize(main::ClientContext*) {
         // DO NOTHING.
     }
+    // Frees the pages of the index once it or its table is dropped. Only used during checkpoint.
+    virtual void reclaimStorage(PageAllocator&) const {
+        // DO NOTHING.
+    }
+    // Moves the pages of the index toward the head of the data file during checkpoint.
+    virtual void compactStorage(StorageCompactor&) {
+        // DO NOTHING.
+    }
 
     std::span<uint8_t> getStorageBuffer() const {
         KU_ASSERT(!loaded);
@@ -213,12 +235,32 @@ public:
         }
     }
     // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+    void rollbackInsert(common::offset_t startOffset, common::row_idx_t numRows) {
+        if (loaded) {
+            KU_ASSERT(index);
+            index->rollbackInsert(startOffset, numRows);
+        }
+    }
+    // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
     void finalize(main::ClientContext* context) {
         if (loaded) {
             KU_ASSERT(index);
             index->finalize(context);
         }
     }
+    void reclaimStorage(PageAllocator& pageAllocator) const {
+        if (loaded) {
+            KU_ASSERT(index);
+            index->reclaimStorage(pageAllocator);
+        }
+    }
+    // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+    void compactStorage(StorageCompactor& compactor) {
+        if (loaded) {
+            KU_ASSERT(index);
+            index->compactStorage(compactor);
+        }
+    }
 
     Index* getIndex() const {
         KU_ASSERT(index);
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "common/serializer/buffer_reader.h"
+#include "storage/index/index.h"
+#include "storage/page_range.h"
+
+namespace kuzu {
+namespace storage {
+
+class NodeTable;
+
+// One side of a range lookup on an ordered index. The key is read from `vector` at `pos`.
+struct OrderedIndexBound {
+    const common::ValueVector* vector;
+    common::sel_t pos;
+    bool inclusive;
+
+    OrderedIndexBound(const common::ValueVector* vector, common::sel_t pos, bool inclusive)
+        : vector{vector}, pos{pos}, inclusive{inclusive} {}
+};
+
+// Sorted (key, offset) pairs of a single key type. The entries are allocated through the memory
+// manager, so that they count against the buffer pool like other in-memory index data.
+class OrderedIndexEntries {
+public:
+    virtual ~OrderedIndexEntries() = default;
+
+    // Returns false if the entry already exists.
+    virtual bool insert(const common::ValueVector& keyVector, common::sel_t pos,
+        common::offset_t offset) = 0;
+    virtual void erase(const std::unordered_set<common::offset_t>& offsets) = 0;
+    // Erases the entries of the offsets in [startOffset, endOffset).
+    virtual void erase(common::offset_t startOffset, common::offset_t endOffset) = 0;
+    // Erases the entries that are in `other`, which must have the same key type.
+    virtual void erase(const OrderedIndexEntries& other) = 0;
+    virtual void lookup(const std::optional<OrderedIndexBound>& lowerBound,
+        const std::optional<OrderedIndexBound>& upperBound,
+        std::vector<common::offset_t>& result) const = 0;
+    virtual void clear() = 0;
+    virtual uint64_t size() const = 0;
+
+    // Writes the entries whose offsets pass the filter and returns their number.
+    virtual uint64_t serialize(common::Serializer& ser,
+        const std::function<bool(common::offset_t)>& filter) const = 0;
+    // Adds the serialized entries.
+    virtual void deserialize(common::Deserializer& deSer) = 0;
+
+    static std::unique_ptr<OrderedIndexEntries> create(common::PhysicalTypeID keyType,
+        MemoryManager* mm);
+};
+
+// The committed entries of an ordered index are persisted in runs of pages. A run erases the
+// entries of the nodes that changed since the previous run and adds their current ones, so that
+// a checkpoint only writes the entries of changed nodes. The runs are merged into a single one
+// once they hold too many outdated entries.
+struct OrderedIndexStorageInfo final : IndexStorageInfo {
+    std::vector<PageRange> runs;
+    // Number of entries written to the runs.
+    uint64_t numEntriesInRuns;
+    // Nodes below this offset were indexed when the runs were written.
+    common::offset_t numIndexedNodes;
+
+    OrderedIndexStorageInfo() : numEntriesInRuns{0}, numIndexedNodes{0} {}
+    OrderedIndexStorageInfo(std::vector<PageRange> runs, uint64_t numEntriesInRuns,
+        common::offset_t numIndexedNodes)
+        : runs{std::move(runs)}, numEntriesInRuns{numEntriesInRuns},
+          numIndexedNodes{numIndexedNodes} {}
+
+    DELETE_COPY_DEFAULT_MOVE(OrderedIndexStorageInfo);
+
+    std::shared_ptr<common::BufferWriter> serialize() const override;
+
+    static std::unique_ptr<OrderedIndexStorageInfo> deserialize(
+        std::unique_ptr<common::BufferReader> reader);
+};
+
+// A built-in secondary index that keeps the values of a single node property in sorted order, so
+// that equality and range predicates on non-primary-key properties can be answered without a full
+// table scan. Null values are not indexed.
+// The index may contain stale entries (e.g. of deleted nodes or overwritten values) until the next
+// checkpoint, so lookups only return candidates that must be re-checked against the table. Entries
+// added for nodes that are rolled back, by inserts or updates, are removed right away.
+class KUZU_API OrderedIndex final : public Index {
+public:
+    static constexpr const char* TYPE_NAME = "ORDERED";
+    // Once there are this many runs, the next checkpoint merges them.
+    static constexpr uint64_t MAX_NUM_RUNS = 16;
+
+    struct InsertState final : Index::InsertState {
+        common::column_id_t columnID;
+
+        explicit InsertState(common::column_id_t columnID) : columnID{columnID} {}
+    };
+
+    struct UpdateState final : Index::UpdateState {};
+
+    struct DeleteState final : Index::DeleteState {};
+
+    OrderedIndex(MemoryManager* mm, IndexInfo indexInfo,
+        std::unique_ptr<OrderedIndexStorageInfo> storageInfo,
+        std::unique_ptr<OrderedIndexEntries> committedEntries);
+
+    static std::unique_ptr<OrderedIndex> createNewIndex(MemoryManager* mm, IndexInfo indexInfo);
+
+    static bool isKeyTypeSupported(common::PhysicalTypeID keyType);
+
+    // Indexes all existing nodes of the table. Used when the index is created on a non-empty table.
+    void build(main::ClientContext* context, NodeTable& nodeTable);
+
+    // Returns the offsets of nodes whose key may fall in [lowerBound, upperBound], in ascending
+    // order. A missing bound is unbounded.
+    void lookup(const transaction::Transaction* transaction,
+        const std::optional<OrderedIndexBound>& lowerBound,
+        const std::optional<OrderedIndexBound>& upperBound,
+        std::vector<common::offset_t>& result);
+
+    std::unique_ptr<Index::InsertState> initInsertState(main::ClientContext* context,
+        visible_func isVisible) override;
+    void insert(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        const std::vector<common::ValueVector*>& indexVectors,
+        Index::InsertState& insertState) override;
+    std::unique_ptr<Index::UpdateState> initUpdateState(main::ClientContext* context,
+        common::column_id_t columnID, visible_func isVisible) override;
+    void update(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        common::ValueVector& propertyVector, Index::UpdateState& updateState) override;
+    std::unique_ptr<Index::DeleteState> initDeleteState(const transaction::Transaction* transaction,
+        MemoryManager* mm, visible_func isVisible) override;
+    void delete_(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        Index::DeleteState& deleteState) override;
+    bool needCommitInsert() const override { return true; }
+    void commitInsert(transaction::Transaction* transaction,
+        const common::ValueVector& nodeIDVector,
+        const std::vector<common::ValueVector*>& indexVectors,
+        Index::InsertState& insertState) override;
+    void rollbackInsert(common::offset_t startOffset, common::row_idx_t numRows) override;
+    void commitUpdate(common::transaction_t transactionID) override;
+    void rollbackUpdate(common::transaction_t transactionID) override;
+
+    void checkpoint(main::ClientContext* context, PageAllocator& pageAllocator) override;
+    void rollbackCheckpoint() override;
+    void finalize(main::ClientContext* context) override;
+    void reclaimStorage(PageAllocator& pageAllocator) const override;
+    void compactStorage(StorageCompactor& compactor) override;
+
+    static std::unique_ptr<Index> load(main::ClientContext* context,
+        StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer);
+
+    static IndexType getIndexType() {
+        static const IndexType ORDERED_INDEX_TYPE{TYPE_NAME,
+            IndexConstraintType::SECONDARY_NON_UNIQUE, IndexDefinitionType::BUILTIN, load};
+        return ORDERED_INDEX_TYPE;
+    }
+
+private:
+    void indexNodes(main::ClientContext* context, transaction::Transaction* transaction,
+        NodeTable& nodeTable, common::offset_t startOffset);
+    // Returns the refreshed offsets in ascending order.
+    std::vector<common::offset_t> refreshDirtyOffsets(main::ClientContext* context,
+        NodeTable& nodeTable);
+    void persistEntries(main::ClientContext* context, PageAllocator& pageAllocator,
+        const std::vector<common::offset_t>& changedOffsets);
+    void resetLocalEntriesIfNeeded(const transaction::Transaction* transaction);
+
+private:
+    MemoryManager* mm;
+    std::shared_mutex mtx;
+    // Entries of committed nodes.
+    std::unique_ptr<OrderedIndexEntries> committedEntries;
+    // Entries of nodes inserted or updated by the current write transaction, which are only
+    // visible to that transaction. They are dropped once the transaction commits or rolls back.
+    std::unique_ptr<OrderedIndexEntries> localEntries;
+    common::transaction_t localTransactionID;
+    std::unordered_set<common::offset_t> localDeletedOffsets;
+    // Committed nodes that have been updated or deleted since the last checkpoint. Their entries
+    // are rebuilt from the table during checkpoint.
+    std::unordered_set<common::offset_t> dirtyOffsets;
+    // Entries added to committedEntries by updates of transactions that haven't ended yet, so
+    // that they are removed if the transaction rolls back.
+    std::unordered_map<common::transaction_t, std::unique_ptr<OrderedIndexEntries>> updatedEntries;
+    common::offset_t numIndexedNodes;
+    // Set while the entries are persisted. If the checkpoint fails meanwhile, the changes it
+    // would have persisted are lost, so the next checkpoint rewrites all entries.
+    bool persisting;
+    bool rewriteEntries;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -195,6 +195,17 @@ public:
         return numInserted == keyVector.state->getSelVector().getSelSize();
     }
 
+    bool insert(const common::ValueVector& keyVector, common::sel_t pos, common::offset_t value,
+        visible_func isVisible) {
+        bool inserted = false;
+        common::TypeUtils::visit(
+            keyDataTypeID,
+            [&]<common::IndexHashable T>(
+                T) { inserted = insert(keyVector.getValue<T>(pos), value, isVisible); },
+            [](auto) { KU_UNREACHABLE; });
+        return inserted;
+    }
+
     bool insert(const common::ku_string_t key, common::offset_t value, visible_func isVisible) {
         return insert(key.getAsString(), value, isVisible);
     }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <unordered_set>
+
 #include "common/copy_constructors.h"
 #include "storage/local_storage/local_hash_index.h"
 #include "storage/local_storage/local_table.h"
@@ -10,6 +12,7 @@ namespace storage {
 
 struct TableScanState;
 class MemoryManager;
+class LocalStorage;
 
 class LocalNodeTable final : public LocalTable {
 public:
@@ -28,6 +31,23 @@ public:
 
     void clear(MemoryManager& mm) override;
 
+    // Compresses full node groups and writes them to the database file, so that large write
+    // transactions don't keep all their rows in memory. Must not be called while the local table
+    // is being scanned.
+    void flushFullNodeGroups(LocalStorage& localStorage);
+    // Reads all flushed node groups back into memory.
+    void loadFlushedNodeGroups();
+    // Reads a flushed node group into a new in-memory chunked group, leaving the node group
+    // flushed.
+    std::unique_ptr<ChunkedNodeGroup> scanFlushedNodeGroup(
+        common::node_group_idx_t nodeGroupIdx) const;
+    // Returns an on-disk chunked group that refers to the pages of a flushed node group, so that
+    // they can be handed to the table on commit. The pages are then no longer reclaimed here.
+    std::unique_ptr<ChunkedNodeGroup> shareFlushedNodeGroup(common::node_group_idx_t nodeGroupIdx);
+    // Frees the pages of the flushed node groups that weren't shared, e.g. once their rows are
+    // committed.
+    void reclaimFlushedNodeGroups() const;
+
     common::row_idx_t getNumTotalRows() override { return nodeGroups.getNumTotalRows(); }
     common::node_group_idx_t getNumNodeGroups() const { return nodeGroups.getNumNodeGroups(); }
 
@@ -48,6 +68,8 @@ public:
 private:
     void initLocalHashIndex(MemoryManager& mm);
     bool isVisible(const transaction::Transaction* transaction, common::offset_t offset) const;
+    std::vector<const Column*> getColumns() const;
+    void loadFlushedNodeGroup(NodeGroup& nodeGroup) const;
 
 private:
     // This is equivalent to the num of committed nodes in the table.
@@ -57,6 +79,10 @@ private:
     OverflowFileHandle* overflowFileHandle;
     std::unique_ptr<LocalHashIndex> hashIndex;
     NodeGroupCollection nodeGroups;
+    // Allocator of the pages of flushed node groups. Null until a node group is flushed.
+    PageAllocator* pageAllocator;
+    // Flushed node groups whose pages now belong to the table.
+    std::unordered_set<common::node_group_idx_t> sharedNodeGroups;
 };
 
 } // namespace storage
@@ -27,6 +27,10 @@ public:
 
     PageAllocator* addOptimisticAllocator();
 
+    // Called between the statements of a transaction. Moves full local node groups out of memory
+    // if memory is running low.
+    void flushLargeLocalTables();
+
     void commit();
     void rollback();
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mutex>
+#include <optional>
 
 #include "common/types/types.h"
 #include "storage/free_space_manager.h"
@@ -21,13 +22,17 @@ class PageManager : public PageAllocator {
 public:
     explicit PageManager(FileHandle* fileHandle)
         : PageAllocator(fileHandle), freeSpaceManager(std::make_unique<FreeSpaceManager>()),
-          fileHandle(fileHandle), version(0) {}
+          fileHandle(fileHandle), version(0), compacting(false) {}
 
     uint64_t getVersion() const { return version; }
     bool changedSinceLastCheckpoint() const { return version != 0; }
     void resetVersion() { version = 0; }
 
     PageRange allocatePageRange(common::page_idx_t numPages) override;
+    // Allocates a free range that starts before the given page. Unlike allocatePageRange(), this
+    // never grows the file. Used to move pages toward the head of the file.
+    std::optional<PageRange> allocatePageRangeBefore(common::page_idx_t numPages,
+        common::page_idx_t pageIdx);
     void freePageRange(PageRange block) override;
     void freeImmediatelyRewritablePageRange(FileHandle* fileHandle, PageRange block);
 
@@ -38,21 +43,27 @@ public:
     void serialize(common::Serializer& serializer);
     void deserialize(common::Deserializer& deSer);
     void finalizeCheckpoint();
-    void rollbackCheckpoint() { freeSpaceManager->rollbackCheckpoint(); }
+    void rollbackCheckpoint();
 
-    common::row_idx_t getNumFreeEntries() const { return freeSpaceManager->getNumEntries(); }
+    // While compacting, allocations take the free range closest to the head of the file instead
+    // of the best fitting one. Reset when the checkpoint is finalized or rolled back.
+    void setCompacting(bool compacting_);
+
+    common::row_idx_t getNumFreeEntries() const;
+    common::page_idx_t getNumFreePages() const;
     std::vector<PageRange> getFreeEntries(common::row_idx_t startOffset,
-        common::row_idx_t endOffset) const {
-        return freeSpaceManager->getEntries(startOffset, endOffset);
-    }
+        common::row_idx_t endOffset) const;
 
     void clearEvictedBMEntriesIfNeeded(BufferManager* bufferManager);
 
 private:
+    // The free space manager isn't thread-safe itself. All accesses go through this class and are
+    // serialized by mtx, as pages are allocated and freed by parallel checkpoint tasks.
     std::unique_ptr<FreeSpaceManager> freeSpaceManager;
-    std::mutex mtx;
+    mutable std::mutex mtx;
     FileHandle* fileHandle;
     uint64_t version;
+    bool compacting;
 };
 } // namespace storage
 } // namespace kuzu
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <shared_mutex>
+
 #include "storage/file_handle.h"
 
 namespace kuzu {
@@ -18,23 +20,31 @@ struct ShadowFileHeader {
 };
 
 class BufferManager;
-// NOTE: This class is NOT thread-safe for now, as we are not checkpointing in parallel yet.
+// Shadow pages can be looked up and created concurrently, since tables and node groups are
+// checkpointed in parallel. Each original page must still be updated by one thread at a time.
+// flushAll, applyShadowPages, clear and reset are only called by the checkpointing thread after
+// all other checkpoint work is done.
 class ShadowFile {
 public:
-    ShadowFile(BufferManager& bm, common::VirtualFileSystem* vfs, const std::string& databasePath);
+    ShadowFile(BufferManager& bm, common::VirtualFileSystem* vfs, const std::string& databasePath,
+        bool enableDirectIO);
 
     // TODO(Guodong): Remove originalFile param.
     bool hasShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage) const {
-        return shadowPagesMap.contains(originalFile) &&
-               shadowPagesMap.at(originalFile).contains(originalPage);
+        std::shared_lock lck{mtx};
+        return hasShadowPageNoLock(originalFile, originalPage);
     }
     void clearShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage);
     common::page_idx_t getShadowPage(common::file_idx_t originalFile,
         common::page_idx_t originalPage) const;
-    common::page_idx_t getOrCreateShadowPage(common::file_idx_t originalFile,
+    // Returns the shadow page and whether this call created it.
+    std::pair<common::page_idx_t, bool> getOrCreateShadowPage(common::file_idx_t originalFile,
         common::page_idx_t originalPage);
 
     FileHandle& getShadowingFH() const { return *shadowingFH; }
+    // Registering the shadowing file handle with the buffer manager isn't thread-safe, so it's
+    // created before any parallel checkpoint work starts.
+    void createShadowingFHIfNecessary();
 
     void applyShadowPages(main::ClientContext& context) const;
 
@@ -49,12 +59,18 @@ public:
     static void replayShadowPageRecords(main::ClientContext& context);
 
 private:
+    bool hasShadowPageNoLock(common::file_idx_t originalFile,
+        common::page_idx_t originalPage) const {
+        return shadowPagesMap.contains(originalFile) &&
+               shadowPagesMap.at(originalFile).contains(originalPage);
+    }
     FileHandle* getOrCreateShadowingFH();
 
 private:
     BufferManager& bm;
     std::string shadowFilePath;
     common::VirtualFileSystem* vfs;
+    bool enableDirectIO;
     // This is the file handle for the shadow file. It is created lazily when the first shadow page
     // is created.
     FileHandle* shadowingFH;
@@ -62,7 +78,10 @@ private:
     std::unordered_map<common::file_idx_t,
         std::unordered_map<common::page_idx_t, common::page_idx_t>>
         shadowPagesMap;
+    // Shadow page i + 1 holds the page of shadowPageRecords[i], so both are updated under the
+    // same lock.
     std::vector<ShadowPageRecord> shadowPageRecords;
+    mutable std::shared_mutex mtx;
 };
 
 } // namespace storage
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "common/copy_constructors.h"
+#include "storage/page_range.h"
+
+namespace kuzu {
+namespace storage {
+
+class FileHandle;
+class PageManager;
+class ShadowFile;
+
+// Moves pages of the data file into free ranges closer to its head during checkpoint, so that the
+// free space collects at the tail of the file, where it is truncated once the checkpoint is
+// finalized. Pages are only copied into ranges that were already free before the checkpoint, and
+// the ranges they are moved out of can't be reused until it is finalized, so the last
+// checkpointed state stays intact until the new metadata is written. If the checkpoint is rolled
+// back instead, rollback() moves the in-memory state back to the old ranges.
+class StorageCompactor {
+public:
+    StorageCompactor(PageManager& pageManager, FileHandle& dataFH, const ShadowFile& shadowFile)
+        : pageManager{pageManager}, dataFH{dataFH}, shadowFile{shadowFile}, numMovedPages{0} {}
+    DELETE_COPY_AND_MOVE(StorageCompactor);
+
+    // Copies the pages of the given range to a free range starting before it and frees the old
+    // range. Returns the new range, or nothing if the pages are left where they are.
+    std::optional<PageRange> relocate(PageRange pageRange);
+    // Registers how to point the owner of relocated pages back at their old range, e.g. by
+    // restoring the chunk metadata. Run by rollback().
+    void addRollbackAction(std::function<void()> action) {
+        rollbackActions.push_back(std::move(action));
+    }
+    // Runs the rollback actions, and frees the ranges the pages were copied to. The old ranges
+    // stay in use, as the page manager drops their pending release when it is rolled back.
+    void rollback();
+
+    uint64_t getNumMovedPages() const { return numMovedPages; }
+
+private:
+    PageManager& pageManager;
+    FileHandle& dataFH;
+    const ShadowFile& shadowFile;
+    uint64_t numMovedPages;
+    std::vector<PageRange> newPageRanges;
+    std::vector<std::function<void()>> rollbackActions;
+};
+
+} // namespace storage
+} // namespace kuzu
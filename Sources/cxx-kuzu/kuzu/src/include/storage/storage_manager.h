@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <mutex>
+#include <span>
 
 #include "catalog/catalog.h"
 #include "shadow_file.h"
@@ -24,11 +26,18 @@ class Table;
 class NodeTable;
 class RelTable;
 class DiskArrayCollection;
+class StorageCompactor;
+
+struct CheckpointPhaseTime {
+    std::string phase;
+    double durationInMS;
+};
 
 class KUZU_API StorageManager {
 public:
     StorageManager(const std::string& databasePath, bool readOnly, MemoryManager& memoryManager,
-        bool enableCompression, common::VirtualFileSystem* vfs);
+        bool enableCompression, common::VirtualFileSystem* vfs, bool enableDirectIO,
+        bool enableMemoryMappedReads);
     ~StorageManager();
 
     Table* getTable(common::table_id_t tableID);
@@ -42,6 +51,18 @@ public:
     bool checkpoint(main::ClientContext* context, PageAllocator& pageAllocator);
     void finalizeCheckpoint();
     void rollbackCheckpoint(const catalog::Catalog& catalog);
+    // Makes the next checkpoint compact the data file, regardless of the compaction threshold.
+    void requestCompaction() { compactionRequested = true; }
+    // Whether the running checkpoint compacts the data file, in which case the catalog and
+    // metadata it writes are placed close to the head of the file as well.
+    bool isCompacting() const { return compacting; }
+    // Wall clock time of the phases of the last checkpoint, in the order they ran.
+    const std::vector<CheckpointPhaseTime>& getLastCheckpointPhaseTimes() const {
+        return lastCheckpointPhaseTimes;
+    }
+    void setLastCheckpointPhaseTimes(std::vector<CheckpointPhaseTime> phaseTimes) {
+        lastCheckpointPhaseTimes = std::move(phaseTimes);
+    }
 
     WAL& getWAL() const;
     ShadowFile& getShadowFile() const;
@@ -72,6 +93,11 @@ private:
 
     void reclaimDroppedTables(const catalog::Catalog& catalog);
 
+    bool shouldCompact(const main::ClientContext& context) const;
+    // Moves table data toward the head of the data file, so that the free space collects at the
+    // tail, where it is truncated when the checkpoint is finalized. Returns true if any page moved.
+    bool compactStorage(std::span<const std::pair<Table*, catalog::TableCatalogEntry*>> tables);
+
 private:
     std::mutex mtx;
     std::string databasePath;
@@ -82,8 +108,17 @@ private:
     std::unique_ptr<WAL> wal;
     std::unique_ptr<ShadowFile> shadowFile;
     bool enableCompression;
+    // Whether the data file and the shadow file bypass the OS page cache.
+    bool enableDirectIO;
+    // Whether pages of the data file are read from a memory mapping when opened read-only.
+    bool enableMemoryMappedReads;
     bool inMemory;
     std::vector<IndexType> registeredIndexTypes;
+    std::vector<CheckpointPhaseTime> lastCheckpointPhaseTimes;
+    std::atomic<bool> compactionRequested;
+    bool compacting;
+    // Kept until the checkpoint is finalized, to undo the relocations if it is rolled back.
+    std::unique_ptr<StorageCompactor> compactor;
 };
 
 } // namespace storage
@@ -22,6 +22,7 @@ class Transaction;
 
 namespace storage {
 class MemoryManager;
+class StorageCompactor;
 
 class Column;
 struct TableScanState;
@@ -131,6 +132,8 @@ public:
         common::row_idx_t startRow, common::length_t numRowsToCheck) const;
     common::row_idx_t getNumDeletions(const transaction::Transaction* transaction,
         common::row_idx_t startRow, common::length_t numRowsToCheck) const;
+    common::row_idx_t getNumSelected(const transaction::Transaction* transaction,
+        common::row_idx_t startRow, common::length_t numRowsToCheck) const;
     bool hasVersionInfo() const { return versionInfo != nullptr; }
 
     void finalize() const;
@@ -156,6 +159,11 @@ public:
     void rollbackDelete(common::row_idx_t startRow, common::row_idx_t numRows_,
         common::transaction_t commitTS);
     virtual void reclaimStorage(PageAllocator& pageAllocator) const;
+    void setBlockCompression(PageAllocator& pageAllocator,
+        common::BlockCompressionType type) const;
+    // Whether any column chunk is stored block compressed.
+    bool hasBlockCompression() const;
+    virtual void compactStorage(StorageCompactor& compactor) const;
 
     uint64_t getEstimatedMemoryUsage() const;
 
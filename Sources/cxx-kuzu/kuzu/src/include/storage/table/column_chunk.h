@@ -7,6 +7,7 @@
 namespace kuzu {
 namespace storage {
 class MemoryManager;
+class StorageCompactor;
 
 struct ChunkCheckpointState {
     std::unique_ptr<ColumnChunkData> chunkData;
@@ -102,6 +103,10 @@ public:
         const transaction::Transaction* transaction) const;
 
     void reclaimStorage(PageAllocator& pageAllocator) const;
+    void setBlockCompression(PageAllocator& pageAllocator, common::BlockCompressionType type) {
+        data->setBlockCompression(pageAllocator, type);
+    }
+    void compactStorage(StorageCompactor& compactor) { data->compactStorage(compactor); }
 
 private:
     void scanCommittedUpdates(const transaction::Transaction* transaction, ColumnChunkData& output,
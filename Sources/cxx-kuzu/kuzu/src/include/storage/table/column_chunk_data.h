@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <optional>
+#include <span>
 #include <variant>
 
 #include "common/data_chunk/sel_vector.h"
@@ -35,6 +36,7 @@ class Column;
 class NullChunkData;
 class ColumnStats;
 class PageAllocator;
+class StorageCompactor;
 class FileHandle;
 
 // TODO(bmwinger): Hide access to variables.
@@ -52,6 +54,10 @@ struct ChunkState {
         std::unique_ptr<InMemoryExceptionChunk<float>>>
         alpExceptionChunk;
 
+    // Used for FSST compressed string data, to read the encoded strings of a scan into without
+    // allocating for each string.
+    mutable std::vector<uint8_t> fsstScratchBuffer;
+
     explicit ChunkState(bool hasNull = true) : column{nullptr} {
         if (hasNull) {
             nullState = std::make_unique<ChunkState>(false /*hasNull*/);
@@ -159,6 +165,9 @@ public:
     virtual void append(common::ValueVector* vector, const common::SelectionView& selView);
     virtual void append(ColumnChunkData* other, common::offset_t startPosInOtherChunk,
         uint32_t numValuesToAppend);
+    // Returns an in-memory chunk of the same capacity whose i-th value is the order[i]-th value of
+    // this one.
+    std::unique_ptr<ColumnChunkData> copyInOrder(std::span<const common::row_idx_t> order);
 
     virtual void flush(PageAllocator& pageAllocator);
 
@@ -241,6 +250,14 @@ public:
     void updateStats(const common::ValueVector* vector, const common::SelectionView& selVector);
 
     virtual void reclaimStorage(PageAllocator& pageAllocator);
+    // Moves the pages of an on-disk chunk to a new page range, compressed as a single block with
+    // the given codec, or decompressed if the type is NONE. Chunks which wouldn't get smaller are
+    // left as they are. Only called during checkpoint.
+    virtual void setBlockCompression(PageAllocator& pageAllocator,
+        common::BlockCompressionType type);
+    // Moves the pages of an on-disk chunk toward the head of the data file. Only called during
+    // checkpoint.
+    virtual void compactStorage(StorageCompactor& compactor);
 
 protected:
     // Initializes the data buffer and functions. They are (and should be) only called in
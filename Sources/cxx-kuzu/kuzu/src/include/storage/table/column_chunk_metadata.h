@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/types/types.h"
+#include "storage/compression/block_compression.h"
 #include "storage/compression/compression.h"
 #include "storage/page_range.h"
 
@@ -9,9 +10,14 @@ struct ColumnChunkMetadata {
     PageRange pageRange;
     uint64_t numValues;
     CompressionMetadata compMeta;
+    // Set once the node group of the chunk has gone cold and its pages were compressed.
+    BlockCompressionMetadata blockCompression;
 
     common::page_idx_t getStartPageIdx() const { return pageRange.startPageIdx; }
     common::page_idx_t getNumPages() const { return pageRange.numPages; }
+    // Number of pages readers see, which differs from the number of pages on disk for block
+    // compressed chunks.
+    common::page_idx_t getNumDecompressedPages() const;
 
     // Returns the number of pages used to store data
     // In the case of ALP compression, this does not include the number of pages used to store
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storage/compression/float_compression.h"
+#include "storage/enums/eviction_policy.h"
 
 namespace kuzu {
 namespace transaction {
@@ -9,6 +10,7 @@ class Transaction;
 namespace storage {
 
 class FileHandle;
+class MemoryManager;
 class ColumnReadWriter;
 class ShadowFile;
 struct ColumnChunkMetadata;
@@ -37,12 +39,12 @@ using filter_func_t = std::function<bool(common::offset_t, common::offset_t)>;
 
 struct ColumnReadWriterFactory {
     static std::unique_ptr<ColumnReadWriter> createColumnReadWriter(common::PhysicalTypeID dataType,
-        FileHandle* dataFH, ShadowFile* shadowFile);
+        FileHandle* dataFH, ShadowFile* shadowFile, MemoryManager* mm);
 };
 
 class ColumnReadWriter {
 public:
-    ColumnReadWriter(FileHandle* dataFH, ShadowFile* shadowFile);
+    ColumnReadWriter(FileHandle* dataFH, ShadowFile* shadowFile, MemoryManager* mm);
 
     virtual ~ColumnReadWriter() = default;
 
@@ -72,8 +74,13 @@ public:
         const uint8_t* data, const common::NullMask* nullChunkData, common::offset_t srcOffset,
         common::offset_t numValues, const write_values_func_t& writeFunc) = 0;
 
-    void readFromPage(common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readFunc) const;
+    // Pages of block compressed chunks are read from the decompressed page cache.
+    void readFromPage(common::page_idx_t pageIdx, const ColumnChunkMetadata& metadata,
+        const std::function<void(uint8_t*)>& readFunc,
+        PageAccessType accessType = PageAccessType::RANDOM) const;
+    // Requests the pages that a sequential scan of the chunk reaches after the given pages.
+    void prefetchAhead(const ColumnChunkMetadata& metadata, common::page_idx_t firstPageIdx,
+        common::page_idx_t lastPageIdx) const;
 
     void updatePageWithCursor(PageCursor cursor,
         const std::function<void(uint8_t*, common::offset_t)>& writeOp) const;
@@ -88,6 +95,7 @@ protected:
 private:
     FileHandle* dataFH;
     ShadowFile* shadowFile;
+    MemoryManager* mm;
 };
 
 } // namespace storage
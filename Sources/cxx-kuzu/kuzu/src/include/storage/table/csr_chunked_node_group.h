@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <span>
 
 #include "storage/table/chunked_node_group.h"
 
@@ -100,12 +101,13 @@ public:
     }
     ChunkedCSRNodeGroup(ChunkedCSRNodeGroup& base,
         const std::vector<common::column_id_t>& selectedColumns)
-        : ChunkedNodeGroup{base, selectedColumns}, csrHeader{std::move(base.csrHeader)} {}
+        : ChunkedNodeGroup{base, selectedColumns}, csrHeader{std::move(base.csrHeader)},
+          sortedByNeighbor{base.sortedByNeighbor} {}
     ChunkedCSRNodeGroup(MemoryManager& mm, ChunkedCSRNodeGroup& base,
         std::span<const common::LogicalType> columnTypes,
         std::span<const common::column_id_t> baseColumnIDs)
         : ChunkedNodeGroup(mm, base, columnTypes, baseColumnIDs),
-          csrHeader(std::move(base.csrHeader)) {}
+          csrHeader(std::move(base.csrHeader)), sortedByNeighbor{base.sortedByNeighbor} {}
     ChunkedCSRNodeGroup(ChunkedCSRHeader csrHeader,
         std::vector<std::unique_ptr<ColumnChunk>> chunks, common::row_idx_t startRowIdx)
         : ChunkedNodeGroup{std::move(chunks), startRowIdx, NodeGroupDataFormat::CSR},
@@ -114,6 +116,11 @@ public:
     ChunkedCSRHeader& getCSRHeader() { return csrHeader; }
     const ChunkedCSRHeader& getCSRHeader() const { return csrHeader; }
 
+    // Whether the rows of every CSR list are ordered by neighbor offset, so that the rels to a
+    // neighbor can be binary searched for.
+    bool isSortedByNeighbor() const { return sortedByNeighbor; }
+    void setSortedByNeighbor(bool sortedByNeighbor_) { sortedByNeighbor = sortedByNeighbor_; }
+
     void serialize(common::Serializer& serializer) const override;
     static std::unique_ptr<ChunkedCSRNodeGroup> deserialize(MemoryManager& memoryManager,
         common::Deserializer& deSer);
@@ -126,12 +133,21 @@ public:
 
     void scanCSRHeader(MemoryManager& memoryManager, CSRNodeGroupCheckpointState& csrState) const;
 
+    // Reorders the rows of each CSR list by neighbor offset and marks the group as sorted. Gaps are
+    // left in place.
+    void sortCSRListsByNeighbor();
+    // Sorts the rows of a CSR list by their neighbor offsets in nbrData. Returns false if the rows
+    // were sorted already.
+    static bool sortCSRListByNeighbor(const ColumnChunkData& nbrData,
+        std::span<common::row_idx_t> rows);
+
     std::unique_ptr<ChunkedNodeGroup> flushAsNewChunkedNodeGroup(
         transaction::Transaction* transaction, MemoryManager& mm,
         PageAllocator& pageAllocator) const override;
 
     void flush(PageAllocator& pageAllocator) override;
     void reclaimStorage(PageAllocator& pageAllocator) const override;
+    void compactStorage(StorageCompactor& compactor) const override;
 
     // this does not override ChunkedNodeGroup::merge() since clang-tidy analyzer
     // seems to struggle with detecting the std::move of the header unless this is inlined
@@ -139,10 +155,12 @@ public:
         const std::vector<common::column_id_t>& columnsToMergeInto) {
         ChunkedNodeGroup::merge(base, columnsToMergeInto);
         csrHeader = std::move(base.csrHeader);
+        sortedByNeighbor = base.sortedByNeighbor;
     }
 
 private:
     ChunkedCSRHeader csrHeader;
+    bool sortedByNeighbor = false;
 };
 
 } // namespace storage
@@ -2,6 +2,8 @@
 
 #include <array>
 #include <bitset>
+#include <optional>
+#include <span>
 
 #include "common/constants.h"
 #include "common/system_config.h"
@@ -151,12 +153,23 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
 
     std::unique_ptr<ChunkedCSRHeader> oldHeader;
     std::unique_ptr<ChunkedCSRHeader> newHeader;
+    // Whether rels inserted into a CSR list are merged into it by neighbor offset.
+    bool sortListsByNeighbor = false;
 
     CSRNodeGroupCheckpointState(std::vector<common::column_id_t> columnIDs,
         std::vector<Column*> columns, PageAllocator& pageAllocator, MemoryManager* mm,
         Column* csrOffsetCol, Column* csrLengthCol)
         : NodeGroupCheckpointState{std::move(columnIDs), std::move(columns), pageAllocator, mm},
           csrOffsetColumn{csrOffsetCol}, csrLengthColumn{csrLengthCol} {}
+
+    // The CSR headers are scratch space of the node group being checkpointed, so they aren't
+    // copied.
+    std::unique_ptr<NodeGroupCheckpointState> copy() const override {
+        auto result = std::make_unique<CSRNodeGroupCheckpointState>(columnIDs, columns,
+            pageAllocator, mm, csrOffsetColumn, csrLengthColumn);
+        result->sortListsByNeighbor = sortListsByNeighbor;
+        return result;
+    }
 };
 
 static constexpr common::column_id_t NBR_ID_COLUMN_ID = 0;
@@ -199,6 +212,22 @@ public:
         const std::vector<ColumnChunk*>& chunks, common::row_idx_t startRowInChunks,
         common::row_idx_t numRows);
 
+    // Adds the number of rels visible to the transaction for each bound node in
+    // [startOffsetInGroup, startOffsetInGroup + degrees.size()) to `degrees`. Only the CSR header
+    // and version info are read, data columns are not scanned.
+    void addDegrees(const transaction::Transaction* transaction, const Column* csrOffsetColumn,
+        const Column* csrLengthColumn, common::offset_t startOffsetInGroup,
+        std::span<uint64_t> degrees) const;
+
+    // Binary searches the persistent CSR list of the bound node for the rel to the neighbor.
+    // Returns the row of the rel, INVALID_ROW_IDX if the rel isn't in the persistent list, or
+    // nullopt if the persistent lists aren't sorted by neighbor and have to be scanned instead.
+    std::optional<common::row_idx_t> findPersistentRowByNeighbor(
+        const transaction::Transaction* transaction, const Column* csrOffsetColumn,
+        const Column* csrLengthColumn, const Column* nbrIDColumn, const Column* relIDColumn,
+        common::offset_t boundOffsetInGroup, common::offset_t nbrOffset,
+        common::offset_t relOffset) const;
+
     void update(const transaction::Transaction* transaction, CSRNodeGroupScanSource source,
         common::row_idx_t rowIdxInGroup, common::column_id_t columnID,
         const common::ValueVector& propertyVector);
@@ -210,6 +239,7 @@ public:
 
     void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state) override;
     void reclaimStorage(PageAllocator& pageAllocator, const common::UniqLock& lock) const override;
+    void compactStorage(StorageCompactor& compactor) override;
 
     bool isEmpty() const override { return !persistentChunkGroup && NodeGroup::isEmpty(); }
 
@@ -227,6 +257,12 @@ private:
     static void initScanForCommittedInMem(RelTableScanState& relScanState,
         CSRNodeGroupScanState& nodeGroupScanState);
 
+    void addPersistentDegrees(const transaction::Transaction* transaction,
+        const Column* csrOffsetColumn, const Column* csrLengthColumn,
+        common::offset_t startOffsetInGroup, std::span<uint64_t> degrees) const;
+    void addInMemDegrees(const transaction::Transaction* transaction,
+        common::offset_t startOffsetInGroup, std::span<uint64_t> degrees) const;
+
     void updateCSRIndex(common::offset_t boundNodeOffsetInGroup, common::row_idx_t startRow,
         common::length_t length) const;
 
@@ -275,11 +311,17 @@ private:
         const std::vector<CSRRegion>& leafRegions, const CSRRegion& region);
 
     void checkpointColumn(const common::UniqLock& lock, common::column_id_t columnID,
-        const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions) const;
+        const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions,
+        const std::vector<row_idx_vec_t>& regionRowOrders) const;
     ChunkCheckpointState checkpointColumnInRegion(const common::UniqLock& lock,
         common::column_id_t columnID, const CSRNodeGroupCheckpointState& csrState,
         const CSRRegion& region) const;
     void checkpointCSRHeaderColumns(const CSRNodeGroupCheckpointState& csrState) const;
+    // Returns the order in which the checkpointed rows of the region are written so that each CSR
+    // list is sorted by neighbor offset.
+    row_idx_vec_t getRegionRowOrderByNeighbor(const common::UniqLock& lock,
+        const CSRNodeGroupCheckpointState& csrState, const CSRRegion& region) const;
+    void sortInMemRowsByNeighbor(const common::UniqLock& lock, row_idx_vec_t& rows) const;
     void finalizeCheckpoint(const common::UniqLock& lock);
 
 private:
@@ -6,6 +6,7 @@
 namespace kuzu {
 namespace storage {
 class MemoryManager;
+class FSSTSymbolTable;
 
 class DictionaryChunk {
 public:
@@ -50,12 +51,22 @@ public:
 
     void flush(PageAllocator& pageAllocator);
 
+    // Returns a copy of the dictionary whose string data is encoded with FSST, or nullptr if the
+    // encoding would not make the string data smaller. String indices are kept unchanged.
+    std::unique_ptr<DictionaryChunk> encodeWithFSST() const;
+    // Replaces FSST-encoded string data scanned from disk with the decoded strings.
+    void decodeFSST(const FSSTSymbolTable& symbolTable);
+    // Flushes the string data, keeping the FSST symbol table in its metadata if it is encoded.
+    std::unique_ptr<ColumnChunkData> flushStringData(PageAllocator& pageAllocator) const;
+
 private:
     bool enableCompression;
     // String data is stored as a UINT8 chunk, using the numValues in the chunk to track the number
     // of characters stored.
     std::unique_ptr<ColumnChunkData> stringDataChunk;
     std::unique_ptr<ColumnChunkData> offsetChunk;
+    // Only set for copies created by encodeWithFSST.
+    std::shared_ptr<const FSSTSymbolTable> fsstSymbolTable;
 
     struct DictionaryEntry {
         string_index_t index;
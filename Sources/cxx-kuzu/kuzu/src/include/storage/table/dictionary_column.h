@@ -34,6 +34,9 @@ private:
     void scanValueToVector(const ChunkState& dataState, uint64_t startOffset, uint64_t endOffset,
         common::ValueVector* resultVector, uint64_t offsetInVector) const;
 
+    // Upper bound on the bytes appended to the data column for strings of the given total length.
+    static uint64_t getMaxDataSizeToAdd(const ChunkState& dataState,
+        uint64_t totalStringLengthToAdd);
     static bool canDataCommitInPlace(const ChunkState& dataState, uint64_t totalStringLengthToAdd);
     bool canOffsetCommitInPlace(const ChunkState& offsetState, const ChunkState& dataState,
         uint64_t numNewStrings, uint64_t totalStringLengthToAdd) const;
@@ -108,6 +108,9 @@ public:
 
     void flush(PageAllocator& pageAllocator) override;
     void reclaimStorage(PageAllocator& pageAllocator) override;
+    void setBlockCompression(PageAllocator& pageAllocator,
+        common::BlockCompressionType type) override;
+    void compactStorage(StorageCompactor& compactor) override;
 
 protected:
     void copyListValues(const common::list_entry_t& entry, common::ValueVector* dataVector);
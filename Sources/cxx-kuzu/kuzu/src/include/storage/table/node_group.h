@@ -15,6 +15,7 @@ class Transaction;
 
 namespace storage {
 class MemoryManager;
+class StorageCompactor;
 
 class ColumnStats;
 struct TableAddColumnState;
@@ -55,6 +56,11 @@ struct NodeGroupCheckpointState {
           pageAllocator{pageAllocator}, mm{mm} {}
     virtual ~NodeGroupCheckpointState() = default;
 
+    // Node groups checkpointed in parallel each use their own copy of the state.
+    virtual std::unique_ptr<NodeGroupCheckpointState> copy() const {
+        return std::make_unique<NodeGroupCheckpointState>(columnIDs, columns, pageAllocator, mm);
+    }
+
     template<typename T>
     const T& cast() const {
         return common::ku_dynamic_cast<const T&>(*this);
@@ -157,6 +163,23 @@ public:
     bool delete_(const transaction::Transaction* transaction, common::row_idx_t rowIdxInGroup);
 
     bool hasDeletions(const transaction::Transaction* transaction) const;
+
+    // Whether all rows of the node group are in a single on-disk chunked group.
+    bool isFlushed() const;
+    // Merges the in-memory chunked groups into a single chunked group, which is compressed and
+    // written through the page allocator. Large write transactions use this to keep their local
+    // node groups out of memory. Deletions visible to the transaction are kept.
+    void flushInMemoryData(PageAllocator& pageAllocator, const std::vector<const Column*>& columns,
+        const transaction::Transaction* transaction);
+    // Reads the data of a flushed node group back into memory and frees its pages.
+    void loadFlushedData(PageAllocator& pageAllocator, const std::vector<const Column*>& columns,
+        const transaction::Transaction* transaction);
+    // Reads the data of a flushed node group into a new in-memory chunked group. The node group
+    // stays flushed and keeps its pages.
+    std::unique_ptr<ChunkedNodeGroup> scanFlushedData(
+        const std::vector<const Column*>& columns) const;
+    // Returns a new on-disk chunked group that refers to the same pages as the flushed data.
+    std::unique_ptr<ChunkedNodeGroup> shareFlushedData() const;
     virtual void addColumn(TableAddColumnState& addColumnState, PageAllocator* pageAllocator,
         ColumnStats* newColumnStats);
 
@@ -167,6 +190,15 @@ public:
     virtual void reclaimStorage(PageAllocator& pageAllocator, const common::UniqLock& lock) const;
 
     virtual void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state);
+    // Counts the checkpoint towards the number of checkpoints the node group has gone without
+    // changes to its data, and block compresses its column chunks once that number exceeds the
+    // threshold. Node groups that are already compressed are skipped. Returns true if the column
+    // chunks were compressed. The count alone isn't reported as a change, so that checkpoints
+    // don't rewrite the metadata just to persist it.
+    bool checkpointColdData(PageAllocator& pageAllocator, common::BlockCompressionType type,
+        uint64_t coldCheckpointThreshold);
+    // Moves the on-disk chunks of the node group toward the head of the data file.
+    virtual void compactStorage(StorageCompactor& compactor);
 
     uint64_t getEstimatedMemoryUsage() const;
 
@@ -217,6 +249,8 @@ private:
         common::row_idx_t rowIdx) const;
     ChunkedNodeGroup* findChunkedGroupFromRowIdxNoLock(common::row_idx_t rowIdx) const;
 
+    bool hasDataChanges(const common::UniqLock& lock,
+        const NodeGroupCheckpointState& state) const;
     std::unique_ptr<ChunkedNodeGroup> checkpointInMemOnly(MemoryManager& memoryManager,
         const common::UniqLock& lock, const NodeGroupCheckpointState& state) const;
     std::unique_ptr<ChunkedNodeGroup> checkpointInMemAndOnDisk(MemoryManager& memoryManager,
@@ -229,7 +263,7 @@ private:
     template<ResidencyState SCAN_RESIDENCY_STATE>
     std::unique_ptr<ChunkedNodeGroup> scanAllInsertedAndVersions(MemoryManager& memoryManager,
         const common::UniqLock& lock, const std::vector<common::column_id_t>& columnIDs,
-        const std::vector<const Column*>& columns) const;
+        const std::vector<const Column*>& columns, bool enableCompression) const;
 
     virtual NodeGroupScanResult scanInternal(const common::UniqLock& lock,
         transaction::Transaction* transaction, TableScanState& state,
@@ -252,6 +286,10 @@ protected:
     common::row_idx_t capacity;
     std::vector<common::LogicalType> dataTypes;
     GroupCollection<ChunkedNodeGroup> chunkedGroups;
+    // Number of consecutive checkpoints which didn't insert or update any rows of the node group.
+    // Only counted for tables with block compression, and not past the point where the node group
+    // became cold.
+    uint64_t numUnchangedCheckpoints = 0;
 };
 
 } // namespace storage
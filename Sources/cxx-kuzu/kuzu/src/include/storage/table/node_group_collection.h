@@ -5,11 +5,15 @@
 #include "storage/table/node_group.h"
 
 namespace kuzu {
+namespace main {
+class ClientContext;
+}
 namespace transaction {
 class Transaction;
 }
 namespace storage {
 class MemoryManager;
+class StorageCompactor;
 
 class NodeGroupCollection {
 public:
@@ -23,6 +27,8 @@ public:
         const std::vector<common::column_id_t>& columnIDs, const NodeGroupCollection& other);
     void append(const transaction::Transaction* transaction,
         const std::vector<common::column_id_t>& columnIDs, const NodeGroup& nodeGroup);
+    void append(const transaction::Transaction* transaction,
+        const std::vector<common::column_id_t>& columnIDs, ChunkedNodeGroup& chunkedGroup);
 
     // This function only tries to append data into the last node group, and if the last node group
     // is not enough to hold all the data, it will append partially and return the number of rows
@@ -33,6 +39,13 @@ public:
         MemoryManager& mm, transaction::Transaction* transaction,
         const std::vector<common::column_id_t>& columnIDs, ChunkedNodeGroup& chunkedGroup,
         PageAllocator& pageAllocator);
+    // Whether the next row is appended to a new node group, i.e. the last node group is full.
+    bool isLastNodeGroupFull() const;
+    // Appends a full chunked group that is already flushed as a new node group, taking over its
+    // pages the same way COPY does. The last node group must be full.
+    void appendFlushedNodeGroup(transaction::Transaction* transaction,
+        const std::vector<common::column_id_t>& columnIDs,
+        std::unique_ptr<ChunkedNodeGroup> flushedGroup);
 
     common::row_idx_t getNumTotalRows() const;
     common::node_group_idx_t getNumNodeGroups() const {
@@ -77,8 +90,14 @@ public:
 
     uint64_t getEstimatedMemoryUsage() const;
 
-    void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state);
+    // Node groups are checkpointed in parallel if a context is given.
+    void checkpoint(main::ClientContext* context, MemoryManager& memoryManager,
+        NodeGroupCheckpointState& state);
+    // Returns true if the metadata of any node group changed.
+    bool checkpointColdData(PageAllocator& pageAllocator, common::BlockCompressionType type,
+        uint64_t coldCheckpointThreshold);
     void reclaimStorage(PageAllocator& pageAllocator) const;
+    void compactStorage(StorageCompactor& compactor) const;
 
     TableStats getStats() const {
         auto lock = nodeGroups.lock();
@@ -109,6 +128,8 @@ public:
 private:
     void pushInsertInfo(const transaction::Transaction* transaction, const NodeGroup* nodeGroup,
         common::row_idx_t numRows);
+    void append(const common::UniqLock& lock, const transaction::Transaction* transaction,
+        const std::vector<common::column_id_t>& columnIDs, ChunkedNodeGroup& chunkedGroup);
 
 private:
     MemoryManager& mm;
@@ -144,6 +144,11 @@ public:
 
     bool lookupPK(const transaction::Transaction* transaction, common::ValueVector* keyVector,
         uint64_t vectorPos, common::offset_t& result) const;
+    // Batched version of lookupPK over the non-null keys at the given positions of keyVector.
+    // results[i] is set to INVALID_OFFSET if the key at positions[i] doesn't exist.
+    void lookupPKBatch(const transaction::Transaction* transaction,
+        const common::ValueVector& keyVector, std::span<const common::sel_t> positions,
+        std::span<common::offset_t> results) const;
 
     void addIndex(std::unique_ptr<Index> index);
     void dropIndex(const std::string& name);
@@ -178,10 +183,14 @@ public:
         PageAllocator& pageAllocator) override;
     void rollbackCheckpoint() override;
     void reclaimStorage(PageAllocator& pageAllocator) const override;
+    void compactStorage(StorageCompactor& compactor) override;
 
     void rollbackPKIndexInsert(main::ClientContext* context, common::row_idx_t startRow,
         common::row_idx_t numRows_, common::node_group_idx_t nodeGroupIdx_);
     void rollbackGroupCollectionInsert(common::row_idx_t numRows_);
+    // The primary key index is rolled back by rollbackPKIndexInsert().
+    void rollbackSecondaryIndexInsert(common::row_idx_t startRow, common::row_idx_t numRows_,
+        common::node_group_idx_t nodeGroupIdx_);
 
     common::node_group_idx_t getNumCommittedNodeGroups() const {
         return nodeGroups->getNumNodeGroups();
@@ -223,6 +232,7 @@ private:
     std::unique_ptr<NodeGroupCollection> nodeGroups;
     common::column_id_t pkColumnID;
     std::vector<IndexHolder> indexes;
+    std::vector<IndexHolder> droppedIndexes;
     NodeTableVersionRecordHandler versionRecordHandler;
 };
 
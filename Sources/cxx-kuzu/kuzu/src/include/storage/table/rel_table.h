@@ -113,6 +113,9 @@ struct RelTableUpdateState final : TableUpdateState {
     common::ValueVector& getBoundNodeIDVector(common::RelDataDirection direction) const {
         return direction == common::RelDataDirection::FWD ? srcNodeIDVector : dstNodeIDVector;
     }
+    common::ValueVector& getNbrNodeIDVector(common::RelDataDirection direction) const {
+        return direction == common::RelDataDirection::FWD ? dstNodeIDVector : srcNodeIDVector;
+    }
 
     RelTableUpdateState(common::column_id_t columnID, common::ValueVector& srcNodeIDVector,
         common::ValueVector& dstNodeIDVector, common::ValueVector& relIDVector,
@@ -130,6 +133,9 @@ struct KUZU_API RelTableDeleteState final : TableDeleteState {
     common::ValueVector& getBoundNodeIDVector(common::RelDataDirection direction) const {
         return direction == common::RelDataDirection::FWD ? srcNodeIDVector : dstNodeIDVector;
     }
+    common::ValueVector& getNbrNodeIDVector(common::RelDataDirection direction) const {
+        return direction == common::RelDataDirection::FWD ? dstNodeIDVector : srcNodeIDVector;
+    }
 
     RelTableDeleteState(common::ValueVector& srcNodeIDVector, common::ValueVector& dstNodeIDVector,
         common::ValueVector& relIDVector,
@@ -168,6 +174,11 @@ public:
     void detachDelete(transaction::Transaction* transaction, RelTableDeleteState* deleteState);
     bool checkIfNodeHasRels(transaction::Transaction* transaction,
         common::RelDataDirection direction, common::ValueVector* srcNodeIDVector) const;
+    // Adds the number of rels of each bound node in
+    // [startNodeOffset, startNodeOffset + degrees.size()) in the given direction to `degrees`,
+    // including local inserts and deletions of the transaction.
+    void addDegrees(transaction::Transaction* transaction, common::RelDataDirection direction,
+        common::offset_t startNodeOffset, std::span<uint64_t> degrees) const;
     void throwIfNodeHasRels(transaction::Transaction* transaction,
         common::RelDataDirection direction, common::ValueVector* srcNodeIDVector,
         const rel_multiplicity_constraint_throw_func_t& throwFunc) const;
@@ -201,6 +212,7 @@ public:
         PageAllocator& pageAllocator) override;
     void rollbackCheckpoint() override {};
     void reclaimStorage(PageAllocator& pageAllocator) const override;
+    void compactStorage(StorageCompactor& compactor) override;
 
     common::row_idx_t getNumTotalRows(const transaction::Transaction* transaction) override;
 
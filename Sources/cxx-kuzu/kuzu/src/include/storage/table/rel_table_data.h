@@ -12,6 +12,9 @@ namespace kuzu {
 namespace catalog {
 class RelGroupCatalogEntry;
 }
+namespace main {
+class ClientContext;
+}
 namespace transaction {
 class Transaction;
 }
@@ -19,6 +22,7 @@ namespace storage {
 class Table;
 class MemoryManager;
 class RelTableData;
+class StorageCompactor;
 
 struct CSRHeaderColumns {
     std::unique_ptr<Column> offset;
@@ -60,10 +64,10 @@ public:
         common::RelDataDirection direction, common::table_id_t nbrTableID, bool enableCompression);
 
     bool update(transaction::Transaction* transaction, common::ValueVector& boundNodeIDVector,
-        const common::ValueVector& relIDVector, common::column_id_t columnID,
-        const common::ValueVector& dataVector) const;
+        const common::ValueVector& nbrNodeIDVector, const common::ValueVector& relIDVector,
+        common::column_id_t columnID, const common::ValueVector& dataVector) const;
     bool delete_(transaction::Transaction* transaction, common::ValueVector& boundNodeIDVector,
-        const common::ValueVector& relIDVector);
+        const common::ValueVector& nbrNodeIDVector, const common::ValueVector& relIDVector);
     void addColumn(TableAddColumnState& addColumnState, PageAllocator& pageAllocator);
 
     bool checkIfNodeHasRels(transaction::Transaction* transaction,
@@ -97,8 +101,9 @@ public:
     TableStats getStats() const { return nodeGroups->getStats(); }
 
     void reclaimStorage(PageAllocator& pageAllocator) const;
-    void checkpoint(const std::vector<common::column_id_t>& columnIDs,
-        PageAllocator& pageAllocator);
+    void compactStorage(StorageCompactor& compactor) const;
+    void checkpoint(main::ClientContext* context, const std::vector<common::column_id_t>& columnIDs,
+        PageAllocator& pageAllocator, bool sortListsByNeighbor);
 
     void pushInsertInfo(const transaction::Transaction* transaction, const CSRNodeGroup& nodeGroup,
         common::row_idx_t numRows_, CSRNodeGroupScanSource source);
@@ -121,7 +126,7 @@ private:
 
     std::pair<CSRNodeGroupScanSource, common::row_idx_t> findMatchingRow(
         transaction::Transaction* transaction, common::ValueVector& boundNodeIDVector,
-        const common::ValueVector& relIDVector) const;
+        const common::ValueVector& nbrNodeIDVector, const common::ValueVector& relIDVector) const;
 
     template<typename T1, typename T2>
     static double divideNoRoundUp(T1 v1, T2 v2) {
@@ -62,6 +62,9 @@ public:
 
     void flush(PageAllocator& pageAllocator) override;
     void reclaimStorage(PageAllocator& pageAllocator) override;
+    void setBlockCompression(PageAllocator& pageAllocator,
+        common::BlockCompressionType type) override;
+    void compactStorage(StorageCompactor& compactor) override;
 
     void resetNumValuesFromMetadata() override;
     void syncNumValues() override {
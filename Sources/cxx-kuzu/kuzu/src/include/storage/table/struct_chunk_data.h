@@ -50,6 +50,9 @@ public:
 
     void flush(PageAllocator& pageAllocator) override;
     void reclaimStorage(PageAllocator& pageAllocator) override;
+    void setBlockCompression(PageAllocator& pageAllocator,
+        common::BlockCompressionType type) override;
+    void compactStorage(StorageCompactor& compactor) override;
 
 protected:
     void append(ColumnChunkData* other, common::offset_t startPosInOtherChunk,
@@ -14,6 +14,7 @@ class ExpressionEvaluator;
 } // namespace evaluator
 namespace storage {
 class MemoryManager;
+class StorageCompactor;
 class Table;
 
 enum class TableScanSource : uint8_t { COMMITTED = 0, UNCOMMITTED = 1, NONE = UINT8_MAX };
@@ -179,6 +180,8 @@ public:
         PageAllocator& pageAllocator) = 0;
     virtual void rollbackCheckpoint() = 0;
     virtual void reclaimStorage(PageAllocator& pageAllocator) const = 0;
+    // Moves the table's on-disk data toward the head of the data file during checkpoint.
+    virtual void compactStorage(StorageCompactor& compactor) = 0;
 
     virtual common::row_idx_t getNumTotalRows(const transaction::Transaction* transaction) = 0;
 
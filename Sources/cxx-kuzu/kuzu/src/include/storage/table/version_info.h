@@ -34,6 +34,9 @@ public:
     bool hasDeletions() const;
     common::row_idx_t getNumDeletions(const transaction::Transaction* transaction,
         common::row_idx_t startRow, common::length_t numRows) const;
+    // Returns the number of rows in [startRow, startRow + numRows) visible to the transaction.
+    common::row_idx_t getNumSelected(const transaction::Transaction* transaction,
+        common::row_idx_t startRow, common::length_t numRows) const;
     bool hasInsertions() const;
     bool isDeleted(const transaction::Transaction* transaction, common::row_idx_t rowInChunk) const;
     bool isInserted(const transaction::Transaction* transaction,
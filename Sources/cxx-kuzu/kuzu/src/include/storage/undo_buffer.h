@@ -20,6 +20,7 @@ namespace main {
 class ClientContext;
 }
 namespace storage {
+class Index;
 class VersionRecordHandler;
 
 class UndoMemoryBuffer {
@@ -76,6 +77,7 @@ public:
         UPDATE_INFO = 6,
         INSERT_INFO = 7,
         DELETE_INFO = 8,
+        INDEX_UPDATE_INFO = 9,
     };
 
     explicit UndoBuffer(MemoryManager* mm) : mm{mm} {}
@@ -89,6 +91,8 @@ public:
         common::row_idx_t numRows, const VersionRecordHandler* versionRecordHandler);
     void createVectorUpdateInfo(UpdateInfo* updateInfo, common::idx_t vectorIdx,
         VectorUpdateInfo* vectorUpdateInfo);
+    // Lets an index commit or roll back the entries it added for the transaction's updates.
+    void createIndexUpdateInfo(Index* index, common::transaction_t transactionID);
 
     void commit(common::transaction_t commitTS) const;
     void rollback(main::ClientContext* context) const;
@@ -120,6 +124,9 @@ private:
     static void rollbackVectorUpdateInfo(const transaction::Transaction* transaction,
         const uint8_t* record);
 
+    static void commitIndexUpdateInfo(const uint8_t* record);
+    static void rollbackIndexUpdateInfo(const uint8_t* record);
+
 private:
     std::mutex mtx;
     MemoryManager* mm;
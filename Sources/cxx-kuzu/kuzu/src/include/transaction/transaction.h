@@ -28,6 +28,7 @@ class UpdateInfo;
 struct VectorUpdateInfo;
 class ChunkedNodeGroup;
 class VersionRecordHandler;
+class Index;
 } // namespace storage
 namespace transaction {
 class TransactionManager;
@@ -142,6 +143,7 @@ public:
         common::row_idx_t numRows, const storage::VersionRecordHandler* versionRecordHandler) const;
     void pushVectorUpdateInfo(storage::UpdateInfo& updateInfo, common::idx_t vectorIdx,
         storage::VectorUpdateInfo& vectorUpdateInfo) const;
+    void pushIndexUpdateInfo(storage::Index& index) const;
 
 private:
     common::offset_t getMinUncommittedNodeOffset(common::table_id_t tableID) const;
@@ -53,7 +53,9 @@ AttachedKuzuDatabase::AttachedKuzuDatabase(std::string dbPath, std::string dbNam
     catalog = std::make_unique<catalog::Catalog>();
     validateEmptyWAL(path, clientContext);
     storageManager = std::make_unique<storage::StorageManager>(path, true /* isReadOnly */,
-        *clientContext->getMemoryManager(), clientContext->getDBConfig()->enableCompression, vfs);
+        *clientContext->getMemoryManager(), clientContext->getDBConfig()->enableCompression, vfs,
+        clientContext->getDBConfig()->enableDirectIO,
+        clientContext->getDBConfig()->enableMemoryMappedReads);
     transactionManager =
         std::make_unique<transaction::TransactionManager>(storageManager->getWAL());
 
@@ -15,6 +15,7 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/query_admission_queue.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/standalone_call_rewriter.h"
@@ -23,7 +24,9 @@
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_tracker.h"
 #include "storage/buffer_manager/spiller.h"
+#include "storage/local_storage/local_storage.h"
 #include "storage/storage_manager.h"
 #include "transaction/transaction_context.h"
 
@@ -70,6 +73,8 @@ ClientContext::ClientContext(Database* database)
     clientConfig.disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
     clientConfig.warningLimit = ClientConfigDefault::WARNING_LIMIT;
     progressBar = std::make_unique<ProgressBar>(clientConfig.enableProgressBar);
+    connectionMemoryTracker = std::make_shared<storage::MemoryTracker>("connection",
+        clientConfig.connectionMemoryLimit, clientConfig.memoryLimitPolicy);
 }
 
 ClientContext::~ClientContext() {
@@ -110,6 +115,18 @@ uint64_t ClientContext::getQueryTimeOut() const {
     return clientConfig.timeoutInMS;
 }
 
+void ClientContext::setQueryMemoryLimit(uint64_t limitInBytes,
+    storage::MemoryLimitPolicy policy) {
+    lock_t lck{mtx};
+    clientConfig.queryMemoryLimit = limitInBytes;
+    clientConfig.memoryLimitPolicy = policy;
+}
+
+void ClientContext::setConnectionMemoryLimit(uint64_t limitInBytes) {
+    lock_t lck{mtx};
+    clientConfig.connectionMemoryLimit = limitInBytes;
+}
+
 void ClientContext::setMaxNumThreadForExec(uint64_t numThreads) {
     lock_t lck{mtx};
     if (numThreads == 0) {
@@ -567,7 +584,18 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     executingTimer.start();
     std::shared_ptr<FactorizedTable> resultFT;
     std::unique_ptr<QueryResult> queryResult;
+    // Declared outside the try block, so that the query stays admitted until it has committed.
+    std::unique_ptr<QueryAdmissionQueue::Ticket> admissionTicket;
     try {
+        admissionTicket =
+            localDatabase->admissionQueue->admit(*cachedStatement->logicalPlan, *this);
+        // The limit may have been changed through a setting since the last query.
+        connectionMemoryTracker->setLimit(clientConfig.connectionMemoryLimit);
+        auto queryMemoryTracker = std::make_shared<storage::MemoryTracker>("query",
+            clientConfig.queryMemoryLimit, clientConfig.memoryLimitPolicy,
+            hasTimeout() ? getTimeoutRemainingInMS() :
+                           storage::MemoryTracker::DEFAULT_MAX_WAIT_TIME_IN_MS,
+            connectionMemoryTracker);
         bool isTransactionStatement =
             preparedStatement->getStatementType() == StatementType::TRANSACTION;
         TransactionHelper::runFuncInTransaction(
@@ -580,6 +608,9 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
                 }
                 const auto executionContext =
                     std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
+                // Buffers allocated while executing are charged to the query. Committing isn't,
+                // so that a checkpoint doesn't fail on a query's limit.
+                storage::MemoryTracker::Scope memoryTrackerScope{queryMemoryTracker};
                 auto mapper = PlanMapper(executionContext.get());
                 const auto physicalPlan = mapper.mapLogicalPlanToPhysical(
                     cachedStatement->logicalPlan.get(), cachedStatement->columns);
@@ -594,6 +625,12 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
                     }
                     resultFT = localDatabase->queryProcessor->execute(physicalPlan.get(),
                         executionContext.get());
+                    if (!transactionContext->isAutoTransaction() &&
+                        getTransaction()->isWriteTransaction()) {
+                        // Nothing scans the local tables between the statements of a
+                        // transaction, so this is where they can be moved out of memory.
+                        getTransaction()->getLocalStorage()->flushLargeLocalTables();
+                    }
                 }
             },
             preparedStatement->isReadOnly(), isTransactionStatement,
@@ -71,6 +71,16 @@ void Connection::setQueryTimeOut(uint64_t timeoutInMS) {
     clientContext->setQueryTimeOut(timeoutInMS);
 }
 
+void Connection::setQueryMemoryLimit(uint64_t limitInBytes, storage::MemoryLimitPolicy policy) {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    clientContext->setQueryMemoryLimit(limitInBytes, policy);
+}
+
+void Connection::setConnectionMemoryLimit(uint64_t limitInBytes) {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    clientContext->setConnectionMemoryLimit(limitInBytes);
+}
+
 std::unique_ptr<QueryResult> Connection::executeWithParams(PreparedStatement* preparedStatement,
     std::unordered_map<std::string, std::unique_ptr<Value>> inputParams) {
     dbLifeCycleManager->checkDatabaseClosedOrThrow();
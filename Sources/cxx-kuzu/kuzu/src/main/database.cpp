@@ -7,7 +7,10 @@
 #include "extension/transformer_extension.h"
 #include "main/client_context.h"
 #include "main/database_manager.h"
+#include "main/query_admission_queue.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/buffer_pool_warmer.h"
+#include "storage/buffer_manager/page_prefetcher.h"
 
 #if defined(_WIN32)
 #include <windows.h>
@@ -96,7 +99,8 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig,
 std::unique_ptr<BufferManager> Database::initBufferManager(const Database& db) {
     return std::make_unique<BufferManager>(db.databasePath,
         StorageUtils::getTmpFilePath(db.databasePath), db.dbConfig.bufferPoolSize,
-        db.dbConfig.maxDBSize, db.vfs.get(), db.dbConfig.readOnly);
+        db.dbConfig.maxDBSize, db.vfs.get(), db.dbConfig.readOnly,
+        VMRegionConfig{db.dbConfig.enableHugePages, db.dbConfig.bindBufferPoolToNumaNodes});
 }
 
 void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFunc) {
@@ -123,9 +127,11 @@ void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFu
 
     catalog = std::make_unique<Catalog>();
     storageManager = std::make_unique<StorageManager>(databasePath, dbConfig.readOnly,
-        *memoryManager, dbConfig.enableCompression, vfs.get());
+        *memoryManager, dbConfig.enableCompression, vfs.get(), dbConfig.enableDirectIO,
+        dbConfig.enableMemoryMappedReads);
     transactionManager = std::make_unique<TransactionManager>(storageManager->getWAL());
     databaseManager = std::make_unique<DatabaseManager>();
+    admissionQueue = std::make_unique<QueryAdmissionQueue>();
 
     extensionManager = std::make_unique<extension::ExtensionManager>();
     dbLifeCycleManager = std::make_shared<DatabaseLifeCycleManager>();
@@ -135,6 +141,12 @@ void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFu
         return;
     }
     StorageManager::recover(clientContext);
+    if (dbConfig.enableBufferPoolWarmup) {
+        bufferPoolWarmer = std::make_unique<BufferPoolWarmer>(*bufferManager,
+            *storageManager->getDataFH(), vfs.get(), StorageUtils::getWarmupFilePath(databasePath),
+            dbConfig.bufferPoolWarmupIntervalInMS, dbConfig.readOnly);
+        bufferPoolWarmer->start();
+    }
 }
 
 Database::~Database() {
@@ -144,6 +156,9 @@ Database::~Database() {
             transactionManager->checkpoint(clientContext);
         } catch (...) {} // NOLINT
     }
+    // Pending prefetches point to file handles that the storage manager closes, and the buffer
+    // manager is destroyed after it.
+    bufferManager->getPrefetcher().stop();
     dbLifeCycleManager->isDatabaseClosed = true;
 }
 
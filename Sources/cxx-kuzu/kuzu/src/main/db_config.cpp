@@ -22,7 +22,11 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(RecursivePatternFactorSetting), GET_CONFIGURATION(EnableMVCCSetting),
     GET_CONFIGURATION(CheckpointThresholdSetting), GET_CONFIGURATION(AutoCheckpointSetting),
     GET_CONFIGURATION(ForceCheckpointClosingDBSetting), GET_CONFIGURATION(SpillToDiskSetting),
-    GET_CONFIGURATION(EnableOptimizerSetting), GET_CONFIGURATION(EnableInternalCatalogSetting)};
+    GET_CONFIGURATION(EnableOptimizerSetting), GET_CONFIGURATION(EnableInternalCatalogSetting),
+    GET_CONFIGURATION(ScanPrefetchDepthSetting), GET_CONFIGURATION(EvictionPolicySetting),
+    GET_CONFIGURATION(CompactionThresholdSetting), GET_CONFIGURATION(QueryMemoryLimitSetting),
+    GET_CONFIGURATION(ConnectionMemoryLimitSetting), GET_CONFIGURATION(MemoryLimitPolicySetting),
+    GET_CONFIGURATION(AdmissionMemoryBudgetSetting)};
 
 DBConfig::DBConfig(const SystemConfig& systemConfig)
     : bufferPoolSize{systemConfig.bufferPoolSize}, maxNumThreads{systemConfig.maxNumThreads},
@@ -30,7 +34,15 @@ DBConfig::DBConfig(const SystemConfig& systemConfig)
       maxDBSize{systemConfig.maxDBSize}, enableMultiWrites{false},
       autoCheckpoint{systemConfig.autoCheckpoint},
       checkpointThreshold{systemConfig.checkpointThreshold},
-      forceCheckpointOnClose{systemConfig.forceCheckpointOnClose}, enableSpillingToDisk{true} {
+      forceCheckpointOnClose{systemConfig.forceCheckpointOnClose}, enableSpillingToDisk{true},
+      evictionPolicy{storage::EvictionPolicy::SECOND_CHANCE},
+      enableHugePages{systemConfig.enableHugePages},
+      bindBufferPoolToNumaNodes{systemConfig.bindBufferPoolToNumaNodes},
+      enableDirectIO{systemConfig.enableDirectIO},
+      enableBufferPoolWarmup{systemConfig.enableBufferPoolWarmup},
+      bufferPoolWarmupIntervalInMS{systemConfig.bufferPoolWarmupIntervalInMS},
+      enableMemoryMappedReads{systemConfig.enableMemoryMappedReads}, compactionThreshold{0},
+      admissionMemoryBudget{0} {
 #if defined(__APPLE__)
     this->threadQos = systemConfig.threadQos;
 #endif
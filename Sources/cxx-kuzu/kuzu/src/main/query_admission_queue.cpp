@@ -0,0 +1,111 @@
+#include "main/query_admission_queue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#include "common/exception/interrupt.h"
+#include "main/client_context.h"
+#include "main/db_config.h"
+#include "planner/operator/logical_plan.h"
+
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace main {
+
+std::unique_ptr<QueryAdmissionQueue::Ticket> QueryAdmissionQueue::admit(const LogicalPlan& plan,
+    ClientContext& context) {
+    // Interrupts and timeouts don't notify, so waiting queries check them regularly.
+    static constexpr auto MAX_WAIT_INTERVAL = std::chrono::milliseconds(10);
+    const auto budget = context.getDBConfig()->admissionMemoryBudget;
+    if (budget == 0 || plan.isEmpty()) {
+        return nullptr;
+    }
+    auto estimatedMemory = estimateMemory(plan);
+    // A query can't take more memory than its limit, whatever the plan suggests.
+    const auto queryMemoryLimit = context.getClientConfig()->queryMemoryLimit;
+    if (queryMemoryLimit != 0) {
+        estimatedMemory = std::min(estimatedMemory, queryMemoryLimit);
+    }
+    if (estimatedMemory < MIN_HEAVY_QUERY_MEMORY) {
+        return nullptr;
+    }
+    std::unique_lock lck{mtx};
+    const auto queryID = nextQueryID++;
+    waitingQueries.push_back(queryID);
+    const auto canAdmit = [&]() {
+        return waitingQueries.front() == queryID &&
+               (numAdmittedQueries == 0 || admittedMemory + estimatedMemory <= budget);
+    };
+    while (!canAdmit()) {
+        if (context.interrupted() ||
+            (context.hasTimeout() && context.getTimeoutRemainingInMS() == 0)) {
+            std::erase(waitingQueries, queryID);
+            // The query behind this one may be next in line now.
+            queryReleased.notify_all();
+            throw InterruptException();
+        }
+        queryReleased.wait_for(lck, MAX_WAIT_INTERVAL);
+    }
+    waitingQueries.pop_front();
+    numAdmittedQueries++;
+    admittedMemory += estimatedMemory;
+    // The query behind this one may fit into the budget as well.
+    queryReleased.notify_all();
+    return std::make_unique<Ticket>(*this, estimatedMemory);
+}
+
+void QueryAdmissionQueue::release(uint64_t estimatedMemory) {
+    {
+        std::unique_lock lck{mtx};
+        numAdmittedQueries--;
+        admittedMemory -= estimatedMemory;
+    }
+    queryReleased.notify_all();
+}
+
+uint64_t QueryAdmissionQueue::estimateMemory(const LogicalPlan& plan) {
+    // Cardinality estimates can be far off, so the estimate is computed in floating point and
+    // clamped instead of overflowing.
+    const auto estimatedMemory = estimateOperatorMemory(plan.getLastOperatorRef());
+    if (estimatedMemory >= static_cast<double>(UINT64_MAX)) {
+        return UINT64_MAX;
+    }
+    return static_cast<uint64_t>(estimatedMemory);
+}
+
+static double estimateMaterializedMemory(const LogicalOperator& child) {
+    const auto numValues = child.getSchema()->getExpressionsInScope().size() + 1;
+    return static_cast<double>(child.getCardinality()) * static_cast<double>(numValues) *
+           static_cast<double>(QueryAdmissionQueue::NUM_BYTES_PER_VALUE);
+}
+
+double QueryAdmissionQueue::estimateOperatorMemory(const LogicalOperator& op) {
+    double estimatedMemory = 0;
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::ACCUMULATE:
+    case LogicalOperatorType::AGGREGATE:
+    case LogicalOperatorType::DISTINCT:
+    case LogicalOperatorType::ORDER_BY: {
+        estimatedMemory += estimateMaterializedMemory(*op.getChild(0));
+    } break;
+    case LogicalOperatorType::HASH_JOIN:
+    case LogicalOperatorType::INTERSECT: {
+        // Every child but the probe side is built into a hash table.
+        for (auto i = 1u; i < op.getNumChildren(); i++) {
+            estimatedMemory += estimateMaterializedMemory(*op.getChild(i));
+        }
+    } break;
+    default:
+        break;
+    }
+    for (auto i = 0u; i < op.getNumChildren(); i++) {
+        estimatedMemory += estimateOperatorMemory(*op.getChild(i));
+    }
+    return estimatedMemory;
+}
+
+} // namespace main
+} // namespace kuzu
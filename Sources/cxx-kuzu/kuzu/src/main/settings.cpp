@@ -1,6 +1,8 @@
 #include "main/settings.h"
 
 #include "common/exception/runtime.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
 #include "main/client_context.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -31,5 +33,85 @@ void SpillToDiskSetting::setContext(ClientContext* context, const common::Value&
     context->getMemoryManager()->getBufferManager()->resetSpiller(spillPath);
 }
 
+void ScanPrefetchDepthSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getMemoryManager()->getBufferManager()->setPrefetchDepth(
+        parameter.getValue<uint64_t>());
+}
+
+common::Value ScanPrefetchDepthSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getMemoryManager()->getBufferManager()->getPrefetchDepth());
+}
+
+void CompactionThresholdSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto threshold = parameter.getValue<double>();
+    if (threshold < 0 || threshold >= 1) {
+        throw common::RuntimeException(common::stringFormat(
+            "Invalid compaction threshold {}. It must be in the range [0, 1).", threshold));
+    }
+    context->getDBConfigUnsafe()->compactionThreshold = threshold;
+}
+
+void EvictionPolicySetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto policyName = common::StringUtils::getLower(parameter.getValue<std::string>());
+    storage::EvictionPolicy policy{};
+    if (policyName == "second_chance") {
+        policy = storage::EvictionPolicy::SECOND_CHANCE;
+    } else if (policyName == "scan_resistant") {
+        policy = storage::EvictionPolicy::SCAN_RESISTANT;
+    } else {
+        throw common::RuntimeException(common::stringFormat(
+            "Unknown eviction policy {}. Supported policies are [second_chance, scan_resistant].",
+            parameter.getValue<std::string>()));
+    }
+    context->getDBConfigUnsafe()->evictionPolicy = policy;
+    context->getMemoryManager()->getBufferManager()->setEvictionPolicy(policy);
+}
+
+common::Value EvictionPolicySetting::getSetting(const ClientContext* context) {
+    switch (context->getDBConfig()->evictionPolicy) {
+    case storage::EvictionPolicy::SECOND_CHANCE:
+        return common::Value::createValue(std::string("second_chance"));
+    case storage::EvictionPolicy::SCAN_RESISTANT:
+        return common::Value::createValue(std::string("scan_resistant"));
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+void MemoryLimitPolicySetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto policyName = common::StringUtils::getLower(parameter.getValue<std::string>());
+    storage::MemoryLimitPolicy policy{};
+    if (policyName == "fail") {
+        policy = storage::MemoryLimitPolicy::FAIL;
+    } else if (policyName == "wait") {
+        policy = storage::MemoryLimitPolicy::WAIT;
+    } else if (policyName == "spill") {
+        policy = storage::MemoryLimitPolicy::SPILL;
+    } else {
+        throw common::RuntimeException(common::stringFormat(
+            "Unknown memory limit policy {}. Supported policies are [fail, wait, spill].",
+            parameter.getValue<std::string>()));
+    }
+    context->getClientConfigUnsafe()->memoryLimitPolicy = policy;
+}
+
+common::Value MemoryLimitPolicySetting::getSetting(const ClientContext* context) {
+    switch (context->getClientConfig()->memoryLimitPolicy) {
+    case storage::MemoryLimitPolicy::FAIL:
+        return common::Value::createValue(std::string("fail"));
+    case storage::MemoryLimitPolicy::WAIT:
+        return common::Value::createValue(std::string("wait"));
+    case storage::MemoryLimitPolicy::SPILL:
+        return common::Value::createValue(std::string("spill"));
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
 } // namespace main
 } // namespace kuzu
@@ -3,13 +3,18 @@
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "binder/expression/scalar_function_expression.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
 #include "main/client_context.h"
 #include "planner/operator/extend/logical_extend.h"
 #include "planner/operator/logical_empty_result.h"
 #include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_table_function_call.h"
+#include "planner/join_order/cardinality_estimator.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
+#include "storage/index/ordered_index.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -51,7 +56,7 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitChildren(
     const std::shared_ptr<LogicalOperator>& op) {
     for (auto i = 0u; i < op->getNumChildren(); ++i) {
         // Start new push down for child.
-        auto optimizer = FilterPushDownOptimizer(context);
+        auto optimizer = FilterPushDownOptimizer(context, cardinalityEstimator);
         op->setChild(i, optimizer.visitOperator(op->getChild(i)));
     }
     op->computeFlatSchema();
@@ -93,10 +98,12 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
     }
     KU_ASSERT(op->getNumChildren() == 2);
     // Push probe side
-    auto probeOptimizer = FilterPushDownOptimizer(context, std::move(probePSet));
+    auto probeOptimizer =
+        FilterPushDownOptimizer(context, cardinalityEstimator, std::move(probePSet));
     op->setChild(0, probeOptimizer.visitOperator(op->getChild(0)));
     // Push build side
-    auto buildOptimizer = FilterPushDownOptimizer(context, std::move(buildPSet));
+    auto buildOptimizer =
+        FilterPushDownOptimizer(context, cardinalityEstimator, std::move(buildPSet));
     op->setChild(1, buildOptimizer.visitOperator(op->getChild(1)));
 
     auto probeSchema = op->getChild(0)->getSchema();
@@ -177,6 +184,112 @@ static bool isConstantExpression(const std::shared_ptr<Expression> expression) {
     }
 }
 
+static ExpressionType flipComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return type;
+    }
+}
+
+// Returns the name of a loaded ordered index on the given node property, or an empty string.
+static std::string getOrderedIndexName(main::ClientContext* context, table_id_t tableID,
+    const PropertyExpression& property) {
+    auto transaction = context->getTransaction();
+    auto tableEntry = context->getCatalog()->getTableCatalogEntry(transaction, tableID);
+    if (!tableEntry->containsProperty(property.getPropertyName())) {
+        return "";
+    }
+    auto propertyID = tableEntry->getPropertyID(property.getPropertyName());
+    for (auto indexEntry : context->getCatalog()->getIndexEntries(transaction, tableID)) {
+        if (indexEntry->getIndexType() == OrderedIndex::TYPE_NAME && indexEntry->isLoaded() &&
+            indexEntry->getPropertyIDs() == std::vector{propertyID}) {
+            return indexEntry->getIndexName();
+        }
+    }
+    return "";
+}
+
+// Picks the bounds of a secondary index scan from comparisons between an indexed property and
+// constant expressions. Equality comparisons are preferred over range comparisons. The predicates
+// that bound the scan are appended to `boundPredicates`.
+// All predicates are kept and re-evaluated on top of the index scan, as the index may return
+// stale candidates.
+static std::unique_ptr<SecondaryIndexScanInfo> getSecondaryIndexScanInfo(
+    main::ClientContext* context, table_id_t tableID, const Expression& nodeID,
+    const expression_vector& predicates, expression_vector& boundPredicates) {
+    std::unique_ptr<SecondaryIndexScanInfo> rangeScanInfo = nullptr;
+    expression_vector rangePredicates;
+    for (auto& predicate : predicates) {
+        auto comparisonType = predicate->expressionType;
+        switch (comparisonType) {
+        case ExpressionType::EQUALS:
+        case ExpressionType::GREATER_THAN:
+        case ExpressionType::GREATER_THAN_EQUALS:
+        case ExpressionType::LESS_THAN:
+        case ExpressionType::LESS_THAN_EQUALS:
+            break;
+        default:
+            continue;
+        }
+        auto propertyExpr = predicate->getChild(0);
+        auto boundExpr = predicate->getChild(1);
+        if (propertyExpr->expressionType != ExpressionType::PROPERTY) {
+            std::swap(propertyExpr, boundExpr);
+            comparisonType = flipComparison(comparisonType);
+        }
+        if (propertyExpr->expressionType != ExpressionType::PROPERTY ||
+            !isConstantExpression(boundExpr) ||
+            propertyExpr->getDataType() != boundExpr->getDataType()) {
+            continue;
+        }
+        auto& property = propertyExpr->constCast<PropertyExpression>();
+        if (property.getVariableName() !=
+                nodeID.constCast<PropertyExpression>().getVariableName() ||
+            !property.hasProperty(tableID) || property.isPrimaryKey(tableID)) {
+            continue;
+        }
+        auto indexName = getOrderedIndexName(context, tableID, property);
+        if (indexName.empty()) {
+            continue;
+        }
+        if (comparisonType == ExpressionType::EQUALS) {
+            boundPredicates.push_back(predicate);
+            return std::make_unique<SecondaryIndexScanInfo>(std::move(indexName), boundExpr,
+                true /* lowerInclusive */, boundExpr, true /* upperInclusive */);
+        }
+        if (rangeScanInfo == nullptr) {
+            rangeScanInfo = std::make_unique<SecondaryIndexScanInfo>(indexName, nullptr, false,
+                nullptr, false);
+        } else if (rangeScanInfo->indexName != indexName) {
+            continue;
+        }
+        auto inclusive = comparisonType == ExpressionType::GREATER_THAN_EQUALS ||
+                         comparisonType == ExpressionType::LESS_THAN_EQUALS;
+        if (comparisonType == ExpressionType::GREATER_THAN ||
+            comparisonType == ExpressionType::GREATER_THAN_EQUALS) {
+            if (rangeScanInfo->lowerBound == nullptr) {
+                rangeScanInfo->lowerBound = boundExpr;
+                rangeScanInfo->lowerInclusive = inclusive;
+                rangePredicates.push_back(predicate);
+            }
+        } else if (rangeScanInfo->upperBound == nullptr) {
+            rangeScanInfo->upperBound = boundExpr;
+            rangeScanInfo->upperInclusive = inclusive;
+            rangePredicates.push_back(predicate);
+        }
+    }
+    boundPredicates.insert(boundPredicates.end(), rangePredicates.begin(), rangePredicates.end());
+    return rangeScanInfo;
+}
+
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableReplace(
     const std::shared_ptr<LogicalOperator>& op) {
     auto& scan = op->cast<LogicalScanNodeTable>();
@@ -204,6 +317,24 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableRepl
             predicateSet.addPredicate(primaryKeyEqualityComparison);
         }
     }
+    if (tableIDs.size() == 1 && scan.getScanType() == LogicalScanNodeTableType::SCAN) {
+        expression_vector boundPredicates;
+        auto indexScanInfo = getSecondaryIndexScanInfo(context, tableIDs[0], *nodeID,
+            predicateSet.getAllPredicates(), boundPredicates);
+        // Only scan the index if the bounds are estimated to be selective enough to beat a
+        // sequential scan that is followed by the same filters.
+        auto selectivity = 1.0;
+        for (auto& predicate : boundPredicates) {
+            selectivity *= (double)cardinalityEstimator.estimateFilter(scan, *predicate) /
+                           (double)std::max<cardinality_t>(scan.getCardinality(), 1);
+        }
+        if (indexScanInfo != nullptr &&
+            selectivity <= PlannerKnobs::SECONDARY_INDEX_SCAN_MAX_SELECTIVITY) {
+            scan.setScanType(LogicalScanNodeTableType::SECONDARY_INDEX_SCAN);
+            scan.setExtraInfo(std::move(indexScanInfo));
+            scan.computeFlatSchema();
+        }
+    }
     return finishPushDown(op);
 }
 
@@ -14,8 +14,13 @@ void LogicalOperatorCollector::collect(planner::LogicalOperator* op) {
 
 void LogicalIndexScanNodeCollector::visitScanNodeTable(planner::LogicalOperator* op) {
     auto scan = op->constCast<planner::LogicalScanNodeTable>();
-    if (scan.getScanType() == planner::LogicalScanNodeTableType::PRIMARY_KEY_SCAN) {
+    switch (scan.getScanType()) {
+    case planner::LogicalScanNodeTableType::PRIMARY_KEY_SCAN:
+    case planner::LogicalScanNodeTableType::SECONDARY_INDEX_SCAN: {
         ops.push_back(op);
+    } break;
+    default:
+        break;
     }
 }
 
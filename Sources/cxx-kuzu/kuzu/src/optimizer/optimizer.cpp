@@ -31,7 +31,7 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
         auto removeUnnecessaryJoinOptimizer = RemoveUnnecessaryJoinOptimizer();
         removeUnnecessaryJoinOptimizer.rewrite(plan);
 
-        auto filterPushDownOptimizer = FilterPushDownOptimizer(context);
+        auto filterPushDownOptimizer = FilterPushDownOptimizer(context, cardinalityEstimator);
         filterPushDownOptimizer.rewrite(plan);
 
         auto projectionPushDownOptimizer =
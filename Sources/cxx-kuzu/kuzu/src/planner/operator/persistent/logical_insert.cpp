@@ -12,9 +12,14 @@ namespace planner {
 
 void LogicalInsert::computeFactorizedSchema() {
     copyChildSchema(0);
+    auto unFlatGroupPos = getUnFlatGroupPos();
     for (auto& info : infos) {
-        auto groupPos = schema->createGroup();
-        schema->setGroupAsSingleState(groupPos);
+        // Inserted columns are produced per tuple, so they belong to the tuples' group.
+        auto groupPos = unFlatGroupPos;
+        if (groupPos == INVALID_F_GROUP_POS) {
+            groupPos = schema->createGroup();
+            schema->setGroupAsSingleState(groupPos);
+        }
         for (auto i = 0u; i < info.columnExprs.size(); ++i) {
             if (info.isReturnColumnExprs[i]) {
                 schema->insertToGroupAndScope(info.columnExprs[i], groupPos);
@@ -52,8 +57,15 @@ std::string LogicalInsert::getExpressionsForPrinting() const {
 }
 
 f_group_pos_set LogicalInsert::getGroupsPosToFlatten() {
+    // Insert iterates the tuples of the remaining unFlat group itself, see Insert.
+    auto childSchema = children[0]->getSchema();
+    return FlattenAllButOne::getGroupsPosToFlatten(childSchema->getGroupsPosInScope(),
+        *childSchema);
+}
+
+f_group_pos LogicalInsert::getUnFlatGroupPos() const {
     auto childSchema = children[0]->getSchema();
-    return FlattenAll::getGroupsPosToFlatten(childSchema->getGroupsPosInScope(), *childSchema);
+    return SchemaUtils::getUnFlatGroupPos(childSchema->getGroupsPosInScope(), *childSchema);
 }
 
 } // namespace planner
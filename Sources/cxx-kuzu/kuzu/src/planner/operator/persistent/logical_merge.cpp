@@ -12,12 +12,17 @@ namespace planner {
 
 void LogicalMerge::computeFactorizedSchema() {
     copyChildSchema(0);
+    auto unFlatGroupPos = getUnFlatGroupPos();
     for (auto& info : insertNodeInfos) {
         // Predicate iri is not matched but needs to be inserted.
         auto node = ku_dynamic_cast<NodeExpression*>(info.pattern.get());
         if (!schema->isExpressionInScope(*node->getInternalID())) {
-            auto groupPos = schema->createGroup();
-            schema->setGroupAsSingleState(groupPos);
+            // Inserted node ids are produced per tuple, so they belong to the tuples' group.
+            auto groupPos = unFlatGroupPos;
+            if (groupPos == INVALID_F_GROUP_POS) {
+                groupPos = schema->createGroup();
+                schema->setGroupAsSingleState(groupPos);
+            }
             schema->insertToGroupAndScope(node->getInternalID(), groupPos);
         }
     }
@@ -32,8 +37,15 @@ void LogicalMerge::computeFlatSchema() {
 }
 
 f_group_pos_set LogicalMerge::getGroupsPosToFlatten() {
+    // Merge iterates the tuples of the remaining unFlat group itself, see Merge.
     auto childSchema = children[0]->getSchema();
-    return FlattenAll::getGroupsPosToFlatten(childSchema->getGroupsPosInScope(), *childSchema);
+    return FlattenAllButOne::getGroupsPosToFlatten(childSchema->getGroupsPosInScope(),
+        *childSchema);
+}
+
+f_group_pos LogicalMerge::getUnFlatGroupPos() const {
+    auto childSchema = children[0]->getSchema();
+    return SchemaUtils::getUnFlatGroupPos(childSchema->getGroupsPosInScope(), *childSchema);
 }
 
 std::unique_ptr<LogicalOperator> LogicalMerge::copy() {
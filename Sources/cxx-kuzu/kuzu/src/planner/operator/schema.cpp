@@ -137,6 +137,16 @@ f_group_pos SchemaUtils::getLeadingGroupPos(const std::unordered_set<f_group_pos
     return leadingGroupPos;
 }
 
+f_group_pos SchemaUtils::getUnFlatGroupPos(const std::unordered_set<f_group_pos>& groupPositions,
+    const Schema& schema) {
+    for (auto groupPos : groupPositions) {
+        if (!schema.getGroup(groupPos)->isFlat()) {
+            return groupPos;
+        }
+    }
+    return INVALID_F_GROUP_POS;
+}
+
 void SchemaUtils::validateAtMostOneUnFlatGroup(
     const std::unordered_set<f_group_pos>& groupPositions, const Schema& schema) {
     auto hasUnFlatGroup = false;
@@ -100,8 +100,11 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapInsert(const LogicalOperator* l
     }
     auto printInfo =
         std::make_unique<InsertPrintInfo>(expressions, logicalInsert.getInfos()[0].conflictAction);
+    auto unFlatGroupPos = logicalInsert.getUnFlatGroupPos();
+    auto unFlatChunkPos =
+        unFlatGroupPos == INVALID_F_GROUP_POS ? INVALID_DATA_CHUNK_POS : unFlatGroupPos;
     return std::make_unique<Insert>(std::move(nodeExecutors), std::move(relExecutors),
-        std::move(prevOperator), getOperatorID(), std::move(printInfo));
+        unFlatChunkPos, std::move(prevOperator), getOperatorID(), std::move(printInfo));
 }
 
 } // namespace processor
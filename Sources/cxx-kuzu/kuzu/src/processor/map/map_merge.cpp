@@ -102,11 +102,14 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapMerge(const LogicalOperator* lo
         keyEvaluators.push_back(expressionMapper.getEvaluator(key));
     }
 
+    auto unFlatGroupPos = logicalMerge.getUnFlatGroupPos();
+    auto unFlatChunkPos =
+        unFlatGroupPos == INVALID_F_GROUP_POS ? INVALID_DATA_CHUNK_POS : unFlatGroupPos;
     MergeInfo mergeInfo{std::move(keyEvaluators),
         getFactorizedTableSchema(logicalMerge.getKeys(),
             logicalMerge.getOnMatchSetNodeInfos().size(),
             logicalMerge.getOnMatchSetRelInfos().size()),
-        std::move(executorInfo), existenceMarkPos};
+        std::move(executorInfo), existenceMarkPos, unFlatChunkPos};
     return std::make_unique<Merge>(std::move(nodeInsertExecutors), std::move(relInsertExecutors),
         std::move(onCreateNodeSetExecutors), std::move(onCreateRelSetExecutors),
         std::move(onMatchNodeSetExecutors), std::move(onMatchRelSetExecutors), std::move(mergeInfo),
@@ -6,6 +6,7 @@
 #include "processor/expression_mapper.h"
 #include "processor/operator/scan/primary_key_scan_node_table.h"
 #include "processor/operator/scan/scan_node_table.h"
+#include "processor/operator/scan/secondary_index_scan_node_table.h"
 #include "processor/plan_mapper.h"
 #include "storage/storage_manager.h"
 
@@ -85,6 +86,34 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(
         return std::make_unique<PrimaryKeyScanNodeTable>(std::move(scanInfo), std::move(tableInfos),
             std::move(evaluator), std::move(sharedState), getOperatorID(), std::move(printInfo));
     }
+    case LogicalScanNodeTableType::SECONDARY_INDEX_SCAN: {
+        KU_ASSERT(tableInfos.size() == 1);
+        auto& indexScanInfo = scan.getExtraInfo()->constCast<SecondaryIndexScanInfo>();
+        auto exprMapper = ExpressionMapper(outSchema);
+        std::string range = "(-inf";
+        std::unique_ptr<evaluator::ExpressionEvaluator> lowerEvaluator = nullptr;
+        if (indexScanInfo.lowerBound != nullptr) {
+            lowerEvaluator = exprMapper.getEvaluator(indexScanInfo.lowerBound);
+            range = std::string(indexScanInfo.lowerInclusive ? "[" : "(") +
+                    indexScanInfo.lowerBound->toString();
+        }
+        range += ", ";
+        std::unique_ptr<evaluator::ExpressionEvaluator> upperEvaluator = nullptr;
+        if (indexScanInfo.upperBound != nullptr) {
+            upperEvaluator = exprMapper.getEvaluator(indexScanInfo.upperBound);
+            range += indexScanInfo.upperBound->toString();
+            range += indexScanInfo.upperInclusive ? "]" : ")";
+        } else {
+            range += "+inf)";
+        }
+        auto printInfo = std::make_unique<SecondaryIndexScanPrintInfo>(scan.getProperties(),
+            indexScanInfo.indexName, std::move(range), alias);
+        return std::make_unique<SecondaryIndexScanNodeTable>(std::move(scanInfo),
+            std::move(tableInfos[0]), indexScanInfo.indexName,
+            SecondaryIndexScanBound{std::move(lowerEvaluator), indexScanInfo.lowerInclusive},
+            SecondaryIndexScanBound{std::move(upperEvaluator), indexScanInfo.upperInclusive},
+            getOperatorID(), std::move(printInfo));
+    }
     default:
         KU_UNREACHABLE;
     }
@@ -39,5 +39,26 @@ void SelVectorOverWriter::resetCurrentSelVector(const SelectionVector& selVector
     }
 }
 
+UnFlatTupleIterator::UnFlatTupleIterator() {
+    flatSelVector = std::make_shared<SelectionVector>(1 /* capacity */);
+    flatSelVector->setToFiltered(1 /* size */);
+}
+
+void UnFlatTupleIterator::iterate(const std::function<void()>& func) {
+    if (state == nullptr) {
+        func();
+        return;
+    }
+    auto selVector = state->getSelVectorShared();
+    state->setSelVector(flatSelVector);
+    state->setToFlat();
+    for (auto i = 0u; i < selVector->getSelSize(); i++) {
+        (*flatSelVector)[0] = (*selVector)[i];
+        func();
+    }
+    state->setToUnflat();
+    state->setSelVector(std::move(selVector));
+}
+
 } // namespace processor
 } // namespace kuzu
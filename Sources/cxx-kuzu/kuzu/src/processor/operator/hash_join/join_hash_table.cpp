@@ -1,5 +1,7 @@
 #include "processor/operator/hash_join/join_hash_table.h"
 
+#include <algorithm>
+
 #include "common/utils.h"
 #include "function/hash/vector_hash_functions.h"
 #include "processor/result/factorized_table.h"
@@ -67,9 +69,14 @@ static void sortSelectedPos(ValueVector* nodeIDVector) {
         std::memcpy(buffer.data(), selVector.getSelectedPositions().data(), size * sizeof(sel_t));
         selVector.setToFiltered();
     }
-    std::sort(buffer.begin(), buffer.begin() + size, [nodeIDVector](sel_t left, sel_t right) {
+    const auto lessByNodeID = [nodeIDVector](sel_t left, sel_t right) {
         return nodeIDVector->getValue<nodeID_t>(left) < nodeIDVector->getValue<nodeID_t>(right);
-    });
+    };
+    // Lists scanned from rel tables kept sorted by neighbor need no sorting.
+    if (std::is_sorted(buffer.begin(), buffer.begin() + size, lessByNodeID)) {
+        return;
+    }
+    std::sort(buffer.begin(), buffer.begin() + size, lessByNodeID);
 }
 
 uint64_t JoinHashTable::appendVectorWithSorting(ValueVector* keyVector,
@@ -88,7 +88,19 @@ void fillOffsetArraysFromVector(transaction::Transaction* transaction, const Ind
                 lookupPos[i] = (keyVector->state->getSelVector()[i]);
             }
 
+            // Resolve all non-null keys with a single batched index lookup.
+            std::vector<sel_t> nonNullPos;
+            nonNullPos.reserve(numKeys);
+            for (auto pos : lookupPos) {
+                if (hasNoNullsGuarantee || !keyVector->isNull(pos)) {
+                    nonNullPos.push_back(pos);
+                }
+            }
+            std::vector<offset_t> lookupOffsets(nonNullPos.size());
+            info.nodeTable->lookupPKBatch(transaction, *keyVector, nonNullPos, lookupOffsets);
+
             OffsetVectorManager resultManager{resultVector, errorHandler};
+            auto lookupIdx = 0u;
             for (auto i = 0u; i < numKeys; i++) {
                 auto pos = lookupPos[i];
                 if constexpr (!hasNoNullsGuarantee) {
@@ -96,8 +108,8 @@ void fillOffsetArraysFromVector(transaction::Transaction* transaction, const Ind
                         continue;
                     }
                 }
-                offset_t lookupOffset = 0;
-                if (!info.nodeTable->lookupPK(transaction, keyVector, pos, lookupOffset)) {
+                const auto lookupOffset = lookupOffsets[lookupIdx++];
+                if (lookupOffset == INVALID_OFFSET) {
                     TypeUtils::visit(keyVector->dataType, [&]<typename type>(type) {
                         errorHandler->handleError(
                             ExceptionMessage::nonExistentPKException(
@@ -62,20 +62,42 @@ void Intersect::probeHTs() {
     }
 }
 
+// A list this many times longer than the list it is intersected with is searched by galloping
+// instead of being merged.
+static constexpr uint64_t GALLOPING_SIZE_RATIO = 8;
+
+// Returns the first position at or after the given one whose node ID is not smaller than target.
+static sel_t gallopTo(const nodeID_t* nodeIDs, sel_t position, sel_t size, nodeID_t target) {
+    // Double the step until the target is passed, then binary search the last step.
+    sel_t bound = position;
+    sel_t step = 1;
+    while (bound < size && nodeIDs[bound] < target) {
+        position = bound + 1;
+        bound += step;
+        step <<= 1;
+    }
+    return std::lower_bound(nodeIDs + position, nodeIDs + std::min(bound, size), target) -
+           nodeIDs;
+}
+
 void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVector,
     nodeID_t* rightNodeIDs, SelectionVector& rSelVector) {
     KU_ASSERT(lSelVector.getSelSize() <= rSelVector.getSelSize());
     auto leftPositionBuffer = lSelVector.getMutableBuffer();
     auto rightPositionBuffer = rSelVector.getMutableBuffer();
+    const auto rightSize = rSelVector.getSelSize();
+    const auto gallop = rightSize >= GALLOPING_SIZE_RATIO * lSelVector.getSelSize();
     sel_t leftPosition = 0, rightPosition = 0;
     uint64_t outputValuePosition = 0;
-    while (leftPosition < lSelVector.getSelSize() && rightPosition < rSelVector.getSelSize()) {
+    while (leftPosition < lSelVector.getSelSize() && rightPosition < rightSize) {
         auto leftNodeID = leftNodeIDs[leftPosition];
         auto rightNodeID = rightNodeIDs[rightPosition];
         if (leftNodeID < rightNodeID) {
             leftPosition++;
         } else if (leftNodeID > rightNodeID) {
-            rightPosition++;
+            rightPosition =
+                gallop ? gallopTo(rightNodeIDs, rightPosition, rightSize, leftNodeID) :
+                         rightPosition + 1;
         } else {
             leftPositionBuffer[outputValuePosition] = leftPosition;
             rightPositionBuffer[outputValuePosition] = rightPosition;
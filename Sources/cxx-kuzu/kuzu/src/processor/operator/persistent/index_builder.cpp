@@ -47,9 +47,10 @@ PhysicalTypeID IndexBuilderGlobalQueues::pkTypeID() const {
     return nodeTable->getPKIndex()->keyTypeID();
 }
 
-void IndexBuilderGlobalQueues::consume(NodeBatchInsertErrorHandler& errorHandler) {
-    for (auto index = 0u; index < NUM_HASH_INDEXES; index++) {
-        maybeConsumeIndex(index, errorHandler);
+void IndexBuilderGlobalQueues::consume(NodeBatchInsertErrorHandler& errorHandler,
+    size_t firstIndex) {
+    for (auto i = 0u; i < NUM_HASH_INDEXES; i++) {
+        maybeConsumeIndex((firstIndex + i) % NUM_HASH_INDEXES, errorHandler);
     }
 }
 
@@ -120,7 +121,8 @@ void IndexBuilderLocalBuffers::flush(NodeBatchInsertErrorHandler& errorHandler)
 }
 
 IndexBuilder::IndexBuilder(std::shared_ptr<IndexBuilderSharedState> sharedState)
-    : sharedState(std::move(sharedState)), localBuffers(this->sharedState->globalQueues) {}
+    : sharedState(std::move(sharedState)), localBuffers(this->sharedState->globalQueues),
+      consumerStartIndex(this->sharedState->getNextConsumerStartIndex()) {}
 
 void IndexBuilderSharedState::quitProducer() {
     if (producers.fetch_sub(1, std::memory_order_relaxed) == 1) {
@@ -168,10 +170,10 @@ void IndexBuilder::insert(const ColumnChunkData& chunk,
 
 void IndexBuilder::finishedProducing(NodeBatchInsertErrorHandler& errorHandler) {
     localBuffers.flush(errorHandler);
-    sharedState->consume(errorHandler);
+    sharedState->consume(errorHandler, consumerStartIndex);
     while (!sharedState->isDone()) {
         std::this_thread::sleep_for(std::chrono::microseconds(500));
-        sharedState->consume(errorHandler);
+        sharedState->consume(errorHandler, consumerStartIndex);
     }
 }
 
@@ -180,7 +182,7 @@ void IndexBuilder::finalize(ExecutionContext* /*context*/,
     // Flush anything added by last node group.
     localBuffers.flush(errorHandler);
 
-    sharedState->consume(errorHandler);
+    sharedState->consume(errorHandler, consumerStartIndex);
 }
 
 bool IndexBuilder::checkNonNullConstraint(const ColumnChunkData& chunk,
@@ -23,18 +23,47 @@ void Insert::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* cont
     for (auto& executor : relExecutors) {
         executor.init(resultSet, context);
     }
+    if (unFlatChunkPos != INVALID_DATA_CHUNK_POS) {
+        const auto& state = resultSet->dataChunks[unFlatChunkPos]->state;
+        tupleIterator.init(state.get());
+        insertNodesInBatch = !nodeExecutors.empty();
+        for (auto& executor : nodeExecutors) {
+            insertNodesInBatch &=
+                executor.initBatch(state, context->clientContext->getMemoryManager());
+        }
+    }
 }
 
-bool Insert::getNextTuplesInternal(ExecutionContext* context) {
-    if (!children[0]->getNextTuple(context)) {
-        return false;
-    }
+void Insert::insertNodes(ExecutionContext* context) {
     for (auto& executor : nodeExecutors) {
         executor.insert(context->clientContext);
     }
+}
+
+void Insert::insertRels(ExecutionContext* context) {
     for (auto& executor : relExecutors) {
         executor.insert(context->clientContext);
     }
+}
+
+bool Insert::getNextTuplesInternal(ExecutionContext* context) {
+    if (!children[0]->getNextTuple(context)) {
+        return false;
+    }
+    if (insertNodesInBatch) {
+        for (auto& executor : nodeExecutors) {
+            executor.insertBatch(context->clientContext);
+        }
+        // Rels may connect nodes inserted above, whose ids are now in the input chunk.
+        if (!relExecutors.empty()) {
+            tupleIterator.iterate([&]() { insertRels(context); });
+        }
+    } else {
+        tupleIterator.iterate([&]() {
+            insertNodes(context);
+            insertRels(context);
+        });
+    }
     return true;
 }
 
@@ -27,10 +27,14 @@ void NodeInsertInfo::updateNodeID(nodeID_t nodeID) const {
 nodeID_t NodeInsertInfo::getNodeID() const {
     auto& nodeIDSelVector = nodeIDVector->state->getSelVector();
     KU_ASSERT(nodeIDSelVector.getSelSize() == 1);
-    if (nodeIDVector->isNull(nodeIDSelVector[0])) {
+    return getNodeID(nodeIDSelVector[0]);
+}
+
+nodeID_t NodeInsertInfo::getNodeID(sel_t pos) const {
+    if (nodeIDVector->isNull(pos)) {
         return {INVALID_OFFSET, INVALID_TABLE_ID};
     }
-    return nodeIDVector->getValue<nodeID_t>(nodeIDSelVector[0]);
+    return nodeIDVector->getValue<nodeID_t>(pos);
 }
 
 void NodeTableInsertInfo::init(const ResultSet& resultSet, main::ClientContext* context) {
@@ -41,6 +45,27 @@ void NodeTableInsertInfo::init(const ResultSet& resultSet, main::ClientContext*
     pkVector = columnDataVectors[table->getPKColumnID()];
 }
 
+bool NodeTableInsertInfo::initBatch(const std::shared_ptr<DataChunkState>& state,
+    storage::MemoryManager* mm) {
+    batchDataVectors.clear();
+    broadcastVectors.clear();
+    for (auto columnDataVector : columnDataVectors) {
+        if (columnDataVector->state == state) {
+            batchDataVectors.push_back(columnDataVector);
+            broadcastVectors.push_back(nullptr);
+        } else if (columnDataVector->state->isFlat()) {
+            auto broadcastVector =
+                std::make_unique<ValueVector>(columnDataVector->dataType.copy(), mm);
+            broadcastVector->setState(state);
+            batchDataVectors.push_back(broadcastVector.get());
+            broadcastVectors.push_back(std::move(broadcastVector));
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
 void NodeInsertExecutor::init(ResultSet* resultSet, const ExecutionContext* context) {
     info.init(*resultSet);
     tableInfo.init(*resultSet, context->clientContext);
@@ -49,17 +74,34 @@ void NodeInsertExecutor::init(ResultSet* resultSet, const ExecutionContext* cont
 static void writeColumnVector(ValueVector* columnVector, const ValueVector* dataVector) {
     auto& columnSelVector = columnVector->state->getSelVector();
     auto& dataSelVector = dataVector->state->getSelVector();
-    KU_ASSERT(columnSelVector.getSelSize() == 1 && dataSelVector.getSelSize() == 1);
-    auto columnPos = columnSelVector[0];
-    auto dataPos = dataSelVector[0];
-    if (dataVector->isNull(dataPos)) {
-        columnVector->setNull(columnPos, true);
-    } else {
-        columnVector->setNull(columnPos, false);
-        columnVector->copyFromVectorData(columnPos, dataVector, dataPos);
+    KU_ASSERT(columnSelVector.getSelSize() == dataSelVector.getSelSize());
+    for (auto i = 0u; i < columnSelVector.getSelSize(); i++) {
+        auto columnPos = columnSelVector[i];
+        auto dataPos = dataSelVector[i];
+        if (dataVector->isNull(dataPos)) {
+            columnVector->setNull(columnPos, true);
+        } else {
+            columnVector->setNull(columnPos, false);
+            columnVector->copyFromVectorData(columnPos, dataVector, dataPos);
+        }
     }
 }
 
+// Copies the single value of a flat vector to every selected position of the target vector.
+static void broadcastColumnVector(const ValueVector& dataVector, ValueVector& broadcastVector) {
+    auto& dataSelVector = dataVector.state->getSelVector();
+    KU_ASSERT(dataSelVector.getSelSize() == 1);
+    const auto dataPos = dataSelVector[0];
+    const auto isNull = dataVector.isNull(dataPos);
+    broadcastVector.resetAuxiliaryBuffer();
+    broadcastVector.state->getSelVector().forEach([&](auto pos) {
+        broadcastVector.setNull(pos, isNull);
+        if (!isNull) {
+            broadcastVector.copyFromVectorData(pos, &dataVector, dataPos);
+        }
+    });
+}
+
 // TODO(Guodong/Xiyang): think we can reference data vector instead of copy.
 static void writeColumnVectors(const std::vector<ValueVector*>& columnVectors,
     const std::vector<ValueVector*>& dataVectors) {
@@ -103,6 +145,49 @@ nodeID_t NodeInsertExecutor::insert(main::ClientContext* context) {
     return info.getNodeID();
 }
 
+bool NodeInsertExecutor::initBatch(const std::shared_ptr<DataChunkState>& state,
+    storage::MemoryManager* mm) {
+    // Conflicting tuples are skipped one at a time. Node ids and returned columns are written per
+    // tuple, so they need to be part of the batch.
+    if (info.conflictAction != ConflictAction::ON_CONFLICT_THROW ||
+        info.nodeIDVector->state != state) {
+        return false;
+    }
+    for (auto columnVector : info.columnVectors) {
+        if (columnVector != nullptr && columnVector->state != state) {
+            return false;
+        }
+    }
+    if (!tableInfo.initBatch(state, mm)) {
+        return false;
+    }
+    batchState = state;
+    return true;
+}
+
+void NodeInsertExecutor::insertBatch(main::ClientContext* context) {
+    KU_ASSERT(batchState != nullptr);
+    auto& selVector = batchState->getSelVector();
+    if (selVector.getSelSize() == 0) {
+        return;
+    }
+    for (auto& evaluator : tableInfo.columnDataEvaluators) {
+        evaluator->evaluate();
+    }
+    for (auto i = 0u; i < tableInfo.broadcastVectors.size(); i++) {
+        if (tableInfo.broadcastVectors[i] != nullptr) {
+            broadcastColumnVector(*tableInfo.columnDataVectors[i], *tableInfo.broadcastVectors[i]);
+        }
+    }
+    selVector.forEach([&](auto pos) { info.nodeIDVector->setNull(pos, false); });
+    const auto pkVector = tableInfo.batchDataVectors[tableInfo.table->getPKColumnID()];
+    auto insertState = std::make_unique<storage::NodeTableInsertState>(*info.nodeIDVector,
+        *pkVector, tableInfo.batchDataVectors);
+    tableInfo.table->initInsertState(context, *insertState);
+    tableInfo.table->insert(context->getTransaction(), *insertState);
+    writeColumnVectors(info.columnVectors, tableInfo.batchDataVectors);
+}
+
 void NodeInsertExecutor::skipInsert() const {
     for (auto& evaluator : tableInfo.columnDataEvaluators) {
         evaluator->evaluate();
@@ -40,6 +40,17 @@ void Merge::initLocalStateInternal(ResultSet* resultSet_, ExecutionContext* cont
         evaluator->init(*resultSet_, context->clientContext);
     }
     localState.init(*resultSet, context->clientContext, info);
+    if (info.unFlatChunkPos != INVALID_DATA_CHUNK_POS) {
+        batchState = resultSet->dataChunks[info.unFlatChunkPos]->state;
+        tupleIterator.init(batchState.get());
+        mergeInBatch = !nodeInsertExecutors.empty() && relInsertExecutors.empty();
+        for (auto& executor : nodeInsertExecutors) {
+            mergeInBatch &=
+                executor.initBatch(batchState, context->clientContext->getMemoryManager());
+        }
+        noMatchSelVector = std::make_shared<common::SelectionVector>();
+        newPatternSelVector = std::make_shared<common::SelectionVector>();
+    }
 }
 
 void MergeLocalState::init(ResultSet& resultSet, main::ClientContext* context, MergeInfo& info) {
@@ -106,6 +117,10 @@ void Merge::executeOnNewPattern(PatternCreationInfo& patternCreationInfo,
         auto relID = executor.insert(context->clientContext);
         patternCreationInfo.updateID(i + nodeInsertExecutors.size(), info.executorInfo, relID);
     }
+    executeOnCreate(context);
+}
+
+void Merge::executeOnCreate(ExecutionContext* context) {
     for (auto& executor : onCreateNodeSetExecutors) {
         executor->set(context);
     }
@@ -126,15 +141,90 @@ void Merge::executeNoMatch(ExecutionContext* context) {
     }
 }
 
-bool Merge::getNextTuplesInternal(ExecutionContext* context) {
-    if (!children[0]->getNextTuple(context)) {
-        return false;
-    }
+void Merge::executeTuple(ExecutionContext* context) {
     if (localState.patternExists()) {
         executeOnMatch(context);
     } else {
         executeNoMatch(context);
     }
+}
+
+void Merge::executeBatch(ExecutionContext* context) {
+    auto inputSelVector = batchState->getSelVectorShared();
+    auto existenceVector = localState.existenceVector;
+    const auto flatExistencePos = existenceVector->state != batchState ?
+                                      existenceVector->state->getSelVector()[0] :
+                                      common::INVALID_SEL;
+    common::sel_t numNoMatches = 0;
+    auto noMatchBuffer = noMatchSelVector->getMutableBuffer();
+    for (auto i = 0u; i < inputSelVector->getSelSize(); i++) {
+        const auto pos = (*inputSelVector)[i];
+        const auto existencePos = flatExistencePos == common::INVALID_SEL ? pos : flatExistencePos;
+        if (!existenceVector->getValue<bool>(existencePos)) {
+            noMatchBuffer[numNoMatches++] = pos;
+        }
+    }
+    noMatchSelVector->setToFiltered(numNoMatches);
+    std::vector<PatternCreationInfo> patternCreationInfos;
+    if (numNoMatches > 0) {
+        // Deduplicate the keys of all unmatched tuples against each other and earlier inputs.
+        batchState->setSelVector(noMatchSelVector);
+        for (auto& evaluator : info.keyEvaluators) {
+            evaluator->evaluate();
+        }
+        patternCreationInfos = localState.getPatternCreationInfos(*batchState);
+        common::sel_t numNewPatterns = 0;
+        auto newPatternBuffer = newPatternSelVector->getMutableBuffer();
+        for (auto i = 0u; i < numNoMatches; i++) {
+            if (!patternCreationInfos[i].hasCreated) {
+                newPatternBuffer[numNewPatterns++] = (*noMatchSelVector)[i];
+            }
+        }
+        newPatternSelVector->setToFiltered(numNewPatterns);
+        // Insert the nodes of all new patterns at once.
+        batchState->setSelVector(newPatternSelVector);
+        for (auto& executor : nodeInsertExecutors) {
+            executor.insertBatch(context->clientContext);
+        }
+        for (auto i = 0u; i < numNoMatches; i++) {
+            if (patternCreationInfos[i].hasCreated) {
+                continue;
+            }
+            const auto pos = (*noMatchSelVector)[i];
+            for (auto j = 0u; j < nodeInsertExecutors.size(); j++) {
+                patternCreationInfos[i].updateID(j, info.executorInfo,
+                    nodeInsertExecutors[j].getNodeID(pos));
+            }
+        }
+        batchState->setSelVector(inputSelVector);
+    }
+    // Set executors run per tuple in input order, as they would with a flattened input.
+    auto noMatchIdx = 0u;
+    tupleIterator.iterate([&]() {
+        if (localState.patternExists()) {
+            executeOnMatch(context);
+            return;
+        }
+        auto& patternCreationInfo = patternCreationInfos[noMatchIdx++];
+        if (patternCreationInfo.hasCreated) {
+            executeOnCreatedPattern(patternCreationInfo, context);
+        } else {
+            executeOnCreate(context);
+        }
+    });
+}
+
+bool Merge::getNextTuplesInternal(ExecutionContext* context) {
+    if (!children[0]->getNextTuple(context)) {
+        return false;
+    }
+    if (mergeInBatch) {
+        executeBatch(context);
+        return true;
+    }
+    // Tuples of an unFlat input are merged in order, so later tuples observe the patterns created
+    // by earlier ones through the pattern creation info table, just as with a flattened input.
+    tupleIterator.iterate([&]() { executeTuple(context); });
     return true;
 }
 
@@ -28,7 +28,7 @@ std::string NodeBatchInsertPrintInfo::toString() const {
 void NodeBatchInsertSharedState::initPKIndex(const ExecutionContext* context) {
     uint64_t numRows = 0;
     if (tableFuncSharedState != nullptr) {
-        numRows = tableFuncSharedState->getNumRows();
+        numRows = tableFuncSharedState->getEstimatedNumRows();
     }
     auto* nodeTable = ku_dynamic_cast<NodeTable*>(table);
     nodeTable->getPKIndex()->bulkReserve(numRows);
@@ -232,26 +232,44 @@ void NodeBatchInsert::writeAndResetNodeGroup(transaction::Transaction* transacti
 void NodeBatchInsert::appendIncompleteNodeGroup(transaction::Transaction* transaction,
     std::unique_ptr<ChunkedNodeGroup> localNodeGroup, std::optional<IndexBuilder>& indexBuilder,
     MemoryManager* mm) const {
-    std::unique_lock xLck{sharedState->mtx};
     const auto nodeLocalState = ku_dynamic_cast<NodeBatchInsertLocalState*>(localState.get());
     const auto nodeSharedState = ku_dynamic_cast<NodeBatchInsertSharedState*>(sharedState.get());
-    if (!nodeSharedState->sharedNodeGroup) {
-        nodeSharedState->sharedNodeGroup = std::move(localNodeGroup);
-        return;
-    }
-    auto numNodesAppended =
-        nodeSharedState->sharedNodeGroup->append(&transaction::DUMMY_TRANSACTION, *localNodeGroup,
-            0 /* offsetInNodeGroup */, localNodeGroup->getNumRows());
-    while (nodeSharedState->sharedNodeGroup->isFullOrOnDisk()) {
-        writeAndResetNodeGroup(transaction, nodeSharedState->sharedNodeGroup, indexBuilder, mm,
+    auto nodeGroupToAppend = std::move(localNodeGroup);
+    while (nodeGroupToAppend) {
+        std::unique_ptr<ChunkedNodeGroup> nodeGroupToWrite;
+        {
+            // The lock only protects the shared node group. Full node groups are taken out of it
+            // and written without holding the lock, so that writing them to disk and inserting
+            // their keys into the PK index doesn't serialize the other threads.
+            std::unique_lock xLck{sharedState->mtx};
+            auto& sharedNodeGroup = nodeSharedState->sharedNodeGroup;
+            if (!sharedNodeGroup) {
+                sharedNodeGroup = std::move(nodeGroupToAppend);
+                return;
+            }
+            const auto numNodesAppended =
+                sharedNodeGroup->append(&transaction::DUMMY_TRANSACTION, *nodeGroupToAppend,
+                    0 /* offsetInNodeGroup */, nodeGroupToAppend->getNumRows());
+            if (!sharedNodeGroup->isFullOrOnDisk()) {
+                KU_ASSERT(numNodesAppended == nodeGroupToAppend->getNumRows());
+                return;
+            }
+            nodeGroupToWrite = std::move(sharedNodeGroup);
+            if (numNodesAppended < nodeGroupToAppend->getNumRows()) {
+                // The remaining nodes are fewer than a full node group, so they become the new
+                // shared node group.
+                clearToIndex(mm, nodeGroupToAppend, numNodesAppended);
+                sharedNodeGroup = std::move(nodeGroupToAppend);
+            }
+            nodeGroupToAppend.reset();
+        }
+        writeAndResetNodeGroup(transaction, nodeGroupToWrite, indexBuilder, mm,
             *nodeLocalState->optimisticAllocator);
-        if (numNodesAppended < localNodeGroup->getNumRows()) {
-            numNodesAppended += nodeSharedState->sharedNodeGroup->append(
-                &transaction::DUMMY_TRANSACTION, *localNodeGroup, numNodesAppended,
-                localNodeGroup->getNumRows() - numNodesAppended);
+        // The last node group of the table may not have had room for all the nodes.
+        if (nodeGroupToWrite->getNumRows() > 0) {
+            nodeGroupToAppend = std::move(nodeGroupToWrite);
         }
     }
-    KU_ASSERT(numNodesAppended == localNodeGroup->getNumRows());
 }
 
 void NodeBatchInsert::finalize(ExecutionContext* context) {
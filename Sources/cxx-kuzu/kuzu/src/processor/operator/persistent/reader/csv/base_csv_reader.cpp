@@ -1,5 +1,6 @@
 #include "processor/operator/persistent/reader/csv/base_csv_reader.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "common/file_system/virtual_file_system.h"
@@ -64,6 +65,21 @@ uint64_t BaseCSVReader::getFileSize() {
     return fileInfo->getFileSize();
 }
 
+uint64_t BaseCSVReader::estimateNumRows() {
+    const auto fileSize = getFileSize();
+    if (fileSize == 0) {
+        return 0;
+    }
+    const auto sampleSize = std::min(fileSize, CopyConstants::INITIAL_BUFFER_SIZE);
+    const auto sample = std::make_unique<char[]>(sampleSize);
+    const auto numBytesRead = fileInfo->readFile(sample.get(), sampleSize);
+    if (numBytesRead <= 0) {
+        return 0;
+    }
+    const uint64_t numLines = std::count(sample.get(), sample.get() + numBytesRead, '\n');
+    return numLines * fileSize / numBytesRead;
+}
+
 template<typename Driver>
 bool BaseCSVReader::addValue(Driver& driver, uint64_t rowNum, column_id_t columnIdx,
     std::string_view strVal, std::vector<uint64_t>& escapePositions) {
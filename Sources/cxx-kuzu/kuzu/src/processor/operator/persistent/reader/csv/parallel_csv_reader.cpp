@@ -281,6 +281,7 @@ static std::unique_ptr<TableFuncSharedState> initSharedState(
         auto reader = std::make_unique<ParallelCSVReader>(filePath, i, csvOption.copy(),
             columnInfo.copy(), bindData->context, nullptr);
         sharedState->totalSize += reader->getFileSize();
+        sharedState->estimatedNumRows += reader->estimateNumRows();
     }
 
     return sharedState;
@@ -7,6 +7,7 @@
 #include "common/task_system/progress_bar.h"
 #include "processor/execution_context.h"
 #include "processor/result/factorized_table_util.h"
+#include "storage/buffer_manager/memory_tracker.h"
 #include "storage/local_storage/local_storage.h"
 #include "storage/storage_manager.h"
 #include "storage/storage_utils.h"
@@ -125,6 +126,8 @@ static void appendNewChunkedGroup(MemoryManager& mm, transaction::Transaction* t
     const std::vector<column_id_t>& columnIDs, ChunkedCSRNodeGroup& chunkedGroup,
     RelTable& relTable, CSRNodeGroup& nodeGroup, RelDataDirection direction,
     PageAllocator& pageAllocator) {
+    // The appended chunked groups are owned by the table, not by the COPY.
+    MemoryTracker::Scope untrackedScope{nullptr};
     const bool isNewNodeGroup = nodeGroup.isEmpty();
     const CSRNodeGroupScanSource source = isNewNodeGroup ?
                                               CSRNodeGroupScanSource::COMMITTED_PERSISTENT :
@@ -183,6 +186,9 @@ void RelBatchInsert::appendNodeGroup(const RelGroupCatalogEntry& relGroupEntry,
         numGapsAtEnd -= numGapsFilled;
     }
     KU_ASSERT(localState.chunkedGroup->getNumRows() == maxSize);
+    if (relGroupEntry.isSortedByNeighbor()) {
+        localState.chunkedGroup->cast<ChunkedCSRNodeGroup>().sortCSRListsByNeighbor();
+    }
     localState.chunkedGroup->finalize();
 
     auto* relTable = sharedState->table->ptrCast<RelTable>();
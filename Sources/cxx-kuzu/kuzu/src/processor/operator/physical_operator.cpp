@@ -2,6 +2,7 @@
 
 #include "common/exception/interrupt.h"
 #include "common/exception/runtime.h"
+#include "common/metric.h"
 #include "common/task_system/progress_bar.h"
 #include "processor/execution_context.h"
 
@@ -96,6 +97,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "SCAN_NODE_TABLE";
     case PhysicalOperatorType::SCAN_REL_TABLE:
         return "SCAN_REL_TABLE";
+    case PhysicalOperatorType::SECONDARY_INDEX_SCAN_NODE_TABLE:
+        return "SECONDARY_INDEX_SCAN_NODE_TABLE";
     case PhysicalOperatorType::SEMI_MASKER:
         return "SEMI_MASKER";
     case PhysicalOperatorType::SET_PROPERTY:
@@ -198,11 +201,23 @@ bool PhysicalOperator::getNextTuple(ExecutionContext* context) {
         }
     }
 #endif
+    // The counters are read outside of the timer, so that reading them, which takes a system call,
+    // doesn't count towards the execution time of the operator.
+    const auto countMemoryAccesses = metrics->numPageFaults.enabled;
+    common::ThreadMemoryCounters startCounters;
+    if (countMemoryAccesses) {
+        startCounters = common::ThreadMemoryCounters::read();
+    }
     metrics->executionTime.start();
     auto result = getNextTuplesInternal(context);
     context->clientContext->getProgressBar()->updateProgress(context->queryID,
         getProgress(context));
     metrics->executionTime.stop();
+    if (countMemoryAccesses) {
+        const auto endCounters = common::ThreadMemoryCounters::read();
+        metrics->numPageFaults.increase(endCounters.numPageFaults - startCounters.numPageFaults);
+        metrics->numTLBMisses.increase(endCounters.numTLBMisses - startCounters.numTLBMisses);
+    }
     return result;
 }
 
@@ -216,7 +231,10 @@ void PhysicalOperator::finalize(ExecutionContext* context) {
 void PhysicalOperator::registerProfilingMetrics(Profiler* profiler) {
     auto executionTime = profiler->registerTimeMetric(getTimeMetricKey());
     auto numOutputTuple = profiler->registerNumericMetric(getNumTupleMetricKey());
-    metrics = std::make_unique<OperatorMetrics>(*executionTime, *numOutputTuple);
+    auto numPageFaults = profiler->registerNumericMetric(getPageFaultMetricKey());
+    auto numTLBMisses = profiler->registerNumericMetric(getTLBMissMetricKey());
+    metrics = std::make_unique<OperatorMetrics>(*executionTime, *numOutputTuple, *numPageFaults,
+        *numTLBMisses);
 }
 
 double PhysicalOperator::getExecutionTime(Profiler& profiler) const {
@@ -231,11 +249,26 @@ uint64_t PhysicalOperator::getNumOutputTuples(Profiler& profiler) const {
     return profiler.sumAllNumericMetricsWithKey(getNumTupleMetricKey());
 }
 
+uint64_t PhysicalOperator::getExclusiveCount(Profiler& profiler,
+    std::string (PhysicalOperator::*getMetricKey)() const) const {
+    auto count = profiler.sumAllNumericMetricsWithKey((this->*getMetricKey)());
+    if (!isSource()) {
+        const auto childCount =
+            profiler.sumAllNumericMetricsWithKey((children[0].get()->*getMetricKey)());
+        count = count > childCount ? count - childCount : 0;
+    }
+    return count;
+}
+
 std::unordered_map<std::string, std::string> PhysicalOperator::getProfilerKeyValAttributes(
     Profiler& profiler) const {
     std::unordered_map<std::string, std::string> result;
     result.insert({"ExecutionTime", std::to_string(getExecutionTime(profiler))});
     result.insert({"NumOutputTuples", std::to_string(getNumOutputTuples(profiler))});
+    result.insert({"PageFaults",
+        std::to_string(getExclusiveCount(profiler, &PhysicalOperator::getPageFaultMetricKey))});
+    result.insert({"TLBMisses",
+        std::to_string(getExclusiveCount(profiler, &PhysicalOperator::getTLBMissMetricKey))});
     return result;
 }
 
@@ -82,6 +82,11 @@ static bool requireRelID(const RJAlgorithm& function) {
     return false;
 }
 
+void RecursiveExtend::initLocalStateInternal(ResultSet* /*resultSet_*/,
+    ExecutionContext* context) {
+    numSparseIterations = context->profiler->registerNumericMetric(getSparseIterationMetricKey());
+}
+
 void RecursiveExtend::executeInternal(ExecutionContext* context) {
     auto clientContext = context->clientContext;
     auto graph = sharedState->graph.get();
@@ -117,9 +122,9 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
             auto computeState = function->getComputeState(context, bindData, sharedState.get());
             auto sourceNodeID = nodeID_t{offset, tableID};
             computeState->initSource(sourceNodeID);
-            GDSUtils::runRecursiveJoinEdgeCompute(context, *computeState, graph,
-                bindData.extendDirection, bindData.upperBound, sharedState->getOutputNodeMaskMap(),
-                propertyNames);
+            numSparseIterations->increase(GDSUtils::runRecursiveJoinEdgeCompute(context,
+                *computeState, graph, bindData.extendDirection, bindData.upperBound,
+                sharedState->getOutputNodeMaskMap(), propertyNames));
             auto writer = function->getOutputWriter(context, bindData, *computeState, sourceNodeID,
                 sharedState.get());
             auto vertexCompute = std::make_unique<RJVertexCompute>(
@@ -153,5 +158,13 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
     sharedState->factorizedTablePool.mergeLocalTables();
 }
 
+std::unordered_map<std::string, std::string> RecursiveExtend::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = Sink::getProfilerKeyValAttributes(profiler);
+    result.insert({"SparseIterations",
+        std::to_string(profiler.sumAllNumericMetricsWithKey(getSparseIterationMetricKey()))});
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
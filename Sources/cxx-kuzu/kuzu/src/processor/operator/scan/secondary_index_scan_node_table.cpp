@@ -0,0 +1,101 @@
+#include "processor/operator/scan/secondary_index_scan_node_table.h"
+
+#include "binder/expression/expression_util.h"
+#include "processor/execution_context.h"
+#include "storage/index/ordered_index.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+std::string SecondaryIndexScanPrintInfo::toString() const {
+    std::string result = "Index: ";
+    result += indexName;
+    result += ", Range: ";
+    result += range;
+    if (!alias.empty()) {
+        result += ",Alias: ";
+        result += alias;
+    }
+    result += ", Expressions: ";
+    result += binder::ExpressionUtil::toString(expressions);
+    return result;
+}
+
+void SecondaryIndexScanNodeTable::initLocalStateInternal(ResultSet* resultSet,
+    ExecutionContext* context) {
+    ScanTable::initLocalStateInternal(resultSet, context);
+    auto nodeIDVector = resultSet->getValueVector(opInfo.nodeIDPos).get();
+    scanState = std::make_unique<NodeTableScanState>(nodeIDVector, std::vector<ValueVector*>{},
+        nodeIDVector->state);
+    tableInfo.initScanState(*scanState, outVectors, context->clientContext);
+    if (lowerBound.evaluator != nullptr) {
+        lowerBound.evaluator->init(*resultSet, context->clientContext);
+    }
+    if (upperBound.evaluator != nullptr) {
+        upperBound.evaluator->init(*resultSet, context->clientContext);
+    }
+    auto& table = tableInfo.table->cast<NodeTable>();
+    const auto indexOptional = table.getIndex(indexName);
+    KU_ASSERT(indexOptional.has_value());
+    index = &indexOptional.value()->cast<OrderedIndex>();
+}
+
+static std::optional<OrderedIndexBound> evaluateBound(SecondaryIndexScanBound& bound,
+    bool& isNull) {
+    if (bound.evaluator == nullptr) {
+        return std::nullopt;
+    }
+    bound.evaluator->evaluate();
+    auto vector = bound.evaluator->resultVector.get();
+    KU_ASSERT(vector->state->getSelVector().getSelSize() == 1);
+    auto pos = vector->state->getSelVector()[0];
+    isNull |= vector->isNull(pos);
+    return OrderedIndexBound{vector, pos, bound.inclusive};
+}
+
+void SecondaryIndexScanNodeTable::lookupIndex(const transaction::Transaction* transaction) {
+    bool hasNullBound = false;
+    auto lower = evaluateBound(lowerBound, hasNullBound);
+    auto upper = evaluateBound(upperBound, hasNullBound);
+    if (hasNullBound) {
+        // Comparisons with null are never true.
+        return;
+    }
+    index->lookup(transaction, lower, upper, offsets);
+}
+
+bool SecondaryIndexScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
+    auto transaction = context->clientContext->getTransaction();
+    if (!lookedUp) {
+        lookupIndex(transaction);
+        lookedUp = true;
+    }
+    auto& table = tableInfo.table->cast<NodeTable>();
+    const auto tableID = table.getTableID();
+    auto nodeIDVector = scanState->nodeIDVector;
+    scanState->resetOutVectors();
+    sel_t numNodes = 0;
+    for (; cursor < offsets.size() && numNodes < DEFAULT_VECTOR_CAPACITY; cursor++) {
+        const auto offset = offsets[cursor];
+        // Deleted nodes are only removed from the index at checkpoint.
+        if (!transaction->isUnCommitted(tableID, offset) &&
+            !table.isVisibleNoLock(transaction, offset)) {
+            continue;
+        }
+        nodeIDVector->setValue<nodeID_t>(numNodes++, nodeID_t{offset, tableID});
+    }
+    if (numNodes == 0) {
+        return false;
+    }
+    nodeIDVector->state->getSelVectorUnsafe().setToUnfiltered(numNodes);
+    table.lookupMultiple(transaction, *scanState);
+    tableInfo.castColumns();
+    metrics->numOutputTuple.increase(numNodes);
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,5 +1,8 @@
 #include "processor/result/pattern_creation_info_table.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 namespace kuzu {
 namespace processor {
 
@@ -32,25 +35,49 @@ PatternCreationInfo PatternCreationInfoTable::getPatternCreationInfo(
         KU_ASSERT(factorizedTable->getNumTuples() == 1);
         return PatternCreationInfo{tuple, hasCreated};
     } else {
+        const auto numEntriesBefore = factorizedTable->getNumTuples();
         resizeHashTableIfNecessary(1);
         computeVectorHashes(keyVectors);
         findHashSlots(keyVectors, std::vector<common::ValueVector*>{}, keyVectors[0]->state.get());
-        hasCreated = tuple != nullptr;
-        auto idTuple = tuple == nullptr ?
-                           factorizedTable->getTuple(factorizedTable->getNumTuples() - 1) :
-                           tuple;
-        return PatternCreationInfo{idTuple + idColOffset, hasCreated};
+        // A new entry is appended if the key has not been seen before.
+        hasCreated = factorizedTable->getNumTuples() == numEntriesBefore;
+        auto pos = hashVector->state->getSelVector()[0];
+        return PatternCreationInfo{hashSlotsToUpdateAggState[pos]->getEntry() + idColOffset,
+            hasCreated};
     }
 }
 
-uint64_t PatternCreationInfoTable::matchFTEntries(std::span<const common::ValueVector*> keyVectors,
-    uint64_t numMayMatches, uint64_t numNoMatches) {
-    numNoMatches = AggregateHashTable::matchFTEntries(keyVectors, numMayMatches, numNoMatches);
-    KU_ASSERT(numMayMatches <= 1);
-    // If we found the entry for the target key, we set tuple to the key tuple. Otherwise, simply
-    // set tuple to nullptr.
-    tuple = numMayMatches != 0 ? hashSlotsToUpdateAggState[mayMatchIdxes[0]]->getEntry() : nullptr;
-    return numNoMatches;
+std::vector<PatternCreationInfo> PatternCreationInfoTable::getPatternCreationInfos(
+    const std::vector<common::ValueVector*>& keyVectors, const common::DataChunkState& state) {
+    const auto numTuples = state.getSelVector().getSelSize();
+    std::vector<PatternCreationInfo> result;
+    result.reserve(numTuples);
+    const auto hasUnFlatKey = std::any_of(keyVectors.begin(), keyVectors.end(),
+        [&](const common::ValueVector* keyVector) { return keyVector->state.get() == &state; });
+    if (!hasUnFlatKey) {
+        // All tuples have the same keys, so only the first one can create the pattern.
+        auto patternCreationInfo = getPatternCreationInfo(keyVectors);
+        result.push_back(patternCreationInfo);
+        for (auto i = 1u; i < numTuples; i++) {
+            result.push_back(PatternCreationInfo{patternCreationInfo.tuple, true /* hasCreated */});
+        }
+        return result;
+    }
+    const auto numEntriesBefore = factorizedTable->getNumTuples();
+    resizeHashTableIfNecessary(numTuples);
+    computeVectorHashes(keyVectors);
+    findHashSlots(keyVectors, std::vector<common::ValueVector*>{}, &state);
+    // Entries appended by this lookup belong to keys that have not been seen before.
+    std::unordered_set<uint8_t*> newEntries;
+    for (auto i = numEntriesBefore; i < factorizedTable->getNumTuples(); i++) {
+        newEntries.insert(factorizedTable->getTuple(i));
+    }
+    hashVector->state->getSelVector().forEach([&](auto pos) {
+        auto entry = hashSlotsToUpdateAggState[pos]->getEntry();
+        const auto hasCreated = newEntries.erase(entry) == 0;
+        result.push_back(PatternCreationInfo{entry + idColOffset, hasCreated});
+    });
+    return result;
 }
 
 } // namespace processor
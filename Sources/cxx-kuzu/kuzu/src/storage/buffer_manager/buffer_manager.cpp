@@ -64,13 +64,20 @@ void EvictionQueue::clear(std::atomic<EvictionCandidate>& candidate) {
 }
 
 BufferManager::BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
-    uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly)
+    uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly,
+    VMRegionConfig vmRegionConfig)
     : bufferPoolSize{bufferPoolSize}, evictionQueue{bufferPoolSize / KUZU_PAGE_SIZE},
-      usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)}, vfs{vfs} {
+      usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)}, vfs{vfs},
+      decompressedPageCache{std::make_unique<DecompressedPageCache>(*this)},
+      prefetchDepth{DEFAULT_PREFETCH_DEPTH}, numPrefetchedPages{0}, numPrefetchHits{0},
+      numWarmedPages{0}, evictionPolicy{EvictionPolicy::SECOND_CHANCE},
+      prefetcher{std::make_unique<PagePrefetcher>(*this)} {
     verifySizeParams(bufferPoolSize, maxDBSize);
 #if !BM_MALLOC
-    vmRegions[0] = std::make_unique<VMRegion>(REGULAR_PAGE, maxDBSize);
-    vmRegions[1] = std::make_unique<VMRegion>(TEMP_PAGE, bufferPoolSize);
+    vmRegions[0] = std::make_unique<VMRegion>(REGULAR_PAGE, maxDBSize, vmRegionConfig);
+    vmRegions[1] = std::make_unique<VMRegion>(TEMP_PAGE, bufferPoolSize, vmRegionConfig);
+#else
+    KU_UNUSED(vmRegionConfig);
 #endif
 
     // TODO(bmwinger): It may be better to spill to disk in a different location for remote file
@@ -127,6 +134,9 @@ uint8_t* BufferManager::pin(FileHandle& fileHandle, page_idx_t pageIdx,
                     throw BufferManagerException(
                         "Eviction queue is full! This should be impossible.");
                 }
+                if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
+                    fileHandle.recordPageMiss();
+                }
 #if BM_MALLOC
                 KU_ASSERT(pageState->getPage());
                 return pageState->getPage();
@@ -137,7 +147,12 @@ uint8_t* BufferManager::pin(FileHandle& fileHandle, page_idx_t pageIdx,
         } break;
         case PageState::UNLOCKED:
         case PageState::MARKED: {
+            if (PageState::isPrefetched(currStateAndVersion)) {
+                recordPrefetchHit(*pageState);
+                continue;
+            }
             if (pageState->tryLock(currStateAndVersion)) {
+                fileHandle.recordPageHit();
                 return getFrame(fileHandle, pageIdx);
             }
         } break;
@@ -216,8 +231,13 @@ inline bool try_func(const std::function<void(uint8_t*)>& func, uint8_t* frame,
 }
 
 void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& func) {
+    const std::function<void(uint8_t*)>& func, PageAccessType accessType) {
     auto pageState = fileHandle.getPageState(pageIdx);
+    // Scans under the scan-resistant policy leave the pages they touch first in line for eviction.
+    const bool keepEvictable = accessType == PageAccessType::SEQUENTIAL_SCAN &&
+                               evictionPolicy == EvictionPolicy::SCAN_RESISTANT;
+    // Set once this call loaded the page, which pin already counted as a miss.
+    bool loaded = false;
 #if defined(_WIN32)
     // Change the Structured Exception handling just for the scope of this function
     auto translator = ScopedTranslator(handleAccessViolation);
@@ -225,23 +245,39 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
         switch (PageState::getState(currStateAndVersion)) {
+        case PageState::MARKED: {
+            if (!keepEvictable) {
+                // If the page is marked, we try to switch to unlocked.
+                pageState->tryClearMark(currStateAndVersion);
+                continue;
+            }
+            // The version check below also fails if the page is evicted during the read.
+            [[fallthrough]];
+        }
         case PageState::UNLOCKED: {
+            if (PageState::isPrefetched(currStateAndVersion)) {
+                recordPrefetchHit(*pageState);
+                continue;
+            }
             if (!try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
                     fileHandle.getPageSizeClass(), pageState)) {
                 continue;
             }
             if (pageState->getStateAndVersion() == currStateAndVersion) {
+                if (!loaded) {
+                    fileHandle.recordPageHit();
+                }
                 return;
             }
         } break;
-        case PageState::MARKED: {
-            // If the page is marked, we try to switch to unlocked.
-            pageState->tryClearMark(currStateAndVersion);
-            continue;
-        }
         case PageState::EVICTED: {
             pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
-            unpin(fileHandle, pageIdx);
+            loaded = true;
+            if (keepEvictable) {
+                pageState->unlockAsMarked();
+            } else {
+                unpin(fileHandle, pageIdx);
+            }
         } break;
         default: {
             // When locked, continue the spinning.
@@ -251,6 +287,114 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
     }
 }
 
+bool BufferManager::cacheLockedPage(FileHandle& fileHandle, page_idx_t pageIdx,
+    const uint8_t* data) {
+    auto pageState = fileHandle.getPageState(pageIdx);
+    // Prefetching and warming are only hints, so failures leave the page evicted instead of being
+    // thrown.
+    bool cached = false;
+    try {
+        if (!claimAFrame(fileHandle, pageIdx,
+                data == nullptr ? PageReadPolicy::READ_PAGE : PageReadPolicy::DONT_READ_PAGE)) {
+            pageState->resetToEvicted();
+            return false;
+        }
+        if (data != nullptr) {
+            memcpy(getFrame(fileHandle, pageIdx), data, fileHandle.getPageSize());
+        }
+        cached = evictionQueue.insert(fileHandle.getFileIndex(), pageIdx);
+    } catch (...) {
+        cached = false;
+    }
+    if (!cached) {
+        releaseFrameForPage(fileHandle, pageIdx);
+        freeUsedMemory(fileHandle.getPageSize());
+        pageState->resetToEvicted();
+        return false;
+    }
+    return true;
+}
+
+bool BufferManager::prefetchPage(FileHandle& fileHandle, page_idx_t pageIdx,
+    uint64_t pageRemovalVersion) {
+    auto pageState = fileHandle.getPageState(pageIdx);
+    const auto currStateAndVersion = pageState->getStateAndVersion();
+    if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+        !pageState->tryLock(currStateAndVersion)) {
+        return true;
+    }
+    if (!cacheLockedPage(fileHandle, pageIdx, nullptr /* data */)) {
+        return true;
+    }
+    // Removing a page from the buffer pool waits for its lock, so a removal we don't see here
+    // evicts the page after we unlock it. A removal we see may belong to a page that is freed and
+    // later rewritten without going through the buffer pool, so the page is dropped.
+    if (fileHandle.getPageRemovalVersion() != pageRemovalVersion) {
+        releaseFrameForPage(fileHandle, pageIdx);
+        freeUsedMemory(fileHandle.getPageSize());
+        pageState->resetToEvicted();
+        return false;
+    }
+    pageState->setPrefetched();
+    // Only sequential scans request prefetches.
+    if (evictionPolicy == EvictionPolicy::SCAN_RESISTANT) {
+        pageState->unlockAsMarked();
+    } else {
+        pageState->unlock();
+    }
+    numPrefetchedPages++;
+    return true;
+}
+
+page_idx_t BufferManager::warmPages(FileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages, uint8_t* buffer, uint64_t pageRemovalVersion) {
+    // Pages stay locked while they are read, as when a page is pinned, so that a concurrent write
+    // can't be overwritten by the older version on disk.
+    std::vector<bool> locked(numPages, false);
+    page_idx_t numLocked = 0;
+    for (auto i = 0u; i < numPages; i++) {
+        auto pageState = fileHandle.getPageState(startPageIdx + i);
+        const auto currStateAndVersion = pageState->getStateAndVersion();
+        if (PageState::getState(currStateAndVersion) == PageState::EVICTED &&
+            pageState->tryLock(currStateAndVersion)) {
+            locked[i] = true;
+            numLocked++;
+        }
+    }
+    if (numLocked == 0) {
+        return 0;
+    }
+    const auto pageSize = fileHandle.getPageSize();
+    bool read = true;
+    try {
+        fileHandle.getFileInfo()->readFromFile(buffer, numPages * pageSize,
+            startPageIdx * pageSize);
+    } catch (...) {
+        read = false;
+    }
+    // As for prefetches, pages may have been read before they were freed and rewritten.
+    if (fileHandle.getPageRemovalVersion() != pageRemovalVersion) {
+        read = false;
+    }
+    page_idx_t numCached = 0;
+    for (auto i = 0u; i < numPages; i++) {
+        if (!locked[i]) {
+            continue;
+        }
+        const auto pageIdx = startPageIdx + i;
+        if (!read) {
+            fileHandle.getPageState(pageIdx)->resetToEvicted();
+            continue;
+        }
+        if (cacheLockedPage(fileHandle, pageIdx, buffer + i * pageSize)) {
+            fileHandle.getPageState(pageIdx)->unlock();
+            numCached++;
+        }
+    }
+    numWarmedPages += numCached;
+    return numCached;
+}
+
 void BufferManager::unpin(FileHandle& fileHandle, page_idx_t pageIdx) {
     auto pageState = fileHandle.getPageState(pageIdx);
     pageState->unlock();
@@ -296,6 +440,24 @@ uint64_t BufferManager::evictPages() {
     return claimedMemory;
 }
 
+std::vector<const FileHandle*> BufferManager::getFileHandles() const {
+    std::vector<const FileHandle*> result;
+    result.reserve(fileHandles.size());
+    for (const auto& fileHandle : fileHandles) {
+        result.push_back(fileHandle.get());
+    }
+    return result;
+}
+
+bool BufferManager::usesHugePages(PageSizeClass pageSizeClass) const {
+#if BM_MALLOC
+    KU_UNUSED(pageSizeClass);
+    return false;
+#else
+    return vmRegions[pageSizeClass]->usesHugePages();
+#endif
+}
+
 void BufferManager::removeEvictedCandidates() {
     auto startCursor = evictionQueue.getEvictionCursor();
     while (evictionQueue.getEvictionCursor() - startCursor < evictionQueue.getCapacity()) {
@@ -378,6 +540,11 @@ bool BufferManager::reserve(uint64_t sizeToReserve) {
             }
         }
         if (memoryClaimed == 0 && needMoreMemory()) {
+            // Decompressed chunks can be recreated from their pages, so they are dropped before
+            // giving up.
+            if (decompressedPageCache->evict(sizeToReserve) > 0) {
+                continue;
+            }
             if (failedCount++ < 2) {
                 // If we failed to find any memory to free, try waiting briefly for other threads to
                 // stop using memory
@@ -400,6 +567,16 @@ bool BufferManager::reserve(uint64_t sizeToReserve) {
     return true;
 }
 
+uint64_t BufferManager::spillNextGroup(const MemoryTracker& owner) {
+    if (!spiller) {
+        return 0;
+    }
+    const auto [memoryFreed, memoryNowEvictable] = spiller->claimNextGroup(&owner);
+    freeUsedMemory(memoryFreed);
+    nonEvictableMemory -= memoryFreed + memoryNowEvictable;
+    return memoryFreed + memoryNowEvictable;
+}
+
 uint64_t BufferManager::tryEvictPage(std::atomic<EvictionCandidate>& _candidate) {
     auto candidate = _candidate.load();
     // Page must have been evicted by another thread already
@@ -474,6 +651,9 @@ void BufferManager::updateFrameIfPageIsInFrameWithoutLock(file_idx_t fileIdx,
 }
 
 void BufferManager::removePageFromFrameIfNecessary(FileHandle& fileHandle, page_idx_t pageIdx) {
+    // Incremented before the page is removed, see prefetchPage().
+    fileHandle.pageRemovalVersion++;
+    decompressedPageCache->invalidate(fileHandle.getFileIndex(), pageIdx);
     if (pageIdx >= fileHandle.getNumPages()) {
         return;
     }
@@ -0,0 +1,265 @@
+#include "storage/buffer_manager/buffer_pool_warmer.h"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+
+#include "common/constants.h"
+#include "common/file_system/virtual_file_system.h"
+#include "common/serializer/buffered_file.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "function/hash/hash_functions.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/page_prefetcher.h"
+#include "storage/file_handle.h"
+#include "storage/page_manager.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+BufferPoolWarmer::BufferPoolWarmer(BufferManager& bm, FileHandle& dataFH, VirtualFileSystem* vfs,
+    std::string warmupFilePath, uint64_t recordIntervalInMS, bool readOnly)
+    : bm{bm}, dataFH{dataFH}, vfs{vfs}, warmupFilePath{std::move(warmupFilePath)},
+      recordIntervalInMS{recordIntervalInMS}, readOnly{readOnly},
+      numPagesAtOpen{dataFH.getNumPages()},
+      pageRemovalVersionAtOpen{dataFH.getPageRemovalVersion()}, stopped{false},
+      restoreDone{false}, restoreInterrupted{false} {
+    const auto pageManager = dataFH.getPageManager();
+    freePageRangesAtOpen = pageManager->getFreeEntries(0, pageManager->getNumFreeEntries());
+    std::sort(freePageRangesAtOpen.begin(), freePageRangesAtOpen.end(),
+        [](const auto& a, const auto& b) { return a.startPageIdx < b.startPageIdx; });
+}
+
+BufferPoolWarmer::~BufferPoolWarmer() {
+    {
+        std::unique_lock lck{mtx};
+        stopped = true;
+    }
+    stopRequested.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+    if (restoreDone && !restoreInterrupted) {
+        record();
+    }
+}
+
+void BufferPoolWarmer::start() {
+#ifdef __SINGLE_THREADED__
+    restore();
+#else
+    worker = std::thread([this]() { run(); });
+#endif
+}
+
+void BufferPoolWarmer::waitForRestore() {
+    std::unique_lock lck{mtx};
+    restoreFinished.wait(lck, [&]() { return restoreDone; });
+}
+
+void BufferPoolWarmer::record() {
+    if (readOnly) {
+        return;
+    }
+    const auto ranges = getCachedPageRanges();
+    std::vector<page_idx_t> startPageIdxes, numPages;
+    for (const auto& range : ranges) {
+        startPageIdxes.push_back(range.startPageIdx);
+        numPages.push_back(range.numPages);
+    }
+    // A crash while writing leaves a recording that fails its checksum, which is then ignored.
+    // Recording is only a hint, so failures are ignored as well.
+    try {
+        auto fileInfo = vfs->openFile(warmupFilePath,
+            FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS));
+        auto writer = std::make_shared<BufferedFileWriter>(*fileInfo);
+        Serializer serializer(writer);
+        serializer.write<uint64_t>(FILE_MAGIC);
+        serializer.write<uint64_t>(FILE_VERSION);
+        serializer.serializeVector(startPageIdxes);
+        serializer.serializeVector(numPages);
+        serializer.write<uint64_t>(computeChecksum(startPageIdxes, numPages));
+        writer->flush();
+        writer->sync();
+    } catch (...) {} // NOLINT
+}
+
+uint64_t BufferPoolWarmer::computeChecksum(const std::vector<page_idx_t>& startPageIdxes,
+    const std::vector<page_idx_t>& numPages) {
+    auto checksum = function::murmurhash64(startPageIdxes.size());
+    for (auto i = 0u; i < startPageIdxes.size(); i++) {
+        checksum = function::combineHashScalar(checksum, function::murmurhash64(startPageIdxes[i]));
+        checksum = function::combineHashScalar(checksum, function::murmurhash64(numPages[i]));
+    }
+    return checksum;
+}
+
+std::vector<PageRange> BufferPoolWarmer::getCachedPageRanges() {
+    std::vector<PageRange> ranges;
+    const auto numPages = dataFH.getNumPages();
+    for (page_idx_t pageIdx = 0; pageIdx < numPages; pageIdx++) {
+        if (dataFH.getPageState(pageIdx)->getState() == PageState::EVICTED) {
+            continue;
+        }
+        if (!ranges.empty() &&
+            ranges.back().startPageIdx + ranges.back().numPages == pageIdx) {
+            ranges.back().numPages++;
+        } else {
+            ranges.push_back(PageRange{pageIdx, 1});
+        }
+    }
+    return ranges;
+}
+
+std::vector<PageRange> BufferPoolWarmer::readPageRanges() const {
+    std::vector<PageRange> ranges;
+    if (!vfs->fileOrPathExists(warmupFilePath)) {
+        return ranges;
+    }
+    // A side file that can't be read, e.g. one written by another version or torn by a crash, is
+    // ignored.
+    try {
+        auto fileInfo = vfs->openFile(warmupFilePath, FileOpenFlags(FileFlags::READ_ONLY));
+        Deserializer deserializer(std::make_unique<BufferedFileReader>(*fileInfo));
+        uint64_t magic = 0, version = 0;
+        deserializer.deserializeValue(magic);
+        deserializer.deserializeValue(version);
+        if (magic != FILE_MAGIC || version != FILE_VERSION) {
+            return ranges;
+        }
+        std::vector<page_idx_t> startPageIdxes, numPages;
+        deserializer.deserializeVector(startPageIdxes);
+        deserializer.deserializeVector(numPages);
+        uint64_t checksum = 0;
+        deserializer.deserializeValue(checksum);
+        if (startPageIdxes.size() != numPages.size() ||
+            checksum != computeChecksum(startPageIdxes, numPages)) {
+            return ranges;
+        }
+        for (auto i = 0u; i < startPageIdxes.size(); i++) {
+            ranges.push_back(PageRange{startPageIdxes[i], numPages[i]});
+        }
+    } catch (...) {
+        ranges.clear();
+    }
+    // Ranges are recorded in order, but sorting keeps the reads sequential for any input.
+    std::sort(ranges.begin(), ranges.end(),
+        [](const auto& a, const auto& b) { return a.startPageIdx < b.startPageIdx; });
+    return ranges;
+}
+
+std::vector<PageRange> BufferPoolWarmer::removePagesNotInUseAtOpen(
+    const std::vector<PageRange>& ranges) const {
+    std::vector<PageRange> result;
+    for (const auto& range : ranges) {
+        auto startPageIdx = range.startPageIdx;
+        const auto endPageIdx =
+            std::min<page_idx_t>(range.startPageIdx + range.numPages, numPagesAtOpen);
+        // The first free range that ends after the start of the range.
+        auto freeRange = std::lower_bound(freePageRangesAtOpen.begin(),
+            freePageRangesAtOpen.end(), startPageIdx, [](const PageRange& a, page_idx_t pageIdx) {
+                return a.startPageIdx + a.numPages <= pageIdx;
+            });
+        while (startPageIdx < endPageIdx) {
+            const auto usedEndPageIdx = freeRange == freePageRangesAtOpen.end() ?
+                                            endPageIdx :
+                                            std::min(endPageIdx, freeRange->startPageIdx);
+            if (startPageIdx < usedEndPageIdx) {
+                result.push_back(PageRange{startPageIdx, usedEndPageIdx - startPageIdx});
+            }
+            if (usedEndPageIdx == endPageIdx) {
+                break;
+            }
+            startPageIdx = freeRange->startPageIdx + freeRange->numPages;
+            ++freeRange;
+        }
+    }
+    return result;
+}
+
+void BufferPoolWarmer::restore() {
+    // Time waited before trying again to load pages while loading is paused.
+    static constexpr auto PAUSE_RETRY_INTERVAL = std::chrono::milliseconds(10);
+    const auto ranges = removePagesNotInUseAtOpen(readPageRanges());
+    const auto pageSize = dataFH.getPageSize();
+    const auto maxUsedMemory =
+        static_cast<uint64_t>(bm.getMemoryLimit() * MAX_BUFFER_POOL_USAGE_RATIO);
+    // The staging buffer is aligned, so that reads bypass the page cache if direct I/O is enabled.
+    constexpr std::align_val_t alignment{BufferPoolConstants::DIRECT_IO_ALIGNMENT};
+    const auto buffer = std::unique_ptr<uint8_t[], void (*)(uint8_t*)>(
+        static_cast<uint8_t*>(::operator new[](MAX_NUM_PAGES_PER_READ * pageSize, alignment)),
+        [](uint8_t* ptr) { ::operator delete[](ptr, alignment); });
+    const auto startTime = std::chrono::steady_clock::now();
+    uint64_t numBytesRead = 0;
+    const auto interrupt = [&]() {
+        std::unique_lock lck{mtx};
+        restoreInterrupted = true;
+    };
+    // Returns false once restoring should stop.
+    const auto restoreRange = [&](const PageRange& range) {
+        // The data file may have shrunk since the pages were recorded.
+        const auto numPagesInFile = dataFH.getNumPages();
+        if (range.startPageIdx >= numPagesInFile) {
+            return true;
+        }
+        const auto endPageIdx =
+            range.startPageIdx + std::min(range.numPages, numPagesInFile - range.startPageIdx);
+        for (auto pageIdx = range.startPageIdx; pageIdx < endPageIdx;
+             pageIdx += MAX_NUM_PAGES_PER_READ) {
+            const auto numPagesToRead = std::min(MAX_NUM_PAGES_PER_READ, endPageIdx - pageIdx);
+            if (bm.getUsedMemory() + numPagesToRead * pageSize > maxUsedMemory ||
+                dataFH.getPageRemovalVersion() != pageRemovalVersionAtOpen) {
+                return false;
+            }
+            // Checkpoints pause prefetching while they write pages in place.
+            while (!bm.getPrefetcher().runUnlessPaused([&]() {
+                bm.warmPages(dataFH, pageIdx, numPagesToRead, buffer.get(),
+                    pageRemovalVersionAtOpen);
+            })) {
+                if (!sleepFor(PAUSE_RETRY_INTERVAL)) {
+                    interrupt();
+                    return false;
+                }
+            }
+            numBytesRead += numPagesToRead * pageSize;
+            // Sleep until the average read rate is back under the limit.
+            const auto expectedElapsed =
+                std::chrono::microseconds(numBytesRead * 1000000 / MAX_RESTORE_BYTES_PER_SEC);
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - startTime);
+            if (!sleepFor(std::max(expectedElapsed - elapsed, std::chrono::microseconds(0)))) {
+                interrupt();
+                return false;
+            }
+        }
+        return true;
+    };
+    for (const auto& range : ranges) {
+        if (!restoreRange(range)) {
+            break;
+        }
+    }
+    {
+        std::unique_lock lck{mtx};
+        restoreDone = true;
+    }
+    restoreFinished.notify_all();
+}
+
+void BufferPoolWarmer::run() {
+    restore();
+    while (sleepFor(std::chrono::milliseconds(recordIntervalInMS))) {
+        record();
+    }
+}
+
+bool BufferPoolWarmer::sleepFor(std::chrono::microseconds duration) {
+    std::unique_lock lck{mtx};
+    return !stopRequested.wait_for(lck, duration, [&]() { return stopped; });
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,110 @@
+#include "storage/buffer_manager/decompressed_page_cache.h"
+
+#include "common/constants.h"
+#include "common/exception/buffer_manager.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/file_handle.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+std::shared_ptr<const uint8_t[]> DecompressedPageCache::getPages(FileHandle& fileHandle,
+    PageRange pageRange, const BlockCompressionMetadata& metadata) {
+    KU_ASSERT(metadata.isCompressed());
+    const auto key = getKey(fileHandle.getFileIndex(), pageRange.startPageIdx);
+    {
+        std::unique_lock lck{mtx};
+        if (const auto it = entries.find(key); it != entries.end()) {
+            lruList.splice(lruList.begin(), lruList, it->second);
+            return it->second->pages;
+        }
+    }
+    // Decompress without holding the lock, since reserving memory may evict entries.
+    const auto size = static_cast<uint64_t>(metadata.numDecompressedPages) * KUZU_PAGE_SIZE;
+    if (!bm.reserve(size)) {
+        throw BufferManagerException(
+            "Unable to allocate memory! The buffer pool is full and no memory could be freed!");
+    }
+    bm.nonEvictableMemory += size;
+    uint8_t* data = nullptr;
+    try {
+        data = new uint8_t[size];
+    } catch (...) {
+        releaseMemory(size);
+        throw;
+    }
+    memoryUsage += size;
+    // The memory is released once the last reader drops the pages, even if the entry was evicted
+    // or invalidated before.
+    std::shared_ptr<uint8_t[]> pages(data, [this, size](const uint8_t* data) {
+        delete[] data;
+        memoryUsage -= size;
+        releaseMemory(size);
+    });
+    const auto compressed =
+        BlockCompression::readPages(fileHandle, pageRange, metadata.compressedSize);
+    BlockCompression::decompress(metadata, compressed, std::span(pages.get(), size));
+
+    std::unique_lock lck{mtx};
+    if (const auto it = entries.find(key); it != entries.end()) {
+        // Another thread has decompressed the same chunk in the meantime.
+        return it->second->pages;
+    }
+    lruList.push_front(Entry{key, size, pages});
+    entries.emplace(key, lruList.begin());
+    numEntries++;
+    const auto capacity = bm.getMemoryLimit() / CAPACITY_RATIO;
+    if (memoryUsage > capacity) {
+        evictNoLock(memoryUsage - capacity);
+    }
+    return pages;
+}
+
+void DecompressedPageCache::invalidate(file_idx_t fileIdx, page_idx_t pageIdx) {
+    if (numEntries == 0) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    const auto it = entries.find(getKey(fileIdx, pageIdx));
+    if (it == entries.end()) {
+        return;
+    }
+    numEntries--;
+    lruList.erase(it->second);
+    entries.erase(it);
+}
+
+uint64_t DecompressedPageCache::evict(uint64_t sizeToEvict) {
+    if (numEntries == 0) {
+        return 0;
+    }
+    std::unique_lock lck{mtx};
+    return evictNoLock(sizeToEvict);
+}
+
+uint64_t DecompressedPageCache::evictNoLock(uint64_t sizeToEvict) {
+    uint64_t evictedSize = 0;
+    while (evictedSize < sizeToEvict && !lruList.empty()) {
+        const auto& entry = lruList.back();
+        // Readers only copy the pages under the lock, so an entry nobody else holds is freed when
+        // it is dropped. Readers still holding the pages keep them alive until they are done, so
+        // their memory isn't freed yet.
+        if (entry.pages.use_count() == 1) {
+            evictedSize += entry.size;
+        }
+        numEntries--;
+        entries.erase(entry.key);
+        lruList.pop_back();
+    }
+    return evictedSize;
+}
+
+void DecompressedPageCache::releaseMemory(uint64_t size) {
+    bm.freeUsedMemory(size);
+    bm.nonEvictableMemory -= size;
+}
+
+} // namespace storage
+} // namespace kuzu
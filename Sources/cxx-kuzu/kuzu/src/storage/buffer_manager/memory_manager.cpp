@@ -1,11 +1,14 @@
 #include "storage/buffer_manager/memory_manager.h"
 
+#include <bit>
+#include <cstring>
 #include <mutex>
 
 #include "common/exception/buffer_manager.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/types/types.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_tracker.h"
 #include "storage/file_handle.h"
 
 using namespace kuzu::common;
@@ -19,20 +22,26 @@ MemoryBuffer::MemoryBuffer(MemoryManager* mm, page_idx_t pageIdx, uint8_t* buffe
 MemoryBuffer::~MemoryBuffer() {
     if (buffer.data() != nullptr && !evicted) {
         mm->freeBlock(pageIdx, buffer);
-        mm->updateUsedMemoryForFreedBlock(pageIdx, buffer);
+        if (tracker != nullptr) {
+            tracker->release(MemoryManager::getAllocationSize(buffer.size()));
+        }
         buffer = std::span<uint8_t>();
     }
 }
 
 SpillResult MemoryBuffer::setSpilledToDisk(uint64_t filePosition) {
-    mm->freeBlock(pageIdx, buffer);
+    mm->freeBlockUncached(pageIdx, buffer);
     // reinterpret_cast isn't allowed here, but we shouldn't leave the invalid pointer and
     // still want to store the size
     buffer = std::span(static_cast<uint8_t*>(nullptr), buffer.size());
     evicted = true;
     this->filePosition = filePosition;
+    const auto allocationSize = MemoryManager::getAllocationSize(buffer.size());
+    if (tracker != nullptr) {
+        tracker->release(allocationSize);
+    }
     if (pageIdx == INVALID_PAGE_IDX) {
-        return SpillResult{buffer.size(), 0};
+        return SpillResult{allocationSize, 0};
     } else {
         return SpillResult{0, buffer.size()};
     }
@@ -42,43 +51,196 @@ void MemoryBuffer::prepareLoadFromDisk() {
     KU_ASSERT(buffer.data() == nullptr && evicted);
     buffer = mm->mallocBuffer(false, buffer.size());
     evicted = false;
+    if (tracker != nullptr) {
+        tracker->forceReserve(MemoryManager::getAllocationSize(buffer.size()));
+    }
 }
 
-MemoryManager::MemoryManager(BufferManager* bm, VirtualFileSystem* vfs) : bm{bm} {
+MemoryManager::MemoryManager(BufferManager* bm, VirtualFileSystem* vfs)
+    : bm{bm}, numPageAllocations{0}, numPageCacheHits{0}, numGlobalPoolRefills{0},
+      numGlobalPoolReturns{0}, numSmallAllocations{0}, numSmallAllocationCacheHits{0},
+      numLockContentions{0} {
     pageSize = TEMP_PAGE_SIZE;
     fh = bm->getFileHandle("mm-256KB", FileHandle::O_IN_MEM_TEMP_FILE, vfs, nullptr);
 }
 
-std::span<uint8_t> MemoryManager::mallocBuffer(bool initializeToZero, uint64_t size) {
-    if (!bm->reserve(size)) {
+MemoryManager::~MemoryManager() {
+    for (auto& slot : cacheSlots) {
+        for (auto& blocks : slot.freeBlocks) {
+            for (const auto block : blocks) {
+                std::free(block);
+            }
+        }
+    }
+}
+
+// Returns the size class of a malloc'd block, or NUM_SIZE_CLASSES if the block is too large to be
+// cached.
+static uint64_t getSizeClass(uint64_t size) {
+    const auto sizeLog2 = std::max<uint64_t>(std::bit_width(std::bit_ceil(size)) - 1,
+        MemoryManager::MIN_SIZE_CLASS_LOG2);
+    if (sizeLog2 > MemoryManager::MAX_SIZE_CLASS_LOG2) {
+        return MemoryManager::NUM_SIZE_CLASSES;
+    }
+    return sizeLog2 - MemoryManager::MIN_SIZE_CLASS_LOG2;
+}
+
+static uint64_t getSizeClassSize(uint64_t sizeClass) {
+    return static_cast<uint64_t>(1) << (sizeClass + MemoryManager::MIN_SIZE_CLASS_LOG2);
+}
+
+uint64_t MemoryManager::getAllocationSize(uint64_t size) {
+    const auto sizeClass = getSizeClass(size);
+    return sizeClass == NUM_SIZE_CLASSES ? size : getSizeClassSize(sizeClass);
+}
+
+MemoryManager::CacheSlot& MemoryManager::getCacheSlot() {
+    // Threads are assigned slots round-robin. The assignment is shared by all memory managers.
+    static std::atomic<uint64_t> nextSlotIdx{0};
+    thread_local const uint64_t slotIdx = nextSlotIdx.fetch_add(1, std::memory_order_relaxed);
+    return cacheSlots[slotIdx % NUM_CACHE_SLOTS];
+}
+
+std::unique_lock<std::mutex> MemoryManager::lockAllocator() {
+    std::unique_lock lock{allocatorLock, std::try_to_lock};
+    if (!lock.owns_lock()) {
+        numLockContentions.fetch_add(1, std::memory_order_relaxed);
+        lock.lock();
+    }
+    return lock;
+}
+
+void MemoryManager::reserveMemory(uint64_t size) {
+    // Cached blocks are counted as used memory, so they are freed before giving up.
+    if (!bm->reserve(size) && (freeCachedBlocks() == 0 || !bm->reserve(size))) {
         throw BufferManagerException(
             "Unable to allocate memory! The buffer pool is full and no memory could be freed!");
     }
-    void* buffer = nullptr;
     bm->nonEvictableMemory += size;
+}
+
+uint64_t MemoryManager::freeCachedBlocks() {
+    uint64_t numFreedBytes = 0;
+    for (auto& slot : cacheSlots) {
+        std::unique_lock lock{slot.mtx};
+        for (auto& blocks : slot.freeBlocks) {
+            for (const auto block : blocks) {
+                std::free(block);
+            }
+            blocks.clear();
+        }
+        numFreedBytes += slot.numCachedBytes;
+        slot.numCachedBytes = 0;
+    }
+    bm->freeUsedMemory(numFreedBytes);
+    bm->nonEvictableMemory -= numFreedBytes;
+    return numFreedBytes;
+}
+
+std::span<uint8_t> MemoryManager::mallocBuffer(bool initializeToZero, uint64_t size) {
+    const auto sizeClass = getSizeClass(size);
+    if (sizeClass == NUM_SIZE_CLASSES) {
+        reserveMemory(size);
+        void* buffer = nullptr;
+        if (initializeToZero) {
+            buffer = calloc(size, 1);
+        } else {
+            buffer = malloc(size);
+        }
+        return std::span(static_cast<uint8_t*>(buffer), size);
+    }
+    numSmallAllocations.fetch_add(1, std::memory_order_relaxed);
+    uint8_t* buffer = nullptr;
+    {
+        auto& slot = getCacheSlot();
+        std::unique_lock lock{slot.mtx};
+        auto& blocks = slot.freeBlocks[sizeClass];
+        if (!blocks.empty()) {
+            buffer = blocks.back();
+            blocks.pop_back();
+            slot.numCachedBytes -= getSizeClassSize(sizeClass);
+        }
+    }
+    // A cached block is still counted as used memory, so only new blocks are reserved.
+    if (buffer != nullptr) {
+        numSmallAllocationCacheHits.fetch_add(1, std::memory_order_relaxed);
+        if (initializeToZero) {
+            memset(buffer, 0, size);
+        }
+        return std::span(buffer, size);
+    }
+    reserveMemory(getSizeClassSize(sizeClass));
     if (initializeToZero) {
-        buffer = calloc(size, 1);
+        buffer = static_cast<uint8_t*>(calloc(getSizeClassSize(sizeClass), 1));
+    } else {
+        buffer = static_cast<uint8_t*>(malloc(getSizeClassSize(sizeClass)));
+    }
+    return std::span(buffer, size);
+}
+
+page_idx_t MemoryManager::allocatePage() {
+    numPageAllocations.fetch_add(1, std::memory_order_relaxed);
+    auto& slot = getCacheSlot();
+    std::unique_lock slotLock{slot.mtx};
+    if (slot.freePages.empty()) {
+        auto lock = lockAllocator();
+        if (freePages.empty()) {
+            return fh->addNewPage();
+        }
+        numGlobalPoolRefills.fetch_add(1, std::memory_order_relaxed);
+        while (!freePages.empty() && slot.freePages.size() < PAGE_CACHE_BATCH_SIZE) {
+            slot.freePages.push_back(freePages.top());
+            freePages.pop();
+        }
     } else {
-        buffer = malloc(size);
+        numPageCacheHits.fetch_add(1, std::memory_order_relaxed);
+    }
+    const auto pageIdx = slot.freePages.back();
+    slot.freePages.pop_back();
+    return pageIdx;
+}
+
+void MemoryManager::freePage(page_idx_t pageIdx) {
+    auto& slot = getCacheSlot();
+    std::unique_lock slotLock{slot.mtx};
+    slot.freePages.push_back(pageIdx);
+    if (slot.freePages.size() < 2 * PAGE_CACHE_BATCH_SIZE) {
+        return;
+    }
+    numGlobalPoolReturns.fetch_add(1, std::memory_order_relaxed);
+    auto lock = lockAllocator();
+    for (auto i = 0u; i < PAGE_CACHE_BATCH_SIZE; i++) {
+        freePages.push(slot.freePages.back());
+        slot.freePages.pop_back();
     }
-    return std::span(static_cast<uint8_t*>(buffer), size);
 }
 
 std::unique_ptr<MemoryBuffer> MemoryManager::allocateBuffer(bool initializeToZero, uint64_t size) {
+    auto tracker = MemoryTracker::getCurrent();
+    if (tracker == nullptr) {
+        return allocateUntrackedBuffer(initializeToZero, size);
+    }
+    // Small allocations take a whole size class block, so that is what they are charged.
+    const auto allocationSize = getAllocationSize(size);
+    tracker->reserve(allocationSize, *bm);
+    std::unique_ptr<MemoryBuffer> memoryBuffer;
+    try {
+        memoryBuffer = allocateUntrackedBuffer(initializeToZero, size);
+    } catch (...) {
+        tracker->release(allocationSize);
+        throw;
+    }
+    memoryBuffer->tracker = std::move(tracker);
+    return memoryBuffer;
+}
+
+std::unique_ptr<MemoryBuffer> MemoryManager::allocateUntrackedBuffer(bool initializeToZero,
+    uint64_t size) {
     if (size != TEMP_PAGE_SIZE) [[unlikely]] {
         auto buffer = mallocBuffer(initializeToZero, size);
         return std::make_unique<MemoryBuffer>(this, INVALID_PAGE_IDX, buffer.data(), size);
     }
-    page_idx_t pageIdx = INVALID_PAGE_IDX;
-    {
-        std::scoped_lock<std::mutex> lock(allocatorLock);
-        if (freePages.empty()) {
-            pageIdx = fh->addNewPage();
-        } else {
-            pageIdx = freePages.top();
-            freePages.pop();
-        }
-    }
+    const auto pageIdx = allocatePage();
     auto buffer = bm->pin(*fh, pageIdx, PageReadPolicy::DONT_READ_PAGE);
     auto memoryBuffer = std::make_unique<MemoryBuffer>(this, pageIdx, buffer);
     if (initializeToZero) {
@@ -88,22 +250,45 @@ std::unique_ptr<MemoryBuffer> MemoryManager::allocateBuffer(bool initializeToZer
 }
 
 void MemoryManager::freeBlock(page_idx_t pageIdx, std::span<uint8_t> buffer) {
-    if (pageIdx == INVALID_PAGE_IDX) {
-        std::free(buffer.data());
-    } else {
+    if (pageIdx != INVALID_PAGE_IDX) {
         bm->unpin(*fh, pageIdx);
+        freePage(pageIdx);
+        return;
+    }
+    const auto sizeClass = getSizeClass(buffer.size());
+    if (sizeClass != NUM_SIZE_CLASSES) {
+        const auto sizeClassSize = getSizeClassSize(sizeClass);
+        auto& slot = getCacheSlot();
+        std::unique_lock lock{slot.mtx};
+        if (slot.numCachedBytes + sizeClassSize <= MAX_CACHED_BYTES_PER_SLOT) {
+            slot.freeBlocks[sizeClass].push_back(buffer.data());
+            slot.numCachedBytes += sizeClassSize;
+            return;
+        }
     }
+    std::free(buffer.data());
+    const auto allocationSize = getAllocationSize(buffer.size());
+    bm->freeUsedMemory(allocationSize);
+    bm->nonEvictableMemory -= allocationSize;
 }
 
-void MemoryManager::updateUsedMemoryForFreedBlock(page_idx_t pageIdx, std::span<uint8_t> buffer) {
-    if (pageIdx == INVALID_PAGE_IDX) {
-        bm->freeUsedMemory(buffer.size());
-        bm->nonEvictableMemory -= buffer.size();
+void MemoryManager::freeBlockUncached(page_idx_t pageIdx, std::span<uint8_t> buffer) {
+    if (pageIdx != INVALID_PAGE_IDX) {
+        bm->unpin(*fh, pageIdx);
     } else {
-        std::unique_lock<std::mutex> lock(allocatorLock);
-        freePages.push(pageIdx);
+        std::free(buffer.data());
     }
 }
 
+MemoryManager::Stats MemoryManager::getStats() const {
+    return Stats{numPageAllocations.load(std::memory_order_relaxed),
+        numPageCacheHits.load(std::memory_order_relaxed),
+        numGlobalPoolRefills.load(std::memory_order_relaxed),
+        numGlobalPoolReturns.load(std::memory_order_relaxed),
+        numSmallAllocations.load(std::memory_order_relaxed),
+        numSmallAllocationCacheHits.load(std::memory_order_relaxed),
+        numLockContentions.load(std::memory_order_relaxed)};
+}
+
 } // namespace storage
 } // namespace kuzu
@@ -0,0 +1,123 @@
+#include "storage/buffer_manager/memory_tracker.h"
+
+#include <algorithm>
+
+#include "common/exception/buffer_manager.h"
+#include "common/string_format.h"
+#include "storage/buffer_manager/buffer_manager.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+static thread_local std::shared_ptr<MemoryTracker> currentTracker;
+
+MemoryTracker::Scope::Scope(std::shared_ptr<MemoryTracker> tracker)
+    : prevTracker{std::move(currentTracker)} {
+    currentTracker = std::move(tracker);
+}
+
+MemoryTracker::Scope::~Scope() {
+    currentTracker = std::move(prevTracker);
+}
+
+MemoryTracker::MemoryTracker(std::string name, uint64_t limit, MemoryLimitPolicy policy,
+    uint64_t maxWaitTimeInMS, std::shared_ptr<MemoryTracker> parent)
+    : name{std::move(name)}, limit{limit}, policy{policy}, maxWaitTimeInMS{maxWaitTimeInMS},
+      parent{std::move(parent)}, usedMemory{0}, peakMemory{0}, numWaiters{0} {}
+
+std::shared_ptr<MemoryTracker> MemoryTracker::getCurrent() {
+    return currentTracker;
+}
+
+MemoryTracker* MemoryTracker::tryReserve(uint64_t size) {
+    for (auto tracker = this; tracker != nullptr; tracker = tracker->parent.get()) {
+        const auto used = tracker->usedMemory.fetch_add(size) + size;
+        const auto trackerLimit = tracker->limit.load();
+        if (trackerLimit != 0 && used > trackerLimit) {
+            for (auto reserved = this;; reserved = reserved->parent.get()) {
+                reserved->usedMemory.fetch_sub(size);
+                if (reserved == tracker) {
+                    break;
+                }
+            }
+            return tracker;
+        }
+        tracker->updatePeakMemory(used);
+    }
+    return nullptr;
+}
+
+void MemoryTracker::updatePeakMemory(uint64_t used) {
+    auto peak = peakMemory.load();
+    while (used > peak && !peakMemory.compare_exchange_weak(peak, used)) {}
+}
+
+void MemoryTracker::reserve(uint64_t size, BufferManager& bm) {
+    auto exceededTracker = tryReserve(size);
+    if (exceededTracker == nullptr) {
+        return;
+    }
+    switch (policy) {
+    case MemoryLimitPolicy::SPILL: {
+        // Spilled chunks release their memory from the trackers they were charged to. Only the
+        // query's own chunks are spilled, so that it doesn't push the data of other queries out.
+        while (exceededTracker != nullptr && bm.spillNextGroup(*this) > 0) {
+            exceededTracker = tryReserve(size);
+        }
+    } break;
+    case MemoryLimitPolicy::WAIT: {
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(maxWaitTimeInMS);
+        // The query doesn't release its own memory while it waits, so waiting only helps if the
+        // allocation fits once all other memory counted against the exceeded limit is released.
+        while (exceededTracker != nullptr &&
+               usedMemory.load() + size <= exceededTracker->limit.load() &&
+               exceededTracker->waitForRelease(deadline)) {
+            exceededTracker = tryReserve(size);
+        }
+    } break;
+    default:
+        break;
+    }
+    if (exceededTracker != nullptr) {
+        throw BufferManagerException(stringFormat(
+            "Unable to allocate memory! The {} memory limit of {} bytes is exceeded.",
+            exceededTracker->name, exceededTracker->limit.load()));
+    }
+}
+
+void MemoryTracker::forceReserve(uint64_t size) {
+    for (auto tracker = this; tracker != nullptr; tracker = tracker->parent.get()) {
+        tracker->updatePeakMemory(tracker->usedMemory.fetch_add(size) + size);
+    }
+}
+
+void MemoryTracker::release(uint64_t size) {
+    for (auto tracker = this; tracker != nullptr; tracker = tracker->parent.get()) {
+        tracker->usedMemory.fetch_sub(size);
+        if (tracker->numWaiters > 0) {
+            std::unique_lock lck{tracker->mtx};
+            tracker->memoryReleased.notify_all();
+        }
+    }
+}
+
+bool MemoryTracker::waitForRelease(std::chrono::steady_clock::time_point deadline) {
+    // Memory released between the failed reservation and the wait doesn't notify, so the wait is
+    // bounded to retry the reservation regularly.
+    static constexpr auto MAX_WAIT_INTERVAL = std::chrono::milliseconds(10);
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) {
+        return false;
+    }
+    std::unique_lock lck{mtx};
+    numWaiters++;
+    memoryReleased.wait_until(lck, std::min(deadline, now + MAX_WAIT_INTERVAL));
+    numWaiters--;
+    return true;
+}
+
+} // namespace storage
+} // namespace kuzu
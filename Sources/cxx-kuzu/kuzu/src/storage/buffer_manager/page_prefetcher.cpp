@@ -0,0 +1,124 @@
+#include "storage/buffer_manager/page_prefetcher.h"
+
+#include <algorithm>
+
+#include "common/assert.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/file_handle.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+PagePrefetcher::~PagePrefetcher() {
+    stop();
+}
+
+void PagePrefetcher::stop() {
+    {
+        std::unique_lock lck{mtx};
+        stopped = true;
+        requests.clear();
+    }
+    hasRequests.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+void PagePrefetcher::pause() {
+    std::unique_lock lck{mtx};
+    numPauses++;
+    requests.clear();
+    isIdle.wait(lck, [&]() { return numActiveWorkers == 0; });
+}
+
+void PagePrefetcher::resume() {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(numPauses > 0);
+    numPauses--;
+}
+
+void PagePrefetcher::prefetch(FileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+#ifdef __SINGLE_THREADED__
+    KU_UNUSED(fileHandle);
+    KU_UNUSED(startPageIdx);
+    KU_UNUSED(numPages);
+#else
+    {
+        std::unique_lock lck{mtx};
+        if (stopped || numPauses > 0 || requests.size() >= MAX_NUM_PENDING_REQUESTS) {
+            return;
+        }
+        if (workers.empty()) {
+            for (auto i = 0u; i < NUM_THREADS; i++) {
+                workers.emplace_back([this]() { runWorker(); });
+            }
+        }
+        requests.push_back(
+            Request{&fileHandle, startPageIdx, numPages, fileHandle.getPageRemovalVersion()});
+    }
+    hasRequests.notify_one();
+#endif
+}
+
+bool PagePrefetcher::runUnlessPaused(const std::function<void()>& load) {
+    {
+        std::unique_lock lck{mtx};
+        if (stopped || numPauses > 0) {
+            return false;
+        }
+        numActiveWorkers++;
+    }
+    const auto finishLoad = [&]() {
+        std::unique_lock lck{mtx};
+        numActiveWorkers--;
+        if (numActiveWorkers == 0) {
+            isIdle.notify_all();
+        }
+    };
+    try {
+        load();
+    } catch (...) {
+        finishLoad();
+        throw;
+    }
+    finishLoad();
+    return true;
+}
+
+void PagePrefetcher::runWorker() {
+    while (true) {
+        Request request{};
+        {
+            std::unique_lock lck{mtx};
+            hasRequests.wait(lck, [&]() { return stopped || !requests.empty(); });
+            if (stopped) {
+                return;
+            }
+            request = requests.front();
+            requests.pop_front();
+            numActiveWorkers++;
+        }
+        const auto endPageIdx = std::min(request.startPageIdx + request.numPages,
+            request.fileHandle->getNumPages());
+        for (auto pageIdx = request.startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+            if (!bm.prefetchPage(*request.fileHandle, pageIdx, request.pageRemovalVersion)) {
+                break;
+            }
+        }
+        {
+            std::unique_lock lck{mtx};
+            numActiveWorkers--;
+            if (numActiveWorkers == 0) {
+                isIdle.notify_all();
+            }
+        }
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -1,5 +1,6 @@
 #include "storage/buffer_manager/spiller.h"
 
+#include <algorithm>
 #include <mutex>
 
 #include "common/assert.h"
@@ -8,6 +9,7 @@
 #include "common/types/types.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/memory_tracker.h"
 #include "storage/file_handle.h"
 #include "storage/table/chunked_node_group.h"
 #include "storage/table/column_chunk_data.h"
@@ -45,8 +47,11 @@ FileHandle* Spiller::getDataFH() const {
 }
 
 void Spiller::addUnusedChunk(ChunkedNodeGroup* nodeGroup) {
+    // The group is filled on a thread working on the query, so its memory is charged to the
+    // current tracker.
+    const auto tracker = MemoryTracker::getCurrent();
     std::unique_lock lock(partitionerGroupsMtx);
-    fullPartitionerGroups.insert(nodeGroup);
+    fullPartitionerGroups.emplace(nodeGroup, tracker.get());
 }
 
 void Spiller::clearUnusedChunk(ChunkedNodeGroup* nodeGroup) {
@@ -87,13 +92,18 @@ void Spiller::loadFromDisk(ColumnChunkData& chunk) const {
     }
 }
 
-SpillResult Spiller::claimNextGroup() {
+SpillResult Spiller::claimNextGroup(const MemoryTracker* owner) {
     ChunkedNodeGroup* groupToFlush = nullptr;
     {
         std::unique_lock lock(partitionerGroupsMtx);
-        if (!fullPartitionerGroups.empty()) {
-            auto groupToFlushEntry = fullPartitionerGroups.begin();
-            groupToFlush = *groupToFlushEntry;
+        auto groupToFlushEntry = fullPartitionerGroups.begin();
+        if (owner != nullptr) {
+            groupToFlushEntry =
+                std::find_if(fullPartitionerGroups.begin(), fullPartitionerGroups.end(),
+                    [&](const auto& entry) { return entry.second == owner; });
+        }
+        if (groupToFlushEntry != fullPartitionerGroups.end()) {
+            groupToFlush = groupToFlushEntry->first;
             fullPartitionerGroups.erase(groupToFlushEntry);
         }
     }
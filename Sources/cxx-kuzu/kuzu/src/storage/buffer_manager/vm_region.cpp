@@ -1,5 +1,8 @@
 #include "storage/buffer_manager/vm_region.h"
 
+#include <algorithm>
+
+#include "common/assert.h"
 #include "common/string_format.h"
 #include "common/system_config.h"
 #include "common/system_message.h"
@@ -12,6 +15,14 @@
 #include <sys/mman.h>
 #endif
 
+#ifdef __linux__
+#include <filesystem>
+
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include "common/exception/buffer_manager.h"
 
 using namespace kuzu::common;
@@ -19,7 +30,29 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 
-VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize) : numFrameGroups{0} {
+// Returns the IDs of the online NUMA nodes, or nothing if the machine has a single node.
+static std::vector<uint32_t> getNumaNodeIDs() {
+    std::vector<uint32_t> nodeIDs;
+#ifdef __linux__
+    std::error_code errorCode;
+    for (const auto& entry :
+        std::filesystem::directory_iterator("/sys/devices/system/node", errorCode)) {
+        const auto name = entry.path().filename().string();
+        if (name.size() > 4 && name.starts_with("node") &&
+            name.find_first_not_of("0123456789", 4) == std::string::npos) {
+            nodeIDs.push_back(std::stoul(name.substr(4)));
+        }
+    }
+#endif
+    if (nodeIDs.size() <= 1) {
+        return {};
+    }
+    std::sort(nodeIDs.begin(), nodeIDs.end());
+    return nodeIDs;
+}
+
+VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize, VMRegionConfig config)
+    : hugePagesEnabled{false}, numFrameGroups{0} {
     if (maxRegionSize > static_cast<std::size_t>(-1)) {
         throw BufferManagerException("maxRegionSize is beyond the max available mmap region size.");
     }
@@ -27,20 +60,37 @@ VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize) : numFra
     const auto numBytesForFrameGroup = frameSize * StorageConstants::PAGE_GROUP_SIZE;
     maxNumFrameGroups = (maxRegionSize + numBytesForFrameGroup - 1) / numBytesForFrameGroup;
 #ifdef _WIN32
+    KU_UNUSED(config);
     region = (uint8_t*)VirtualAlloc(NULL, getMaxRegionSize(), MEM_RESERVE, PAGE_READWRITE);
     if (region == NULL) {
         throw BufferManagerException(stringFormat(
             "VirtualAlloc for size {} failed with error code {}: {}.", getMaxRegionSize(),
             GetLastError(), std::system_category().message(GetLastError())));
     }
+    mappedRegion = region;
+    mappedSize = getMaxRegionSize();
 #else
+    // Reserve an extra huge page so that the region can start at a huge page boundary.
+    mappedSize = getMaxRegionSize() + (config.useHugePages ? HUGE_PAGE_SIZE : 0);
     // Create a private anonymous mapping. The mapping is not shared with other processes and not
     // backed by any file, and its content are initialized to zero.
-    region = static_cast<uint8_t*>(mmap(NULL, getMaxRegionSize(), PROT_READ | PROT_WRITE,
+    mappedRegion = static_cast<uint8_t*>(mmap(NULL, mappedSize, PROT_READ | PROT_WRITE,
         MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1 /* fd */, 0 /* offset */));
-    if (region == MAP_FAILED) {
-        throw BufferManagerException(
-            "Mmap for size " + std::to_string(getMaxRegionSize()) + " failed.");
+    if (mappedRegion == MAP_FAILED) {
+        throw BufferManagerException("Mmap for size " + std::to_string(mappedSize) + " failed.");
+    }
+    region = mappedRegion;
+    if (config.useHugePages) {
+        const auto address = reinterpret_cast<uintptr_t>(mappedRegion);
+        region += (HUGE_PAGE_SIZE - address % HUGE_PAGE_SIZE) % HUGE_PAGE_SIZE;
+#ifdef MADV_HUGEPAGE
+        // The kernel rejects the advice if transparent huge pages are not supported, in which
+        // case the region stays backed by regular pages.
+        hugePagesEnabled = madvise(region, getMaxRegionSize(), MADV_HUGEPAGE) == 0;
+#endif
+    }
+    if (config.bindToNumaNodes) {
+        numaNodeIDs = getNumaNodeIDs();
     }
 #endif
 }
@@ -49,7 +99,23 @@ VMRegion::~VMRegion() {
 #ifdef _WIN32
     VirtualFree(region, 0, MEM_RELEASE);
 #else
-    munmap(region, getMaxRegionSize());
+    munmap(mappedRegion, mappedSize);
+#endif
+}
+
+void VMRegion::bindFrameGroupToNumaNode(frame_group_idx_t frameGroupIdx) const {
+#ifdef __linux__
+    static constexpr uint64_t NUM_BITS_PER_MASK_WORD = sizeof(unsigned long) * 8;
+    const auto nodeID = numaNodeIDs[frameGroupIdx % numaNodeIDs.size()];
+    std::vector<unsigned long> nodeMask(nodeID / NUM_BITS_PER_MASK_WORD + 1, 0);
+    nodeMask[nodeID / NUM_BITS_PER_MASK_WORD] |= 1ul << (nodeID % NUM_BITS_PER_MASK_WORD);
+    const auto frameGroupSize = frameSize * StorageConstants::PAGE_GROUP_SIZE;
+    // The binding is a preference: memory still comes from other nodes when the node is full. It
+    // is only a hint, so failures are ignored.
+    syscall(SYS_mbind, region + frameGroupIdx * frameGroupSize, frameGroupSize, MPOL_PREFERRED,
+        nodeMask.data(), nodeMask.size() * NUM_BITS_PER_MASK_WORD + 1, 0 /* flags */);
+#else
+    KU_UNUSED(frameGroupIdx);
 #endif
 }
 
@@ -84,6 +150,9 @@ frame_group_idx_t VMRegion::addNewFrameGroup() {
         throw BufferManagerException("No more frame groups can be added to the allocator.");
         // LCOV_EXCL_STOP
     }
+    if (!numaNodeIDs.empty()) {
+        bindFrameGroupToNumaNode(numFrameGroups);
+    }
     return numFrameGroups++;
 }
 
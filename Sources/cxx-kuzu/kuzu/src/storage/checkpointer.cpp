@@ -7,9 +7,11 @@
 #include "common/serializer/buffered_file.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/in_mem_file_writer.h"
+#include "common/timer.h"
 #include "extension/extension_manager.h"
 #include "main/db_config.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/page_prefetcher.h"
 #include "storage/shadow_utils.h"
 #include "storage/storage_manager.h"
 #include "storage/storage_version_info.h"
@@ -99,14 +101,29 @@ void Checkpointer::writeCheckpoint() {
     if (isInMemory) {
         return;
     }
+    std::vector<CheckpointPhaseTime> phaseTimes;
+    common::Timer timer;
+    timer.start();
+    const auto finishPhase = [&](std::string phase) {
+        timer.stop();
+        phaseTimes.push_back({std::move(phase), timer.getDuration() / 1000});
+        timer.start();
+    };
 
+    // Pages are freed, reused and rewritten in place during checkpoint without going through the
+    // buffer pool, so neither prefetches nor the buffer pool warmer may read them in the meantime.
+    PagePrefetcher::PauseScope pausePrefetches{
+        clientContext.getMemoryManager()->getBufferManager()->getPrefetcher()};
     auto databaseHeader = getCurrentDatabaseHeader();
     // Checkpoint storage. Note that we first checkpoint storage before serializing the catalog, as
     // checkpointing storage may overwrite columnIDs in the catalog.
     bool hasStorageChanges = checkpointStorage();
+    finishPhase("storage");
     serializeCatalogAndMetadata(databaseHeader, hasStorageChanges);
     writeDatabaseHeader(databaseHeader);
+    finishPhase("catalog_and_metadata");
     logCheckpointAndApplyShadowPages();
+    finishPhase("shadow_pages");
 
     // This function will evict all pages that were freed during this checkpoint
     // It must be called before we remove all evicted candidates from the BM
@@ -125,6 +142,8 @@ void Checkpointer::writeCheckpoint() {
     dataFH->getPageManager()->resetVersion();
     storageManager->getWAL().reset();
     storageManager->getShadowFile().reset();
+    finishPhase("finalize");
+    storageManager->setLastCheckpointPhaseTimes(std::move(phaseTimes));
 }
 
 bool Checkpointer::checkpointStorage() {
@@ -141,14 +160,14 @@ void Checkpointer::serializeCatalogAndMetadata(DatabaseHeader& databaseHeader,
 
     // Serialize the catalog if there are changes
     if (databaseHeader.catalogPageRange.startPageIdx == common::INVALID_PAGE_IDX ||
-        catalog->changedSinceLastCheckpoint()) {
+        catalog->changedSinceLastCheckpoint() || storageManager->isCompacting()) {
         databaseHeader.updateCatalogPageRange(*dataFH->getPageManager(),
             serializeCatalog(*catalog, *storageManager));
     }
     // Serialize the storage metadata if there are changes
     if (databaseHeader.metadataPageRange.startPageIdx == common::INVALID_PAGE_IDX ||
         hasStorageChanges || catalog->changedSinceLastCheckpoint() ||
-        dataFH->getPageManager()->changedSinceLastCheckpoint()) {
+        storageManager->isCompacting() || dataFH->getPageManager()->changedSinceLastCheckpoint()) {
         // We must free the existing metadata page range before serializing
         // So that the freed pages are serialized by the FSM
         databaseHeader.freeMetadataPageRange(*dataFH->getPageManager());
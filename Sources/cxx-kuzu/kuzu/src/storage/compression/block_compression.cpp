@@ -0,0 +1,117 @@
+#include "storage/compression/block_compression.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/constants.h"
+#include "common/exception/storage.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "lz4.hpp"
+#include "storage/file_handle.h"
+#include "zstd.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+void BlockCompressionMetadata::serialize(Serializer& serializer) const {
+    serializer.write(type);
+    serializer.write(compressedSize);
+    serializer.write(numDecompressedPages);
+}
+
+BlockCompressionMetadata BlockCompressionMetadata::deserialize(Deserializer& deserializer) {
+    BlockCompressionMetadata metadata;
+    deserializer.deserializeValue(metadata.type);
+    deserializer.deserializeValue(metadata.compressedSize);
+    deserializer.deserializeValue(metadata.numDecompressedPages);
+    return metadata;
+}
+
+std::vector<uint8_t> BlockCompression::compress(BlockCompressionType type,
+    std::span<const uint8_t> data) {
+    std::vector<uint8_t> result;
+    switch (type) {
+    case BlockCompressionType::ZSTD: {
+        result.resize(kuzu_zstd::ZSTD_compressBound(data.size()));
+        const auto compressedSize = kuzu_zstd::ZSTD_compress(result.data(), result.size(),
+            data.data(), data.size(), ZSTD_CLEVEL_DEFAULT);
+        if (kuzu_zstd::ZSTD_isError(compressedSize)) {
+            return {};
+        }
+        result.resize(compressedSize);
+    } break;
+    case BlockCompressionType::LZ4: {
+        result.resize(kuzu_lz4::LZ4_compressBound(data.size()));
+        const auto compressedSize =
+            kuzu_lz4::LZ4_compress_default(reinterpret_cast<const char*>(data.data()),
+                reinterpret_cast<char*>(result.data()), data.size(), result.size());
+        if (compressedSize <= 0) {
+            return {};
+        }
+        result.resize(compressedSize);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    return result;
+}
+
+void BlockCompression::decompress(const BlockCompressionMetadata& metadata,
+    std::span<const uint8_t> src, std::span<uint8_t> dst) {
+    KU_ASSERT(src.size() >= metadata.compressedSize);
+    switch (metadata.type) {
+    case BlockCompressionType::ZSTD: {
+        const auto res =
+            kuzu_zstd::ZSTD_decompress(dst.data(), dst.size(), src.data(), metadata.compressedSize);
+        // LCOV_EXCL_START
+        if (kuzu_zstd::ZSTD_isError(res) || res != dst.size()) {
+            throw StorageException("ZSTD decompression of a column chunk failed.");
+        }
+        // LCOV_EXCL_STOP
+    } break;
+    case BlockCompressionType::LZ4: {
+        const auto res = kuzu_lz4::LZ4_decompress_safe(reinterpret_cast<const char*>(src.data()),
+            reinterpret_cast<char*>(dst.data()), metadata.compressedSize, dst.size());
+        // LCOV_EXCL_START
+        if (res < 0 || static_cast<uint64_t>(res) != dst.size()) {
+            throw StorageException("LZ4 decompression of a column chunk failed.");
+        }
+        // LCOV_EXCL_STOP
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+std::vector<uint8_t> BlockCompression::readPages(FileHandle& fileHandle, PageRange pageRange,
+    uint64_t numBytes) {
+    KU_ASSERT(numBytes <= static_cast<uint64_t>(pageRange.numPages) * KUZU_PAGE_SIZE);
+    std::vector<uint8_t> result(numBytes);
+    for (auto i = 0u; i < pageRange.numPages; i++) {
+        const auto offset = static_cast<uint64_t>(i) * KUZU_PAGE_SIZE;
+        fileHandle.optimisticReadPage(pageRange.startPageIdx + i, [&](const uint8_t* frame) {
+            std::memcpy(result.data() + offset, frame,
+                std::min<uint64_t>(KUZU_PAGE_SIZE, numBytes - offset));
+        });
+    }
+    return result;
+}
+
+std::vector<uint8_t> BlockCompression::readDecompressedPages(FileHandle& fileHandle,
+    PageRange pageRange, const BlockCompressionMetadata& metadata) {
+    if (!metadata.isCompressed()) {
+        return readPages(fileHandle, pageRange,
+            static_cast<uint64_t>(pageRange.numPages) * KUZU_PAGE_SIZE);
+    }
+    const auto compressed = readPages(fileHandle, pageRange, metadata.compressedSize);
+    std::vector<uint8_t> result(static_cast<uint64_t>(metadata.numDecompressedPages) *
+                                KUZU_PAGE_SIZE);
+    decompress(metadata, compressed, result);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
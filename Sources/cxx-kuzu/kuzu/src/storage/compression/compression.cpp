@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "common/assert.h"
 #include "common/exception/not_implemented.h"
@@ -19,6 +20,7 @@
 #include "storage/compression/bitpacking_int128.h"
 #include "storage/compression/bitpacking_utils.h"
 #include "storage/compression/float_compression.h"
+#include "storage/compression/fsst.h"
 #include "storage/compression/sign_extend.h"
 #include "storage/storage_utils.h"
 #include "storage/table/column_chunk_data.h"
@@ -108,6 +110,33 @@ std::unique_ptr<ExtraMetadata> ALPMetadata::copy() {
     return std::make_unique<ALPMetadata>(*this);
 }
 
+void RLEMetadata::serialize(common::Serializer& serializer) const {
+    serializer.write(numValuesPerPage);
+}
+
+RLEMetadata RLEMetadata::deserialize(common::Deserializer& deserializer) {
+    RLEMetadata ret;
+    deserializer.deserializeValue(ret.numValuesPerPage);
+    return ret;
+}
+
+std::unique_ptr<ExtraMetadata> RLEMetadata::copy() {
+    return std::make_unique<RLEMetadata>(*this);
+}
+
+void FSSTMetadata::serialize(common::Serializer& serializer) const {
+    symbolTable->serialize(serializer);
+}
+
+FSSTMetadata FSSTMetadata::deserialize(common::Deserializer& deserializer) {
+    return FSSTMetadata(
+        std::make_shared<const FSSTSymbolTable>(FSSTSymbolTable::deserialize(deserializer)));
+}
+
+std::unique_ptr<ExtraMetadata> FSSTMetadata::copy() {
+    return std::make_unique<FSSTMetadata>(*this);
+}
+
 CompressionMetadata::CompressionMetadata(StorageValue min, StorageValue max,
     CompressionType compression, const alp::state& state, StorageValue minEncoded,
     StorageValue maxEncoded, common::PhysicalTypeID physicalType)
@@ -154,6 +183,10 @@ void CompressionMetadata::serialize(Serializer& serializer) const {
 
     if (compression == CompressionType::ALP) {
         floatMetadata()->serialize(serializer);
+    } else if (compression == CompressionType::RLE) {
+        rleMetadata()->serialize(serializer);
+    } else if (compression == CompressionType::FSST) {
+        fsstMetadata()->serialize(serializer);
     }
 
     KU_ASSERT(children.size() == getChildCount(compression));
@@ -175,6 +208,11 @@ CompressionMetadata CompressionMetadata::deserialize(common::Deserializer& deser
     if (compressionType == CompressionType::ALP) {
         auto alpMetadata = std::make_unique<ALPMetadata>(ALPMetadata::deserialize(deserializer));
         ret.extraMetadata = std::move(alpMetadata);
+    } else if (compressionType == CompressionType::RLE) {
+        ret.extraMetadata = std::make_unique<RLEMetadata>(RLEMetadata::deserialize(deserializer));
+    } else if (compressionType == CompressionType::FSST) {
+        ret.extraMetadata =
+            std::make_unique<FSSTMetadata>(FSSTMetadata::deserialize(deserializer));
     }
 
     for (size_t i = 0; i < getChildCount(compressionType); ++i) {
@@ -187,12 +225,15 @@ CompressionMetadata CompressionMetadata::deserialize(common::Deserializer& deser
 bool CompressionMetadata::canAlwaysUpdateInPlace() const {
     switch (compression) {
     case CompressionType::BOOLEAN_BITPACKING:
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return true;
     }
     case CompressionType::CONSTANT:
     case CompressionType::ALP:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RLE: {
         return false;
     }
     default: {
@@ -280,6 +321,12 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos, ui
                 return false;
             });
     }
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RLE: {
+        // Changing a single value would shift all following deltas or split a run, so the chunk
+        // is always rewritten out of place.
+        return false;
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -296,7 +343,8 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
     case CompressionType::CONSTANT: {
         return std::numeric_limits<uint64_t>::max();
     }
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return Uncompressed::numValues(pageSize, dataType);
     }
     case CompressionType::INTEGER_BITPACKING: {
@@ -349,6 +397,25 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
+    case CompressionType::DELTA_BITPACKING: {
+        return TypeUtils::visit(
+            dataType,
+            [&](internalID_t) {
+                return IntegerDeltaBitpacking<uint64_t>::numValues(pageSize, *this);
+            },
+            [&]<IntegerEncodingType T>(
+                T) { return IntegerDeltaBitpacking<T>::numValues(pageSize, *this); },
+            [&](auto) -> uint64_t {
+                throw common::StorageException(
+                    "Attempted to read from a column chunk which uses delta bitpacking but does "
+                    "not have a supported integer physical type: " +
+                    PhysicalTypeUtils::toString(dataType));
+            });
+    }
+    case CompressionType::RLE: {
+        KU_ASSERT(pageSize == KUZU_PAGE_SIZE);
+        return rleMetadata()->numValuesPerPage;
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -358,7 +425,8 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
 
 size_t CompressionMetadata::getChildCount(CompressionType compressionType) {
     switch (compressionType) {
-    case CompressionType::ALP: {
+    case CompressionType::ALP:
+    case CompressionType::DELTA_BITPACKING: {
         return 1;
     }
     default: {
@@ -462,6 +530,23 @@ std::string CompressionMetadata::toString(const PhysicalTypeID physicalType) con
             [](auto) -> uint8_t { KU_UNREACHABLE; });
         return stringFormat("INTEGER_BITPACKING[{}]", bitWidth);
     }
+    case CompressionType::DELTA_BITPACKING: {
+        uint8_t bitWidth = TypeUtils::visit(
+            physicalType,
+            [&](common::internalID_t) {
+                return IntegerBitpacking<uint64_t>::getPackingInfo(getChild(0)).bitWidth;
+            },
+            [&]<IntegerEncodingType T>(
+                T) { return IntegerBitpacking<T>::getPackingInfo(getChild(0)).bitWidth; },
+            [](auto) -> uint8_t { KU_UNREACHABLE; });
+        return stringFormat("DELTA_BITPACKING[{}]", bitWidth);
+    }
+    case CompressionType::RLE: {
+        return stringFormat("RLE[{}]", rleMetadata()->numValuesPerPage);
+    }
+    case CompressionType::FSST: {
+        return stringFormat("FSST[{}]", fsstMetadata()->symbolTable->getNumSymbols());
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return "BOOLEAN_BITPACKING";
     }
@@ -739,6 +824,16 @@ uint64_t IntegerBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
         return Uncompressed(sizeof(T)).compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
             dstBufferSize, metadata);
     }
+    if constexpr (IntegerEncodingType<T>) {
+        if (metadata.compression == CompressionType::DELTA_BITPACKING) {
+            return IntegerDeltaBitpacking<T>().compressNextPage(srcBuffer, numValuesRemaining,
+                dstBuffer, dstBufferSize, metadata);
+        }
+        if (metadata.compression == CompressionType::RLE) {
+            return RunLengthEncoding<T>().compressNextPage(srcBuffer, numValuesRemaining,
+                dstBuffer, dstBufferSize, metadata);
+        }
+    }
     KU_ASSERT(metadata.compression == CompressionType::INTEGER_BITPACKING);
     auto info = getPackingInfo(metadata);
     auto bitWidth = info.bitWidth;
@@ -842,6 +937,214 @@ template class IntegerBitpacking<uint16_t>;
 template class IntegerBitpacking<uint32_t>;
 template class IntegerBitpacking<uint64_t>;
 
+// Wraps around on overflow, which is undone when the deltas are summed up again
+template<IntegerEncodingType T>
+static T getDelta(T value, T previousValue) {
+    using U = numeric_utils::MakeUnSignedT<T>;
+    return static_cast<T>(static_cast<U>(value) - static_cast<U>(previousValue));
+}
+
+template<IntegerEncodingType T>
+std::optional<CompressionMetadata> IntegerDeltaBitpacking<T>::analyze(std::span<const T> values,
+    StorageValue min, StorageValue max) {
+    // The first delta of each page is 0, so 0 is always in the range of deltas
+    T minDelta = 0, maxDelta = 0;
+    for (auto i = 1u; i < values.size(); i++) {
+        const auto delta = getDelta(values[i], values[i - 1]);
+        minDelta = std::min(minDelta, delta);
+        maxDelta = std::max(maxDelta, delta);
+    }
+    auto deltaMetadata = CompressionMetadata(StorageValue(minDelta), StorageValue(maxDelta),
+        CompressionType::INTEGER_BITPACKING);
+    const auto bitWidth = IntegerBitpacking<T>::getPackingInfo(deltaMetadata).bitWidth;
+    if (bitWidth == 0 || bitWidth >= sizeof(T) * 8) {
+        return std::nullopt;
+    }
+    auto metadata = CompressionMetadata(min, max, CompressionType::DELTA_BITPACKING);
+    metadata.children.push_back(std::move(deltaMetadata));
+    return metadata;
+}
+
+template<IntegerEncodingType T>
+uint64_t IntegerDeltaBitpacking<T>::numValues(uint64_t dataSize,
+    const CompressionMetadata& metadata) {
+    return IntegerBitpacking<T>::numValues(dataSize - HEADER_SIZE,
+        metadata.getChild(DELTA_CHILD_IDX));
+}
+
+template<IntegerEncodingType T>
+void IntegerDeltaBitpacking<T>::setValuesFromUncompressed(const uint8_t*, offset_t, uint8_t*,
+    offset_t, offset_t, const CompressionMetadata&, const NullMask*) const {
+    // canUpdateInPlace always returns false for delta bitpacked chunks
+    KU_UNREACHABLE;
+}
+
+template<IntegerEncodingType T>
+uint64_t IntegerDeltaBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const CompressionMetadata& metadata) const {
+    KU_ASSERT(metadata.compression == CompressionType::DELTA_BITPACKING);
+    const auto numValuesToCompress =
+        std::min(numValuesRemaining, numValues(dstBufferSize, metadata));
+    KU_ASSERT(numValuesToCompress > 0);
+    const auto* values = reinterpret_cast<const T*>(srcBuffer);
+    std::memcpy(dstBuffer, values, sizeof(T));
+    std::vector<T> deltas(numValuesToCompress, 0);
+    for (auto i = 1u; i < numValuesToCompress; i++) {
+        deltas[i] = getDelta(values[i], values[i - 1]);
+    }
+    const auto* deltaCursor = reinterpret_cast<const uint8_t*>(deltas.data());
+    const auto packedSize = IntegerBitpacking<T>().compressNextPage(deltaCursor,
+        numValuesToCompress, dstBuffer + HEADER_SIZE, dstBufferSize - HEADER_SIZE,
+        metadata.getChild(DELTA_CHILD_IDX));
+    srcBuffer += numValuesToCompress * sizeof(T);
+    return HEADER_SIZE + packedSize;
+}
+
+template<IntegerEncodingType T>
+void IntegerDeltaBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    static constexpr auto CHUNK_SIZE = IntegerBitpacking<T>::CHUNK_SIZE;
+    const auto& deltaMetadata = metadata.getChild(DELTA_CHILD_IDX);
+    const IntegerBitpacking<T> deltaBitpacking;
+    T firstValue{};
+    std::memcpy(&firstValue, srcBuffer, sizeof(T));
+    auto value = static_cast<U>(firstValue);
+    auto* dst = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+    const auto endOffset = srcOffset + numValues;
+    // Deltas are unpacked one bitpacking chunk at a time and summed up directly into the result
+    T deltas[CHUNK_SIZE];
+    for (uint64_t chunkStart = 0; chunkStart < endOffset; chunkStart += CHUNK_SIZE) {
+        const auto numDeltas = std::min(CHUNK_SIZE, endOffset - chunkStart);
+        deltaBitpacking.decompressFromPage(srcBuffer + HEADER_SIZE, chunkStart,
+            reinterpret_cast<uint8_t*>(deltas), 0, numDeltas, deltaMetadata);
+        for (auto i = 0u; i < numDeltas; i++) {
+            value += static_cast<U>(deltas[i]);
+            if (chunkStart + i >= srcOffset) {
+                dst[chunkStart + i - srcOffset] = static_cast<T>(value);
+            }
+        }
+    }
+}
+
+template class IntegerDeltaBitpacking<int8_t>;
+template class IntegerDeltaBitpacking<int16_t>;
+template class IntegerDeltaBitpacking<int32_t>;
+template class IntegerDeltaBitpacking<int64_t>;
+template class IntegerDeltaBitpacking<uint8_t>;
+template class IntegerDeltaBitpacking<uint16_t>;
+template class IntegerDeltaBitpacking<uint32_t>;
+template class IntegerDeltaBitpacking<uint64_t>;
+
+template<typename T>
+static bool runsFitInPages(std::span<const T> values, uint64_t numValuesPerPage,
+    uint64_t maxNumRunsPerPage) {
+    for (uint64_t pageStart = 0; pageStart < values.size(); pageStart += numValuesPerPage) {
+        const auto pageEnd = std::min<uint64_t>(values.size(), pageStart + numValuesPerPage);
+        uint64_t numRuns = 1;
+        for (auto i = pageStart + 1; i < pageEnd; i++) {
+            numRuns += values[i] != values[i - 1];
+        }
+        if (numRuns > maxNumRunsPerPage) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<IntegerEncodingType T>
+std::optional<CompressionMetadata> RunLengthEncoding<T>::analyze(std::span<const T> values,
+    StorageValue min, StorageValue max) {
+    if (values.empty()) {
+        return std::nullopt;
+    }
+    uint64_t numRuns = 1;
+    for (auto i = 1u; i < values.size(); i++) {
+        numRuns += values[i] != values[i - 1];
+    }
+    if (numRuns * MIN_AVERAGE_RUN_LENGTH > values.size()) {
+        return std::nullopt;
+    }
+    // Start with the number of values whose runs fit in a page on average, and halve it until the
+    // runs of every page fit. A page can always hold as many values as it can hold runs.
+    const auto maxNumRunsPerPage = getMaxNumRunsPerPage(KUZU_PAGE_SIZE);
+    auto numValuesPerPage =
+        std::min<uint64_t>(values.size(), maxNumRunsPerPage * (values.size() / numRuns));
+    while (numValuesPerPage > maxNumRunsPerPage &&
+           !runsFitInPages(values, numValuesPerPage, maxNumRunsPerPage)) {
+        numValuesPerPage = std::max(maxNumRunsPerPage, numValuesPerPage / 2);
+    }
+    auto metadata = CompressionMetadata(min, max, CompressionType::RLE);
+    metadata.extraMetadata = std::make_unique<RLEMetadata>(numValuesPerPage);
+    return metadata;
+}
+
+template<IntegerEncodingType T>
+void RunLengthEncoding<T>::setValuesFromUncompressed(const uint8_t*, offset_t, uint8_t*, offset_t,
+    offset_t, const CompressionMetadata&, const NullMask*) const {
+    // canUpdateInPlace always returns false for run-length encoded chunks
+    KU_UNREACHABLE;
+}
+
+template<IntegerEncodingType T>
+uint64_t RunLengthEncoding<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const CompressionMetadata& metadata) const {
+    KU_ASSERT(metadata.compression == CompressionType::RLE);
+    KU_UNUSED(dstBufferSize);
+    const auto numValuesToCompress =
+        std::min(numValuesRemaining, metadata.rleMetadata()->numValuesPerPage);
+    const auto* values = reinterpret_cast<const T*>(srcBuffer);
+    // Run ends are written as the runs are found; the run values are appended after them once
+    // the number of runs is known.
+    auto* runEnds = reinterpret_cast<uint32_t*>(dstBuffer + sizeof(uint32_t));
+    std::vector<T> runValues;
+    for (auto i = 1u; i <= numValuesToCompress; i++) {
+        if (i == numValuesToCompress || values[i] != values[i - 1]) {
+            runEnds[runValues.size()] = i;
+            runValues.push_back(values[i - 1]);
+        }
+    }
+    const auto numRuns = static_cast<uint32_t>(runValues.size());
+    KU_ASSERT(numRuns <= getMaxNumRunsPerPage(dstBufferSize));
+    std::memcpy(dstBuffer, &numRuns, sizeof(uint32_t));
+    const auto runValuesOffset = sizeof(uint32_t) * (1 + numRuns);
+    std::memcpy(dstBuffer + runValuesOffset, runValues.data(), numRuns * sizeof(T));
+    srcBuffer += numValuesToCompress * sizeof(T);
+    return runValuesOffset + numRuns * sizeof(T);
+}
+
+template<IntegerEncodingType T>
+void RunLengthEncoding<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& /*metadata*/) const {
+    uint32_t numRuns = 0;
+    std::memcpy(&numRuns, srcBuffer, sizeof(uint32_t));
+    const auto* runEnds = reinterpret_cast<const uint32_t*>(srcBuffer + sizeof(uint32_t));
+    const auto* runValues = srcBuffer + sizeof(uint32_t) * (1 + numRuns);
+    auto* dst = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+    auto run = std::upper_bound(runEnds, runEnds + numRuns, srcOffset) - runEnds;
+    const auto endOffset = srcOffset + numValues;
+    for (auto pos = srcOffset; pos < endOffset; run++) {
+        KU_ASSERT(run < numRuns);
+        T value{};
+        std::memcpy(&value, runValues + run * sizeof(T), sizeof(T));
+        const auto runEnd = std::min<uint64_t>(runEnds[run], endOffset);
+        std::fill(dst + (pos - srcOffset), dst + (runEnd - srcOffset), value);
+        pos = runEnd;
+    }
+}
+
+template class RunLengthEncoding<int8_t>;
+template class RunLengthEncoding<int16_t>;
+template class RunLengthEncoding<int32_t>;
+template class RunLengthEncoding<int64_t>;
+template class RunLengthEncoding<uint8_t>;
+template class RunLengthEncoding<uint16_t>;
+template class RunLengthEncoding<uint32_t>;
+template class RunLengthEncoding<uint64_t>;
+
 void BooleanBitpacking::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
     uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
     const CompressionMetadata& /*metadata*/, const NullMask* /*nullMask*/) const {
@@ -878,6 +1181,38 @@ void BooleanBitpacking::copyFromPage(const uint8_t* srcBuffer, uint64_t srcOffse
         reinterpret_cast<uint64_t*>(dstBuffer), dstOffset, numValues);
 }
 
+template<IntegerEncodingType T>
+static void decompressEncodedIntegers(const uint8_t* frame, uint64_t srcOffset, uint8_t* dst,
+    uint64_t dstOffset, uint64_t numValues, const CompressionMetadata& metadata) {
+    if (metadata.compression == CompressionType::RLE) {
+        RunLengthEncoding<T>().decompressFromPage(frame, srcOffset, dst, dstOffset, numValues,
+            metadata);
+    } else {
+        KU_ASSERT(metadata.compression == CompressionType::DELTA_BITPACKING);
+        IntegerDeltaBitpacking<T>().decompressFromPage(frame, srcOffset, dst, dstOffset,
+            numValues, metadata);
+    }
+}
+
+static void decompressEncodedIntegers(PhysicalTypeID physicalType, const uint8_t* frame,
+    uint64_t srcOffset, uint8_t* dst, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) {
+    TypeUtils::visit(
+        physicalType,
+        [&](internalID_t) {
+            decompressEncodedIntegers<uint64_t>(frame, srcOffset, dst, dstOffset, numValues,
+                metadata);
+        },
+        [&]<IntegerEncodingType T>(T) {
+            decompressEncodedIntegers<T>(frame, srcOffset, dst, dstOffset, numValues, metadata);
+        },
+        [&](auto) {
+            throw NotImplementedException(
+                "DELTA_BITPACKING and RLE are not implemented for type " +
+                PhysicalTypeUtils::toString(physicalType));
+        });
+}
+
 void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, PageCursor& pageCursor,
     common::ValueVector* resultVector, uint32_t posInVector, uint64_t numValuesToRead,
     const CompressionMetadata& metadata) {
@@ -886,6 +1221,8 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         return constant.decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
             posInVector, numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    // FSST-encoded bytes are stored as they are and decoded by the dictionary
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -949,6 +1286,10 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RLE:
+        return decompressEncodedIntegers(physicalType, frame, pageCursor.elemPosInPage,
+            resultVector->getData(), posInVector, numValuesToRead, metadata);
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
@@ -965,6 +1306,7 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         return constant.copyFromPage(frame, pageCursor.elemPosInPage, result, startPosInResult,
             numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage, result,
             startPosInResult, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -1028,6 +1370,10 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RLE:
+        return decompressEncodedIntegers(physicalType, frame, pageCursor.elemPosInPage, result,
+            startPosInResult, numValuesToRead, metadata);
     case CompressionType::BOOLEAN_BITPACKING:
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(frame, pageCursor.elemPosInPage, result,
@@ -1045,6 +1391,7 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
         return constant.setValuesFromUncompressed(data, dataOffset, frame, posInFrame, numValues,
             metadata, nullMask);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.setValuesFromUncompressed(data, dataOffset, frame, posInFrame,
             numValues, metadata, nullMask);
     case CompressionType::INTEGER_BITPACKING: {
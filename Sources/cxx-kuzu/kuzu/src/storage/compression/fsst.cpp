@@ -0,0 +1,196 @@
+#include "storage/compression/fsst.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <unordered_map>
+
+#include "common/assert.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+namespace kuzu {
+namespace storage {
+
+// Number of rounds of encoding the sample and refining the symbol table.
+static constexpr uint64_t NUM_GENERATIONS = 5;
+// While building the table, escaped bytes are counted as pseudo codes following the symbol codes.
+static constexpr uint64_t NUM_PSEUDO_CODES = 512;
+static constexpr uint64_t BYTE_PSEUDO_CODE_START = 256;
+
+FSSTSymbolTable::FSSTSymbolTable(std::vector<FSSTSymbol> symbols) : symbols{std::move(symbols)} {
+    KU_ASSERT(this->symbols.size() <= MAX_NUM_SYMBOLS);
+    for (auto code = 0u; code < this->symbols.size(); code++) {
+        uint8_t firstByte = 0;
+        std::memcpy(&firstByte, &this->symbols[code].value, 1);
+        codesByFirstByte[firstByte].push_back(static_cast<uint8_t>(code));
+    }
+    for (auto& codes : codesByFirstByte) {
+        std::stable_sort(codes.begin(), codes.end(), [&](uint8_t a, uint8_t b) {
+            return this->symbols[a].length > this->symbols[b].length;
+        });
+    }
+}
+
+static FSSTSymbol concatSymbols(const FSSTSymbol& first, const FSSTSymbol& second) {
+    KU_ASSERT(first.length + second.length <= FSSTSymbolTable::MAX_SYMBOL_LENGTH);
+    uint8_t bytes[FSSTSymbolTable::MAX_SYMBOL_LENGTH]{};
+    std::memcpy(bytes, &first.value, first.length);
+    std::memcpy(bytes + first.length, &second.value, second.length);
+    FSSTSymbol result{0, static_cast<uint8_t>(first.length + second.length)};
+    std::memcpy(&result.value, bytes, result.length);
+    return result;
+}
+
+static FSSTSymbol byteSymbol(uint8_t byte) {
+    FSSTSymbol result{0, 1};
+    std::memcpy(&result.value, &byte, 1);
+    return result;
+}
+
+FSSTSymbolTable FSSTSymbolTable::build(std::span<const std::string_view> sample) {
+    FSSTSymbolTable table;
+    std::vector<uint64_t> counts(NUM_PSEUDO_CODES);
+    // Only pairs occurring in the sample are counted, so the map is sized to the sample instead of
+    // all NUM_PSEUDO_CODES^2 pairs.
+    std::unordered_map<uint64_t, uint64_t> pairCounts;
+    for (auto generation = 0u; generation < NUM_GENERATIONS; generation++) {
+        std::fill(counts.begin(), counts.end(), 0);
+        pairCounts.clear();
+        auto getSymbol = [&](uint64_t code) {
+            return code >= BYTE_PSEUDO_CODE_START ?
+                       byteSymbol(static_cast<uint8_t>(code - BYTE_PSEUDO_CODE_START)) :
+                       table.symbols[code];
+        };
+        // Encode the sample with the current table, counting how often each symbol and each
+        // pair of adjacent symbols is used.
+        for (const auto& value : sample) {
+            uint64_t pos = 0;
+            std::optional<uint64_t> prevCode;
+            while (pos < value.size()) {
+                uint64_t code = table.findLongestSymbol(value.substr(pos));
+                if (code == ESCAPE_CODE) {
+                    code = BYTE_PSEUDO_CODE_START + static_cast<uint8_t>(value[pos]);
+                }
+                counts[code]++;
+                if (prevCode.has_value()) {
+                    pairCounts[*prevCode * NUM_PSEUDO_CODES + code]++;
+                }
+                prevCode = code;
+                pos += getSymbol(code).length;
+            }
+        }
+        // The gain of a symbol is the number of bytes it covers in the sample. Concatenations of
+        // adjacent symbols become candidates for the next generation.
+        std::map<std::pair<uint64_t, uint8_t>, uint64_t> gains;
+        for (auto code = 0u; code < NUM_PSEUDO_CODES; code++) {
+            if (counts[code] == 0) {
+                continue;
+            }
+            const auto symbol = getSymbol(code);
+            gains[{symbol.value, symbol.length}] += counts[code] * symbol.length;
+        }
+        // Gains are summed into an ordered map, so the order of the pairs doesn't matter.
+        for (const auto& [pair, pairCount] : pairCounts) {
+            const auto symbol = getSymbol(pair / NUM_PSEUDO_CODES);
+            const auto nextSymbol = getSymbol(pair % NUM_PSEUDO_CODES);
+            if (symbol.length + nextSymbol.length > MAX_SYMBOL_LENGTH) {
+                continue;
+            }
+            const auto concat = concatSymbols(symbol, nextSymbol);
+            gains[{concat.value, concat.length}] += pairCount * concat.length;
+        }
+        std::vector<std::pair<uint64_t, FSSTSymbol>> candidates;
+        candidates.reserve(gains.size());
+        for (const auto& [symbol, gain] : gains) {
+            candidates.emplace_back(gain, FSSTSymbol{symbol.first, symbol.second});
+        }
+        // std::map iterates in a fixed order, so a stable sort keeps the result deterministic.
+        std::stable_sort(candidates.begin(), candidates.end(),
+            [](const auto& a, const auto& b) { return a.first > b.first; });
+        std::vector<FSSTSymbol> symbols;
+        for (auto i = 0u; i < std::min<uint64_t>(candidates.size(), MAX_NUM_SYMBOLS); i++) {
+            symbols.push_back(candidates[i].second);
+        }
+        table = FSSTSymbolTable(std::move(symbols));
+    }
+    return table;
+}
+
+uint8_t FSSTSymbolTable::findLongestSymbol(std::string_view value) const {
+    KU_ASSERT(!value.empty());
+    for (const auto code : codesByFirstByte[static_cast<uint8_t>(value[0])]) {
+        const auto& symbol = symbols[code];
+        if (symbol.length <= value.size() &&
+            std::memcmp(&symbol.value, value.data(), symbol.length) == 0) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+void FSSTSymbolTable::encode(std::string_view value, std::vector<uint8_t>& result) const {
+    uint64_t pos = 0;
+    while (pos < value.size()) {
+        const auto code = findLongestSymbol(value.substr(pos));
+        result.push_back(code);
+        if (code == ESCAPE_CODE) {
+            result.push_back(static_cast<uint8_t>(value[pos]));
+            pos++;
+        } else {
+            pos += symbols[code].length;
+        }
+    }
+}
+
+uint64_t FSSTSymbolTable::getDecodedLength(std::span<const uint8_t> encoded) const {
+    uint64_t length = 0;
+    for (auto i = 0u; i < encoded.size(); i++) {
+        if (encoded[i] == ESCAPE_CODE) {
+            length++;
+            i++;
+        } else {
+            KU_ASSERT(encoded[i] < symbols.size());
+            length += symbols[encoded[i]].length;
+        }
+    }
+    return length;
+}
+
+uint64_t FSSTSymbolTable::decode(std::span<const uint8_t> encoded, uint8_t* dst) const {
+    const auto start = dst;
+    for (auto i = 0u; i < encoded.size(); i++) {
+        if (encoded[i] == ESCAPE_CODE) {
+            KU_ASSERT(i + 1 < encoded.size());
+            *dst++ = encoded[++i];
+        } else {
+            const auto& symbol = symbols[encoded[i]];
+            std::memcpy(dst, &symbol.value, symbol.length);
+            dst += symbol.length;
+        }
+    }
+    return dst - start;
+}
+
+void FSSTSymbolTable::serialize(common::Serializer& serializer) const {
+    serializer.write<uint64_t>(symbols.size());
+    for (const auto& symbol : symbols) {
+        serializer.write(symbol.value);
+        serializer.write(symbol.length);
+    }
+}
+
+FSSTSymbolTable FSSTSymbolTable::deserialize(common::Deserializer& deserializer) {
+    uint64_t numSymbols = 0;
+    deserializer.deserializeValue(numSymbols);
+    std::vector<FSSTSymbol> symbols(numSymbols);
+    for (auto& symbol : symbols) {
+        deserializer.deserializeValue(symbol.value);
+        deserializer.deserializeValue(symbol.length);
+    }
+    return FSSTSymbolTable(std::move(symbols));
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -1,11 +1,14 @@
 #include "storage/disk_array.h"
 
+#include <algorithm>
+
 #include "common/exception/runtime.h"
 #include "common/string_format.h"
 #include "common/types/types.h"
 #include "storage/file_handle.h"
 #include "storage/shadow_file.h"
 #include "storage/shadow_utils.h"
+#include "storage/storage_compactor.h"
 #include "storage/storage_utils.h"
 #include "transaction/transaction.h"
 
@@ -102,6 +105,40 @@ void DiskArrayInternal::get(uint64_t idx, const Transaction* transaction,
     }
 }
 
+void DiskArrayInternal::getBatch(std::span<const uint64_t> idxs, const Transaction* transaction,
+    uint64_t elementSize, std::span<std::byte> vals) {
+    KU_ASSERT(vals.size() == idxs.size() * elementSize);
+    KU_ASSERT(std::is_sorted(idxs.begin(), idxs.end()));
+    std::shared_lock sLck{diskArraySharedMtx};
+    auto readElements = [&](uint64_t startIdx, uint64_t endIdx, const uint8_t* frame) {
+        for (auto i = startIdx; i < endIdx; i++) {
+            const auto elemPosInPage = getAPIdxAndOffsetInAP(storageInfo, idxs[i]).elemPosInPage;
+            memcpy(vals.data() + i * elementSize, frame + elemPosInPage, elementSize);
+        }
+    };
+    uint64_t startIdx = 0;
+    while (startIdx < idxs.size()) {
+        KU_ASSERT(checkOutOfBoundAccess(transaction->getType(), idxs[startIdx]));
+        const auto apIdx = getAPIdxAndOffsetInAP(storageInfo, idxs[startIdx]).pageIdx;
+        auto endIdx = startIdx + 1;
+        while (endIdx < idxs.size() &&
+               getAPIdxAndOffsetInAP(storageInfo, idxs[endIdx]).pageIdx == apIdx) {
+            endIdx++;
+        }
+        const auto apPageIdx = getAPPageIdxNoLock(apIdx, transaction->getType());
+        if (transaction->getType() != TransactionType::CHECKPOINT || !hasTransactionalUpdates ||
+            apPageIdx > lastPageOnDisk ||
+            !shadowFile->hasShadowPage(fileHandle.getFileIndex(), apPageIdx)) {
+            fileHandle.optimisticReadPage(apPageIdx,
+                [&](const uint8_t* frame) -> void { readElements(startIdx, endIdx, frame); });
+        } else {
+            ShadowUtils::readShadowVersionOfPage(fileHandle, apPageIdx, *shadowFile,
+                [&](const uint8_t* frame) -> void { readElements(startIdx, endIdx, frame); });
+        }
+        startIdx = endIdx;
+    }
+}
+
 void DiskArrayInternal::updatePage(uint64_t pageIdx, bool isNewPage,
     std::function<void(uint8_t*)> updateOp) {
     // Pages which are new to this transaction are written directly to the file
@@ -251,6 +288,65 @@ void DiskArrayInternal::reclaimStorage(PageAllocator& pageAllocator) const {
     }
 }
 
+void DiskArrayInternal::compactStorage(StorageCompactor& compactor) {
+    std::unique_lock xLck{diskArraySharedMtx};
+    if (hasTransactionalUpdates) {
+        return;
+    }
+    const auto oldLastAPPageIdx = lastAPPageIdx;
+    const auto oldLastPageOnDisk = lastPageOnDisk;
+    bool changed = false;
+    for (auto& pip : pips) {
+        const auto oldPIPContents = pip.pipContents;
+        bool pipChanged = false;
+        for (auto& pageIdx : pip.pipContents.pageIdxs) {
+            if (pageIdx == ShadowUtils::NULL_PAGE_IDX) {
+                continue;
+            }
+            if (const auto pageRange = compactor.relocate(PageRange(pageIdx, 1))) {
+                if (lastAPPageIdx == pageIdx) {
+                    lastAPPageIdx = pageRange->startPageIdx;
+                }
+                pageIdx = pageRange->startPageIdx;
+                pipChanged = true;
+            }
+        }
+        if (pipChanged) {
+            ShadowUtils::updatePage(fileHandle, pip.pipPageIdx, true /* skipReadingOriginalPage */,
+                *shadowFile, [&](auto* frame) { memcpy(frame, &pip.pipContents, sizeof(PIP)); });
+            // The shadow page is rewritten as well, as the shadow file outlives a rolled back
+            // checkpoint and is applied by the next one.
+            compactor.addRollbackAction([this, &pip, oldPIPContents]() {
+                std::unique_lock lck{diskArraySharedMtx};
+                pip.pipContents = oldPIPContents;
+                ShadowUtils::updatePage(fileHandle, pip.pipPageIdx,
+                    true /* skipReadingOriginalPage */, *shadowFile,
+                    [&](auto* frame) { memcpy(frame, &pip.pipContents, sizeof(PIP)); });
+            });
+            changed = true;
+        }
+    }
+    if (changed) {
+        compactor.addRollbackAction([this, oldLastAPPageIdx, oldLastPageOnDisk]() {
+            std::unique_lock lck{diskArraySharedMtx};
+            lastAPPageIdx = oldLastAPPageIdx;
+            lastPageOnDisk = oldLastPageOnDisk;
+        });
+    }
+    // Pages after lastPageOnDisk are written without shadowing, which is only safe for pages new
+    // to the transaction. Array pages may now be out of order, so it is set to the last of them.
+    if (lastPageOnDisk != INVALID_PAGE_IDX) {
+        lastPageOnDisk = 0;
+        for (const auto& pip : pips) {
+            for (const auto pageIdx : pip.pipContents.pageIdxs) {
+                if (pageIdx != ShadowUtils::NULL_PAGE_IDX) {
+                    lastPageOnDisk = std::max(lastPageOnDisk, pageIdx);
+                }
+            }
+        }
+    }
+}
+
 bool DiskArrayInternal::hasPIPUpdatesNoLock(uint64_t pipIdx) const {
     // This is a request to a pipIdx > pips.size(). Since pips.size() is the original number of pips
     // we started with before the write transaction is updated, we return true, i.e., this PIP is
@@ -14,7 +14,9 @@ FileHandle::FileHandle(const std::string& path, uint8_t fhFlags, BufferManager*
     uint32_t fileIndex, VirtualFileSystem* vfs, main::ClientContext* context)
     : fhFlags{fhFlags}, fileIndex{fileIndex}, numPages{0}, pageCapacity{0}, bm{bm},
       pageSizeClass{isNewTmpFile() && isLargePaged() ? TEMP_PAGE : REGULAR_PAGE}, pageStates{0, 0},
-      frameGroupIdxes{0, 0}, pageManager(std::make_unique<PageManager>(this)) {
+      frameGroupIdxes{0, 0}, pageManager(std::make_unique<PageManager>(this)), mappedData{nullptr},
+      numMappedPages{0}, numPageHits{0}, numPageMisses{0},
+      pageRemovalVersion{0} {
     if (isNewTmpFile()) {
         constructTmpFileHandle(path);
     } else {
@@ -40,6 +42,9 @@ void FileHandle::constructPersistentFileHandle(const std::string& path, VirtualF
             ((createFileIfNotExists()) ? FileFlags::CREATE_IF_NOT_EXISTS : 0x00000000);
         openFlags.lockType = isLockRequired() ? FileLockType::WRITE_LOCK : FileLockType::NO_LOCK;
     }
+    if (isDirectIORequested()) {
+        openFlags.flags |= FileFlags::DIRECT_IO;
+    }
     fileInfo = vfs->openFile(path, openFlags, context);
     const auto fileLength = fileInfo->getFileSize();
     numPages = ceil(static_cast<double>(fileLength) / static_cast<double>(getPageSize()));
@@ -47,6 +52,13 @@ void FileHandle::constructPersistentFileHandle(const std::string& path, VirtualF
     while (pageCapacity < numPages) {
         pageCapacity += StorageConstants::PAGE_GROUP_SIZE;
     }
+    // Mapping a partial last page would fault on reads past the end of the file.
+    if (isMemoryMappingRequested() && isReadOnlyFile() && fileLength >= getPageSize()) {
+        mappedData = fileInfo->mapForReading(fileLength);
+        if (mappedData != nullptr) {
+            numMappedPages = fileLength / getPageSize();
+        }
+    }
 }
 
 void FileHandle::constructTmpFileHandle(const std::string& path) {
@@ -96,14 +108,17 @@ uint8_t* FileHandle::pinPage(page_idx_t pageIdx, PageReadPolicy readPolicy) {
 }
 
 void FileHandle::optimisticReadPage(page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readOp) {
+    const std::function<void(uint8_t*)>& readOp, PageAccessType accessType) {
     if (isInMemoryMode()) {
         KU_ASSERT(
             PageState::getState(getPageState(pageIdx)->getStateAndVersion()) == PageState::LOCKED);
         const auto frame = bm->getFrame(*this, pageIdx);
         readOp(frame);
+    } else if (pageIdx < numMappedPages) {
+        // Read operations don't modify the page.
+        readOp(const_cast<uint8_t*>(mappedData) + static_cast<uint64_t>(pageIdx) * getPageSize());
     } else {
-        bm->optimisticRead(*this, pageIdx, readOp);
+        bm->optimisticRead(*this, pageIdx, readOp, accessType);
     }
 }
 
@@ -134,6 +149,10 @@ void FileHandle::removePageIdxAndTruncateIfNecessary(page_idx_t pageIdx) {
     }
     numPages = pageIdx;
     pageStates.resize(numPages);
+    // The pages are free, so the file is shrunk as well to give the space back to the OS.
+    if (!isInMemoryMode() && !isReadOnlyFile() && fileInfo) {
+        fileInfo->truncate(static_cast<uint64_t>(numPages) * getPageSize());
+    }
     const auto numPageGroups = getNumPageGroups();
     if (numPageGroups == frameGroupIdxes.size()) {
         return;
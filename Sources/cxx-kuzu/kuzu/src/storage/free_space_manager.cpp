@@ -9,16 +9,17 @@
 #include "storage/page_range.h"
 
 namespace kuzu::storage {
-static FreeSpaceManager::sorted_free_list_t& getFreeList(
-    std::vector<FreeSpaceManager::sorted_free_list_t>& freeLists, common::idx_t level) {
+template<typename T, typename Cmp>
+static std::set<T, Cmp>& getFreeList(std::vector<std::set<T, Cmp>>& freeLists, common::idx_t level,
+    Cmp cmp) {
     if (level >= freeLists.size()) {
-        freeLists.resize(level + 1,
-            FreeSpaceManager::sorted_free_list_t{&FreeSpaceManager::entryCmp});
+        freeLists.resize(level + 1, std::set<T, Cmp>{cmp});
     }
     return freeLists[level];
 }
 
-FreeSpaceManager::FreeSpaceManager() : freeLists{}, numEntries(0), needClearEvictedEntries(false){};
+FreeSpaceManager::FreeSpaceManager()
+    : freeLists{}, freeListsByStartPage{}, numEntries(0), needClearEvictedEntries(false){};
 
 common::idx_t FreeSpaceManager::getLevel(common::page_idx_t numPages) {
     // level is exponent of largest power of 2 that is <= numPages
@@ -31,14 +32,26 @@ bool FreeSpaceManager::entryCmp(const PageRange& a, const PageRange& b) {
     return a.numPages == b.numPages ? a.startPageIdx < b.startPageIdx : a.numPages < b.numPages;
 }
 
+bool FreeSpaceManager::startPageCmp(const PageRange& a, const PageRange& b) {
+    return a.startPageIdx < b.startPageIdx;
+}
+
 void FreeSpaceManager::addFreePages(PageRange entry) {
     KU_ASSERT(entry.numPages > 0);
     const auto entryLevel = getLevel(entry.numPages);
-    KU_ASSERT(!getFreeList(freeLists, entryLevel).contains(entry));
-    getFreeList(freeLists, entryLevel).insert(entry);
+    KU_ASSERT(!getFreeList(freeLists, entryLevel, &entryCmp).contains(entry));
+    getFreeList(freeLists, entryLevel, &entryCmp).insert(entry);
+    getFreeList(freeListsByStartPage, entryLevel, &startPageCmp).insert(entry);
     ++numEntries;
 }
 
+void FreeSpaceManager::removeFreePages(const PageRange& entry) {
+    const auto entryLevel = getLevel(entry.numPages);
+    freeLists[entryLevel].erase(entry);
+    freeListsByStartPage[entryLevel].erase(entry);
+    --numEntries;
+}
+
 void FreeSpaceManager::evictAndAddFreePages(FileHandle* fileHandle, PageRange entry) {
     evictPages(fileHandle, entry);
     addFreePages(entry);
@@ -61,8 +74,7 @@ std::optional<PageRange> FreeSpaceManager::popFreePages(common::page_idx_t numPa
             auto entryIt = curList.lower_bound(PageRange{0, numPages});
             if (entryIt != curList.end()) {
                 auto entry = *entryIt;
-                curList.erase(entryIt);
-                --numEntries;
+                removeFreePages(entry);
                 return splitPageRange(entry, numPages);
             }
         }
@@ -70,6 +82,43 @@ std::optional<PageRange> FreeSpaceManager::popFreePages(common::page_idx_t numPa
     return std::nullopt;
 }
 
+std::optional<PageRange> FreeSpaceManager::popLowestFreePages(common::page_idx_t numPages,
+    common::page_idx_t endPageIdx) {
+    if (numPages == 0) {
+        return std::nullopt;
+    }
+    std::optional<PageRange> lowestEntry;
+    const auto isLower = [&](const PageRange& entry) {
+        return entry.startPageIdx < (lowestEntry ? lowestEntry->startPageIdx : endPageIdx);
+    };
+    const auto minLevel = getLevel(numPages);
+    // Every entry of a higher level fits, so the first entry by start page is its lowest fit.
+    for (auto level = minLevel + 1; level < freeListsByStartPage.size(); ++level) {
+        const auto& curList = freeListsByStartPage[level];
+        if (!curList.empty() && isLower(*curList.begin())) {
+            lowestEntry = *curList.begin();
+        }
+    }
+    // Entries of the lowest level may be too small, so they are scanned by start page until one
+    // fits or the lowest fit found so far is reached.
+    if (minLevel < freeListsByStartPage.size()) {
+        for (const auto& entry : freeListsByStartPage[minLevel]) {
+            if (!isLower(entry)) {
+                break;
+            }
+            if (entry.numPages >= numPages) {
+                lowestEntry = entry;
+                break;
+            }
+        }
+    }
+    if (!lowestEntry) {
+        return std::nullopt;
+    }
+    removeFreePages(*lowestEntry);
+    return splitPageRange(*lowestEntry, numPages);
+}
+
 PageRange FreeSpaceManager::splitPageRange(PageRange chunk, common::page_idx_t numRequiredPages) {
     KU_ASSERT(chunk.numPages >= numRequiredPages);
     PageRange ret{chunk.startPageIdx, numRequiredPages};
@@ -166,7 +215,8 @@ void FreeSpaceManager::serialize(common::Serializer& ser) const {
     serializeInternal(serWrapper);
 }
 
-void FreeSpaceManager::deserialize(common::Deserializer& deSer) {
+void FreeSpaceManager::deserialize(common::Deserializer& deSer,
+    common::page_idx_t numPagesInFile) {
     std::string key;
 
     deSer.validateDebuggingInfo(key, "page_manager");
@@ -179,6 +229,10 @@ void FreeSpaceManager::deserialize(common::Deserializer& deSer) {
         PageRange entry{};
         deSer.deserializeValue<common::page_idx_t>(entry.startPageIdx);
         deSer.deserializeValue<common::page_idx_t>(entry.numPages);
+        if (entry.startPageIdx >= numPagesInFile) {
+            continue;
+        }
+        entry.numPages = std::min(entry.numPages, numPagesInFile - entry.startPageIdx);
         addFreePages(entry);
     }
 }
@@ -203,6 +257,7 @@ void FreeSpaceManager::finalizeCheckpoint(FileHandle* fileHandle) {
 
 void FreeSpaceManager::resetFreeLists() {
     freeLists.clear();
+    freeListsByStartPage.clear();
     numEntries = 0;
 }
 
@@ -246,6 +301,16 @@ common::row_idx_t FreeSpaceManager::getNumEntries() const {
     return numEntries;
 }
 
+common::page_idx_t FreeSpaceManager::getNumFreePages() const {
+    common::page_idx_t numFreePages = 0;
+    for (const auto& freeList : freeLists) {
+        for (const auto& entry : freeList) {
+            numFreePages += entry.numPages;
+        }
+    }
+    return numFreePages;
+}
+
 std::vector<PageRange> FreeSpaceManager::getEntries(common::row_idx_t startOffset,
     common::row_idx_t endOffset) const {
     KU_ASSERT(endOffset >= startOffset);
@@ -1,13 +1,16 @@
 #include "storage/index/hash_index.h"
 
-#include <bitset>
+#include <atomic>
 
 #include "common/assert.h"
 #include "common/exception/message.h"
 #include "common/serializer/deserializer.h"
+#include "common/task_system/task_scheduler.h"
 #include "common/types/int128_t.h"
 #include "common/types/ku_string.h"
 #include "common/types/types.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
 #include "storage/disk_array.h"
 #include "storage/disk_array_collection.h"
 #include "storage/file_handle.h"
@@ -39,6 +42,66 @@ HashIndex<T>::HashIndex(MemoryManager& memoryManager, OverflowFileHandle* overfl
     oSlots = diskArrays.getDiskArray<OnDiskSlotType>(NUM_HASH_INDEXES + indexPos);
 }
 
+template<typename T>
+void HashIndex<T>::lookupBatch(const Transaction* transaction, std::span<const Key> keys,
+    std::span<const hash_t> hashes, std::span<offset_t> results, const visible_func& isVisible) {
+    KU_ASSERT(keys.size() == hashes.size() && keys.size() == results.size());
+    auto& header = transaction->getType() == TransactionType::CHECKPOINT ?
+                       this->indexHeaderForWriteTrx :
+                       this->indexHeaderForReadTrx;
+    // (primary slot id, key idx) of keys that have to be looked up in the persistent storage.
+    std::vector<std::pair<slot_id_t, uint32_t>> persistentLookups;
+    persistentLookups.reserve(keys.size());
+    for (auto i = 0u; i < keys.size(); i++) {
+        offset_t result = INVALID_OFFSET;
+        const auto localLookupState = localStorage->lookup(keys[i], result, isVisible);
+        results[i] = localLookupState == HashIndexLocalLookupState::KEY_FOUND ? result :
+                                                                                 INVALID_OFFSET;
+        if (localLookupState == HashIndexLocalLookupState::KEY_NOT_EXIST && header.numEntries > 0) {
+            persistentLookups.emplace_back(
+                HashIndexUtils::getPrimarySlotIdForHash(header, hashes[i]), i);
+        }
+    }
+    if (persistentLookups.empty()) {
+        return;
+    }
+    std::sort(persistentLookups.begin(), persistentLookups.end());
+    std::vector<uint64_t> slotIds;
+    for (const auto& [slotId, _] : persistentLookups) {
+        if (slotIds.empty() || slotIds.back() != slotId) {
+            slotIds.push_back(slotId);
+        }
+    }
+    std::vector<OnDiskSlotType> primarySlots(slotIds.size());
+    pSlots->getBatch(slotIds, transaction, primarySlots);
+    auto slotIdx = 0u;
+    for (const auto& [slotId, keyIdx] : persistentLookups) {
+        while (slotIds[slotIdx] != slotId) {
+            slotIdx++;
+        }
+        const auto& key = keys[keyIdx];
+        const auto fingerprint = HashIndexUtils::getFingerprintForHash(hashes[keyIdx]);
+        const auto& primarySlot = primarySlots[slotIdx];
+        auto entryPos =
+            findMatchedEntryInSlot(transaction, primarySlot, key, fingerprint, isVisible);
+        if (entryPos != SlotHeader::INVALID_ENTRY_POS) {
+            results[keyIdx] = primarySlot.entries[entryPos].value;
+            continue;
+        }
+        if (primarySlot.header.nextOvfSlotId == SlotHeader::INVALID_OVERFLOW_SLOT_ID) {
+            continue;
+        }
+        SlotIterator iter{SlotInfo{slotId, SlotType::PRIMARY}, primarySlot};
+        while (nextChainedSlot(transaction, iter)) {
+            entryPos = findMatchedEntryInSlot(transaction, iter.slot, key, fingerprint, isVisible);
+            if (entryPos != SlotHeader::INVALID_ENTRY_POS) {
+                results[keyIdx] = iter.slot.entries[entryPos].value;
+                break;
+            }
+        }
+    }
+}
+
 template<typename T>
 void HashIndex<T>::deleteFromPersistentIndex(const Transaction* transaction, Key key,
     visible_func isVisible) {
@@ -69,22 +132,45 @@ inline hash_t HashIndex<ku_string_t>::hashStored(const Transaction* transaction,
     return hash;
 }
 
+template<typename T>
+uint64_t HashIndex<T>::reserveForCheckpoint(PageAllocator& pageAllocator) {
+    if (!localStorage->hasUpdates()) {
+        return 0;
+    }
+    uint64_t numInsertions = 0;
+    localStorage->applyLocalChanges([&](Key) {},
+        [&](const auto& insertions) { numInsertions = insertions.size(); });
+    // The number of insertions is an upper bound of the net inserts.
+    if (numInsertions > 0) {
+        reserve(pageAllocator, &DUMMY_CHECKPOINT_TRANSACTION, numInsertions);
+    }
+    return numInsertions;
+}
+
+template<typename T>
+void HashIndex<T>::sortInsertionsForCheckpoint() {
+    KU_ASSERT(sortedInsertions.empty());
+    localStorage->applyLocalChanges([&](Key) {}, [&](const auto& insertions) {
+        sortedInsertions.reserve(insertions.size());
+        for (uint64_t localSlotId = 0; localSlotId < insertions.numPrimarySlots();
+             localSlotId++) {
+            auto localSlot = typename InMemHashIndex<T>::SlotIterator(localSlotId, &insertions);
+            collectEntries(&DUMMY_CHECKPOINT_TRANSACTION, insertions, localSlot,
+                sortedInsertions);
+        }
+    });
+    std::sort(sortedInsertions.begin(), sortedInsertions.end(),
+        [](const auto& entry1, const auto& entry2) {
+            return entry1.diskSlotId < entry2.diskSlotId;
+        });
+}
+
 template<typename T>
 bool HashIndex<T>::checkpoint(PageAllocator& pageAllocator) {
     if (localStorage->hasUpdates()) {
-        auto transaction = &DUMMY_CHECKPOINT_TRANSACTION;
-        auto netInserts = localStorage->getNetInserts();
-        if (netInserts > 0) {
-            reserve(pageAllocator, transaction, netInserts);
-        }
-        localStorage->applyLocalChanges(
-            [&](Key) {
-                // TODO(Guodong/Ben): FIX-ME. We should vacuum the index during checkpoint.
-                // DO NOTHING.
-            },
-            [&](const auto& insertions) {
-                mergeBulkInserts(pageAllocator, transaction, insertions);
-            });
+        // TODO(Guodong/Ben): FIX-ME. We should vacuum the index during checkpoint.
+        // Local deletions are currently not applied to the on-disk index.
+        mergeBulkInserts(pageAllocator, &DUMMY_CHECKPOINT_TRANSACTION);
         pSlots->checkpoint();
         oSlots->checkpoint();
         return true;
@@ -131,6 +217,12 @@ void HashIndex<T>::reclaimStorage(PageAllocator& pageAllocator) {
     oSlots->reclaimStorage(pageAllocator);
 }
 
+template<typename T>
+void HashIndex<T>::compactStorage(StorageCompactor& compactor) {
+    pSlots->compactStorage(compactor);
+    oSlots->compactStorage(compactor);
+}
+
 template<typename T>
 void HashIndex<T>::splitSlots(PageAllocator& pageAllocator, const Transaction* transaction,
     HashIndexHeader& header, slot_id_t numSlotsToSplit) {
@@ -237,10 +329,10 @@ void HashIndex<T>::reserve(PageAllocator& pageAllocator, const Transaction* tran
 }
 
 template<typename T>
-void HashIndex<T>::sortEntries(const Transaction* transaction,
+void HashIndex<T>::collectEntries(const Transaction* transaction,
     const InMemHashIndex<T>& insertLocalStorage,
     typename InMemHashIndex<T>::SlotIterator& slotToMerge,
-    std::vector<HashIndexEntryView>& entries) {
+    std::vector<HashIndexEntryView>& entries) const {
     do {
         auto numEntries = slotToMerge.slot->header.numEntries();
         for (auto entryPos = 0u; entryPos < numEntries; entryPos++) {
@@ -252,93 +344,24 @@ void HashIndex<T>::sortEntries(const Transaction* transaction,
                 slotToMerge.slot->header.fingerprints[entryPos], entry});
         }
     } while (insertLocalStorage.nextChainedSlot(slotToMerge));
-    std::sort(entries.begin(), entries.end(), [&](auto entry1, auto entry2) -> bool {
-        // Sort based on the entry's disk slot ID so that the first slot is at the end.
-        // Sorting is done reversed so that we can process from the back of the list,
-        // using the size to track the remaining entries
-        return entry1.diskSlotId > entry2.diskSlotId;
-    });
 }
 
 template<typename T>
-void HashIndex<T>::mergeBulkInserts(PageAllocator& pageAllocator, const Transaction* transaction,
-    const InMemHashIndex<T>& insertLocalStorage) {
-    // TODO: Ideally we can split slots at the same time that we insert new ones
-    // Compute the new number of primary slots, and iterate over each slot, determining if it
-    // needs to be split (and how many times, which is complicated) and insert/rehash each element
-    // one by one. Rehashed entries should be copied into a new slot in-memory, and then that new
-    // slot (with the entries from the respective slot in the local storage) should be processed
-    // immediately to avoid increasing memory usage (caching one page of slots at a time since split
-    // slots usually get rehashed to a new page).
-    //
-    // On the other hand, two passes may not be significantly slower than one
-    // TODO: one pass would also reduce locking when frames are unpinned,
-    // which is useful if this can be parallelized
-    reserve(pageAllocator, transaction, insertLocalStorage.size());
-    // RUNTIME_CHECK(auto originalNumEntries = this->indexHeaderForWriteTrx.numEntries);
-
-    // Storing as many slots in-memory as on-disk shouldn't be necessary (for one, it makes memory
-    // usage an issue as we may need significantly more memory to store the slots that we would
-    // otherwise). Instead, when merging here, we can re-hash and split each in-memory slot (into
-    // temporary vector buffers instead of slots for improved performance) and then merge each of
-    // those one at a time into the disk slots. That will keep the low memory requirements and still
-    // let us update each on-disk slot one at a time.
-
+void HashIndex<T>::mergeBulkInserts(PageAllocator& pageAllocator, const Transaction* transaction) {
+    // The insertions are sorted by their disk slot id, so the primary slots are visited in
+    // ascending order and each page of slots is pinned and written once. New overflow slots are
+    // always appended at the end of the overflow slot array.
     auto diskSlotIterator = pSlots->iter_mut();
-    // TODO: Use a separate random access iterator and one that's sequential for adding new overflow
-    // slots All new slots will be sequential and benefit from caching, but for existing randomly
-    // accessed slots we just benefit from the interface. However, the two iterators would not be
-    // able to pin the same page simultaneously
-    // Alternatively, cache new slots in memory and pushBack them at the end like in splitSlots
     auto diskOverflowSlotIterator = oSlots->iter_mut();
-
-    // Store sorted slot positions. Re-use to avoid re-allocating memory
-    // TODO: Unify implementations to make sure this matches the size used by the disk array
-    constexpr size_t NUM_SLOTS_PER_PAGE =
-        KUZU_PAGE_SIZE / DiskArray<OnDiskSlotType>::getAlignedElementSize();
-    std::array<std::vector<HashIndexEntryView>, NUM_SLOTS_PER_PAGE> partitionedEntries;
-    // Sort entries for a page of slots at a time, then move vertically and process all entries
-    // which map to a given page on disk, then horizontally to the next page in the set. These pages
-    // may not be consecutive, but we reduce the memory overhead for storing the information about
-    // the sorted data and still just process each page once.
-    for (uint64_t localSlotId = 0; localSlotId < insertLocalStorage.numPrimarySlots();
-         localSlotId += NUM_SLOTS_PER_PAGE) {
-        for (size_t i = 0;
-             i < NUM_SLOTS_PER_PAGE && localSlotId + i < insertLocalStorage.numPrimarySlots();
-             i++) {
-            auto localSlot =
-                typename InMemHashIndex<T>::SlotIterator(localSlotId + i, &insertLocalStorage);
-            partitionedEntries[i].clear();
-            // Results are sorted in reverse, so we can process the end first and pop_back to remove
-            // them from the vector
-            sortEntries(transaction, insertLocalStorage, localSlot, partitionedEntries[i]);
-        }
-        // Repeat until there are no unprocessed partitions in partitionedEntries
-        // This will run at most NUM_SLOTS_PER_PAGE times the number of entries
-        std::bitset<NUM_SLOTS_PER_PAGE> done;
-        while (!done.all()) {
-            std::optional<page_idx_t> diskSlotPage;
-            for (size_t i = 0; i < NUM_SLOTS_PER_PAGE; i++) {
-                if (!done[i] && !partitionedEntries[i].empty()) {
-                    auto diskSlotId = partitionedEntries[i].back().diskSlotId;
-                    if (!diskSlotPage) {
-                        diskSlotPage = diskSlotId / NUM_SLOTS_PER_PAGE;
-                    }
-                    if (diskSlotId / NUM_SLOTS_PER_PAGE == diskSlotPage) {
-                        auto merged = mergeSlot(pageAllocator, transaction, partitionedEntries[i],
-                            diskSlotIterator, diskOverflowSlotIterator, diskSlotId);
-                        KU_ASSERT(merged <= partitionedEntries[i].size());
-                        partitionedEntries[i].resize(partitionedEntries[i].size() - merged);
-                        if (partitionedEntries[i].empty()) {
-                            done[i] = true;
-                        }
-                    }
-                } else {
-                    done[i] = true;
-                }
-            }
-        }
+    std::span<const HashIndexEntryView> remaining = sortedInsertions;
+    while (!remaining.empty()) {
+        auto merged = mergeSlot(pageAllocator, transaction, remaining, diskSlotIterator,
+            diskOverflowSlotIterator, remaining.front().diskSlotId);
+        KU_ASSERT(merged > 0 && merged <= remaining.size());
+        remaining = remaining.subspan(merged);
     }
+    // Release the memory of the sorted entries as soon as they have been merged.
+    sortedInsertions = {};
     // TODO(Guodong): Fix this assertion statement which doesn't count the entries in
     // deleteLocalStorage.
     //     KU_ASSERT(originalNumEntries + insertLocalStorage.getIndexHeader().numEntries ==
@@ -347,7 +370,7 @@ void HashIndex<T>::mergeBulkInserts(PageAllocator& pageAllocator, const Transact
 
 template<typename T>
 size_t HashIndex<T>::mergeSlot(PageAllocator& pageAllocator, const Transaction* transaction,
-    const std::vector<HashIndexEntryView>& slotToMerge,
+    std::span<const HashIndexEntryView> slotToMerge,
     typename DiskArray<OnDiskSlotType>::WriteIterator& diskSlotIterator,
     typename DiskArray<OnDiskSlotType>::WriteIterator& diskOverflowSlotIterator,
     slot_id_t diskSlotId) {
@@ -359,7 +382,7 @@ size_t HashIndex<T>::mergeSlot(PageAllocator& pageAllocator, const Transaction*
               diskOverflowSlotIterator.size() > diskSlot->header.nextOvfSlotId);
     // Merge slot from local storage to an existing slot.
     size_t merged = 0;
-    for (auto it = std::rbegin(slotToMerge); it != std::rend(slotToMerge); ++it) {
+    for (auto it = slotToMerge.begin(); it != slotToMerge.end(); ++it) {
         if (it->diskSlotId != diskSlotId) {
             return merged;
         }
@@ -556,6 +579,65 @@ bool PrimaryKeyIndex::lookup(const Transaction* trx, ValueVector* keyVector, uin
     return retVal;
 }
 
+void PrimaryKeyIndex::lookupBatch(const Transaction* trx, const ValueVector& keyVector,
+    std::span<const sel_t> positions, std::span<offset_t> results, const visible_func& isVisible) {
+    KU_ASSERT(indexInfo.keyDataTypes.size() == 1);
+    KU_ASSERT(positions.size() == results.size());
+    TypeUtils::visit(
+        indexInfo.keyDataTypes[0],
+        [&]<IndexHashable T>(T) {
+            using Key = typename HashIndex<T>::Key;
+            const auto numKeys = positions.size();
+            // Hash every key once and bucket the keys by sub-index with a counting sort.
+            std::vector<hash_t> hashes(numKeys);
+            std::array<uint32_t, NUM_HASH_INDEXES + 1> bucketStarts{};
+            for (auto i = 0u; i < numKeys; i++) {
+                const auto key = keyVector.getValue<T>(positions[i]);
+                if constexpr (std::same_as<T, ku_string_t>) {
+                    hashes[i] = HashIndexUtils::hash(key.getAsStringView());
+                } else {
+                    hashes[i] = HashIndexUtils::hash(key);
+                }
+                bucketStarts[HashIndexUtils::getHashIndexPositionForHash(hashes[i]) + 1]++;
+            }
+            for (auto i = 0u; i < NUM_HASH_INDEXES; i++) {
+                bucketStarts[i + 1] += bucketStarts[i];
+            }
+            std::vector<uint32_t> keyIdxs(numKeys);
+            std::vector<Key> bucketedKeys(numKeys);
+            std::vector<hash_t> bucketedHashes(numKeys);
+            auto bucketEnds = bucketStarts;
+            for (auto i = 0u; i < numKeys; i++) {
+                const auto bucketPos =
+                    bucketEnds[HashIndexUtils::getHashIndexPositionForHash(hashes[i])]++;
+                keyIdxs[bucketPos] = i;
+                bucketedHashes[bucketPos] = hashes[i];
+                if constexpr (std::same_as<T, ku_string_t>) {
+                    bucketedKeys[bucketPos] =
+                        keyVector.getValue<ku_string_t>(positions[i]).getAsStringView();
+                } else {
+                    bucketedKeys[bucketPos] = keyVector.getValue<T>(positions[i]);
+                }
+            }
+            std::vector<offset_t> bucketedResults(numKeys);
+            for (auto indexPos = 0u; indexPos < NUM_HASH_INDEXES; indexPos++) {
+                const auto start = bucketStarts[indexPos];
+                const auto size = bucketStarts[indexPos + 1] - start;
+                if (size == 0) {
+                    continue;
+                }
+                getTypedHashIndexByPos<T>(indexPos)->lookupBatch(trx,
+                    std::span<const Key>(bucketedKeys).subspan(start, size),
+                    std::span<const hash_t>(bucketedHashes).subspan(start, size),
+                    std::span(bucketedResults).subspan(start, size), isVisible);
+            }
+            for (auto i = 0u; i < numKeys; i++) {
+                results[keyIdxs[i]] = bucketedResults[i];
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
 void PrimaryKeyIndex::commitInsert(Transaction* transaction, const ValueVector& nodeIDVector,
     const std::vector<ValueVector*>& indexVectors, Index::InsertState& insertState) {
     KU_ASSERT(indexVectors.size() == 1);
@@ -667,11 +749,66 @@ static void updateOverflowHeaderPageIfNeeded(IndexStorageInfo* storageInfo,
     }
 }
 
-void PrimaryKeyIndex::checkpoint(main::ClientContext*, storage::PageAllocator& pageAllocator) {
+// Sorting the insertions of one sub-index is CPU bound (hashing every key), so it is parallelized
+// over sub-indexes. Sub-indexes are processed in batches to bound the memory of the sorted entries.
+static constexpr uint64_t NUM_HASH_INDEXES_PER_CHECKPOINT_BATCH = 32;
+// Below this number of insertions, sorting is cheaper than scheduling a task.
+static constexpr uint64_t MIN_INSERTIONS_FOR_PARALLEL_SORT = 64 * 1024;
+
+class SortHashIndexInsertionsTask final : public Task {
+public:
+    SortHashIndexInsertionsTask(uint64_t maxNumThreads,
+        std::span<const std::unique_ptr<OnDiskHashIndex>> hashIndices)
+        : Task{maxNumThreads}, hashIndices{hashIndices}, nextIndex{0} {}
+
+    void run() override {
+        for (auto i = nextIndex.fetch_add(1); i < hashIndices.size(); i = nextIndex.fetch_add(1)) {
+            hashIndices[i]->sortInsertionsForCheckpoint();
+        }
+    }
+
+private:
+    std::span<const std::unique_ptr<OnDiskHashIndex>> hashIndices;
+    std::atomic<uint64_t> nextIndex;
+};
+
+void PrimaryKeyIndex::sortInsertionsForCheckpoint(main::ClientContext* context,
+    uint64_t startIndex, uint64_t endIndex) {
+    const auto numThreads =
+        context == nullptr ? 1 : std::min(context->getMaxNumThreadForExec(), endIndex - startIndex);
+    if (numThreads <= 1) {
+        for (auto i = startIndex; i < endIndex; i++) {
+            hashIndices[i]->sortInsertionsForCheckpoint();
+        }
+        return;
+    }
+    auto task = std::make_shared<SortHashIndexInsertionsTask>(numThreads,
+        std::span{hashIndices}.subspan(startIndex, endIndex - startIndex));
+    processor::ExecutionContext executionContext{nullptr, context, 0 /* queryID */};
+    // Checkpoint may be run by a worker thread of the task scheduler (e.g. the CHECKPOINT
+    // statement), so a new worker thread is launched to avoid losing it while waiting.
+    context->getTaskScheduler()->scheduleTaskAndWaitOrError(task, &executionContext,
+        true /* launchNewWorkerThread */);
+}
+
+void PrimaryKeyIndex::checkpoint(main::ClientContext* context,
+    storage::PageAllocator& pageAllocator) {
     bool indexChanged = false;
+    uint64_t numInsertions = 0;
     for (auto i = 0u; i < NUM_HASH_INDEXES; i++) {
-        if (hashIndices[i]->checkpoint(pageAllocator)) {
-            indexChanged = true;
+        numInsertions += hashIndices[i]->reserveForCheckpoint(pageAllocator);
+    }
+    auto sortContext = numInsertions >= MIN_INSERTIONS_FOR_PARALLEL_SORT ? context : nullptr;
+    for (auto startIndex = 0u; startIndex < NUM_HASH_INDEXES;
+         startIndex += NUM_HASH_INDEXES_PER_CHECKPOINT_BATCH) {
+        const auto endIndex = std::min<uint64_t>(
+            startIndex + NUM_HASH_INDEXES_PER_CHECKPOINT_BATCH, NUM_HASH_INDEXES);
+        sortInsertionsForCheckpoint(sortContext, startIndex, endIndex);
+        // Merging allocates pages and writes through the shadow file, so it stays serial.
+        for (auto i = startIndex; i < endIndex; i++) {
+            if (hashIndices[i]->checkpoint(pageAllocator)) {
+                indexChanged = true;
+            }
         }
     }
     if (indexChanged) {
@@ -704,6 +841,12 @@ std::unique_ptr<Index> PrimaryKeyIndex::load(main::ClientContext* context,
         *storageManager->getDataFH()->getPageManager(), &storageManager->getShadowFile());
 }
 
+void PrimaryKeyIndex::compactStorage(StorageCompactor& compactor) {
+    for (auto& hashIndex : hashIndices) {
+        hashIndex->compactStorage(compactor);
+    }
+}
+
 void PrimaryKeyIndex::reclaimStorage(PageAllocator& pageAllocator) const {
     for (auto& hashIndex : hashIndices) {
         hashIndex->reclaimStorage(pageAllocator);
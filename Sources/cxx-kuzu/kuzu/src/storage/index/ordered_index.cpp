@@ -0,0 +1,556 @@
+#include "storage/index/ordered_index.h"
+
+#include <algorithm>
+#include <set>
+
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/buffered_file.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/in_mem_file_writer.h"
+#include "common/serializer/serializer.h"
+#include "common/type_utils.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/mm_allocator.h"
+#include "storage/file_handle.h"
+#include "storage/page_allocator.h"
+#include "storage/storage_compactor.h"
+#include "storage/storage_manager.h"
+#include "storage/storage_utils.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+template<typename T>
+class TypedOrderedIndexEntries final : public OrderedIndexEntries {
+    // Strings are owned by the index, as the ku_string_t read from a vector points into the
+    // vector's overflow buffer.
+    using key_t = std::conditional_t<std::is_same_v<T, ku_string_t>, std::string, T>;
+    using entry_t = std::pair<key_t, offset_t>;
+
+public:
+    explicit TypedOrderedIndexEntries(MemoryManager* mm) : entries{MmAllocator<entry_t>{mm}} {}
+
+    bool insert(const ValueVector& keyVector, sel_t pos, offset_t offset) override {
+        return entries.emplace(readKey(keyVector, pos), offset).second;
+    }
+
+    void erase(const std::unordered_set<offset_t>& offsets) override {
+        std::erase_if(entries,
+            [&](const entry_t& entry) { return offsets.contains(entry.second); });
+    }
+
+    void erase(offset_t startOffset, offset_t endOffset) override {
+        std::erase_if(entries, [&](const entry_t& entry) {
+            return entry.second >= startOffset && entry.second < endOffset;
+        });
+    }
+
+    void erase(const OrderedIndexEntries& other) override {
+        for (const auto& entry :
+            ku_dynamic_cast<const TypedOrderedIndexEntries<T>&>(other).entries) {
+            entries.erase(entry);
+        }
+    }
+
+    void lookup(const std::optional<OrderedIndexBound>& lowerBound,
+        const std::optional<OrderedIndexBound>& upperBound,
+        std::vector<offset_t>& result) const override {
+        auto begin = entries.begin();
+        if (lowerBound.has_value()) {
+            const auto key = readKey(*lowerBound->vector, lowerBound->pos);
+            begin = lowerBound->inclusive ? entries.lower_bound(entry_t{key, 0}) :
+                                            entries.upper_bound(entry_t{key, INVALID_OFFSET});
+        }
+        auto end = entries.end();
+        if (upperBound.has_value()) {
+            const auto key = readKey(*upperBound->vector, upperBound->pos);
+            end = upperBound->inclusive ? entries.upper_bound(entry_t{key, INVALID_OFFSET}) :
+                                          entries.lower_bound(entry_t{key, 0});
+        }
+        if (begin == entries.end() || (end != entries.end() && *end < *begin)) {
+            return;
+        }
+        for (auto it = begin; it != end; ++it) {
+            result.push_back(it->second);
+        }
+    }
+
+    void clear() override { entries.clear(); }
+    uint64_t size() const override { return entries.size(); }
+
+    uint64_t serialize(Serializer& ser,
+        const std::function<bool(offset_t)>& filter) const override {
+        const auto numEntries = std::count_if(entries.begin(), entries.end(),
+            [&](const entry_t& entry) { return filter(entry.second); });
+        ser.write<uint64_t>(numEntries);
+        for (const auto& [key, offset] : entries) {
+            if (filter(offset)) {
+                ser.write<key_t>(key);
+                ser.write<offset_t>(offset);
+            }
+        }
+        return numEntries;
+    }
+
+    void deserialize(Deserializer& deSer) override {
+        uint64_t numEntries = 0;
+        deSer.deserializeValue<uint64_t>(numEntries);
+        for (auto i = 0u; i < numEntries; i++) {
+            key_t key{};
+            offset_t offset = INVALID_OFFSET;
+            deSer.deserializeValue<key_t>(key);
+            deSer.deserializeValue<offset_t>(offset);
+            // Entries are serialized in order, so each one usually goes to the end.
+            entries.emplace_hint(entries.end(), std::move(key), offset);
+        }
+    }
+
+private:
+    static key_t readKey(const ValueVector& vector, sel_t pos) {
+        if constexpr (std::is_same_v<T, ku_string_t>) {
+            return vector.getValue<ku_string_t>(pos).getAsString();
+        } else {
+            return vector.getValue<T>(pos);
+        }
+    }
+
+private:
+    std::set<entry_t, std::less<entry_t>, MmAllocator<entry_t>> entries;
+};
+
+std::unique_ptr<OrderedIndexEntries> OrderedIndexEntries::create(PhysicalTypeID keyType,
+    MemoryManager* mm) {
+    return TypeUtils::visit(
+        keyType,
+        [&]<typename T>(T)
+            requires(IndexHashable<T> && !std::is_same_v<T, std::string_view> &&
+                     !std::is_same_v<T, std::string>)
+        { return std::unique_ptr<OrderedIndexEntries>(new TypedOrderedIndexEntries<T>(mm)); },
+        [&](auto) -> std::unique_ptr<OrderedIndexEntries> { KU_UNREACHABLE; });
+}
+
+std::shared_ptr<BufferWriter> OrderedIndexStorageInfo::serialize() const {
+    auto bufferWriter = std::make_shared<BufferWriter>();
+    auto serializer = Serializer(bufferWriter);
+    serializer.write<uint64_t>(runs.size());
+    for (const auto& run : runs) {
+        serializer.write<page_idx_t>(run.startPageIdx);
+        serializer.write<page_idx_t>(run.numPages);
+    }
+    serializer.write<uint64_t>(numEntriesInRuns);
+    serializer.write<offset_t>(numIndexedNodes);
+    return bufferWriter;
+}
+
+std::unique_ptr<OrderedIndexStorageInfo> OrderedIndexStorageInfo::deserialize(
+    std::unique_ptr<BufferReader> reader) {
+    Deserializer deSer(std::move(reader));
+    uint64_t numRuns = 0;
+    deSer.deserializeValue<uint64_t>(numRuns);
+    std::vector<PageRange> runs(numRuns);
+    for (auto& run : runs) {
+        deSer.deserializeValue<page_idx_t>(run.startPageIdx);
+        deSer.deserializeValue<page_idx_t>(run.numPages);
+    }
+    uint64_t numEntriesInRuns = 0;
+    offset_t numIndexedNodes = 0;
+    deSer.deserializeValue<uint64_t>(numEntriesInRuns);
+    deSer.deserializeValue<offset_t>(numIndexedNodes);
+    return std::make_unique<OrderedIndexStorageInfo>(std::move(runs), numEntriesInRuns,
+        numIndexedNodes);
+}
+
+OrderedIndex::OrderedIndex(MemoryManager* mm, IndexInfo indexInfo,
+    std::unique_ptr<OrderedIndexStorageInfo> storageInfo,
+    std::unique_ptr<OrderedIndexEntries> committedEntries)
+    : Index{std::move(indexInfo), std::move(storageInfo)}, mm{mm},
+      committedEntries{std::move(committedEntries)}, localTransactionID{INVALID_TRANSACTION},
+      numIndexedNodes{this->storageInfo->constCast<OrderedIndexStorageInfo>().numIndexedNodes},
+      persisting{false}, rewriteEntries{false} {
+    KU_ASSERT(this->indexInfo.keyDataTypes.size() == 1);
+    localEntries = OrderedIndexEntries::create(this->indexInfo.keyDataTypes[0], mm);
+}
+
+std::unique_ptr<OrderedIndex> OrderedIndex::createNewIndex(MemoryManager* mm,
+    IndexInfo indexInfo) {
+    KU_ASSERT(indexInfo.keyDataTypes.size() == 1);
+    auto entries = OrderedIndexEntries::create(indexInfo.keyDataTypes[0], mm);
+    return std::make_unique<OrderedIndex>(mm, std::move(indexInfo),
+        std::make_unique<OrderedIndexStorageInfo>(), std::move(entries));
+}
+
+bool OrderedIndex::isKeyTypeSupported(PhysicalTypeID keyType) {
+    switch (keyType) {
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::STRING:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void OrderedIndex::build(main::ClientContext* context, NodeTable& nodeTable) {
+    KU_ASSERT(numIndexedNodes == 0);
+    indexNodes(context, context->getTransaction(), nodeTable, 0 /*startOffset*/);
+}
+
+void OrderedIndex::indexNodes(main::ClientContext* context, Transaction* transaction,
+    NodeTable& nodeTable, offset_t startOffset) {
+    const auto columnID = indexInfo.columnIDs[0];
+    std::vector<LogicalType> types;
+    types.push_back(LogicalType::INTERNAL_ID());
+    types.push_back(nodeTable.getColumn(columnID).getDataType().copy());
+    auto dataChunk = Table::constructDataChunk(context->getMemoryManager(), std::move(types));
+    NodeTableScanState scanState{&dataChunk.getValueVectorMutable(0),
+        std::vector{&dataChunk.getValueVectorMutable(1)}, dataChunk.state};
+    scanState.source = TableScanSource::COMMITTED;
+    scanState.setToTable(transaction, &nodeTable, {columnID}, {});
+    const auto numNodes = nodeTable.getNumTotalRows(transaction);
+    std::unique_lock lck{mtx};
+    for (auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(startOffset);
+         nodeGroupIdx < nodeTable.getNumCommittedNodeGroups(); nodeGroupIdx++) {
+        scanState.nodeGroupIdx = nodeGroupIdx;
+        nodeTable.initScanState(transaction, scanState);
+        while (nodeTable.scan(transaction, scanState)) {
+            const auto& keyVector = *scanState.outputVectors[0];
+            scanState.outState->getSelVector().forEach([&](auto pos) {
+                const auto offset = scanState.nodeIDVector->readNodeOffset(pos);
+                if (offset < startOffset || keyVector.isNull(pos)) {
+                    return;
+                }
+                committedEntries->insert(keyVector, pos, offset);
+            });
+        }
+    }
+    numIndexedNodes = std::max(numIndexedNodes, numNodes);
+}
+
+void OrderedIndex::lookup(const Transaction* transaction,
+    const std::optional<OrderedIndexBound>& lowerBound,
+    const std::optional<OrderedIndexBound>& upperBound, std::vector<offset_t>& result) {
+    std::shared_lock lck{mtx};
+    committedEntries->lookup(lowerBound, upperBound, result);
+    if (transaction->getID() == localTransactionID) {
+        localEntries->lookup(lowerBound, upperBound, result);
+        std::erase_if(result,
+            [&](offset_t offset) { return localDeletedOffsets.contains(offset); });
+    }
+    // An updated node may have an entry for both its old and new values.
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+}
+
+void OrderedIndex::resetLocalEntriesIfNeeded(const Transaction* transaction) {
+    if (transaction->getID() != localTransactionID) {
+        localEntries->clear();
+        localDeletedOffsets.clear();
+        localTransactionID = transaction->getID();
+    }
+}
+
+std::unique_ptr<Index::InsertState> OrderedIndex::initInsertState(main::ClientContext*,
+    visible_func) {
+    return std::make_unique<InsertState>(indexInfo.columnIDs[0]);
+}
+
+void OrderedIndex::insert(Transaction* transaction, const ValueVector& nodeIDVector,
+    const std::vector<ValueVector*>& indexVectors, Index::InsertState&) {
+    KU_ASSERT(indexVectors.size() == 1);
+    const auto& keyVector = *indexVectors[0];
+    std::unique_lock lck{mtx};
+    resetLocalEntriesIfNeeded(transaction);
+    auto& nodeIDSelVector = nodeIDVector.state->getSelVector();
+    auto& keySelVector = keyVector.state->getSelVector();
+    KU_ASSERT(nodeIDSelVector.getSelSize() == keySelVector.getSelSize());
+    for (auto i = 0u; i < nodeIDSelVector.getSelSize(); i++) {
+        const auto nodeIDPos = nodeIDSelVector[i];
+        const auto keyPos = keySelVector[i];
+        if (nodeIDVector.isNull(nodeIDPos) || keyVector.isNull(keyPos)) {
+            continue;
+        }
+        localEntries->insert(keyVector, keyPos, nodeIDVector.readNodeOffset(nodeIDPos));
+    }
+}
+
+std::unique_ptr<Index::UpdateState> OrderedIndex::initUpdateState(main::ClientContext*,
+    column_id_t, visible_func) {
+    return std::make_unique<UpdateState>();
+}
+
+void OrderedIndex::update(Transaction* transaction, const ValueVector& nodeIDVector,
+    ValueVector& propertyVector, Index::UpdateState&) {
+    KU_ASSERT(nodeIDVector.state->getSelVector().getSelSize() == 1);
+    const auto nodeIDPos = nodeIDVector.state->getSelVector()[0];
+    const auto keyPos = propertyVector.state->getSelVector()[0];
+    const auto offset = nodeIDVector.readNodeOffset(nodeIDPos);
+    std::unique_lock lck{mtx};
+    if (transaction->isUnCommitted(indexInfo.tableID, offset)) {
+        // The final values of uncommitted nodes are indexed when the transaction commits.
+        resetLocalEntriesIfNeeded(transaction);
+        if (!propertyVector.isNull(keyPos)) {
+            localEntries->insert(propertyVector, keyPos, offset);
+        }
+        return;
+    }
+    // The entry of the old value is removed at the next checkpoint. Until then, both entries are
+    // returned by lookups and the stale one is filtered out when the predicate is re-evaluated.
+    if (!propertyVector.isNull(keyPos) &&
+        committedEntries->insert(propertyVector, keyPos, offset)) {
+        auto& entries = updatedEntries[transaction->getID()];
+        if (!entries) {
+            entries = OrderedIndexEntries::create(indexInfo.keyDataTypes[0], mm);
+            transaction->pushIndexUpdateInfo(*this);
+        }
+        entries->insert(propertyVector, keyPos, offset);
+    }
+    dirtyOffsets.insert(offset);
+}
+
+std::unique_ptr<Index::DeleteState> OrderedIndex::initDeleteState(const Transaction*,
+    MemoryManager*, visible_func) {
+    return std::make_unique<DeleteState>();
+}
+
+void OrderedIndex::delete_(Transaction* transaction, const ValueVector& nodeIDVector,
+    Index::DeleteState&) {
+    std::unique_lock lck{mtx};
+    nodeIDVector.state->getSelVector().forEach([&](auto i) {
+        if (nodeIDVector.isNull(i)) {
+            return;
+        }
+        const auto offset = nodeIDVector.readNodeOffset(i);
+        if (transaction->isUnCommitted(indexInfo.tableID, offset)) {
+            resetLocalEntriesIfNeeded(transaction);
+            localDeletedOffsets.insert(offset);
+        } else {
+            // Deleted nodes are not visible to lookups, so their entries are only removed at the
+            // next checkpoint, when the deletion can no longer be rolled back.
+            dirtyOffsets.insert(offset);
+        }
+    });
+}
+
+void OrderedIndex::commitInsert(Transaction* transaction, const ValueVector& nodeIDVector,
+    const std::vector<ValueVector*>& indexVectors, Index::InsertState&) {
+    KU_ASSERT(indexVectors.size() == 1);
+    const auto& keyVector = *indexVectors[0];
+    std::unique_lock lck{mtx};
+    if (transaction->getID() == localTransactionID) {
+        localEntries->clear();
+        localDeletedOffsets.clear();
+        localTransactionID = INVALID_TRANSACTION;
+    }
+    keyVector.state->getSelVector().forEach([&](auto pos) {
+        const auto offset = nodeIDVector.readNodeOffset(pos);
+        numIndexedNodes = std::max(numIndexedNodes, offset + 1);
+        if (keyVector.isNull(pos)) {
+            return;
+        }
+        committedEntries->insert(keyVector, pos, offset);
+    });
+}
+
+void OrderedIndex::rollbackInsert(offset_t startOffset, row_idx_t numRows) {
+    std::unique_lock lck{mtx};
+    committedEntries->erase(startOffset, startOffset + numRows);
+    // The offsets are reused by the next insertion, which has to be indexed again.
+    numIndexedNodes = std::min(numIndexedNodes, startOffset);
+    KU_ASSERT(
+        numIndexedNodes >= storageInfo->constCast<OrderedIndexStorageInfo>().numIndexedNodes);
+}
+
+void OrderedIndex::commitUpdate(transaction_t transactionID) {
+    std::unique_lock lck{mtx};
+    updatedEntries.erase(transactionID);
+}
+
+void OrderedIndex::rollbackUpdate(transaction_t transactionID) {
+    std::unique_lock lck{mtx};
+    const auto it = updatedEntries.find(transactionID);
+    if (it == updatedEntries.end()) {
+        return;
+    }
+    committedEntries->erase(*it->second);
+    updatedEntries.erase(it);
+}
+
+std::vector<offset_t> OrderedIndex::refreshDirtyOffsets(main::ClientContext* context,
+    NodeTable& nodeTable) {
+    if (dirtyOffsets.empty()) {
+        return {};
+    }
+    committedEntries->erase(dirtyOffsets);
+    const auto columnID = indexInfo.columnIDs[0];
+    std::vector<LogicalType> types;
+    types.push_back(LogicalType::INTERNAL_ID());
+    types.push_back(nodeTable.getColumn(columnID).getDataType().copy());
+    auto dataChunk = Table::constructDataChunk(context->getMemoryManager(), std::move(types));
+    NodeTableScanState scanState{&dataChunk.getValueVectorMutable(0),
+        std::vector{&dataChunk.getValueVectorMutable(1)}, dataChunk.state};
+    scanState.setToTable(&DUMMY_CHECKPOINT_TRANSACTION, &nodeTable, {columnID}, {});
+    scanState.source = TableScanSource::COMMITTED;
+    scanState.nodeGroupIdx = INVALID_NODE_GROUP_IDX;
+    const auto& keyVector = *scanState.outputVectors[0];
+    std::vector<offset_t> offsets{dirtyOffsets.begin(), dirtyOffsets.end()};
+    std::sort(offsets.begin(), offsets.end());
+    for (const auto offset : offsets) {
+        if (!nodeTable.isVisibleNoLock(&DUMMY_CHECKPOINT_TRANSACTION, offset)) {
+            continue;
+        }
+        scanState.nodeIDVector->setValue(0, internalID_t{offset, indexInfo.tableID});
+        scanState.nodeIDVector->state->getSelVectorUnsafe().setToUnfiltered(1);
+        const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(offset);
+        if (scanState.nodeGroupIdx != nodeGroupIdx) {
+            scanState.nodeGroupIdx = nodeGroupIdx;
+            nodeTable.initScanState(&DUMMY_CHECKPOINT_TRANSACTION, scanState);
+        }
+        if (!nodeTable.lookup<false>(&DUMMY_CHECKPOINT_TRANSACTION, scanState) ||
+            keyVector.isNull(0)) {
+            continue;
+        }
+        committedEntries->insert(keyVector, 0, offset);
+    }
+    dirtyOffsets.clear();
+    return offsets;
+}
+
+void OrderedIndex::checkpoint(main::ClientContext* context, PageAllocator& pageAllocator) {
+    auto& nodeTable =
+        context->getStorageManager()->getTable(indexInfo.tableID)->cast<NodeTable>();
+    std::unique_lock lck{mtx};
+    // Checkpointing requires all transactions to have finished.
+    localEntries->clear();
+    localDeletedOffsets.clear();
+    localTransactionID = INVALID_TRANSACTION;
+    updatedEntries.clear();
+    const auto changedOffsets = refreshDirtyOffsets(context, nodeTable);
+    if (!pageAllocator.getDataFH()->isInMemoryMode()) {
+        persistEntries(context, pageAllocator, changedOffsets);
+    }
+}
+
+void OrderedIndex::persistEntries(main::ClientContext* context, PageAllocator& pageAllocator,
+    const std::vector<offset_t>& changedOffsets) {
+    const auto& persistedInfo = storageInfo->constCast<OrderedIndexStorageInfo>();
+    // Entries of nodes from this offset on are either new or rolled back since the last run.
+    const auto tailStartOffset = persistedInfo.numIndexedNodes;
+    if (!rewriteEntries && changedOffsets.empty() && numIndexedNodes == tailStartOffset) {
+        return;
+    }
+    persisting = true;
+    const std::unordered_set<offset_t> changedOffsetSet{changedOffsets.begin(),
+        changedOffsets.end()};
+    auto writer = std::make_shared<InMemFileWriter>(*context->getMemoryManager());
+    Serializer ser(writer);
+    ser.write<offset_t>(tailStartOffset);
+    ser.serializeVector(changedOffsets);
+    auto numEntries = committedEntries->serialize(ser, [&](offset_t offset) {
+        return offset >= tailStartOffset || changedOffsetSet.contains(offset);
+    });
+    auto runs = persistedInfo.runs;
+    auto numEntriesInRuns = persistedInfo.numEntriesInRuns + numEntries;
+    if (rewriteEntries || runs.size() >= MAX_NUM_RUNS ||
+        numEntriesInRuns > 2 * committedEntries->size()) {
+        // The runs are replaced by a single one holding all entries.
+        for (const auto& run : runs) {
+            pageAllocator.freePageRange(run);
+        }
+        runs.clear();
+        writer->clear();
+        ser.write<offset_t>(0 /* tailStartOffset */);
+        ser.serializeVector(std::vector<offset_t>{});
+        numEntries = committedEntries->serialize(ser, [](offset_t) { return true; });
+        numEntriesInRuns = numEntries;
+    }
+    runs.push_back(writer->flush(pageAllocator, context->getStorageManager()->getShadowFile()));
+    storageInfo = std::make_unique<OrderedIndexStorageInfo>(std::move(runs), numEntriesInRuns,
+        numIndexedNodes);
+    persisting = false;
+    rewriteEntries = false;
+}
+
+void OrderedIndex::rollbackCheckpoint() {
+    std::unique_lock lck{mtx};
+    if (persisting) {
+        persisting = false;
+        rewriteEntries = true;
+    }
+}
+
+void OrderedIndex::finalize(main::ClientContext* context) {
+    // Nodes copied in bulk are appended to the table directly and are indexed here, by the copying
+    // transaction, which is the only one that sees them yet. Other transactions skip the entries
+    // as long as the nodes aren't visible to them, and rollbackInsert() removes them if the copy
+    // is rolled back.
+    auto transaction = context->getTransaction();
+    auto& nodeTable =
+        context->getStorageManager()->getTable(indexInfo.tableID)->cast<NodeTable>();
+    if (nodeTable.getNumTotalRows(transaction) == numIndexedNodes) {
+        return;
+    }
+    indexNodes(context, transaction, nodeTable, numIndexedNodes);
+}
+
+void OrderedIndex::reclaimStorage(PageAllocator& pageAllocator) const {
+    for (const auto& run : storageInfo->constCast<OrderedIndexStorageInfo>().runs) {
+        pageAllocator.freePageRange(run);
+    }
+}
+
+void OrderedIndex::compactStorage(StorageCompactor& compactor) {
+    for (auto& run : storageInfo->cast<OrderedIndexStorageInfo>().runs) {
+        if (const auto pageRange = compactor.relocate(run)) {
+            compactor.addRollbackAction([&run, oldPageRange = run]() { run = oldPageRange; });
+            run = *pageRange;
+        }
+    }
+}
+
+std::unique_ptr<Index> OrderedIndex::load(main::ClientContext* context,
+    StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer) {
+    KU_ASSERT(indexInfo.keyDataTypes.size() == 1);
+    auto storageInfo = OrderedIndexStorageInfo::deserialize(
+        std::make_unique<BufferReader>(storageInfoBuffer.data(), storageInfoBuffer.size()));
+    const auto mm = context->getMemoryManager();
+    auto entries = OrderedIndexEntries::create(indexInfo.keyDataTypes[0], mm);
+    if (!storageInfo->runs.empty()) {
+        auto reader =
+            std::make_unique<BufferedFileReader>(*storageManager->getDataFH()->getFileInfo());
+        const auto readerPtr = reader.get();
+        Deserializer deSer(std::move(reader));
+        // Each run replaces the entries of the nodes that changed since the previous one.
+        for (const auto& run : storageInfo->runs) {
+            readerPtr->resetReadOffset(run.startPageIdx * KUZU_PAGE_SIZE);
+            offset_t tailStartOffset = 0;
+            std::vector<offset_t> changedOffsets;
+            deSer.deserializeValue<offset_t>(tailStartOffset);
+            deSer.deserializeVector(changedOffsets);
+            entries->erase(tailStartOffset, INVALID_OFFSET);
+            if (!changedOffsets.empty()) {
+                entries->erase(
+                    std::unordered_set<offset_t>{changedOffsets.begin(), changedOffsets.end()});
+            }
+            entries->deserialize(deSer);
+        }
+    }
+    return std::make_unique<OrderedIndex>(mm, std::move(indexInfo), std::move(storageInfo),
+        std::move(entries));
+}
+
+} // namespace storage
+} // namespace kuzu
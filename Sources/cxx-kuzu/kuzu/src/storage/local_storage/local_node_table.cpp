@@ -5,6 +5,7 @@
 #include "common/exception/message.h"
 #include "common/types/types.h"
 #include "storage/index/hash_index.h"
+#include "storage/local_storage/local_storage.h"
 #include "storage/storage_utils.h"
 #include "storage/table/node_table.h"
 
@@ -26,7 +27,8 @@ std::vector<LogicalType> LocalNodeTable::getNodeTableColumnTypes(
 LocalNodeTable::LocalNodeTable(const catalog::TableCatalogEntry* tableEntry, Table& table,
     MemoryManager& mm)
     : LocalTable{table}, overflowFileHandle(nullptr),
-      nodeGroups{mm, getNodeTableColumnTypes(*tableEntry), false /*enableCompression*/} {
+      nodeGroups{mm, getNodeTableColumnTypes(*tableEntry), false /*enableCompression*/},
+      pageAllocator{nullptr} {
     initLocalHashIndex(mm);
     startOffset = table.getNumTotalRows(nullptr /* transaction */);
 }
@@ -59,17 +61,21 @@ offset_t LocalNodeTable::validateUniquenessConstraint(const Transaction* transac
 
 bool LocalNodeTable::insert(Transaction* transaction, TableInsertState& insertState) {
     auto& nodeInsertState = insertState.constCast<NodeTableInsertState>();
-    const auto nodeOffset = startOffset + nodeGroups.getNumTotalRows();
-    KU_ASSERT(nodeInsertState.pkVector.state->getSelVector().getSelSize() == 1);
-    if (!hashIndex->insert(nodeInsertState.pkVector, nodeOffset,
-            [&](offset_t offset) { return isVisible(transaction, offset); })) {
-        const auto val =
-            nodeInsertState.pkVector.getAsValue(nodeInsertState.pkVector.state->getSelVector()[0]);
-        throw RuntimeException(ExceptionMessage::duplicatePKException(val->toString()));
+    const auto startNodeOffset = startOffset + nodeGroups.getNumTotalRows();
+    auto& pkSelVector = nodeInsertState.pkVector.state->getSelVector();
+    auto& nodeIDSelVector = nodeInsertState.nodeIDVector.state->getSelVector();
+    KU_ASSERT(pkSelVector.getSelSize() == nodeIDSelVector.getSelSize());
+    for (auto i = 0u; i < pkSelVector.getSelSize(); i++) {
+        const auto nodeOffset = startNodeOffset + i;
+        if (!hashIndex->insert(nodeInsertState.pkVector, pkSelVector[i], nodeOffset,
+                [&](offset_t offset) { return isVisible(transaction, offset); })) {
+            const auto val = nodeInsertState.pkVector.getAsValue(pkSelVector[i]);
+            throw RuntimeException(ExceptionMessage::duplicatePKException(val->toString()));
+        }
+        nodeInsertState.nodeIDVector.setValue(nodeIDSelVector[i],
+            internalID_t{nodeOffset, table.getTableID()});
     }
-    const auto nodeIDPos =
-        nodeInsertState.nodeIDVector.state->getSelVector().getSelectedPositions()[0];
-    nodeInsertState.nodeIDVector.setValue(nodeIDPos, internalID_t{nodeOffset, table.getTableID()});
+    // All rows go into local storage with one append.
     nodeGroups.append(&DUMMY_TRANSACTION, insertState.propertyVectors);
     return true;
 }
@@ -85,6 +91,8 @@ bool LocalNodeTable::update(Transaction* transaction, TableUpdateState& updateSt
     const auto [nodeGroupIdx, rowIdxInGroup] =
         StorageUtils::getQuotientRemainder(offset - startOffset, StorageConfig::NODE_GROUP_SIZE);
     const auto nodeGroup = nodeGroups.getNodeGroup(nodeGroupIdx);
+    // Flushed data can't be updated in place.
+    loadFlushedNodeGroup(*nodeGroup);
     nodeGroup->update(transaction, rowIdxInGroup, nodeUpdateState.columnID,
         nodeUpdateState.propertyVector);
     return true;
@@ -105,16 +113,86 @@ bool LocalNodeTable::delete_(Transaction* transaction, TableDeleteState& deleteS
 }
 
 bool LocalNodeTable::addColumn(TableAddColumnState& addColumnState) {
+    // The new column is added in memory, so flushed node groups have to be loaded first.
+    loadFlushedNodeGroups();
     nodeGroups.addColumn(addColumnState);
     return true;
 }
 
+std::vector<const Column*> LocalNodeTable::getColumns() const {
+    // Local chunks are laid out in the same order as the columns of the table.
+    auto& nodeTable = ku_dynamic_cast<const NodeTable&>(table);
+    std::vector<const Column*> columns;
+    for (auto columnID = 0u; columnID < nodeGroups.getNumColumns(); columnID++) {
+        columns.push_back(&nodeTable.getColumn(columnID));
+    }
+    return columns;
+}
+
+void LocalNodeTable::flushFullNodeGroups(LocalStorage& localStorage) {
+    std::vector<const Column*> columns;
+    for (auto nodeGroupIdx = 0u; nodeGroupIdx < nodeGroups.getNumNodeGroups(); nodeGroupIdx++) {
+        const auto nodeGroup = nodeGroups.getNodeGroup(nodeGroupIdx);
+        if (!nodeGroup->isFull() || nodeGroup->isFlushed()) {
+            continue;
+        }
+        if (pageAllocator == nullptr) {
+            pageAllocator = localStorage.addOptimisticAllocator();
+        }
+        if (columns.empty()) {
+            columns = getColumns();
+        }
+        nodeGroup->flushInMemoryData(*pageAllocator, columns, &DUMMY_TRANSACTION);
+    }
+}
+
+void LocalNodeTable::loadFlushedNodeGroups() {
+    for (auto nodeGroupIdx = 0u; nodeGroupIdx < nodeGroups.getNumNodeGroups(); nodeGroupIdx++) {
+        loadFlushedNodeGroup(*nodeGroups.getNodeGroup(nodeGroupIdx));
+    }
+}
+
+std::unique_ptr<ChunkedNodeGroup> LocalNodeTable::scanFlushedNodeGroup(
+    node_group_idx_t nodeGroupIdx) const {
+    const auto nodeGroup = nodeGroups.getNodeGroup(nodeGroupIdx);
+    KU_ASSERT(nodeGroup->isFlushed());
+    return nodeGroup->scanFlushedData(getColumns());
+}
+
+std::unique_ptr<ChunkedNodeGroup> LocalNodeTable::shareFlushedNodeGroup(
+    node_group_idx_t nodeGroupIdx) {
+    const auto nodeGroup = nodeGroups.getNodeGroup(nodeGroupIdx);
+    KU_ASSERT(nodeGroup->isFlushed());
+    sharedNodeGroups.insert(nodeGroupIdx);
+    return nodeGroup->shareFlushedData();
+}
+
+void LocalNodeTable::reclaimFlushedNodeGroups() const {
+    for (auto nodeGroupIdx = 0u; nodeGroupIdx < nodeGroups.getNumNodeGroups(); nodeGroupIdx++) {
+        const auto nodeGroup = nodeGroups.getNodeGroup(nodeGroupIdx);
+        if (nodeGroup->isFlushed() && !sharedNodeGroups.contains(nodeGroupIdx)) {
+            KU_ASSERT(pageAllocator);
+            nodeGroup->reclaimStorage(*pageAllocator);
+        }
+    }
+}
+
+void LocalNodeTable::loadFlushedNodeGroup(NodeGroup& nodeGroup) const {
+    if (!nodeGroup.isFlushed()) {
+        return;
+    }
+    KU_ASSERT(pageAllocator && !sharedNodeGroups.contains(nodeGroup.getNodeGroupIdx()));
+    nodeGroup.loadFlushedData(*pageAllocator, getColumns(), &DUMMY_TRANSACTION);
+}
+
 void LocalNodeTable::clear(MemoryManager& mm) {
     auto& nodeTable = ku_dynamic_cast<const NodeTable&>(table);
     hashIndex = std::make_unique<LocalHashIndex>(mm,
         nodeTable.getColumn(nodeTable.getPKColumnID()).getDataType().getPhysicalType(),
         overflowFileHandle);
     nodeGroups.clear();
+    pageAllocator = nullptr;
+    sharedNodeGroups.clear();
 }
 
 bool LocalNodeTable::lookupPK(const Transaction* transaction, const ValueVector* keyVector,
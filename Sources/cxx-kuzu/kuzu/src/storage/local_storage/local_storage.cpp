@@ -1,6 +1,7 @@
 #include "storage/local_storage/local_storage.h"
 
 #include "main/client_context.h"
+#include "storage/buffer_manager/buffer_manager.h"
 #include "storage/local_storage/local_node_table.h"
 #include "storage/local_storage/local_rel_table.h"
 #include "storage/local_storage/local_table.h"
@@ -56,6 +57,20 @@ PageAllocator* LocalStorage::addOptimisticAllocator() {
     return optimisticAllocators.back().get();
 }
 
+void LocalStorage::flushLargeLocalTables() {
+    if (clientContext.getStorageManager()->isInMemory() ||
+        !clientContext.getMemoryManager()->getBufferManager()->isUnderMemoryPressure()) {
+        return;
+    }
+    // Local rel tables are kept in memory, as their rows are looked up by position in a single
+    // node group.
+    for (auto& [_, localTable] : tables) {
+        if (localTable->getTableType() == TableType::NODE) {
+            localTable->cast<LocalNodeTable>().flushFullNodeGroups(*this);
+        }
+    }
+}
+
 void LocalStorage::commit() {
     auto catalog = clientContext.getCatalog();
     auto transaction = clientContext.getTransaction();
@@ -15,6 +15,28 @@ PageRange OptimisticAllocator::allocatePageRange(common::page_idx_t numPages) {
 }
 
 void OptimisticAllocator::freePageRange(PageRange block) {
+    // Pages allocated by this transaction were never visible to others, so they can be reused
+    // right away. They are also no longer tracked, as freeing them again on rollback would hand
+    // them out twice.
+    for (auto i = 0u; i < optimisticallyAllocatedPages.size(); i++) {
+        const auto entry = optimisticallyAllocatedPages[i];
+        if (block.startPageIdx < entry.startPageIdx ||
+            block.startPageIdx + block.numPages > entry.startPageIdx + entry.numPages) {
+            continue;
+        }
+        optimisticallyAllocatedPages.erase(optimisticallyAllocatedPages.begin() + i);
+        if (block.startPageIdx > entry.startPageIdx) {
+            optimisticallyAllocatedPages.emplace_back(entry.startPageIdx,
+                block.startPageIdx - entry.startPageIdx);
+        }
+        const auto blockEnd = block.startPageIdx + block.numPages;
+        if (blockEnd < entry.startPageIdx + entry.numPages) {
+            optimisticallyAllocatedPages.emplace_back(blockEnd,
+                entry.startPageIdx + entry.numPages - blockEnd);
+        }
+        pageManager.freeImmediatelyRewritablePageRange(pageManager.getDataFH(), block);
+        return;
+    }
     pageManager.freePageRange(block);
 }
 
@@ -9,7 +9,9 @@ static constexpr bool ENABLE_FSM = true;
 PageRange PageManager::allocatePageRange(common::page_idx_t numPages) {
     if constexpr (ENABLE_FSM) {
         common::UniqLock lck{mtx};
-        auto allocatedFreeChunk = freeSpaceManager->popFreePages(numPages);
+        auto allocatedFreeChunk =
+            compacting ? freeSpaceManager->popLowestFreePages(numPages, common::INVALID_PAGE_IDX) :
+                         freeSpaceManager->popFreePages(numPages);
         if (allocatedFreeChunk.has_value()) {
             ++version;
             return {*allocatedFreeChunk};
@@ -20,6 +22,19 @@ PageRange PageManager::allocatePageRange(common::page_idx_t numPages) {
     return PageRange(startPageIdx, numPages);
 }
 
+std::optional<PageRange> PageManager::allocatePageRangeBefore(common::page_idx_t numPages,
+    common::page_idx_t pageIdx) {
+    if constexpr (ENABLE_FSM) {
+        common::UniqLock lck{mtx};
+        auto allocatedFreeChunk = freeSpaceManager->popLowestFreePages(numPages, pageIdx);
+        if (allocatedFreeChunk.has_value()) {
+            ++version;
+        }
+        return allocatedFreeChunk;
+    }
+    return std::nullopt;
+}
+
 void PageManager::freePageRange(PageRange entry) {
     if constexpr (ENABLE_FSM) {
         common::UniqLock lck{mtx};
@@ -31,6 +46,7 @@ void PageManager::freePageRange(PageRange entry) {
 }
 
 common::page_idx_t PageManager::estimatePagesNeededForSerialize() {
+    common::UniqLock lck{mtx};
     return freeSpaceManager->getMaxNumPagesForSerialization();
 }
 
@@ -43,18 +59,50 @@ void PageManager::freeImmediatelyRewritablePageRange(FileHandle* fileHandle, Pag
 }
 
 void PageManager::serialize(common::Serializer& serializer) {
+    common::UniqLock lck{mtx};
     freeSpaceManager->serialize(serializer);
 }
 
 void PageManager::deserialize(common::Deserializer& deSer) {
-    freeSpaceManager->deserialize(deSer);
+    common::UniqLock lck{mtx};
+    freeSpaceManager->deserialize(deSer, fileHandle->getNumPages());
 }
 
 void PageManager::finalizeCheckpoint() {
+    common::UniqLock lck{mtx};
     freeSpaceManager->finalizeCheckpoint(fileHandle);
+    compacting = false;
+}
+
+void PageManager::rollbackCheckpoint() {
+    common::UniqLock lck{mtx};
+    freeSpaceManager->rollbackCheckpoint();
+    compacting = false;
+}
+
+void PageManager::setCompacting(bool compacting_) {
+    common::UniqLock lck{mtx};
+    compacting = compacting_;
+}
+
+common::row_idx_t PageManager::getNumFreeEntries() const {
+    common::UniqLock lck{mtx};
+    return freeSpaceManager->getNumEntries();
+}
+
+common::page_idx_t PageManager::getNumFreePages() const {
+    common::UniqLock lck{mtx};
+    return freeSpaceManager->getNumFreePages();
+}
+
+std::vector<PageRange> PageManager::getFreeEntries(common::row_idx_t startOffset,
+    common::row_idx_t endOffset) const {
+    common::UniqLock lck{mtx};
+    return freeSpaceManager->getEntries(startOffset, endOffset);
 }
 
 void PageManager::clearEvictedBMEntriesIfNeeded(BufferManager* bufferManager) {
+    common::UniqLock lck{mtx};
     freeSpaceManager->clearEvictedBufferManagerEntriesIfNeeded(bufferManager);
 }
 } // namespace kuzu::storage
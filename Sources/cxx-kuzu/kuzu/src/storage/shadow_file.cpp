@@ -30,14 +30,16 @@ ShadowPageRecord ShadowPageRecord::deserialize(Deserializer& deserializer) {
     return ShadowPageRecord{originalFileIdx, originalPageIdx};
 }
 
-ShadowFile::ShadowFile(BufferManager& bm, VirtualFileSystem* vfs, const std::string& databasePath)
+ShadowFile::ShadowFile(BufferManager& bm, VirtualFileSystem* vfs, const std::string& databasePath,
+    bool enableDirectIO)
     : bm{bm}, shadowFilePath{StorageUtils::getShadowFilePath(databasePath)}, vfs{vfs},
-      shadowingFH{nullptr} {
+      enableDirectIO{enableDirectIO}, shadowingFH{nullptr} {
     KU_ASSERT(vfs);
 }
 
 void ShadowFile::clearShadowPage(file_idx_t originalFile, page_idx_t originalPage) {
-    if (hasShadowPage(originalFile, originalPage)) {
+    std::unique_lock lck{mtx};
+    if (hasShadowPageNoLock(originalFile, originalPage)) {
         shadowPagesMap.at(originalFile).erase(originalPage);
         if (shadowPagesMap.at(originalFile).empty()) {
             shadowPagesMap.erase(originalFile);
@@ -45,18 +47,21 @@ void ShadowFile::clearShadowPage(file_idx_t originalFile, page_idx_t originalPag
     }
 }
 
-page_idx_t ShadowFile::getOrCreateShadowPage(file_idx_t originalFile, page_idx_t originalPage) {
-    if (hasShadowPage(originalFile, originalPage)) {
-        return shadowPagesMap[originalFile][originalPage];
+std::pair<page_idx_t, bool> ShadowFile::getOrCreateShadowPage(file_idx_t originalFile,
+    page_idx_t originalPage) {
+    std::unique_lock lck{mtx};
+    if (hasShadowPageNoLock(originalFile, originalPage)) {
+        return {shadowPagesMap[originalFile][originalPage], false};
     }
     const auto shadowPageIdx = getOrCreateShadowingFH()->addNewPage();
     shadowPagesMap[originalFile][originalPage] = shadowPageIdx;
     shadowPageRecords.push_back({originalFile, originalPage});
-    return shadowPageIdx;
+    return {shadowPageIdx, true};
 }
 
 page_idx_t ShadowFile::getShadowPage(file_idx_t originalFile, page_idx_t originalPage) const {
-    KU_ASSERT(hasShadowPage(originalFile, originalPage));
+    std::shared_lock lck{mtx};
+    KU_ASSERT(hasShadowPageNoLock(originalFile, originalPage));
     return shadowPagesMap.at(originalFile).at(originalPage);
 }
 
@@ -147,10 +152,18 @@ void ShadowFile::reset() {
     vfs->removeFileIfExists(shadowFilePath);
 }
 
+void ShadowFile::createShadowingFHIfNecessary() {
+    std::unique_lock lck{mtx};
+    getOrCreateShadowingFH();
+}
+
 FileHandle* ShadowFile::getOrCreateShadowingFH() {
     if (!shadowingFH) {
-        shadowingFH = bm.getFileHandle(shadowFilePath,
-            FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS, vfs, nullptr);
+        auto flag = FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS;
+        if (enableDirectIO) {
+            flag |= FileHandle::O_DIRECT_IO;
+        }
+        shadowingFH = bm.getFileHandle(shadowFilePath, flag, vfs, nullptr);
         if (shadowingFH->getNumPages() == 0) {
             // Reserve the first page for the header.
             shadowingFH->addNewPage();
@@ -12,11 +12,11 @@ namespace storage {
 ShadowPageAndFrame ShadowUtils::createShadowVersionIfNecessaryAndPinPage(page_idx_t originalPage,
     bool skipReadingOriginalPage, FileHandle& fileHandle, ShadowFile& shadowFile) {
     KU_ASSERT(!fileHandle.isInMemoryMode());
-    const auto hasShadowPage = shadowFile.hasShadowPage(fileHandle.getFileIndex(), originalPage);
-    auto shadowPage = shadowFile.getOrCreateShadowPage(fileHandle.getFileIndex(), originalPage);
+    const auto [shadowPage, isNewShadowPage] =
+        shadowFile.getOrCreateShadowPage(fileHandle.getFileIndex(), originalPage);
     uint8_t* shadowFrame = nullptr;
     try {
-        if (hasShadowPage) {
+        if (!isNewShadowPage) {
             shadowFrame =
                 shadowFile.getShadowingFH().pinPage(shadowPage, PageReadPolicy::READ_PAGE);
         } else {
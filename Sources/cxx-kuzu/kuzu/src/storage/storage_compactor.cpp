@@ -0,0 +1,51 @@
+#include "storage/storage_compactor.h"
+
+#include "storage/compression/block_compression.h"
+#include "storage/file_handle.h"
+#include "storage/page_manager.h"
+#include "storage/shadow_file.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+std::optional<PageRange> StorageCompactor::relocate(PageRange pageRange) {
+    if (pageRange.numPages == 0 || pageRange.startPageIdx == INVALID_PAGE_IDX) {
+        return std::nullopt;
+    }
+    // Pages updated during this checkpoint have their new versions in the shadow file, which are
+    // applied to the original location. They are left for a later compaction.
+    for (auto i = 0u; i < pageRange.numPages; i++) {
+        if (shadowFile.hasShadowPage(dataFH.getFileIndex(), pageRange.startPageIdx + i)) {
+            return std::nullopt;
+        }
+    }
+    const auto newPageRange =
+        pageManager.allocatePageRangeBefore(pageRange.numPages, pageRange.startPageIdx);
+    if (!newPageRange) {
+        return std::nullopt;
+    }
+    const auto pages = BlockCompression::readPages(dataFH, pageRange,
+        static_cast<uint64_t>(pageRange.numPages) * dataFH.getPageSize());
+    dataFH.writePagesToFile(pages.data(), pages.size(), newPageRange->startPageIdx);
+    pageManager.freePageRange(pageRange);
+    numMovedPages += pageRange.numPages;
+    newPageRanges.push_back(*newPageRange);
+    return newPageRange;
+}
+
+void StorageCompactor::rollback() {
+    for (auto it = rollbackActions.rbegin(); it != rollbackActions.rend(); ++it) {
+        (*it)();
+    }
+    rollbackActions.clear();
+    for (const auto& pageRange : newPageRanges) {
+        pageManager.freeImmediatelyRewritablePageRange(&dataFH, pageRange);
+    }
+    newPageRanges.clear();
+    numMovedPages = 0;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -1,14 +1,23 @@
 #include "storage/storage_manager.h"
 
+#include <atomic>
+#include <span>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/serializer/in_mem_file_writer.h"
+#include "common/task_system/task_scheduler.h"
 #include "main/client_context.h"
 #include "main/db_config.h"
+#include "processor/execution_context.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/checkpointer.h"
+#include "storage/index/ordered_index.h"
+#include "storage/storage_compactor.h"
 #include "storage/table/node_table.h"
 #include "storage/table/rel_table.h"
 #include "storage/wal/wal_replayer.h"
@@ -22,14 +31,18 @@ namespace kuzu {
 namespace storage {
 
 StorageManager::StorageManager(const std::string& databasePath, bool readOnly,
-    MemoryManager& memoryManager, bool enableCompression, VirtualFileSystem* vfs)
+    MemoryManager& memoryManager, bool enableCompression, VirtualFileSystem* vfs,
+    bool enableDirectIO, bool enableMemoryMappedReads)
     : databasePath{databasePath}, readOnly{readOnly}, dataFH{nullptr}, memoryManager{memoryManager},
-      enableCompression{enableCompression} {
+      enableCompression{enableCompression}, enableDirectIO{enableDirectIO},
+      enableMemoryMappedReads{enableMemoryMappedReads}, compactionRequested{false},
+      compacting{false} {
     wal = std::make_unique<WAL>(databasePath, readOnly, vfs);
-    shadowFile =
-        std::make_unique<ShadowFile>(*memoryManager.getBufferManager(), vfs, this->databasePath);
+    shadowFile = std::make_unique<ShadowFile>(*memoryManager.getBufferManager(), vfs,
+        this->databasePath, enableDirectIO);
     inMemory = main::DBConfig::isDBPathInMemory(databasePath);
     registerIndexType(PrimaryKeyIndex::getIndexType());
+    registerIndexType(OrderedIndex::getIndexType());
 }
 
 StorageManager::~StorageManager() = default;
@@ -42,6 +55,12 @@ void StorageManager::initDataFileHandle(VirtualFileSystem* vfs, main::ClientCont
         auto flag = readOnly ? FileHandle::O_PERSISTENT_FILE_READ_ONLY :
                                FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS;
         flag |= FileHandle::O_LOCKED_PERSISTENT_FILE;
+        if (enableDirectIO) {
+            flag |= FileHandle::O_DIRECT_IO;
+        }
+        if (readOnly && enableMemoryMappedReads) {
+            flag |= FileHandle::O_MEMORY_MAPPED;
+        }
         dataFH = memoryManager.getBufferManager()->getFileHandle(databasePath, flag, vfs, context);
         if (dataFH->getNumPages() == 0) {
             if (!readOnly) {
@@ -154,19 +173,45 @@ void StorageManager::reclaimDroppedTables(const Catalog& catalog) {
     }
 }
 
+class CheckpointTablesTask final : public Task {
+public:
+    CheckpointTablesTask(uint64_t maxNumThreads, main::ClientContext* context,
+        std::span<const std::pair<Table*, TableCatalogEntry*>> tables,
+        PageAllocator& pageAllocator)
+        : Task{maxNumThreads}, context{context}, tables{tables}, pageAllocator{pageAllocator},
+          nextIdx{0}, hasChanges{false} {}
+
+    void run() override {
+        for (auto i = nextIdx.fetch_add(1); i < tables.size(); i = nextIdx.fetch_add(1)) {
+            const auto [table, entry] = tables[i];
+            if (table->checkpoint(context, entry, pageAllocator)) {
+                hasChanges = true;
+            }
+        }
+    }
+
+    bool hasAnyChanges() const { return hasChanges; }
+
+private:
+    main::ClientContext* context;
+    std::span<const std::pair<Table*, TableCatalogEntry*>> tables;
+    PageAllocator& pageAllocator;
+    std::atomic<uint64_t> nextIdx;
+    std::atomic<bool> hasChanges;
+};
+
 bool StorageManager::checkpoint(main::ClientContext* context, PageAllocator& pageAllocator) {
-    bool hasChanges = false;
     const auto catalog = context->getCatalog();
     const auto nodeTableEntries = catalog->getNodeTableEntries(&DUMMY_CHECKPOINT_TRANSACTION);
     const auto relGroupEntries = catalog->getRelGroupEntries(&DUMMY_CHECKPOINT_TRANSACTION);
 
+    std::vector<std::pair<Table*, TableCatalogEntry*>> tablesToCheckpoint;
     for (const auto entry : nodeTableEntries) {
         if (!tables.contains(entry->getTableID())) {
             throw RuntimeException(stringFormat(
                 "Checkpoint failed: table {} not found in storage manager.", entry->getName()));
         }
-        hasChanges =
-            tables.at(entry->getTableID())->checkpoint(context, entry, pageAllocator) || hasChanges;
+        tablesToCheckpoint.emplace_back(tables.at(entry->getTableID()).get(), entry);
     }
     for (const auto entry : relGroupEntries) {
         for (auto& info : entry->getRelEntryInfos()) {
@@ -174,17 +219,74 @@ bool StorageManager::checkpoint(main::ClientContext* context, PageAllocator& pag
                 throw RuntimeException(stringFormat(
                     "Checkpoint failed: table {} not found in storage manager.", entry->getName()));
             }
-            hasChanges =
-                tables.at(info.oid)->checkpoint(context, entry, pageAllocator) || hasChanges;
+            tablesToCheckpoint.emplace_back(tables.at(info.oid).get(), entry);
         }
+    }
+    shadowFile->createShadowingFHIfNecessary();
+    // Tables don't share pages, so they are checkpointed in parallel. Each table checkpoints its
+    // node groups in parallel as well.
+    bool hasChanges = false;
+    const auto numThreads =
+        std::min<uint64_t>(context->getMaxNumThreadForExec(), tablesToCheckpoint.size());
+    if (numThreads <= 1) {
+        for (const auto& [table, entry] : tablesToCheckpoint) {
+            hasChanges = table->checkpoint(context, entry, pageAllocator) || hasChanges;
+        }
+    } else {
+        auto task = std::make_shared<CheckpointTablesTask>(numThreads, context, tablesToCheckpoint,
+            pageAllocator);
+        processor::ExecutionContext executionContext{nullptr, context, 0 /* queryID */};
+        // Checkpoint may be run by a worker thread of the task scheduler (e.g. the CHECKPOINT
+        // statement), so a new worker thread is launched to avoid losing it while waiting.
+        context->getTaskScheduler()->scheduleTaskAndWaitOrError(task, &executionContext,
+            true /* launchNewWorkerThread */);
+        hasChanges = task->hasAnyChanges();
+    }
+    // Rel tables of a group share the catalog entry, so its column IDs are vacuumed once all of
+    // them are checkpointed.
+    for (const auto entry : relGroupEntries) {
         entry->vacuumColumnIDs(1);
     }
     reclaimDroppedTables(*catalog);
+    if (shouldCompact(*context)) {
+        hasChanges = compactStorage(tablesToCheckpoint) || hasChanges;
+    }
     return hasChanges;
 }
 
+bool StorageManager::shouldCompact(const main::ClientContext& context) const {
+    if (inMemory) {
+        return false;
+    }
+    if (compactionRequested) {
+        return true;
+    }
+    const auto threshold = context.getDBConfig()->compactionThreshold;
+    const auto numPages = dataFH->getNumPages();
+    return threshold > 0 && numPages > 0 &&
+           dataFH->getPageManager()->getNumFreePages() > threshold * numPages;
+}
+
+bool StorageManager::compactStorage(
+    std::span<const std::pair<Table*, TableCatalogEntry*>> tablesToCompact) {
+    auto& pageManager = *dataFH->getPageManager();
+    // Tables are compacted one after another, so that each chunk takes the lowest free range.
+    compactor = std::make_unique<StorageCompactor>(pageManager, *dataFH, *shadowFile);
+    for (const auto& [table, entry] : tablesToCompact) {
+        table->compactStorage(*compactor);
+    }
+    pageManager.setCompacting(true);
+    compacting = true;
+    return compactor->getNumMovedPages() > 0;
+}
+
 void StorageManager::finalizeCheckpoint() {
     dataFH->getPageManager()->finalizeCheckpoint();
+    if (compacting) {
+        compactionRequested = false;
+        compacting = false;
+    }
+    compactor.reset();
 }
 
 void StorageManager::rollbackCheckpoint(const Catalog& catalog) {
@@ -194,7 +296,12 @@ void StorageManager::rollbackCheckpoint(const Catalog& catalog) {
         KU_ASSERT(tables.contains(tableEntry->getTableID()));
         tables.at(tableEntry->getTableID())->rollbackCheckpoint();
     }
+    if (compactor) {
+        compactor->rollback();
+        compactor.reset();
+    }
     dataFH->getPageManager()->rollbackCheckpoint();
+    compacting = false;
 }
 
 std::optional<std::reference_wrapper<const IndexType>> StorageManager::getIndexType(
@@ -283,6 +390,13 @@ void StorageManager::deserialize(main::ClientContext* context, const Catalog* ca
             tables.at(info.oid)->deserialize(context, this, deSer);
         }
     }
+    // Built-in secondary indexes are loaded together with their tables, so their catalog entries
+    // are marked as loaded here instead of when an extension is loaded.
+    for (auto& indexEntry : catalog->getIndexEntries(&DUMMY_TRANSACTION)) {
+        if (indexEntry->getIndexType() == OrderedIndex::TYPE_NAME && !indexEntry->isLoaded()) {
+            indexEntry->setAuxInfo(std::make_unique<OrderedIndexAuxInfo>());
+        }
+    }
 }
 
 } // namespace storage
@@ -1,5 +1,7 @@
 #include "storage/table/chunked_node_group.h"
 
+#include <algorithm>
+
 #include "common/assert.h"
 #include "common/types/types.h"
 #include "storage/buffer_manager/buffer_manager.h"
@@ -409,6 +411,15 @@ row_idx_t ChunkedNodeGroup::getNumDeletions(const Transaction* transaction, row_
     return 0;
 }
 
+row_idx_t ChunkedNodeGroup::getNumSelected(const Transaction* transaction, row_idx_t startRow,
+    length_t numRowsToCheck) const {
+    if (versionInfo) {
+        return versionInfo->getNumSelected(transaction, startRow, numRowsToCheck);
+    }
+    const auto numRows = getNumRows();
+    return startRow >= numRows ? 0 : std::min(numRowsToCheck, numRows - startRow);
+}
+
 void ChunkedNodeGroup::finalize() const {
     for (auto i = 0u; i < chunks.size(); i++) {
         chunks[i]->getData().finalize();
@@ -499,6 +510,31 @@ void ChunkedNodeGroup::reclaimStorage(PageAllocator& pageAllocator) const {
     }
 }
 
+void ChunkedNodeGroup::setBlockCompression(PageAllocator& pageAllocator,
+    BlockCompressionType type) const {
+    KU_ASSERT(residencyState == ResidencyState::ON_DISK);
+    for (auto& columnChunk : chunks) {
+        if (columnChunk) {
+            columnChunk->setBlockCompression(pageAllocator, type);
+        }
+    }
+}
+
+bool ChunkedNodeGroup::hasBlockCompression() const {
+    return std::ranges::any_of(chunks, [](const auto& columnChunk) {
+        return columnChunk && columnChunk->getData().getMetadata().blockCompression.type !=
+                                  BlockCompressionType::NONE;
+    });
+}
+
+void ChunkedNodeGroup::compactStorage(StorageCompactor& compactor) const {
+    for (auto& columnChunk : chunks) {
+        if (columnChunk) {
+            columnChunk->compactStorage(compactor);
+        }
+    }
+}
+
 void ChunkedNodeGroup::serialize(Serializer& serializer) const {
     KU_ASSERT(residencyState == ResidencyState::ON_DISK);
     serializer.writeDebuggingInfo("chunks");
@@ -106,7 +106,7 @@ Column::Column(std::string name, LogicalType dataType, FileHandle* dataFH, Memor
     : name{std::move(name)}, dataType{std::move(dataType)}, mm{mm}, dataFH(dataFH),
       shadowFile(shadowFile), enableCompression{enableCompression},
       columnReadWriter(ColumnReadWriterFactory::createColumnReadWriter(
-          this->dataType.getPhysicalType(), dataFH, shadowFile)) {
+          this->dataType.getPhysicalType(), dataFH, shadowFile, mm)) {
     readToVectorFunc = getReadValuesToVectorFunc(this->dataType);
     readToPageFunc = ReadCompressedValuesFromPage(this->dataType);
     writeFunc = getWriteValuesFunc(this->dataType);
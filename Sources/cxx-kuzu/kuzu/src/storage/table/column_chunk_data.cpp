@@ -16,9 +16,11 @@
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/buffer_manager/spill_result.h"
 #include "storage/buffer_manager/spiller.h"
+#include "storage/compression/block_compression.h"
 #include "storage/compression/compression.h"
 #include "storage/compression/float_compression.h"
 #include "storage/stats/column_stats.h"
+#include "storage/storage_compactor.h"
 #include "storage/table/column.h"
 #include "storage/table/column_chunk_metadata.h"
 #include "storage/table/compression_flush_buffer.h"
@@ -301,6 +303,23 @@ void ColumnChunkData::append(ColumnChunkData* other, offset_t startPosInOtherChu
     updateInMemoryStats(inMemoryStats, other, startPosInOtherChunk, numValuesToAppend);
 }
 
+std::unique_ptr<ColumnChunkData> ColumnChunkData::copyInOrder(std::span<const row_idx_t> order) {
+    KU_ASSERT(order.size() <= capacity);
+    auto result = ColumnChunkFactory::createColumnChunkData(getMemoryManager(), dataType.copy(),
+        enableCompression, capacity, ResidencyState::IN_MEMORY, hasNullData());
+    // Runs of consecutive rows are appended together.
+    for (auto i = 0u; i < order.size();) {
+        uint32_t numValuesToAppend = 1;
+        while (i + numValuesToAppend < order.size() &&
+               order[i + numValuesToAppend] == order[i] + numValuesToAppend) {
+            numValuesToAppend++;
+        }
+        result->append(this, order[i], numValuesToAppend);
+        i += numValuesToAppend;
+    }
+    return result;
+}
+
 void ColumnChunkData::flush(PageAllocator& pageAllocator) {
     const auto preScanMetadata = getMetadataToFlush();
     auto allocatedEntry = pageAllocator.allocatePageRange(preScanMetadata.getNumPages());
@@ -1017,6 +1036,57 @@ void ColumnChunkData::reclaimStorage(PageAllocator& pageAllocator) {
     }
 }
 
+void ColumnChunkData::setBlockCompression(PageAllocator& pageAllocator,
+    BlockCompressionType type) {
+    if (nullData) {
+        nullData->setBlockCompression(pageAllocator, type);
+    }
+    // ALP exceptions are read through their own metadata, so those chunks are never compressed.
+    if (residencyState != ResidencyState::ON_DISK || metadata.getNumPages() == 0 ||
+        metadata.compMeta.compression == CompressionType::ALP ||
+        metadata.blockCompression.type == type) {
+        return;
+    }
+    auto& dataFH = *pageAllocator.getDataFH();
+    const auto pages = BlockCompression::readDecompressedPages(dataFH, metadata.pageRange,
+        metadata.blockCompression);
+    std::vector<uint8_t> compressedPages;
+    std::span<const uint8_t> dataToWrite = pages;
+    BlockCompressionMetadata blockCompression;
+    if (type != BlockCompressionType::NONE) {
+        compressedPages = BlockCompression::compress(type, pages);
+        const auto numDecompressedPages = metadata.getNumDecompressedPages();
+        if (compressedPages.empty() ||
+            getNumPagesForBytes(compressedPages.size()) >= numDecompressedPages) {
+            return;
+        }
+        blockCompression = BlockCompressionMetadata{type, compressedPages.size(),
+            numDecompressedPages};
+        dataToWrite = compressedPages;
+    }
+    const auto pageRange = pageAllocator.allocatePageRange(getNumPagesForBytes(dataToWrite.size()));
+    dataFH.writePagesToFile(dataToWrite.data(), dataToWrite.size(), pageRange.startPageIdx);
+    pageAllocator.freePageRange(metadata.pageRange);
+    metadata.pageRange = pageRange;
+    metadata.blockCompression = blockCompression;
+}
+
+void ColumnChunkData::compactStorage(StorageCompactor& compactor) {
+    if (nullData) {
+        nullData->compactStorage(compactor);
+    }
+    if (residencyState != ResidencyState::ON_DISK || metadata.getNumPages() == 0) {
+        return;
+    }
+    // Pages are copied as they are, so compressed chunks and the exceptions of ALP chunks, which
+    // are addressed relative to the start of the chunk, stay valid.
+    if (const auto pageRange = compactor.relocate(metadata.pageRange)) {
+        compactor.addRollbackAction(
+            [this, oldPageRange = metadata.pageRange]() { metadata.pageRange = oldPageRange; });
+        metadata.pageRange = *pageRange;
+    }
+}
+
 ColumnChunkData::~ColumnChunkData() = default;
 
 } // namespace storage
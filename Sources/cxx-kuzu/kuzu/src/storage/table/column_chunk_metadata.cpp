@@ -77,6 +77,7 @@ void ColumnChunkMetadata::serialize(common::Serializer& serializer) const {
     serializer.write(pageRange.numPages);
     serializer.write(numValues);
     compMeta.serialize(serializer);
+    blockCompression.serialize(serializer);
 }
 
 ColumnChunkMetadata ColumnChunkMetadata::deserialize(common::Deserializer& deserializer) {
@@ -85,10 +86,15 @@ ColumnChunkMetadata ColumnChunkMetadata::deserialize(common::Deserializer& deser
     deserializer.deserializeValue(ret.pageRange.numPages);
     deserializer.deserializeValue(ret.numValues);
     ret.compMeta = decltype(ret.compMeta)::deserialize(deserializer);
+    ret.blockCompression = BlockCompressionMetadata::deserialize(deserializer);
 
     return ret;
 }
 
+page_idx_t ColumnChunkMetadata::getNumDecompressedPages() const {
+    return blockCompression.isCompressed() ? blockCompression.numDecompressedPages : getNumPages();
+}
+
 page_idx_t ColumnChunkMetadata::getNumDataPages(PhysicalTypeID dataType) const {
     switch (compMeta.compression) {
     case CompressionType::ALP: {
@@ -104,7 +110,32 @@ page_idx_t ColumnChunkMetadata::getNumDataPages(PhysicalTypeID dataType) const {
     }
 }
 
-ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> /*buffer*/,
+namespace {
+// Delta and run-length encoding are only used when they need fewer pages than bitpacking (or no
+// compression), since values can no longer be read or updated independently of their neighbours.
+template<IntegerEncodingType T>
+CompressionMetadata selectIntegerEncoding(std::span<const uint8_t> buffer, uint64_t numValues,
+    const LogicalType& dataType, CompressionMetadata compMeta) {
+    if (numValues == 0) {
+        return compMeta;
+    }
+    const std::span<const T> values{reinterpret_cast<const T*>(buffer.data()), numValues};
+    const auto getNumPages = [&](const CompressionMetadata& metadata) {
+        return ceilDiv(numValues, metadata.numValues(KUZU_PAGE_SIZE, dataType));
+    };
+    auto numPages = getNumPages(compMeta);
+    for (auto& candidate : {RunLengthEncoding<T>::analyze(values, compMeta.min, compMeta.max),
+             IntegerDeltaBitpacking<T>::analyze(values, compMeta.min, compMeta.max)}) {
+        if (candidate.has_value() && getNumPages(*candidate) < numPages) {
+            numPages = getNumPages(*candidate);
+            compMeta = *candidate;
+        }
+    }
+    return compMeta;
+}
+} // namespace
+
+ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> buffer,
     uint64_t capacity, uint64_t numValues, StorageValue min, StorageValue max) {
     // For supported types, min and max may be null if all values are null
     // Compression is supported in this case
@@ -120,14 +151,27 @@ ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> /
                 if (IntegerBitpacking<T>::getPackingInfo(compMeta).bitWidth >= sizeof(T) * 8) {
                     compMeta = CompressionMetadata(min, max, CompressionType::UNCOMPRESSED);
                 }
+                if constexpr (IntegerEncodingType<T>) {
+                    compMeta = selectIntegerEncoding<T>(buffer, numValues, dataType, compMeta);
+                }
+            },
+            [&](internalID_t) {
+                compMeta = selectIntegerEncoding<offset_t>(buffer, numValues, dataType, compMeta);
             },
             [&](auto) {});
     }
     const auto numValuesPerPage = compMeta.numValues(KUZU_PAGE_SIZE, dataType);
+    // Delta and run-length encoded chunks are never written to in place, so there is no need to
+    // reserve pages for the remaining capacity.
+    const auto numValuesToStore = compMeta.compression == CompressionType::DELTA_BITPACKING ||
+                                          compMeta.compression == CompressionType::RLE ?
+                                      numValues :
+                                      capacity;
     const auto numPages =
         numValuesPerPage == UINT64_MAX ?
             0 :
-            capacity / numValuesPerPage + (capacity % numValuesPerPage == 0 ? 0 : 1);
+            numValuesToStore / numValuesPerPage +
+                (numValuesToStore % numValuesPerPage == 0 ? 0 : 1);
     return ColumnChunkMetadata(INVALID_PAGE_IDX, numPages, numValues, compMeta);
 }
 
@@ -4,6 +4,7 @@
 #include "common/utils.h"
 #include "common/vector/value_vector.h"
 #include "storage/compression/float_compression.h"
+#include "storage/buffer_manager/buffer_manager.h"
 #include "storage/file_handle.h"
 #include "storage/shadow_utils.h"
 #include "storage/storage_utils.h"
@@ -19,7 +20,7 @@ using namespace transaction;
 namespace {
 [[maybe_unused]] bool isPageIdxValid(page_idx_t pageIdx, const ColumnChunkMetadata& metadata) {
     return (metadata.getStartPageIdx() <= pageIdx &&
-               pageIdx < metadata.getStartPageIdx() + metadata.getNumPages()) ||
+               pageIdx < metadata.getStartPageIdx() + metadata.getNumDecompressedPages()) ||
            (pageIdx == INVALID_PAGE_IDX && metadata.compMeta.isConstant());
 }
 
@@ -76,8 +77,8 @@ class FloatColumnReadWriter;
 
 class DefaultColumnReadWriter final : public ColumnReadWriter {
 public:
-    DefaultColumnReadWriter(FileHandle* dataFH, ShadowFile* shadowFile)
-        : ColumnReadWriter(dataFH, shadowFile) {}
+    DefaultColumnReadWriter(FileHandle* dataFH, ShadowFile* shadowFile, MemoryManager* mm)
+        : ColumnReadWriter(dataFH, shadowFile, mm) {}
 
     void readCompressedValueToPage(const ChunkState& state, offset_t nodeOffset, uint8_t* result,
         uint32_t offsetInResult, const read_value_from_page_func_t<uint8_t*>& readFunc) override {
@@ -128,6 +129,8 @@ public:
         offset_t srcOffset, offset_t numValues,
         const write_values_to_page_func_t<InputType, AdditionalArgs...>& writeFunc,
         const NullMask* nullMask) {
+        // Block compressed chunks are decompressed before the node group is checkpointed.
+        KU_ASSERT(!state.metadata.blockCompression.isCompressed());
         auto numValuesWritten = 0u;
         auto cursor = getPageCursorForOffsetInGroup(dstOffset, state.metadata.getStartPageIdx(),
             state.numValuesPerPage);
@@ -156,7 +159,7 @@ public:
         offset_t /*offsetInChunk*/, OutputType result, uint32_t offsetInResult,
         const read_value_from_page_func_t<OutputType>& readFunc) {
 
-        readFromPage(cursor.pageIdx, [&](uint8_t* frame) -> void {
+        readFromPage(cursor.pageIdx, metadata, [&](uint8_t* frame) -> void {
             readFunc(frame, cursor, result, offsetInResult, 1 /* numValuesToRead */,
                 metadata.compMeta);
         });
@@ -176,6 +179,10 @@ public:
         auto pageCursor = getPageCursorForOffsetInGroup(startNodeOffset,
             chunkMeta.getStartPageIdx(), state.numValuesPerPage);
         KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
+        prefetchAhead(chunkMeta, pageCursor.pageIdx,
+            getPageCursorForOffsetInGroup(endNodeOffset - 1, chunkMeta.getStartPageIdx(),
+                state.numValuesPerPage)
+                .pageIdx);
 
         uint64_t numValuesScanned = 0;
         while (numValuesScanned < numValuesToScan) {
@@ -190,7 +197,8 @@ public:
                     readFunc(frame, pageCursor, result, numValuesScanned + startOffsetInResult,
                         numValuesToScanInPage, chunkMeta.compMeta);
                 };
-                readFromPage(pageCursor.pageIdx, std::cref(readFromPageFunc));
+                readFromPage(pageCursor.pageIdx, chunkMeta, std::cref(readFromPageFunc),
+                    PageAccessType::SEQUENTIAL_SCAN);
             }
             numValuesScanned += numValuesToScanInPage;
             pageCursor.nextPage();
@@ -203,9 +211,9 @@ public:
 template<std::floating_point T>
 class FloatColumnReadWriter final : public ColumnReadWriter {
 public:
-    FloatColumnReadWriter(FileHandle* dataFH, ShadowFile* shadowFile)
-        : ColumnReadWriter(dataFH, shadowFile),
-          defaultReader(std::make_unique<DefaultColumnReadWriter>(dataFH, shadowFile)) {}
+    FloatColumnReadWriter(FileHandle* dataFH, ShadowFile* shadowFile, MemoryManager* mm)
+        : ColumnReadWriter(dataFH, shadowFile, mm),
+          defaultReader(std::make_unique<DefaultColumnReadWriter>(dataFH, shadowFile, mm)) {}
 
     void readCompressedValueToPage(const ChunkState& state, offset_t nodeOffset, uint8_t* result,
         uint32_t offsetInResult, const read_value_from_page_func_t<uint8_t*>& readFunc) override {
@@ -402,28 +410,61 @@ private:
 } // namespace
 
 std::unique_ptr<ColumnReadWriter> ColumnReadWriterFactory::createColumnReadWriter(
-    PhysicalTypeID dataType, FileHandle* dataFH, ShadowFile* shadowFile) {
+    PhysicalTypeID dataType, FileHandle* dataFH, ShadowFile* shadowFile, MemoryManager* mm) {
     switch (dataType) {
     case PhysicalTypeID::FLOAT:
-        return std::make_unique<FloatColumnReadWriter<float>>(dataFH, shadowFile);
+        return std::make_unique<FloatColumnReadWriter<float>>(dataFH, shadowFile, mm);
     case PhysicalTypeID::DOUBLE:
-        return std::make_unique<FloatColumnReadWriter<double>>(dataFH, shadowFile);
+        return std::make_unique<FloatColumnReadWriter<double>>(dataFH, shadowFile, mm);
     default:
-        return std::make_unique<DefaultColumnReadWriter>(dataFH, shadowFile);
+        return std::make_unique<DefaultColumnReadWriter>(dataFH, shadowFile, mm);
     }
 }
 
-ColumnReadWriter::ColumnReadWriter(FileHandle* dataFH, ShadowFile* shadowFile)
-    : dataFH(dataFH), shadowFile(shadowFile) {}
+ColumnReadWriter::ColumnReadWriter(FileHandle* dataFH, ShadowFile* shadowFile, MemoryManager* mm)
+    : dataFH(dataFH), shadowFile(shadowFile), mm(mm) {}
 
-void ColumnReadWriter::readFromPage(page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readFunc) const {
+void ColumnReadWriter::readFromPage(page_idx_t pageIdx, const ColumnChunkMetadata& metadata,
+    const std::function<void(uint8_t*)>& readFunc, PageAccessType accessType) const {
     // For constant compression, call read on a nullptr since there is no data on disk and
     // decompression only requires metadata
     if (pageIdx == INVALID_PAGE_IDX) {
         return readFunc(nullptr);
     }
-    dataFH->optimisticReadPage(pageIdx, readFunc);
+    if (metadata.blockCompression.isCompressed()) {
+        const auto pages = mm->getBufferManager()->getDecompressedPageCache().getPages(*dataFH,
+            metadata.pageRange, metadata.blockCompression);
+        // Read functions don't modify the page.
+        auto* page = const_cast<uint8_t*>(pages.get()) +
+                     static_cast<uint64_t>(pageIdx - metadata.getStartPageIdx()) * KUZU_PAGE_SIZE;
+        return readFunc(page);
+    }
+    dataFH->optimisticReadPage(pageIdx, readFunc, accessType);
+}
+
+void ColumnReadWriter::prefetchAhead(const ColumnChunkMetadata& metadata,
+    page_idx_t firstPageIdx, page_idx_t lastPageIdx) const {
+    auto* bm = mm->getBufferManager();
+    const auto depth = bm->getPrefetchDepth();
+    const auto startPageIdx = metadata.getStartPageIdx();
+    if (depth == 0 || startPageIdx == INVALID_PAGE_IDX ||
+        metadata.blockCompression.isCompressed() || dataFH->isInMemoryMode() ||
+        dataFH->isMemoryMapped()) {
+        return;
+    }
+    // Pages are requested a block of depth pages at a time. Once a scan reaches the start of a
+    // block, the rest of the block and the whole next block are requested, which keeps the
+    // prefetcher about one block ahead without re-requesting pages on every read.
+    const auto blockStartPageIdx =
+        startPageIdx + (firstPageIdx - startPageIdx + depth - 1) / depth * depth;
+    if (blockStartPageIdx > lastPageIdx) {
+        return;
+    }
+    const auto endPageIdx =
+        std::min<uint64_t>(blockStartPageIdx + 2 * depth, startPageIdx + metadata.getNumPages());
+    if (lastPageIdx + 1 < endPageIdx) {
+        bm->prefetch(*dataFH, lastPageIdx + 1, endPageIdx - lastPageIdx - 1);
+    }
 }
 
 void ColumnReadWriter::updatePageWithCursor(PageCursor cursor,
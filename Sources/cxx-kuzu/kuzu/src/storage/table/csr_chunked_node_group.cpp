@@ -1,5 +1,7 @@
 #include "storage/table/csr_chunked_node_group.h"
 
+#include <numeric>
+
 #include "common/serializer/deserializer.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/storage_utils.h"
@@ -247,6 +249,7 @@ std::unique_ptr<ChunkedNodeGroup> ChunkedCSRNodeGroup::flushAsNewChunkedNodeGrou
     ChunkedCSRHeader newCSRHeader{std::move(csrOffset), std::move(csrLength)};
     auto flushedChunkedGroup = std::make_unique<ChunkedCSRNodeGroup>(std::move(newCSRHeader),
         std::move(flushedChunks), 0 /*startRowIdx*/);
+    flushedChunkedGroup->sortedByNeighbor = sortedByNeighbor;
     flushedChunkedGroup->versionInfo = std::make_unique<VersionInfo>();
     KU_ASSERT(numRows == flushedChunkedGroup->getNumRows());
     flushedChunkedGroup->versionInfo->append(transaction->getID(), 0, numRows);
@@ -271,6 +274,16 @@ void ChunkedCSRNodeGroup ::reclaimStorage(PageAllocator& pageAllocator) const {
     }
 }
 
+void ChunkedCSRNodeGroup::compactStorage(StorageCompactor& compactor) const {
+    ChunkedNodeGroup::compactStorage(compactor);
+    if (csrHeader.offset) {
+        csrHeader.offset->compactStorage(compactor);
+    }
+    if (csrHeader.length) {
+        csrHeader.length->compactStorage(compactor);
+    }
+}
+
 void ChunkedCSRNodeGroup::scanCSRHeader(MemoryManager& memoryManager,
     CSRNodeGroupCheckpointState& csrState) const {
     if (!csrState.oldHeader) {
@@ -287,12 +300,46 @@ void ChunkedCSRNodeGroup::scanCSRHeader(MemoryManager& memoryManager,
     csrState.csrLengthColumn->scan(headerChunkState, &csrState.oldHeader->length->getData());
 }
 
+bool ChunkedCSRNodeGroup::sortCSRListByNeighbor(const ColumnChunkData& nbrData,
+    std::span<row_idx_t> rows) {
+    const auto lessByNbr = [&](row_idx_t a, row_idx_t b) {
+        return nbrData.getValue<offset_t>(a) < nbrData.getValue<offset_t>(b);
+    };
+    if (std::is_sorted(rows.begin(), rows.end(), lessByNbr)) {
+        return false;
+    }
+    std::stable_sort(rows.begin(), rows.end(), lessByNbr);
+    return true;
+}
+
+void ChunkedCSRNodeGroup::sortCSRListsByNeighbor() {
+    const auto& nbrData = chunks[NBR_ID_COLUMN_ID]->getData();
+    std::vector<row_idx_t> order(nbrData.getNumValues());
+    std::iota(order.begin(), order.end(), 0);
+    bool reordered = false;
+    for (auto nodeOffset = 0u; nodeOffset < csrHeader.offset->getNumValues(); nodeOffset++) {
+        const auto startRow = csrHeader.getStartCSROffset(nodeOffset);
+        const auto length = csrHeader.getCSRLength(nodeOffset);
+        KU_ASSERT(startRow + length <= order.size());
+        reordered |= sortCSRListByNeighbor(nbrData, std::span(order).subspan(startRow, length));
+    }
+    sortedByNeighbor = true;
+    if (!reordered) {
+        return;
+    }
+    for (auto& chunk : chunks) {
+        chunk->setData(chunk->getData().copyInOrder(order));
+    }
+}
+
 void ChunkedCSRNodeGroup::serialize(Serializer& serializer) const {
     KU_ASSERT(csrHeader.offset && csrHeader.length);
     serializer.writeDebuggingInfo("csr_header_offset");
     csrHeader.offset->serialize(serializer);
     serializer.writeDebuggingInfo("csr_header_length");
     csrHeader.length->serialize(serializer);
+    serializer.writeDebuggingInfo("sorted_by_neighbor");
+    serializer.write<bool>(sortedByNeighbor);
     ChunkedNodeGroup::serialize(serializer);
 }
 
@@ -303,6 +350,9 @@ std::unique_ptr<ChunkedCSRNodeGroup> ChunkedCSRNodeGroup::deserialize(MemoryMana
     auto offset = ColumnChunk::deserialize(memoryManager, deSer);
     deSer.validateDebuggingInfo(key, "csr_header_length");
     auto length = ColumnChunk::deserialize(memoryManager, deSer);
+    bool sortedByNeighbor = false;
+    deSer.validateDebuggingInfo(key, "sorted_by_neighbor");
+    deSer.deserializeValue<bool>(sortedByNeighbor);
     // TODO(Guodong): Rework to reuse ChunkedNodeGroup::deserialize().
     std::vector<std::unique_ptr<ColumnChunk>> chunks;
     deSer.validateDebuggingInfo(key, "chunks");
@@ -312,6 +362,7 @@ std::unique_ptr<ChunkedCSRNodeGroup> ChunkedCSRNodeGroup::deserialize(MemoryMana
     deSer.deserializeValue<row_idx_t>(startRowIdx);
     auto chunkedGroup = std::make_unique<ChunkedCSRNodeGroup>(
         ChunkedCSRHeader{std::move(offset), std::move(length)}, std::move(chunks), startRowIdx);
+    chunkedGroup->sortedByNeighbor = sortedByNeighbor;
     bool hasVersions = false;
     deSer.validateDebuggingInfo(key, "has_version_info");
     deSer.deserializeValue<bool>(hasVersions);
@@ -1,5 +1,7 @@
 #include "storage/table/csr_node_group.h"
 
+#include <numeric>
+
 #include "common/constants.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/storage_utils.h"
@@ -324,6 +326,156 @@ NodeGroupScanResult CSRNodeGroup::scanCommittedInMemRandom(const Transaction* tr
     return NodeGroupScanResult{0, numRows};
 }
 
+void CSRNodeGroup::addDegrees(const Transaction* transaction, const Column* csrOffsetColumn,
+    const Column* csrLengthColumn, offset_t startOffsetInGroup, std::span<uint64_t> degrees) const {
+    KU_ASSERT(startOffsetInGroup + degrees.size() <= StorageConfig::NODE_GROUP_SIZE);
+    if (persistentChunkGroup) {
+        addPersistentDegrees(transaction, csrOffsetColumn, csrLengthColumn, startOffsetInGroup,
+            degrees);
+    }
+    if (csrIndex) {
+        addInMemDegrees(transaction, startOffsetInGroup, degrees);
+    }
+}
+
+void CSRNodeGroup::addPersistentDegrees(const Transaction* transaction,
+    const Column* csrOffsetColumn, const Column* csrLengthColumn, offset_t startOffsetInGroup,
+    std::span<uint64_t> degrees) const {
+    auto& csrChunkGroup = persistentChunkGroup->cast<ChunkedCSRNodeGroup>();
+    const auto& csrHeader = csrChunkGroup.getCSRHeader();
+    const auto numBoundNodes = csrHeader.length->getNumValues();
+    if (startOffsetInGroup >= numBoundNodes) {
+        return;
+    }
+    const auto numNodes = std::min<offset_t>(degrees.size(), numBoundNodes - startOffsetInGroup);
+    // Scan the offsets starting from the node before the range so that the start csr offset of
+    // the first node is available. Results are relative to `offsetToScanFrom`.
+    const auto offsetToScanFrom = startOffsetInGroup == 0 ? 0 : startOffsetInGroup - 1;
+    const auto numOffsetsToScan = startOffsetInGroup + numNodes - offsetToScanFrom;
+    ChunkState offsetState, lengthState;
+    csrHeader.offset->initializeScanState(offsetState, csrOffsetColumn);
+    csrHeader.length->initializeScanState(lengthState, csrLengthColumn);
+    ChunkedCSRHeader header(mm, false /*enableCompression*/, numOffsetsToScan,
+        ResidencyState::IN_MEMORY);
+    csrHeader.offset->scanCommitted<ResidencyState::ON_DISK>(transaction, offsetState,
+        *header.offset, offsetToScanFrom, numOffsetsToScan);
+    csrHeader.length->scanCommitted<ResidencyState::ON_DISK>(transaction, lengthState,
+        *header.length, startOffsetInGroup, numNodes);
+    const auto& offsets = header.offset->getData();
+    const auto& lengths = header.length->getData();
+    for (auto i = 0u; i < numNodes; i++) {
+        const auto offsetInGroup = startOffsetInGroup + i;
+        const auto startCSROffset =
+            offsetInGroup == 0 ? 0 :
+                                 offsets.getValue<offset_t>(offsetInGroup - 1 - offsetToScanFrom);
+        const auto length = lengths.getValue<length_t>(i);
+        if (length == 0) {
+            continue;
+        }
+        degrees[i] += persistentChunkGroup->getNumSelected(transaction, startCSROffset, length);
+    }
+}
+
+void CSRNodeGroup::addInMemDegrees(const Transaction* transaction, offset_t startOffsetInGroup,
+    std::span<uint64_t> degrees) const {
+    const ChunkedNodeGroup* chunkedGroup = nullptr;
+    node_group_idx_t currentChunkIdx = INVALID_NODE_GROUP_IDX;
+    auto getChunkedGroup = [&](node_group_idx_t chunkIdx) {
+        if (chunkIdx != currentChunkIdx) {
+            currentChunkIdx = chunkIdx;
+            const auto lock = chunkedGroups.lock();
+            chunkedGroup = chunkedGroups.getGroup(lock, chunkIdx);
+        }
+        return chunkedGroup;
+    };
+    for (auto i = 0u; i < degrees.size(); i++) {
+        const auto& nodeCSRIndex = csrIndex->indices[startOffsetInGroup + i];
+        if (nodeCSRIndex.isEmpty()) {
+            continue;
+        }
+        if (nodeCSRIndex.isSequential) {
+            auto startRow = nodeCSRIndex.rowIndices[0];
+            auto numRowsLeft = nodeCSRIndex.rowIndices[1];
+            while (numRowsLeft > 0) {
+                auto [chunkIdx, startRowInChunk] = StorageUtils::getQuotientRemainder(startRow,
+                    StorageConfig::CHUNKED_NODE_GROUP_CAPACITY);
+                const auto numRows = std::min(numRowsLeft,
+                    StorageConfig::CHUNKED_NODE_GROUP_CAPACITY - startRowInChunk);
+                degrees[i] += getChunkedGroup(chunkIdx)->getNumSelected(transaction,
+                    startRowInChunk, numRows);
+                startRow += numRows;
+                numRowsLeft -= numRows;
+            }
+        } else {
+            for (const auto rowIdx : nodeCSRIndex.rowIndices) {
+                auto [chunkIdx, rowInChunk] = StorageUtils::getQuotientRemainder(rowIdx,
+                    StorageConfig::CHUNKED_NODE_GROUP_CAPACITY);
+                degrees[i] += getChunkedGroup(chunkIdx)->getNumSelected(transaction, rowInChunk, 1);
+            }
+        }
+    }
+}
+
+std::optional<row_idx_t> CSRNodeGroup::findPersistentRowByNeighbor(const Transaction* transaction,
+    const Column* csrOffsetColumn, const Column* csrLengthColumn, const Column* nbrIDColumn,
+    const Column* relIDColumn, offset_t boundOffsetInGroup, offset_t nbrOffset,
+    offset_t relOffset) const {
+    if (!persistentChunkGroup) {
+        return INVALID_ROW_IDX;
+    }
+    auto& csrChunkGroup = persistentChunkGroup->cast<ChunkedCSRNodeGroup>();
+    if (!csrChunkGroup.isSortedByNeighbor()) {
+        return std::nullopt;
+    }
+    const auto& csrHeader = csrChunkGroup.getCSRHeader();
+    if (boundOffsetInGroup >= csrHeader.length->getNumValues()) {
+        return INVALID_ROW_IDX;
+    }
+    // The start csr offset of the list is the end csr offset of the node before it.
+    ChunkState offsetState, lengthState;
+    csrHeader.offset->initializeScanState(offsetState, csrOffsetColumn);
+    csrHeader.length->initializeScanState(lengthState, csrLengthColumn);
+    ChunkedCSRHeader header(mm, false /*enableCompression*/, 1, ResidencyState::IN_MEMORY);
+    if (boundOffsetInGroup > 0) {
+        csrHeader.offset->scanCommitted<ResidencyState::ON_DISK>(transaction, offsetState,
+            *header.offset, boundOffsetInGroup - 1, 1);
+    }
+    csrHeader.length->scanCommitted<ResidencyState::ON_DISK>(transaction, lengthState,
+        *header.length, boundOffsetInGroup, 1);
+    const auto startRow =
+        boundOffsetInGroup == 0 ? 0 : header.offset->getData().getValue<offset_t>(0);
+    const auto endRow = startRow + header.length->getData().getValue<length_t>(0);
+
+    const auto& nbrChunk = csrChunkGroup.getColumnChunk(NBR_ID_COLUMN_ID);
+    const auto& relChunk = csrChunkGroup.getColumnChunk(REL_ID_COLUMN_ID);
+    ChunkState nbrState, relState;
+    nbrChunk.initializeScanState(nbrState, nbrIDColumn);
+    relChunk.initializeScanState(relState, relIDColumn);
+    ValueVector idVector(LogicalType::INTERNAL_ID(), &mm,
+        DataChunkState::getSingleValueDataChunkState());
+    const auto readOffset = [&](const ColumnChunk& chunk, const ChunkState& state, row_idx_t row) {
+        chunk.lookup(transaction, state, row, idVector, 0);
+        return idVector.getValue<internalID_t>(0).offset;
+    };
+    // Find the first rel to the neighbor, then check the rels to the neighbor for the rel ID.
+    auto low = startRow, high = endRow;
+    while (low < high) {
+        const auto mid = low + (high - low) / 2;
+        if (readOffset(nbrChunk, nbrState, mid) < nbrOffset) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    for (auto row = low; row < endRow && readOffset(nbrChunk, nbrState, row) == nbrOffset; row++) {
+        if (readOffset(relChunk, relState, row) == relOffset &&
+            !csrChunkGroup.isDeleted(transaction, row)) {
+            return row;
+        }
+    }
+    return INVALID_ROW_IDX;
+}
+
 void CSRNodeGroup::appendChunkedCSRGroup(const Transaction* transaction,
     const std::vector<column_id_t>& columnIDs, ChunkedCSRNodeGroup& chunkedGroup) {
     const auto& csrHeader = chunkedGroup.getCSRHeader();
@@ -476,6 +628,13 @@ void CSRNodeGroup::reclaimStorage(PageAllocator& pageAllocator, const UniqLock&
     }
 }
 
+void CSRNodeGroup::compactStorage(StorageCompactor& compactor) {
+    NodeGroup::compactStorage(compactor);
+    if (persistentChunkGroup) {
+        persistentChunkGroup->compactStorage(compactor);
+    }
+}
+
 static std::unique_ptr<ChunkedCSRNodeGroup> createNewPersistentChunkGroup(
     ChunkedCSRNodeGroup& oldPersistentChunkGroup, CSRNodeGroupCheckpointState& csrState) {
     auto newGroup =
@@ -537,12 +696,28 @@ void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheck
         persistentChunkGroup = nullptr;
     } else {
         KU_ASSERT(csrState.newHeader->sanityCheck());
+        // Insertions are appended to the end of each CSR list, so lists of regions with insertions
+        // are re-sorted if the table keeps them sorted by neighbor.
+        std::vector<row_idx_vec_t> regionRowOrders(regionsToCheckpoint.size());
+        if (csrState.sortListsByNeighbor) {
+            for (auto i = 0u; i < regionsToCheckpoint.size(); i++) {
+                if (regionsToCheckpoint[i].hasInsertions) {
+                    regionRowOrders[i] =
+                        getRegionRowOrderByNeighbor(lock, csrState, regionsToCheckpoint[i]);
+                }
+            }
+        }
         for (const auto columnID : csrState.columnIDs) {
-            checkpointColumn(lock, columnID, csrState, regionsToCheckpoint);
+            checkpointColumn(lock, columnID, csrState, regionsToCheckpoint, regionRowOrders);
         }
         checkpointCSRHeaderColumns(csrState);
+        // Lists stay sorted only if they were sorted before and the insertions are merged in.
+        const auto sortedByNeighbor =
+            csrState.sortListsByNeighbor &&
+            persistentChunkGroup->cast<ChunkedCSRNodeGroup>().isSortedByNeighbor();
         persistentChunkGroup = createNewPersistentChunkGroup(
             persistentChunkGroup->cast<ChunkedCSRNodeGroup>(), csrState);
+        persistentChunkGroup->cast<ChunkedCSRNodeGroup>().setSortedByNeighbor(sortedByNeighbor);
     }
     finalizeCheckpoint(lock);
 }
@@ -575,10 +750,13 @@ void CSRNodeGroup::redistributeCSRRegions(const CSRNodeGroupCheckpointState& csr
 }
 
 void CSRNodeGroup::checkpointColumn(const UniqLock& lock, column_id_t columnID,
-    const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions) const {
+    const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions,
+    const std::vector<row_idx_vec_t>& regionRowOrders) const {
+    KU_ASSERT(regions.size() == regionRowOrders.size());
     std::vector<ChunkCheckpointState> chunkCheckpointStates;
     chunkCheckpointStates.reserve(regions.size());
-    for (auto& region : regions) {
+    for (auto i = 0u; i < regions.size(); i++) {
+        const auto& region = regions[i];
         if (!region.needCheckpointColumn(columnID)) {
             // Skip checkpoint for the column if it has no changes in the region.
             continue;
@@ -590,6 +768,10 @@ void CSRNodeGroup::checkpointColumn(const UniqLock& lock, column_id_t columnID,
             // region, but keep deleted rows aa gaps.
             continue;
         }
+        if (!regionRowOrders[i].empty()) {
+            regionCheckpointState.chunkData =
+                regionCheckpointState.chunkData->copyInOrder(regionRowOrders[i]);
+        }
         chunkCheckpointStates.push_back(std::move(regionCheckpointState));
     }
     ColumnCheckpointState checkpointState(persistentChunkGroup->getColumnChunk(columnID).getData(),
@@ -675,6 +857,36 @@ ChunkCheckpointState CSRNodeGroup::checkpointColumnInRegion(const UniqLock& lock
     return ChunkCheckpointState(newChunk->moveData(), leftCSROffset, numRowsInRegion);
 }
 
+row_idx_vec_t CSRNodeGroup::getRegionRowOrderByNeighbor(const UniqLock& lock,
+    const CSRNodeGroupCheckpointState& csrState, const CSRRegion& region) const {
+    const auto nbrState = checkpointColumnInRegion(lock, NBR_ID_COLUMN_ID, csrState, region);
+    row_idx_vec_t order(nbrState.numRows);
+    std::iota(order.begin(), order.end(), 0);
+    const auto leftCSROffset = csrState.newHeader->getStartCSROffset(region.leftNodeOffset);
+    for (auto nodeOffset = region.leftNodeOffset; nodeOffset <= region.rightNodeOffset;
+         nodeOffset++) {
+        const auto startRow = csrState.newHeader->getStartCSROffset(nodeOffset) - leftCSROffset;
+        const auto length = csrState.newHeader->getCSRLength(nodeOffset);
+        ChunkedCSRNodeGroup::sortCSRListByNeighbor(*nbrState.chunkData,
+            std::span(order).subspan(startRow, length));
+    }
+    return order;
+}
+
+void CSRNodeGroup::sortInMemRowsByNeighbor(const UniqLock& lock, row_idx_vec_t& rows) const {
+    std::erase(rows, INVALID_ROW_IDX);
+    const auto getNbrOffset = [&](row_idx_t row) {
+        const auto [chunkIdx, rowInChunk] =
+            StorageUtils::getQuotientRemainder(row, StorageConfig::CHUNKED_NODE_GROUP_CAPACITY);
+        return chunkedGroups.getGroup(lock, chunkIdx)
+            ->getColumnChunk(NBR_ID_COLUMN_ID)
+            .getData()
+            .getValue<offset_t>(rowInChunk);
+    };
+    std::stable_sort(rows.begin(), rows.end(),
+        [&](row_idx_t a, row_idx_t b) { return getNbrOffset(a) < getNbrOffset(b); });
+}
+
 void CSRNodeGroup::checkpointCSRHeaderColumns(const CSRNodeGroupCheckpointState& csrState) const {
     std::vector<ChunkCheckpointState> csrOffsetChunkCheckpointStates;
     const auto numNodes = csrState.newHeader->offset->getNumValues();
@@ -846,8 +1058,11 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
 
     // Scan tuples from in mem node groups and append to data chunks to flush.
     for (auto offset = 0u; offset < numNodes; offset++) {
-        const auto numRows = csrIndex->getNumRows(offset);
         auto rows = csrIndex->indices[offset].getRows();
+        if (csrState.sortListsByNeighbor) {
+            sortInMemRowsByNeighbor(lock, rows);
+        }
+        const row_idx_t numRows = rows.size();
         auto numRowsTryAppended = 0u;
         while (numRowsTryAppended < numRows) {
             const auto maxNumRowsToAppend =
@@ -896,6 +1111,8 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     csrState.newHeader->length->getData().flush(csrState.pageAllocator);
     persistentChunkGroup = std::make_unique<ChunkedCSRNodeGroup>(std::move(*csrState.newHeader),
         std::move(dataChunksToFlush), 0);
+    persistentChunkGroup->cast<ChunkedCSRNodeGroup>().setSortedByNeighbor(
+        csrState.sortListsByNeighbor);
     // TODO(Guodong): Use `finalizeCheckpoint`.
     chunkedGroups.clear(lock);
     // Set `numRows` back to 0 is to reflect that the in mem part of the node group is empty.
@@ -4,7 +4,9 @@
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/compression/fsst.h"
 #include "storage/enums/residency_state.h"
+#include "storage/page_allocator.h"
 #include <bit>
 
 using namespace kuzu::common;
@@ -21,6 +23,10 @@ namespace storage {
 // exactly the node group size (which is always a power of 2), making sure there is always extra
 // space for updates.
 static constexpr uint64_t INITIAL_OFFSET_CHUNK_CAPACITY = 3;
+// String data smaller than a page gains nothing from FSST, since it still takes a full page.
+static constexpr uint64_t FSST_MIN_DATA_SIZE = KUZU_PAGE_SIZE;
+// Approximate number of bytes of string data sampled to build the FSST symbol table.
+static constexpr uint64_t FSST_SAMPLE_SIZE = 16 * 1024;
 
 DictionaryChunk::DictionaryChunk(MemoryManager& mm, uint64_t capacity, bool enableCompression,
     ResidencyState residencyState)
@@ -102,10 +108,100 @@ uint64_t DictionaryChunk::getEstimatedMemoryUsage() const {
 }
 
 void DictionaryChunk::flush(PageAllocator& pageAllocator) {
+    if (const auto encoded = encodeWithFSST()) {
+        stringDataChunk = encoded->flushStringData(pageAllocator);
+        encoded->offsetChunk->flush(pageAllocator);
+        offsetChunk = std::move(encoded->offsetChunk);
+        // The index table refers to the unencoded strings, which are no longer in memory.
+        indexTable.clear();
+        return;
+    }
     stringDataChunk->flush(pageAllocator);
     offsetChunk->flush(pageAllocator);
 }
 
+std::unique_ptr<DictionaryChunk> DictionaryChunk::encodeWithFSST() const {
+    const auto dataSize = stringDataChunk->getNumValues();
+    const auto numStrings = offsetChunk->getNumValues();
+    if (!enableCompression || dataSize < FSST_MIN_DATA_SIZE) {
+        return nullptr;
+    }
+    // Build the symbol table from evenly spaced strings.
+    std::vector<std::string_view> sample;
+    const auto stride = std::max<uint64_t>(1, dataSize / FSST_SAMPLE_SIZE);
+    for (auto i = 0u; i < numStrings; i += stride) {
+        sample.push_back(getString(i));
+    }
+    auto symbolTable = std::make_shared<const FSSTSymbolTable>(FSSTSymbolTable::build(sample));
+    std::vector<uint8_t> encodedData;
+    encodedData.reserve(dataSize);
+    std::vector<string_offset_t> offsets(numStrings);
+    for (auto i = 0u; i < numStrings; i++) {
+        offsets[i] = encodedData.size();
+        symbolTable->encode(getString(i), encodedData);
+    }
+    if (encodedData.size() + symbolTable->getNumSymbols() * sizeof(FSSTSymbol) >= dataSize) {
+        return nullptr;
+    }
+    auto encoded = std::make_unique<DictionaryChunk>(stringDataChunk->getMemoryManager(),
+        numStrings, enableCompression, ResidencyState::IN_MEMORY);
+    // Leave the same room for in-place updates as appendString does.
+    encoded->stringDataChunk->resize(std::bit_ceil(encodedData.size()));
+    memcpy(encoded->stringDataChunk->getData(), encodedData.data(), encodedData.size());
+    encoded->stringDataChunk->setNumValues(encodedData.size());
+    encoded->offsetChunk->resize(numStrings);
+    for (auto i = 0u; i < numStrings; i++) {
+        encoded->offsetChunk->setValue<string_offset_t>(offsets[i], i);
+    }
+    encoded->fsstSymbolTable = std::move(symbolTable);
+    return encoded;
+}
+
+void DictionaryChunk::decodeFSST(const FSSTSymbolTable& symbolTable) {
+    const auto encodedSize = stringDataChunk->getNumValues();
+    const auto numStrings = offsetChunk->getNumValues();
+    const std::vector<uint8_t> encodedData(stringDataChunk->getData(),
+        stringDataChunk->getData() + encodedSize);
+    // Strings are encoded independently, so the concatenated strings decode to the concatenation
+    // of the decoded strings.
+    const auto decodedSize = symbolTable.getDecodedLength(encodedData);
+    if (decodedSize > stringDataChunk->getCapacity()) {
+        stringDataChunk->resize(std::bit_ceil(decodedSize));
+    }
+    uint64_t decodedOffset = 0;
+    for (auto i = 0u; i < numStrings; i++) {
+        const auto startOffset = offsetChunk->getValue<string_offset_t>(i);
+        const auto endOffset =
+            i + 1 < numStrings ? offsetChunk->getValue<string_offset_t>(i + 1) : encodedSize;
+        offsetChunk->setValue<string_offset_t>(decodedOffset, i);
+        decodedOffset += symbolTable.decode(
+            std::span(encodedData.data() + startOffset, endOffset - startOffset),
+            stringDataChunk->getData() + decodedOffset);
+    }
+    KU_ASSERT(decodedOffset == decodedSize);
+    stringDataChunk->setNumValues(decodedSize);
+}
+
+std::unique_ptr<ColumnChunkData> DictionaryChunk::flushStringData(
+    PageAllocator& pageAllocator) const {
+    auto metadata = stringDataChunk->getMetadataToFlush();
+    if (fsstSymbolTable) {
+        // The encoded bytes are stored as they are, even if they would be constant, since the
+        // symbol table is needed to decode them.
+        metadata = ColumnChunkMetadata(INVALID_PAGE_IDX,
+            ColumnChunkData::getNumPagesForBytes(stringDataChunk->getBufferSize()),
+            metadata.numValues,
+            CompressionMetadata(metadata.compMeta.min, metadata.compMeta.max,
+                CompressionType::FSST));
+        metadata.compMeta.extraMetadata = std::make_unique<FSSTMetadata>(fsstSymbolTable);
+    }
+    const auto pageRange = pageAllocator.allocatePageRange(metadata.getNumPages());
+    auto flushedMetadata = stringDataChunk->flushBuffer(pageAllocator, pageRange, metadata);
+    return ColumnChunkFactory::createColumnChunkData(stringDataChunk->getMemoryManager(),
+        LogicalType::UINT8(), false /*enableCompression*/, flushedMetadata,
+        false /*hasNullData*/, true /*initializeToZero*/);
+}
+
 void DictionaryChunk::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("offset_chunk");
     offsetChunk->serialize(serializer);
@@ -5,6 +5,7 @@
 #include "common/types/ku_string.h"
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/compression/fsst.h"
 #include "storage/storage_utils.h"
 #include "storage/table/string_column.h"
 #include <bit>
@@ -48,6 +49,9 @@ void DictionaryColumn::scan(const ChunkState& state, DictionaryChunk& dictChunk)
     }
     offsetColumn->scan(StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET),
         offsetChunk);
+    if (dataMetadata.compMeta.compression == CompressionType::FSST) {
+        dictChunk.decodeFSST(*dataMetadata.compMeta.fsstMetadata()->symbolTable);
+    }
 }
 
 void DictionaryColumn::scan(const ChunkState& offsetState, const ChunkState& dataState,
@@ -99,8 +103,13 @@ void DictionaryColumn::scan(const ChunkState& offsetState, const ChunkState& dat
 
 string_index_t DictionaryColumn::append(const DictionaryChunk& dictChunk, ChunkState& state,
     std::string_view val) {
-    const auto startOffset = dataColumn->appendValues(*dictChunk.getStringDataChunk(),
-        StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA),
+    auto& dataState = StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA);
+    std::vector<uint8_t> encoded;
+    if (dataState.metadata.compMeta.compression == CompressionType::FSST) {
+        dataState.metadata.compMeta.fsstMetadata()->symbolTable->encode(val, encoded);
+        val = std::string_view(reinterpret_cast<const char*>(encoded.data()), encoded.size());
+    }
+    const auto startOffset = dataColumn->appendValues(*dictChunk.getStringDataChunk(), dataState,
         reinterpret_cast<const uint8_t*>(val.data()), nullptr /*nullChunkData*/, val.size());
     return offsetColumn->appendValues(*dictChunk.getOffsetChunk(),
         StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET),
@@ -123,6 +132,21 @@ void DictionaryColumn::scanOffsets(const ChunkState& state,
 void DictionaryColumn::scanValueToVector(const ChunkState& dataState, uint64_t startOffset,
     uint64_t endOffset, ValueVector* resultVector, uint64_t offsetInVector) const {
     KU_ASSERT(endOffset >= startOffset);
+    const auto& compMeta = dataState.metadata.compMeta;
+    if (compMeta.compression == CompressionType::FSST) {
+        // Only the encoded bytes of this string are read and decoded
+        auto& encoded = dataState.fsstScratchBuffer;
+        encoded.resize(endOffset - startOffset);
+        dataColumn->scan(dataState, startOffset, endOffset, encoded.data());
+        const auto& symbolTable = *compMeta.fsstMetadata()->symbolTable;
+        auto& kuString = StringVector::reserveString(resultVector, offsetInVector,
+            symbolTable.getDecodedLength(encoded));
+        symbolTable.decode(encoded, (uint8_t*)kuString.getData());
+        if (!ku_string_t::isShortString(kuString.len)) {
+            memcpy(kuString.prefix, kuString.getData(), ku_string_t::PREFIX_LENGTH);
+        }
+        return;
+    }
     // Add string to vector first and read directly into the vector
     auto& kuString =
         StringVector::reserveString(resultVector, offsetInVector, endOffset - startOffset);
@@ -149,10 +173,20 @@ bool DictionaryColumn::canCommitInPlace(const ChunkState& state, uint64_t numNew
     return true;
 }
 
+uint64_t DictionaryColumn::getMaxDataSizeToAdd(const ChunkState& dataState,
+    uint64_t totalStringLengthToAdd) {
+    if (dataState.metadata.compMeta.compression == CompressionType::FSST) {
+        return totalStringLengthToAdd * FSSTSymbolTable::MAX_ENCODED_SIZE_FACTOR;
+    }
+    return totalStringLengthToAdd;
+}
+
 bool DictionaryColumn::canDataCommitInPlace(const ChunkState& dataState,
     uint64_t totalStringLengthToAdd) {
-    // Make sure there is sufficient space in the data chunk (not currently compressed)
-    auto totalStringDataAfterUpdate = dataState.metadata.numValues + totalStringLengthToAdd;
+    // Make sure there is sufficient space in the data chunk (only compressed with FSST, which
+    // leaves the encoded bytes as they are)
+    auto totalStringDataAfterUpdate =
+        dataState.metadata.numValues + getMaxDataSizeToAdd(dataState, totalStringLengthToAdd);
     if (totalStringDataAfterUpdate > dataState.metadata.getNumPages() * KUZU_PAGE_SIZE) {
         // Data cannot be updated in place
         return false;
@@ -162,7 +196,8 @@ bool DictionaryColumn::canDataCommitInPlace(const ChunkState& dataState,
 
 bool DictionaryColumn::canOffsetCommitInPlace(const ChunkState& offsetState,
     const ChunkState& dataState, uint64_t numNewStrings, uint64_t totalStringLengthToAdd) const {
-    auto totalStringOffsetsAfterUpdate = dataState.metadata.numValues + totalStringLengthToAdd;
+    auto totalStringOffsetsAfterUpdate =
+        dataState.metadata.numValues + getMaxDataSizeToAdd(dataState, totalStringLengthToAdd);
     auto offsetCapacity =
         offsetState.metadata.compMeta.numValues(KUZU_PAGE_SIZE, offsetColumn->getDataType()) *
         offsetState.metadata.getNumPages();
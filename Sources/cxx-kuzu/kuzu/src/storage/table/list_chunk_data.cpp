@@ -448,5 +448,19 @@ void ListChunkData::reclaimStorage(PageAllocator& pageAllocator) {
     offsetColumnChunk->reclaimStorage(pageAllocator);
 }
 
+void ListChunkData::setBlockCompression(PageAllocator& pageAllocator, BlockCompressionType type) {
+    ColumnChunkData::setBlockCompression(pageAllocator, type);
+    sizeColumnChunk->setBlockCompression(pageAllocator, type);
+    dataColumnChunk->setBlockCompression(pageAllocator, type);
+    offsetColumnChunk->setBlockCompression(pageAllocator, type);
+}
+
+void ListChunkData::compactStorage(StorageCompactor& compactor) {
+    ColumnChunkData::compactStorage(compactor);
+    sizeColumnChunk->compactStorage(compactor);
+    dataColumnChunk->compactStorage(compactor);
+    offsetColumnChunk->compactStorage(compactor);
+}
+
 } // namespace storage
 } // namespace kuzu
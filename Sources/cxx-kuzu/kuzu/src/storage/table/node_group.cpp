@@ -1,6 +1,13 @@
 #include "storage/table/node_group.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "common/assert.h"
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/buffer_writer.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
 #include "common/types/types.h"
 #include "common/uniq_lock.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -343,6 +350,64 @@ bool NodeGroup::hasDeletions(const Transaction* transaction) const {
     return false;
 }
 
+bool NodeGroup::isFlushed() const {
+    const auto lock = chunkedGroups.lock();
+    return chunkedGroups.getNumGroups(lock) == 1 &&
+           chunkedGroups.getFirstGroup(lock)->getResidencyState() == ResidencyState::ON_DISK;
+}
+
+static std::vector<column_id_t> getAllColumnIDs(column_id_t numColumns) {
+    std::vector<column_id_t> columnIDs(numColumns);
+    std::iota(columnIDs.begin(), columnIDs.end(), 0);
+    return columnIDs;
+}
+
+void NodeGroup::flushInMemoryData(PageAllocator& pageAllocator,
+    const std::vector<const Column*>& columns, const Transaction* transaction) {
+    const auto lock = chunkedGroups.lock();
+    KU_ASSERT(getNumResidentRows<ResidencyState::ON_DISK>(lock) == 0);
+    auto versionInfo = checkpointVersionInfo(lock, transaction);
+    auto flushedGroup = scanAllInsertedAndVersions<ResidencyState::IN_MEMORY>(mm, lock,
+        getAllColumnIDs(columns.size()), columns, true /* enableCompression */);
+    flushedGroup->flush(pageAllocator);
+    flushedGroup->setVersionInfo(std::move(versionInfo));
+    chunkedGroups.clear(lock);
+    chunkedGroups.appendGroup(lock, std::move(flushedGroup));
+}
+
+void NodeGroup::loadFlushedData(PageAllocator& pageAllocator,
+    const std::vector<const Column*>& columns, const Transaction* transaction) {
+    const auto lock = chunkedGroups.lock();
+    KU_ASSERT(getNumResidentRows<ResidencyState::IN_MEMORY>(lock) == 0);
+    auto versionInfo = checkpointVersionInfo(lock, transaction);
+    auto loadedGroup = scanAllInsertedAndVersions<ResidencyState::ON_DISK>(mm, lock,
+        getAllColumnIDs(columns.size()), columns, enableCompression);
+    loadedGroup->setVersionInfo(std::move(versionInfo));
+    reclaimStorage(pageAllocator, lock);
+    chunkedGroups.clear(lock);
+    chunkedGroups.appendGroup(lock, std::move(loadedGroup));
+}
+
+std::unique_ptr<ChunkedNodeGroup> NodeGroup::scanFlushedData(
+    const std::vector<const Column*>& columns) const {
+    const auto lock = chunkedGroups.lock();
+    KU_ASSERT(getNumResidentRows<ResidencyState::IN_MEMORY>(lock) == 0);
+    return scanAllInsertedAndVersions<ResidencyState::ON_DISK>(mm, lock,
+        getAllColumnIDs(columns.size()), columns, enableCompression);
+}
+
+std::unique_ptr<ChunkedNodeGroup> NodeGroup::shareFlushedData() const {
+    const auto lock = chunkedGroups.lock();
+    KU_ASSERT(getNumResidentRows<ResidencyState::IN_MEMORY>(lock) == 0);
+    // The chunk metadata is copied through the serializer, which leaves the pages untouched.
+    const auto bufferWriter = std::make_shared<BufferWriter>();
+    Serializer serializer(bufferWriter);
+    chunkedGroups.getFirstGroup(lock)->serialize(serializer);
+    Deserializer deSer(
+        std::make_unique<BufferReader>(bufferWriter->getBlobData(), bufferWriter->getSize()));
+    return ChunkedNodeGroup::deserialize(mm, deSer);
+}
+
 void NodeGroup::addColumn(TableAddColumnState& addColumnState, PageAllocator* pageAllocator,
     ColumnStats* newColumnStats) {
     dataTypes.push_back(addColumnState.propertyDefinition.getType().copy());
@@ -381,15 +446,22 @@ void NodeGroup::checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointStat
     if (checkpointedVersionInfo->getNumDeletions(&DUMMY_CHECKPOINT_TRANSACTION, 0, numRows) ==
         numRows - firstGroup->getStartRowIdx()) {
         reclaimStorage(state.pageAllocator, lock);
+        numUnchangedCheckpoints = 0;
         checkpointedChunkedGroup =
             std::make_unique<ChunkedNodeGroup>(memoryManager, dataTypes, enableCompression,
                 StorageConfig::CHUNKED_NODE_GROUP_CAPACITY, numRows, ResidencyState::IN_MEMORY);
         checkpointedChunkedGroup->flush(state.pageAllocator);
     } else {
         if (hasPersistentData) {
+            if (hasDataChanges(lock, state)) {
+                // Chunks are rewritten in place, so they can't stay block compressed.
+                firstGroup->setBlockCompression(state.pageAllocator, BlockCompressionType::NONE);
+                numUnchangedCheckpoints = 0;
+            }
             checkpointedChunkedGroup = checkpointInMemAndOnDisk(memoryManager, lock, state);
         } else {
             checkpointedChunkedGroup = checkpointInMemOnly(memoryManager, lock, state);
+            numUnchangedCheckpoints = 0;
         }
         checkpointedChunkedGroup->setVersionInfo(std::move(checkpointedVersionInfo));
     }
@@ -398,6 +470,45 @@ void NodeGroup::checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointStat
     checkpointDataTypesNoLock(state);
 }
 
+bool NodeGroup::checkpointColdData(PageAllocator& pageAllocator, BlockCompressionType type,
+    uint64_t coldCheckpointThreshold) {
+    const auto lock = chunkedGroups.lock();
+    if (numUnchangedCheckpoints > coldCheckpointThreshold ||
+        chunkedGroups.getNumGroups(lock) != 1) {
+        return false;
+    }
+    const auto firstGroup = chunkedGroups.getFirstGroup(lock);
+    if (firstGroup->getResidencyState() != ResidencyState::ON_DISK ||
+        firstGroup->hasBlockCompression()) {
+        return false;
+    }
+    numUnchangedCheckpoints++;
+    if (numUnchangedCheckpoints <= coldCheckpointThreshold) {
+        return false;
+    }
+    firstGroup->setBlockCompression(pageAllocator, type);
+    return true;
+}
+
+void NodeGroup::compactStorage(StorageCompactor& compactor) {
+    const auto lock = chunkedGroups.lock();
+    for (auto& chunkedGroup : chunkedGroups.getAllGroups(lock)) {
+        chunkedGroup->compactStorage(compactor);
+    }
+}
+
+bool NodeGroup::hasDataChanges(const UniqLock& lock, const NodeGroupCheckpointState& state) const {
+    // Deletions only change the version info, so they don't count as changes to the data.
+    const auto firstGroup = chunkedGroups.getFirstGroup(lock);
+    if (numRows > firstGroup->getStartRowIdx() + firstGroup->getNumRows()) {
+        return true;
+    }
+    return std::ranges::any_of(state.columnIDs, [&](column_id_t columnID) {
+        return firstGroup->hasAnyUpdates(&DUMMY_CHECKPOINT_TRANSACTION, columnID, 0,
+            firstGroup->getNumRows());
+    });
+}
+
 void NodeGroup::checkpointDataTypesNoLock(const NodeGroupCheckpointState& state) {
     std::vector<LogicalType> checkpointedTypes;
     for (auto i = 0u; i < state.columnIDs.size(); i++) {
@@ -418,7 +529,7 @@ std::unique_ptr<ChunkedNodeGroup> NodeGroup::checkpointInMemAndOnDisk(MemoryMana
         columnPtrs.push_back(column);
     }
     const auto insertChunkedGroup = scanAllInsertedAndVersions<ResidencyState::IN_MEMORY>(
-        memoryManager, lock, state.columnIDs, columnPtrs);
+        memoryManager, lock, state.columnIDs, columnPtrs, enableCompression);
     const auto numInsertedRows = insertChunkedGroup->getNumRows();
     for (auto i = 0u; i < state.columnIDs.size(); i++) {
         const auto columnID = state.columnIDs[i];
@@ -433,7 +544,7 @@ std::unique_ptr<ChunkedNodeGroup> NodeGroup::checkpointInMemAndOnDisk(MemoryMana
         if (columnHasUpdates) {
             // TODO(Guodong): Optimize this to scan only vectors with updates.
             const auto updateChunk = scanAllInsertedAndVersions<ResidencyState::ON_DISK>(
-                memoryManager, lock, {columnID}, {state.columns[columnID]});
+                memoryManager, lock, {columnID}, {state.columns[columnID]}, enableCompression);
             KU_ASSERT(updateChunk->getNumRows() == numPersistentRows);
             chunkCheckpointStates.push_back(ChunkCheckpointState{
                 updateChunk->getColumnChunk(0).moveData(), 0, updateChunk->getNumRows()});
@@ -468,7 +579,7 @@ std::unique_ptr<ChunkedNodeGroup> NodeGroup::checkpointInMemOnly(MemoryManager&
         columnPtrs.push_back(column);
     }
     auto insertChunkedGroup = scanAllInsertedAndVersions<ResidencyState::IN_MEMORY>(memoryManager,
-        lock, state.columnIDs, columnPtrs);
+        lock, state.columnIDs, columnPtrs, enableCompression);
     insertChunkedGroup->flush(state.pageAllocator);
     return insertChunkedGroup;
 }
@@ -517,6 +628,8 @@ void NodeGroup::serialize(Serializer& serializer) {
         serializer.writeDebuggingInfo("checkpointed_data");
         chunkedGroup->serialize(serializer);
     }
+    serializer.writeDebuggingInfo("num_unchanged_checkpoints");
+    serializer.write<uint64_t>(numUnchangedCheckpoints);
 }
 
 std::unique_ptr<NodeGroup> NodeGroup::deserialize(MemoryManager& mm, Deserializer& deSer,
@@ -546,8 +659,11 @@ std::unique_ptr<NodeGroup> NodeGroup::deserialize(MemoryManager& mm, Deserialize
             chunkedNodeGroup = std::make_unique<ChunkedNodeGroup>(mm, columnTypes,
                 enableCompression, 0, 0, ResidencyState::IN_MEMORY);
         }
-        return std::make_unique<NodeGroup>(mm, nodeGroupIdx, enableCompression,
+        auto nodeGroup = std::make_unique<NodeGroup>(mm, nodeGroupIdx, enableCompression,
             std::move(chunkedNodeGroup));
+        deSer.validateDebuggingInfo(key, "num_unchanged_checkpoints");
+        deSer.deserializeValue<uint64_t>(nodeGroup->numUnchangedCheckpoints);
+        return nodeGroup;
     }
     case NodeGroupDataFormat::CSR: {
         if (hasCheckpointedData) {
@@ -616,7 +732,7 @@ row_idx_t NodeGroup::getNumResidentRows(const UniqLock& lock) const {
 template<ResidencyState RESIDENCY_STATE>
 std::unique_ptr<ChunkedNodeGroup> NodeGroup::scanAllInsertedAndVersions(
     MemoryManager& memoryManager, const UniqLock& lock, const std::vector<column_id_t>& columnIDs,
-    const std::vector<const Column*>& columns) const {
+    const std::vector<const Column*>& columns, bool enableCompression) const {
     auto numResidentRows = getNumResidentRows<RESIDENCY_STATE>(lock);
     std::vector<LogicalType> columnTypes;
     for (const auto* column : columns) {
@@ -644,11 +760,11 @@ std::unique_ptr<ChunkedNodeGroup> NodeGroup::scanAllInsertedAndVersions(
 template std::unique_ptr<ChunkedNodeGroup>
 NodeGroup::scanAllInsertedAndVersions<ResidencyState::ON_DISK>(MemoryManager& memoryManager,
     const UniqLock& lock, const std::vector<column_id_t>& columnIDs,
-    const std::vector<const Column*>& columns) const;
+    const std::vector<const Column*>& columns, bool enableCompression) const;
 template std::unique_ptr<ChunkedNodeGroup>
 NodeGroup::scanAllInsertedAndVersions<ResidencyState::IN_MEMORY>(MemoryManager& memoryManager,
     const UniqLock& lock, const std::vector<column_id_t>& columnIDs,
-    const std::vector<const Column*>& columns) const;
+    const std::vector<const Column*>& columns, bool enableCompression) const;
 
 bool NodeGroup::isVisible(const Transaction* transaction, row_idx_t rowIdxInGroup) const {
     ChunkedNodeGroup* chunkedGroup = nullptr;
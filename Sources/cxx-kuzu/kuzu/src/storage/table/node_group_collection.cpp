@@ -1,6 +1,11 @@
 #include "storage/table/node_group_collection.h"
 
+#include <atomic>
+
+#include "common/task_system/task_scheduler.h"
 #include "common/vector/value_vector.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
 #include "storage/table/csr_node_group.h"
 #include "storage/table/table.h"
 #include "transaction/transaction.h"
@@ -69,36 +74,44 @@ void NodeGroupCollection::append(const Transaction* transaction,
     const std::vector<column_id_t>& columnIDs, const NodeGroup& nodeGroup) {
     KU_ASSERT(nodeGroup.getDataTypes().size() == columnIDs.size());
     const auto lock = nodeGroups.lock();
+    const auto numChunkedGroupsToAppend = nodeGroup.getNumChunkedGroups();
+    for (auto i = 0u; i < numChunkedGroupsToAppend; i++) {
+        append(lock, transaction, columnIDs, *nodeGroup.getChunkedNodeGroup(i));
+    }
+}
+
+void NodeGroupCollection::append(const Transaction* transaction,
+    const std::vector<column_id_t>& columnIDs, ChunkedNodeGroup& chunkedGroup) {
+    KU_ASSERT(chunkedGroup.getNumColumns() == columnIDs.size());
+    append(nodeGroups.lock(), transaction, columnIDs, chunkedGroup);
+}
+
+void NodeGroupCollection::append(const UniqLock& lock, const Transaction* transaction,
+    const std::vector<column_id_t>& columnIDs, ChunkedNodeGroup& chunkedGroup) {
     if (nodeGroups.isEmpty(lock)) {
         auto newGroup =
             std::make_unique<NodeGroup>(mm, 0, enableCompression, LogicalType::copy(types));
         nodeGroups.appendGroup(lock, std::move(newGroup));
     }
-    const auto numChunkedGroupsToAppend = nodeGroup.getNumChunkedGroups();
-    node_group_idx_t numChunkedGroupsAppended = 0;
-    while (numChunkedGroupsAppended < numChunkedGroupsToAppend) {
-        const auto chunkedGroupToAppend = nodeGroup.getChunkedNodeGroup(numChunkedGroupsAppended);
-        const auto numRowsToAppendInChunkedGroup = chunkedGroupToAppend->getNumRows();
-        row_idx_t numRowsAppendedInChunkedGroup = 0;
-        while (numRowsAppendedInChunkedGroup < numRowsToAppendInChunkedGroup) {
-            auto lastNodeGroup = nodeGroups.getLastGroup(lock);
-            if (!lastNodeGroup || lastNodeGroup->isFull()) {
-                auto newGroup = std::make_unique<NodeGroup>(mm, nodeGroups.getNumGroups(lock),
-                    enableCompression, LogicalType::copy(types));
-                nodeGroups.appendGroup(lock, std::move(newGroup));
-            }
-            lastNodeGroup = nodeGroups.getLastGroup(lock);
-            const auto numToAppendInBatch =
-                std::min(numRowsToAppendInChunkedGroup - numRowsAppendedInChunkedGroup,
-                    lastNodeGroup->getNumRowsLeftToAppend());
-            lastNodeGroup->moveNextRowToAppend(numToAppendInBatch);
-            pushInsertInfo(transaction, lastNodeGroup, numToAppendInBatch);
-            numTotalRows += numToAppendInBatch;
-            lastNodeGroup->append(transaction, columnIDs, *chunkedGroupToAppend,
-                numRowsAppendedInChunkedGroup, numToAppendInBatch);
-            numRowsAppendedInChunkedGroup += numToAppendInBatch;
+    const auto numRowsToAppendInChunkedGroup = chunkedGroup.getNumRows();
+    row_idx_t numRowsAppendedInChunkedGroup = 0;
+    while (numRowsAppendedInChunkedGroup < numRowsToAppendInChunkedGroup) {
+        auto lastNodeGroup = nodeGroups.getLastGroup(lock);
+        if (!lastNodeGroup || lastNodeGroup->isFull()) {
+            auto newGroup = std::make_unique<NodeGroup>(mm, nodeGroups.getNumGroups(lock),
+                enableCompression, LogicalType::copy(types));
+            nodeGroups.appendGroup(lock, std::move(newGroup));
         }
-        numChunkedGroupsAppended++;
+        lastNodeGroup = nodeGroups.getLastGroup(lock);
+        const auto numToAppendInBatch =
+            std::min(numRowsToAppendInChunkedGroup - numRowsAppendedInChunkedGroup,
+                lastNodeGroup->getNumRowsLeftToAppend());
+        lastNodeGroup->moveNextRowToAppend(numToAppendInBatch);
+        pushInsertInfo(transaction, lastNodeGroup, numToAppendInBatch);
+        numTotalRows += numToAppendInBatch;
+        lastNodeGroup->append(transaction, columnIDs, chunkedGroup, numRowsAppendedInChunkedGroup,
+            numToAppendInBatch);
+        numRowsAppendedInChunkedGroup += numToAppendInBatch;
     }
 }
 
@@ -155,6 +168,31 @@ std::pair<offset_t, offset_t> NodeGroupCollection::appendToLastNodeGroupAndFlush
     return {startOffset, numToAppend};
 }
 
+bool NodeGroupCollection::isLastNodeGroupFull() const {
+    const auto lock = nodeGroups.lock();
+    return nodeGroups.isEmpty(lock) || nodeGroups.getLastGroup(lock)->isFull();
+}
+
+void NodeGroupCollection::appendFlushedNodeGroup(Transaction* transaction,
+    const std::vector<column_id_t>& columnIDs, std::unique_ptr<ChunkedNodeGroup> flushedGroup) {
+    KU_ASSERT(flushedGroup->getResidencyState() == ResidencyState::ON_DISK);
+    const auto numRows = flushedGroup->getNumRows();
+    auto versionInfo = std::make_unique<VersionInfo>();
+    versionInfo->append(transaction->getID(), 0, numRows);
+    flushedGroup->setVersionInfo(std::move(versionInfo));
+    auto groupToMerge = std::make_unique<ChunkedNodeGroup>(mm, *flushedGroup, types, columnIDs);
+    const auto lock = nodeGroups.lock();
+    KU_ASSERT(nodeGroups.isEmpty(lock) || nodeGroups.getLastGroup(lock)->isFull());
+    nodeGroups.appendGroup(lock, std::make_unique<NodeGroup>(mm, nodeGroups.getNumGroups(lock),
+                                     enableCompression, LogicalType::copy(types)));
+    const auto nodeGroup = nodeGroups.getLastGroup(lock);
+    KU_ASSERT(nodeGroup->getNumRowsLeftToAppend() == numRows);
+    nodeGroup->moveNextRowToAppend(numRows);
+    pushInsertInfo(transaction, nodeGroup, numRows);
+    numTotalRows += numRows;
+    nodeGroup->merge(transaction, std::move(groupToMerge));
+}
+
 row_idx_t NodeGroupCollection::getNumTotalRows() const {
     const auto lock = nodeGroups.lock();
     return numTotalRows;
@@ -198,13 +236,48 @@ uint64_t NodeGroupCollection::getEstimatedMemoryUsage() const {
     return estimatedMemUsage;
 }
 
+class CheckpointNodeGroupsTask final : public Task {
+public:
+    CheckpointNodeGroupsTask(uint64_t maxNumThreads,
+        std::span<const std::unique_ptr<NodeGroup>> nodeGroups, MemoryManager& memoryManager,
+        const NodeGroupCheckpointState& state)
+        : Task{maxNumThreads}, nodeGroups{nodeGroups}, memoryManager{memoryManager}, state{state},
+          nextIdx{0} {}
+
+    void run() override {
+        const auto localState = state.copy();
+        for (auto i = nextIdx.fetch_add(1); i < nodeGroups.size(); i = nextIdx.fetch_add(1)) {
+            nodeGroups[i]->checkpoint(memoryManager, *localState);
+        }
+    }
+
+private:
+    std::span<const std::unique_ptr<NodeGroup>> nodeGroups;
+    MemoryManager& memoryManager;
+    const NodeGroupCheckpointState& state;
+    std::atomic<uint64_t> nextIdx;
+};
+
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
-void NodeGroupCollection::checkpoint(MemoryManager& memoryManager,
+void NodeGroupCollection::checkpoint(main::ClientContext* context, MemoryManager& memoryManager,
     NodeGroupCheckpointState& state) {
     KU_ASSERT(residency == ResidencyState::ON_DISK);
     const auto lock = nodeGroups.lock();
-    for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
-        nodeGroup->checkpoint(memoryManager, state);
+    const auto& groups = nodeGroups.getAllGroups(lock);
+    const uint64_t maxNumThreads = context == nullptr ? 1 : context->getMaxNumThreadForExec();
+    const auto numThreads = std::min<uint64_t>(maxNumThreads, groups.size());
+    if (numThreads <= 1) {
+        for (const auto& nodeGroup : groups) {
+            nodeGroup->checkpoint(memoryManager, state);
+        }
+    } else {
+        auto task =
+            std::make_shared<CheckpointNodeGroupsTask>(numThreads, groups, memoryManager, state);
+        processor::ExecutionContext executionContext{nullptr, context, 0 /* queryID */};
+        // The caller may itself be a worker thread of the task scheduler, so a new worker thread
+        // is launched to avoid losing it while waiting.
+        context->getTaskScheduler()->scheduleTaskAndWaitOrError(task, &executionContext,
+            true /* launchNewWorkerThread */);
     }
     std::vector<LogicalType> typesAfterCheckpoint;
     for (auto i = 0u; i < state.columnIDs.size(); i++) {
@@ -213,6 +286,17 @@ void NodeGroupCollection::checkpoint(MemoryManager& memoryManager,
     types = std::move(typesAfterCheckpoint);
 }
 
+bool NodeGroupCollection::checkpointColdData(PageAllocator& pageAllocator,
+    BlockCompressionType type, uint64_t coldCheckpointThreshold) {
+    KU_ASSERT(residency == ResidencyState::ON_DISK);
+    const auto lock = nodeGroups.lock();
+    bool changed = false;
+    for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
+        changed |= nodeGroup->checkpointColdData(pageAllocator, type, coldCheckpointThreshold);
+    }
+    return changed;
+}
+
 void NodeGroupCollection::reclaimStorage(PageAllocator& pageAllocator) const {
     const auto lock = nodeGroups.lock();
     for (auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
@@ -220,6 +304,13 @@ void NodeGroupCollection::reclaimStorage(PageAllocator& pageAllocator) const {
     }
 }
 
+void NodeGroupCollection::compactStorage(StorageCompactor& compactor) const {
+    const auto lock = nodeGroups.lock();
+    for (auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
+        nodeGroup->compactStorage(compactor);
+    }
+}
+
 void NodeGroupCollection::rollbackInsert(row_idx_t numRows_, bool updateNumRows) {
     const auto lock = nodeGroups.lock();
 
@@ -6,6 +6,8 @@
 #include "common/exception/runtime.h"
 #include "common/types/types.h"
 #include "main/client_context.h"
+#include "storage/buffer_manager/memory_tracker.h"
+#include "storage/file_handle.h"
 #include "storage/local_storage/local_node_table.h"
 #include "storage/local_storage/local_storage.h"
 #include "storage/local_storage/local_table.h"
@@ -33,6 +35,7 @@ void NodeTableVersionRecordHandler::applyFuncToChunkedGroups(version_record_hand
 void NodeTableVersionRecordHandler::rollbackInsert(main::ClientContext* context,
     node_group_idx_t nodeGroupIdx, row_idx_t startRow, row_idx_t numRows) const {
     table->rollbackPKIndexInsert(context, startRow, numRows, nodeGroupIdx);
+    table->rollbackSecondaryIndexInsert(startRow, numRows, nodeGroupIdx);
 
     // the only case where a node group would be empty (and potentially removed before) is if an
     // exception occurred while adding its first chunk
@@ -390,16 +393,31 @@ offset_t NodeTable::validateUniquenessConstraint(const Transaction* transaction,
 }
 
 void NodeTable::validatePkNotExists(const Transaction* transaction, ValueVector* pkVector) const {
-    offset_t dummyOffset = INVALID_OFFSET;
     auto& selVector = pkVector->state->getSelVector();
-    KU_ASSERT(selVector.getSelSize() == 1);
-    if (pkVector->isNull(selVector[0])) {
-        throw RuntimeException(ExceptionMessage::nullPKException());
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        if (pkVector->isNull(selVector[i])) {
+            throw RuntimeException(ExceptionMessage::nullPKException());
+        }
     }
-    if (getPKIndex()->lookup(transaction, pkVector, selVector[0], dummyOffset,
-            [&](offset_t offset) { return isVisible(transaction, offset); })) {
-        throw RuntimeException(
-            ExceptionMessage::duplicatePKException(pkVector->getAsValue(selVector[0])->toString()));
+    auto isVisibleFunc = [&](offset_t offset) { return isVisible(transaction, offset); };
+    if (selVector.getSelSize() == 1) {
+        offset_t dummyOffset = INVALID_OFFSET;
+        if (getPKIndex()->lookup(transaction, pkVector, selVector[0], dummyOffset,
+                isVisibleFunc)) {
+            throw RuntimeException(ExceptionMessage::duplicatePKException(
+                pkVector->getAsValue(selVector[0])->toString()));
+        }
+        return;
+    }
+    // The keys of a multi-row insert are probed with a single batched lookup.
+    std::vector<offset_t> offsets(selVector.getSelSize());
+    getPKIndex()->lookupBatch(transaction, *pkVector, selVector.getSelectedPositions(), offsets,
+        isVisibleFunc);
+    for (auto i = 0u; i < offsets.size(); i++) {
+        if (offsets[i] != INVALID_OFFSET) {
+            throw RuntimeException(ExceptionMessage::duplicatePKException(
+                pkVector->getAsValue(selVector[i])->toString()));
+        }
     }
 }
 
@@ -417,9 +435,12 @@ void NodeTable::initInsertState(main::ClientContext* context, TableInsertState&
 void NodeTable::insert(Transaction* transaction, TableInsertState& insertState) {
     const auto& nodeInsertState = insertState.cast<NodeTableInsertState>();
     auto& nodeIDSelVector = nodeInsertState.nodeIDVector.state->getSelVector();
-    KU_ASSERT(nodeInsertState.propertyVectors[0]->state->getSelVector().getSelSize() == 1);
-    KU_ASSERT(nodeIDSelVector.getSelSize() == 1);
-    if (nodeInsertState.nodeIDVector.isNull(nodeIDSelVector[0])) {
+    // A multi-row insert shares one selection between the node id and property vectors, and has
+    // no null node ids.
+    KU_ASSERT(nodeInsertState.propertyVectors[0]->state->getSelVector().getSelSize() ==
+              nodeIDSelVector.getSelSize());
+    if (nodeIDSelVector.getSelSize() == 1 &&
+        nodeInsertState.nodeIDVector.isNull(nodeIDSelVector[0])) {
         return;
     }
     const auto localTable = transaction->getLocalStorage()->getOrCreateLocalTable(*this);
@@ -562,6 +583,8 @@ std::pair<offset_t, offset_t> NodeTable::appendToLastNodeGroup(MemoryManager& mm
     Transaction* transaction, const std::vector<column_id_t>& columnIDs,
     ChunkedNodeGroup& chunkedGroup, PageAllocator& pageAllocator) {
     hasChanges = true;
+    // The appended node groups are owned by the table, not by the COPY.
+    MemoryTracker::Scope untrackedScope{nullptr};
     return nodeGroups->appendToLastNodeGroupAndFlushWhenFull(mm, transaction, columnIDs,
         chunkedGroup, pageAllocator);
 }
@@ -577,6 +600,8 @@ DataChunk NodeTable::constructDataChunkForColumns(const std::vector<column_id_t>
 
 void NodeTable::commit(main::ClientContext* context, TableCatalogEntry* tableEntry,
     LocalTable* localTable) {
+    // The committed node groups are owned by the table, not by the transaction's connection.
+    MemoryTracker::Scope untrackedScope{nullptr};
     const auto startNodeOffset = nodeGroups->getNumTotalRows();
     auto& localNodeTable = localTable->cast<LocalNodeTable>();
 
@@ -591,7 +616,24 @@ void NodeTable::commit(main::ClientContext* context, TableCatalogEntry* tableEnt
     // Note: We cannot simply remove all deleted tuples in local node table, as they may have
     // connected local rels. Directly removing them will cause shift of committed node offset,
     // leading to an inconsistent result with connected rels.
-    nodeGroups->append(transaction, columnIDsToCommit, localNodeTable.getNodeGroups());
+    // Node groups flushed by a large transaction are handed to nodeGroups together with their
+    // pages, the same way COPY appends full chunks, when they start a new node group of the
+    // table. Otherwise, they are read back one at a time while they are appended, so that they
+    // aren't all held in memory at once.
+    for (auto localNodeGroupIdx = 0u; localNodeGroupIdx < localNodeTable.getNumNodeGroups();
+         localNodeGroupIdx++) {
+        const auto localNodeGroup = localNodeTable.getNodeGroup(localNodeGroupIdx);
+        if (localNodeGroup->isFlushed() && nodeGroups->isLastNodeGroupFull()) {
+            nodeGroups->appendFlushedNodeGroup(transaction, columnIDsToCommit,
+                localNodeTable.shareFlushedNodeGroup(localNodeGroupIdx));
+        } else if (localNodeGroup->isFlushed()) {
+            const auto chunkedGroup = localNodeTable.scanFlushedNodeGroup(localNodeGroupIdx);
+            nodeGroups->append(transaction, columnIDsToCommit, *chunkedGroup);
+        } else {
+            nodeGroups->append(transaction, columnIDsToCommit, *localNodeGroup);
+        }
+    }
+    nodeGroups->mergeStats(columnIDsToCommit, localNodeTable.getStats());
     // 2. Set deleted flag for tuples that are deleted in local storage.
     row_idx_t numLocalRows = 0u;
     for (auto localNodeGroupIdx = 0u; localNodeGroupIdx < localNodeTable.getNumNodeGroups();
@@ -636,7 +678,9 @@ void NodeTable::commit(main::ClientContext* context, TableCatalogEntry* tableEnt
         scanIndexColumns(context, indexInserter, localNodeTable.getNodeGroups());
     }
 
-    // 4. Clear local table.
+    // 4. Clear local table. The pages of flushed node groups that weren't handed to nodeGroups are
+    // no longer needed, as their rows are now copied into nodeGroups.
+    localNodeTable.reclaimFlushedNodeGroups();
     localTable->clear(*context->getMemoryManager());
 }
 
@@ -647,7 +691,7 @@ visible_func NodeTable::getVisibleFunc(const Transaction* transaction) const {
 
 bool NodeTable::checkpoint(main::ClientContext* context, TableCatalogEntry* tableEntry,
     PageAllocator& pageAllocator) {
-    const bool ret = hasChanges;
+    bool ret = hasChanges;
     if (hasChanges) {
         // Deleted columns are vacuumed and not checkpointed.
         std::vector<std::unique_ptr<Column>> checkpointColumns;
@@ -666,13 +710,23 @@ bool NodeTable::checkpoint(main::ClientContext* context, TableCatalogEntry* tabl
 
         NodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator,
             memoryManager};
-        nodeGroups->checkpoint(*memoryManager, state);
+        nodeGroups->checkpoint(context, *memoryManager, state);
         for (auto& index : indexes) {
             index.checkpoint(context, pageAllocator);
         }
+        for (auto& index : droppedIndexes) {
+            index.reclaimStorage(pageAllocator);
+        }
+        droppedIndexes.clear();
         tableEntry->vacuumColumnIDs(0 /*nextColumnID*/);
         hasChanges = false;
     }
+    const auto& nodeTableEntry = tableEntry->constCast<NodeTableCatalogEntry>();
+    if (nodeTableEntry.getBlockCompressionType() != BlockCompressionType::NONE &&
+        !pageAllocator.getDataFH()->isInMemoryMode()) {
+        ret |= nodeGroups->checkpointColdData(pageAllocator,
+            nodeTableEntry.getBlockCompressionType(), nodeTableEntry.getColdCheckpointThreshold());
+    }
     return ret;
 }
 
@@ -685,6 +739,14 @@ void NodeTable::rollbackPKIndexInsert(main::ClientContext* context, row_idx_t st
     scanIndexColumns(context, pkDeleter, *nodeGroups);
 }
 
+void NodeTable::rollbackSecondaryIndexInsert(row_idx_t startRow, row_idx_t numRows_,
+    node_group_idx_t nodeGroupIdx_) {
+    const auto startNodeOffset = startRow + StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx_);
+    for (auto& index : indexes) {
+        index.rollbackInsert(startNodeOffset, numRows_);
+    }
+}
+
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
 void NodeTable::rollbackGroupCollectionInsert(row_idx_t numRows_) {
     nodeGroups->rollbackInsert(numRows_);
@@ -698,7 +760,19 @@ void NodeTable::rollbackCheckpoint() {
 
 void NodeTable::reclaimStorage(PageAllocator& pageAllocator) const {
     nodeGroups->reclaimStorage(pageAllocator);
-    getPKIndex()->reclaimStorage(pageAllocator);
+    for (auto& index : indexes) {
+        index.reclaimStorage(pageAllocator);
+    }
+    for (auto& index : droppedIndexes) {
+        index.reclaimStorage(pageAllocator);
+    }
+}
+
+void NodeTable::compactStorage(StorageCompactor& compactor) {
+    nodeGroups->compactStorage(compactor);
+    for (auto& index : indexes) {
+        index.compactStorage(compactor);
+    }
 }
 
 TableStats NodeTable::getStats(const Transaction* transaction) const {
@@ -738,6 +812,39 @@ bool NodeTable::lookupPK(const Transaction* transaction, ValueVector* keyVector,
         [&](offset_t offset) { return isVisibleNoLock(transaction, offset); });
 }
 
+void NodeTable::lookupPKBatch(const Transaction* transaction, const ValueVector& keyVector,
+    std::span<const sel_t> positions, std::span<offset_t> results) const {
+    KU_ASSERT(positions.size() == results.size());
+    auto isVisible = [&](offset_t offset) { return isVisibleNoLock(transaction, offset); };
+    const auto localTable = transaction->getLocalStorage() ?
+                                transaction->getLocalStorage()->getLocalTable(tableID) :
+                                nullptr;
+    if (!localTable) {
+        getPKIndex()->lookupBatch(transaction, keyVector, positions, results, isVisible);
+        return;
+    }
+    // Keys inserted by this transaction are resolved by the local table. Only the remaining keys
+    // go to the persistent index.
+    std::vector<sel_t> remainingPositions;
+    std::vector<idx_t> remainingIdxs;
+    for (auto i = 0u; i < positions.size(); i++) {
+        if (!localTable->cast<LocalNodeTable>().lookupPK(transaction, &keyVector, positions[i],
+                results[i])) {
+            remainingPositions.push_back(positions[i]);
+            remainingIdxs.push_back(i);
+        }
+    }
+    if (remainingPositions.empty()) {
+        return;
+    }
+    std::vector<offset_t> remainingResults(remainingPositions.size());
+    getPKIndex()->lookupBatch(transaction, keyVector, remainingPositions, remainingResults,
+        isVisible);
+    for (auto i = 0u; i < remainingIdxs.size(); i++) {
+        results[remainingIdxs[i]] = remainingResults[i];
+    }
+}
+
 void NodeTable::scanIndexColumns(main::ClientContext* context, IndexScanHelper& scanHelper,
     const NodeGroupCollection& nodeGroups_) const {
     auto dataChunk = constructDataChunkForColumns(scanHelper.index->getIndexInfo().columnIDs);
@@ -778,7 +885,10 @@ void NodeTable::dropIndex(const std::string& name) {
     for (auto it = indexes.begin(); it != indexes.end(); ++it) {
         if (StringUtils::caseInsensitiveEquals(it->getName(), name)) {
             KU_ASSERT(it->isLoaded());
+            // The pages of the index are freed at the next checkpoint.
+            droppedIndexes.push_back(std::move(*it));
             indexes.erase(it);
+            hasChanges = true;
             return;
         }
     }
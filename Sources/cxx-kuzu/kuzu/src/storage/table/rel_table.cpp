@@ -6,6 +6,7 @@
 #include "common/exception/message.h"
 #include "common/exception/runtime.h"
 #include "main/client_context.h"
+#include "storage/buffer_manager/memory_tracker.h"
 #include "storage/local_storage/local_rel_table.h"
 #include "storage/local_storage/local_storage.h"
 #include "storage/local_storage/local_table.h"
@@ -223,6 +224,7 @@ void RelTable::update(Transaction* transaction, TableUpdateState& updateState) {
         for (auto& relData : directedRelData) {
             relData->update(transaction,
                 relUpdateState.getBoundNodeIDVector(relData->getDirection()),
+                relUpdateState.getNbrNodeIDVector(relData->getDirection()),
                 relUpdateState.relIDVector, relUpdateState.columnID, relUpdateState.propertyVector);
         }
     }
@@ -250,6 +252,7 @@ bool RelTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
         for (auto& relData : directedRelData) {
             isDeleted = relData->delete_(transaction,
                 relDeleteState.getBoundNodeIDVector(relData->getDirection()),
+                relDeleteState.getNbrNodeIDVector(relData->getDirection()),
                 relDeleteState.relIDVector);
             if (!isDeleted) {
                 break;
@@ -318,6 +321,35 @@ bool RelTable::checkIfNodeHasRels(Transaction* transaction, RelDataDirection dir
     return hasRels;
 }
 
+void RelTable::addDegrees(Transaction* transaction, RelDataDirection direction,
+    offset_t startNodeOffset, std::span<uint64_t> degrees) const {
+    const auto tableData = getDirectedTableData(direction);
+    offset_t numNodesProcessed = 0;
+    while (numNodesProcessed < degrees.size()) {
+        const auto nodeOffset = startNodeOffset + numNodesProcessed;
+        const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(nodeOffset);
+        const auto offsetInGroup = nodeOffset % StorageConfig::NODE_GROUP_SIZE;
+        const auto numNodesInGroup = std::min<offset_t>(degrees.size() - numNodesProcessed,
+            StorageConfig::NODE_GROUP_SIZE - offsetInGroup);
+        if (const auto nodeGroup = tableData->getNodeGroup(nodeGroupIdx)) {
+            nodeGroup->cast<CSRNodeGroup>().addDegrees(transaction,
+                tableData->getCSROffsetColumn(), tableData->getCSRLengthColumn(), offsetInGroup,
+                degrees.subspan(numNodesProcessed, numNodesInGroup));
+        }
+        numNodesProcessed += numNodesInGroup;
+    }
+    // Deleted local rels are removed from the local csr index, so the index only holds rels that
+    // are visible to the transaction.
+    if (const auto localTable = transaction->getLocalStorage()->getLocalTable(tableID)) {
+        auto& localCSRIndex = localTable->cast<LocalRelTable>().getCSRIndex(direction);
+        const auto endNodeOffset = startNodeOffset + degrees.size();
+        for (auto it = localCSRIndex.lower_bound(startNodeOffset);
+             it != localCSRIndex.end() && it->first < endNodeOffset; ++it) {
+            degrees[it->first - startNodeOffset] += it->second.size();
+        }
+    }
+}
+
 void RelTable::throwIfNodeHasRels(Transaction* transaction, RelDataDirection direction,
     ValueVector* srcNodeIDVector, const rel_multiplicity_constraint_throw_func_t& throwFunc) const {
     const auto nodeIDPos = srcNodeIDVector->state->getSelVector()[0];
@@ -345,10 +377,12 @@ void RelTable::detachDeleteForCSRRels(Transaction* transaction, RelTableData* ta
                 continue;
             }
             [[maybe_unused]] const auto deleted = tableData->delete_(transaction,
-                deleteState->srcNodeIDVector, deleteState->relIDVector);
+                deleteState->srcNodeIDVector, deleteState->dstNodeIDVector,
+                deleteState->relIDVector);
             if (reverseTableData) {
                 [[maybe_unused]] const auto reverseDeleted = reverseTableData->delete_(transaction,
-                    deleteState->dstNodeIDVector, deleteState->relIDVector);
+                    deleteState->dstNodeIDVector, deleteState->srcNodeIDVector,
+                    deleteState->relIDVector);
                 KU_ASSERT(deleted == reverseDeleted);
             }
         }
@@ -394,6 +428,8 @@ void RelTable::pushInsertInfo(const Transaction* transaction, RelDataDirection d
 
 void RelTable::commit(main::ClientContext* context, TableCatalogEntry* tableEntry,
     LocalTable* localTable) {
+    // The committed node groups are owned by the table, not by the transaction's connection.
+    MemoryTracker::Scope untrackedScope{nullptr};
     auto& localRelTable = localTable->cast<LocalRelTable>();
     if (localRelTable.isEmpty()) {
         localTable->clear(*context->getMemoryManager());
@@ -443,6 +479,12 @@ void RelTable::reclaimStorage(PageAllocator& pageAllocator) const {
     }
 }
 
+void RelTable::compactStorage(StorageCompactor& compactor) {
+    for (auto& relData : directedRelData) {
+        relData->compactStorage(compactor);
+    }
+}
+
 void RelTable::updateRelOffsets(const LocalRelTable& localRelTable) {
     auto& localNodeGroup = localRelTable.getLocalNodeGroup();
     const offset_t maxCommittedOffset = reserveRelOffsets(localNodeGroup.getNumRows());
@@ -488,7 +530,7 @@ void RelTable::prepareCommitForNodeGroup(const Transaction* transaction,
     }
 }
 
-bool RelTable::checkpoint(main::ClientContext*, TableCatalogEntry* tableEntry,
+bool RelTable::checkpoint(main::ClientContext* context, TableCatalogEntry* tableEntry,
     PageAllocator& pageAllocator) {
     bool ret = hasChanges;
     if (hasChanges) {
@@ -498,8 +540,10 @@ bool RelTable::checkpoint(main::ClientContext*, TableCatalogEntry* tableEntry,
         for (auto& property : tableEntry->getProperties()) {
             columnIDs.push_back(tableEntry->getColumnID(property.getName()));
         }
+        const auto sortListsByNeighbor =
+            tableEntry->constCast<RelGroupCatalogEntry>().isSortedByNeighbor();
         for (auto& directedRelData : directedRelData) {
-            directedRelData->checkpoint(columnIDs, pageAllocator);
+            directedRelData->checkpoint(context, columnIDs, pageAllocator, sortListsByNeighbor);
         }
         hasChanges = false;
     }
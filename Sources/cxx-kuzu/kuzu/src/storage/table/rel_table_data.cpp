@@ -105,7 +105,8 @@ void RelTableData::initPropertyColumns(const RelGroupCatalogEntry& relGroupEntry
 }
 
 bool RelTableData::update(Transaction* transaction, ValueVector& boundNodeIDVector,
-    const ValueVector& relIDVector, column_id_t columnID, const ValueVector& dataVector) const {
+    const ValueVector& nbrNodeIDVector, const ValueVector& relIDVector, column_id_t columnID,
+    const ValueVector& dataVector) const {
     KU_ASSERT(boundNodeIDVector.state->getSelVector().getSelSize() == 1);
     KU_ASSERT(relIDVector.state->getSelVector().getSelSize() == 1);
     const auto boundNodePos = boundNodeIDVector.state->getSelVector()[0];
@@ -113,7 +114,8 @@ bool RelTableData::update(Transaction* transaction, ValueVector& boundNodeIDVect
     if (boundNodeIDVector.isNull(boundNodePos) || relIDVector.isNull(relIDPos)) {
         return false;
     }
-    const auto [source, rowIdx] = findMatchingRow(transaction, boundNodeIDVector, relIDVector);
+    const auto [source, rowIdx] =
+        findMatchingRow(transaction, boundNodeIDVector, nbrNodeIDVector, relIDVector);
     KU_ASSERT(rowIdx != INVALID_ROW_IDX);
     const auto boundNodeOffset = boundNodeIDVector.getValue<nodeID_t>(boundNodePos).offset;
     const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(boundNodeOffset);
@@ -124,13 +126,14 @@ bool RelTableData::update(Transaction* transaction, ValueVector& boundNodeIDVect
 
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
 bool RelTableData::delete_(Transaction* transaction, ValueVector& boundNodeIDVector,
-    const ValueVector& relIDVector) {
+    const ValueVector& nbrNodeIDVector, const ValueVector& relIDVector) {
     const auto boundNodePos = boundNodeIDVector.state->getSelVector()[0];
     const auto relIDPos = relIDVector.state->getSelVector()[0];
     if (boundNodeIDVector.isNull(boundNodePos) || relIDVector.isNull(relIDPos)) {
         return false;
     }
-    const auto [source, rowIdx] = findMatchingRow(transaction, boundNodeIDVector, relIDVector);
+    const auto [source, rowIdx] =
+        findMatchingRow(transaction, boundNodeIDVector, nbrNodeIDVector, relIDVector);
     if (rowIdx == INVALID_ROW_IDX) {
         return false;
     }
@@ -152,7 +155,8 @@ void RelTableData::addColumn(TableAddColumnState& addColumnState, PageAllocator&
 }
 
 std::pair<CSRNodeGroupScanSource, row_idx_t> RelTableData::findMatchingRow(Transaction* transaction,
-    ValueVector& boundNodeIDVector, const ValueVector& relIDVector) const {
+    ValueVector& boundNodeIDVector, const ValueVector& nbrNodeIDVector,
+    const ValueVector& relIDVector) const {
     KU_ASSERT(boundNodeIDVector.state->getSelVector().getSelSize() == 1);
     KU_ASSERT(relIDVector.state->getSelVector().getSelSize() == 1);
     const auto boundNodePos = boundNodeIDVector.state->getSelVector()[0];
@@ -160,6 +164,23 @@ std::pair<CSRNodeGroupScanSource, row_idx_t> RelTableData::findMatchingRow(Trans
     const auto boundNodeOffset = boundNodeIDVector.getValue<nodeID_t>(boundNodePos).offset;
     const auto relOffset = relIDVector.getValue<nodeID_t>(relIDPos).offset;
     const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(boundNodeOffset);
+    const auto& nodeGroup = getNodeGroup(nodeGroupIdx)->cast<CSRNodeGroup>();
+
+    // Lists sorted by neighbor are binary searched instead of scanned. The in-memory rels of the
+    // node group are only scanned if the rel isn't persistent.
+    const auto nbrPos = nbrNodeIDVector.state->getSelVector()[0];
+    if (!nbrNodeIDVector.isNull(nbrPos)) {
+        const auto persistentRowIdx = nodeGroup.findPersistentRowByNeighbor(transaction,
+            getCSROffsetColumn(), getCSRLengthColumn(), getColumn(NBR_ID_COLUMN_ID),
+            getColumn(REL_ID_COLUMN_ID), boundNodeOffset % StorageConfig::NODE_GROUP_SIZE,
+            nbrNodeIDVector.getValue<nodeID_t>(nbrPos).offset, relOffset);
+        if (persistentRowIdx.has_value() && *persistentRowIdx != INVALID_ROW_IDX) {
+            return {CSRNodeGroupScanSource::COMMITTED_PERSISTENT, *persistentRowIdx};
+        }
+        if (persistentRowIdx.has_value() && nodeGroup.getNumChunkedGroups() == 0) {
+            return {CSRNodeGroupScanSource::NONE, INVALID_ROW_IDX};
+        }
+    }
 
     DataChunk scanChunk(1);
     // RelID output vector.
@@ -242,8 +263,9 @@ void RelTableData::pushInsertInfo(const Transaction* transaction, const CSRNodeG
         getVersionRecordHandler(source), shouldIncrementNumRows);
 }
 
-void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
-    PageAllocator& pageAllocator) {
+void RelTableData::checkpoint(main::ClientContext* context,
+    const std::vector<column_id_t>& columnIDs, PageAllocator& pageAllocator,
+    bool sortListsByNeighbor) {
     std::vector<std::unique_ptr<Column>> checkpointColumns;
     for (auto i = 0u; i < columnIDs.size(); i++) {
         const auto columnID = columnIDs[i];
@@ -258,7 +280,8 @@ void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
 
     CSRNodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator, mm,
         csrHeaderColumns.offset.get(), csrHeaderColumns.length.get()};
-    nodeGroups->checkpoint(*mm, state);
+    state.sortListsByNeighbor = sortListsByNeighbor;
+    nodeGroups->checkpoint(context, *mm, state);
 }
 
 void RelTableData::serialize(Serializer& serializer) const {
@@ -288,5 +311,9 @@ void RelTableData::reclaimStorage(PageAllocator& pageAllocator) const {
     nodeGroups->reclaimStorage(pageAllocator);
 }
 
+void RelTableData::compactStorage(StorageCompactor& compactor) const {
+    nodeGroups->compactStorage(compactor);
+}
+
 } // namespace storage
 } // namespace kuzu
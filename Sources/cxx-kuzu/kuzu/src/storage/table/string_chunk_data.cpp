@@ -262,6 +262,20 @@ void StringChunkData::reclaimStorage(PageAllocator& pageAllocator) {
     dictionaryChunk->getStringDataChunk()->reclaimStorage(pageAllocator);
 }
 
+void StringChunkData::setBlockCompression(PageAllocator& pageAllocator, BlockCompressionType type) {
+    ColumnChunkData::setBlockCompression(pageAllocator, type);
+    indexColumnChunk->setBlockCompression(pageAllocator, type);
+    dictionaryChunk->getOffsetChunk()->setBlockCompression(pageAllocator, type);
+    dictionaryChunk->getStringDataChunk()->setBlockCompression(pageAllocator, type);
+}
+
+void StringChunkData::compactStorage(StorageCompactor& compactor) {
+    ColumnChunkData::compactStorage(compactor);
+    indexColumnChunk->compactStorage(compactor);
+    dictionaryChunk->getOffsetChunk()->compactStorage(compactor);
+    dictionaryChunk->getStringDataChunk()->compactStorage(compactor);
+}
+
 uint64_t StringChunkData::getEstimatedMemoryUsage() const {
     return ColumnChunkData::getEstimatedMemoryUsage() + dictionaryChunk->getEstimatedMemoryUsage();
 }
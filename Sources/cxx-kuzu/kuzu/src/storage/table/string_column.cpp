@@ -52,10 +52,12 @@ std::unique_ptr<ColumnChunkData> StringColumn::flushChunkData(const ColumnChunkD
     flushedStringData.setIndexChunk(
         Column::flushChunkData(*stringChunk.getIndexColumnChunk(), pageAllocator));
     auto& dictChunk = stringChunk.getDictionaryChunk();
+    const auto encodedDictChunk = dictChunk.encodeWithFSST();
+    const auto& dictChunkToFlush = encodedDictChunk ? *encodedDictChunk : dictChunk;
     flushedStringData.getDictionaryChunk().setOffsetChunk(
-        Column::flushChunkData(*dictChunk.getOffsetChunk(), pageAllocator));
+        Column::flushChunkData(*dictChunkToFlush.getOffsetChunk(), pageAllocator));
     flushedStringData.getDictionaryChunk().setStringDataChunk(
-        Column::flushChunkData(*dictChunk.getStringDataChunk(), pageAllocator));
+        dictChunkToFlush.flushStringData(pageAllocator));
     return flushedChunkData;
 }
 
@@ -94,6 +94,20 @@ void StructChunkData::reclaimStorage(PageAllocator& pageAllocator) {
     }
 }
 
+void StructChunkData::setBlockCompression(PageAllocator& pageAllocator, BlockCompressionType type) {
+    ColumnChunkData::setBlockCompression(pageAllocator, type);
+    for (const auto& childChunk : childChunks) {
+        childChunk->setBlockCompression(pageAllocator, type);
+    }
+}
+
+void StructChunkData::compactStorage(StorageCompactor& compactor) {
+    ColumnChunkData::compactStorage(compactor);
+    for (const auto& childChunk : childChunks) {
+        childChunk->compactStorage(compactor);
+    }
+}
+
 void StructChunkData::append(ColumnChunkData* other, offset_t startPosInOtherChunk,
     uint32_t numValuesToAppend) {
     KU_ASSERT(other->getDataType().getPhysicalType() == PhysicalTypeID::STRUCT);
@@ -4,6 +4,7 @@
 
 #include "common/exception/runtime.h"
 #include "common/vector/value_vector.h"
+#include "storage/buffer_manager/memory_tracker.h"
 #include "storage/storage_utils.h"
 #include "storage/table/column_chunk_data.h"
 #include "transaction/transaction.h"
@@ -16,6 +17,8 @@ namespace storage {
 
 VectorUpdateInfo* UpdateInfo::update(MemoryManager& memoryManager, const Transaction* transaction,
     const idx_t vectorIdx, const sel_t rowIdxInVector, const ValueVector& values) {
+    // Updated values are kept by the table until checkpoint, so they aren't charged to the query.
+    MemoryTracker::Scope untrackedScope{nullptr};
     auto& vectorUpdateInfo = getOrCreateVectorInfo(memoryManager, transaction, vectorIdx,
         rowIdxInVector, values.dataType);
     // Check if the row is already updated in this transaction. Overwrite if so.
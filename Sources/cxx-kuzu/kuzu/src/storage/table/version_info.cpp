@@ -58,6 +58,9 @@ struct VectorVersionInfo {
 
     row_idx_t getNumDeletions(transaction_t startTS, transaction_t transactionID,
         row_idx_t startRow, length_t numRows) const;
+    // Returns the number of rows in the range that are both inserted and not deleted.
+    row_idx_t getNumSelected(transaction_t startTS, transaction_t transactionID,
+        row_idx_t startRow, length_t numRows) const;
 
     void serialize(Serializer& serializer) const;
     static std::unique_ptr<VectorVersionInfo> deSerialize(Deserializer& deSer);
@@ -252,6 +255,22 @@ row_idx_t VectorVersionInfo::getNumDeletions(transaction_t startTS, transaction_
     return numDeletions;
 }
 
+row_idx_t VectorVersionInfo::getNumSelected(transaction_t startTS, transaction_t transactionID,
+    row_idx_t startRow, length_t numRows) const {
+    if (insertionStatus == InsertionStatus::NO_INSERTED) {
+        return 0;
+    }
+    if (insertionStatus == InsertionStatus::ALWAYS_INSERTED &&
+        deletionStatus == DeletionStatus::NO_DELETED) {
+        return numRows;
+    }
+    row_idx_t numSelected = 0u;
+    for (auto i = 0u; i < numRows; i++) {
+        numSelected += isSelected(startTS, transactionID, startRow + i);
+    }
+    return numSelected;
+}
+
 void VectorVersionInfo::rollbackInsertions(row_idx_t startRowInVector, row_idx_t numRows) {
     if (isSameInsertionVersion()) {
         // This implicitly assumes that all rows are inserted in the same transaction, so regardless
@@ -550,6 +569,34 @@ row_idx_t VersionInfo::getNumDeletions(const transaction::Transaction* transacti
     return numDeletions;
 }
 
+row_idx_t VersionInfo::getNumSelected(const transaction::Transaction* transaction,
+    row_idx_t startRow, length_t numRows) const {
+    if (numRows == 0) {
+        return 0;
+    }
+    auto [startVector, startRowInVector] =
+        StorageUtils::getQuotientRemainder(startRow, DEFAULT_VECTOR_CAPACITY);
+    auto [endVectorIdx, endRowInVector] =
+        StorageUtils::getQuotientRemainder(startRow + numRows - 1, DEFAULT_VECTOR_CAPACITY);
+    idx_t vectorIdx = startVector;
+    row_idx_t numSelected = 0u;
+    while (vectorIdx <= endVectorIdx) {
+        const auto rowInVector = vectorIdx == startVector ? startRowInVector : 0;
+        const auto numRowsInVector = vectorIdx == endVectorIdx ?
+                                         endRowInVector - rowInVector + 1 :
+                                         DEFAULT_VECTOR_CAPACITY - rowInVector;
+        const auto vectorVersion = getVectorVersionInfo(vectorIdx);
+        if (vectorVersion) {
+            numSelected += vectorVersion->getNumSelected(transaction->getStartTS(),
+                transaction->getID(), rowInVector, numRowsInVector);
+        } else {
+            numSelected += numRowsInVector;
+        }
+        vectorIdx++;
+    }
+    return numSelected;
+}
+
 bool VersionInfo::hasInsertions() const {
     for (auto& vectorInfo : vectorsInfo) {
         if (vectorInfo &&
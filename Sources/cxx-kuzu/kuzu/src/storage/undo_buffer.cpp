@@ -5,6 +5,7 @@
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "catalog/catalog_set.h"
 #include "main/client_context.h"
+#include "storage/index/index.h"
 #include "storage/table/chunked_node_group.h"
 #include "storage/table/update_info.h"
 #include "storage/table/version_record_handler.h"
@@ -52,6 +53,11 @@ struct VectorUpdateRecord {
     VectorUpdateInfo* vectorUpdateInfo;
 };
 
+struct IndexUpdateRecord {
+    Index* index;
+    transaction_t transactionID;
+};
+
 template<typename F>
 void UndoBufferIterator::iterate(F&& callback) {
     idx_t bufferIdx = 0;
@@ -145,6 +151,16 @@ void UndoBuffer::createVectorUpdateInfo(UpdateInfo* updateInfo, const idx_t vect
     *reinterpret_cast<VectorUpdateRecord*>(buffer) = vectorUpdateRecord;
 }
 
+void UndoBuffer::createIndexUpdateInfo(Index* index, transaction_t transactionID) {
+    auto buffer = createUndoRecord(sizeof(UndoRecordHeader) + sizeof(IndexUpdateRecord));
+    const UndoRecordHeader recordHeader{UndoRecordType::INDEX_UPDATE_INFO,
+        sizeof(IndexUpdateRecord)};
+    *reinterpret_cast<UndoRecordHeader*>(buffer) = recordHeader;
+    buffer += sizeof(UndoRecordHeader);
+    const IndexUpdateRecord indexUpdateRecord{index, transactionID};
+    *reinterpret_cast<IndexUpdateRecord*>(buffer) = indexUpdateRecord;
+}
+
 uint8_t* UndoBuffer::createUndoRecord(const uint64_t size) {
     std::unique_lock xLck{mtx};
     if (memoryBuffers.empty() || !memoryBuffers.back().canFit(size)) {
@@ -191,6 +207,9 @@ void UndoBuffer::commitRecord(UndoRecordType recordType, const uint8_t* record,
     case UndoRecordType::UPDATE_INFO: {
         commitVectorUpdateInfo(record, commitTS);
     } break;
+    case UndoRecordType::INDEX_UPDATE_INFO: {
+        commitIndexUpdateInfo(record);
+    } break;
     default:
         KU_UNREACHABLE;
     }
@@ -226,6 +245,11 @@ void UndoBuffer::commitVectorUpdateInfo(const uint8_t* record, transaction_t com
     undoRecord.vectorUpdateInfo->version = commitTS;
 }
 
+void UndoBuffer::commitIndexUpdateInfo(const uint8_t* record) {
+    const auto& undoRecord = *reinterpret_cast<IndexUpdateRecord const*>(record);
+    undoRecord.index->commitUpdate(undoRecord.transactionID);
+}
+
 void UndoBuffer::rollbackRecord(ClientContext* context, const UndoRecordType recordType,
     const uint8_t* record) {
     switch (recordType) {
@@ -242,6 +266,9 @@ void UndoBuffer::rollbackRecord(ClientContext* context, const UndoRecordType rec
     case UndoRecordType::UPDATE_INFO: {
         rollbackVectorUpdateInfo(context->getTransaction(), record);
     } break;
+    case UndoRecordType::INDEX_UPDATE_INFO: {
+        rollbackIndexUpdateInfo(record);
+    } break;
     default: {
         KU_UNREACHABLE;
     }
@@ -322,5 +349,10 @@ void UndoBuffer::rollbackVectorUpdateInfo(const transaction::Transaction* transa
     }
 }
 
+void UndoBuffer::rollbackIndexUpdateInfo(const uint8_t* record) {
+    const auto& undoRecord = *reinterpret_cast<IndexUpdateRecord const*>(record);
+    undoRecord.index->rollbackUpdate(undoRecord.transactionID);
+}
+
 } // namespace storage
 } // namespace kuzu
@@ -168,6 +168,15 @@ static void serializeAlterExtraInfo(Serializer& serializer, const BoundAlterInfo
         auto commentInfo = extraInfo->constPtrCast<BoundExtraCommentInfo>();
         serializer.write(commentInfo->comment);
     } break;
+    case AlterType::SET_COMPRESSION: {
+        auto compressionInfo = extraInfo->constPtrCast<BoundExtraSetCompressionInfo>();
+        serializer.write(compressionInfo->type);
+        serializer.write(compressionInfo->coldCheckpointThreshold);
+    } break;
+    case AlterType::SET_NEIGHBOR_ORDER: {
+        auto orderInfo = extraInfo->constPtrCast<BoundExtraSetNeighborOrderInfo>();
+        serializer.write(orderInfo->sortedByNeighbor);
+    } break;
     case AlterType::RENAME: {
         auto renameTableInfo = extraInfo->constPtrCast<BoundExtraRenameTableInfo>();
         serializer.write(renameTableInfo->newName);
@@ -213,6 +222,18 @@ static decltype(auto) deserializeAlterRecord(Deserializer& deserializer) {
         deserializer.deserializeValue(comment);
         extraInfo = std::make_unique<BoundExtraCommentInfo>(std::move(comment));
     } break;
+    case AlterType::SET_COMPRESSION: {
+        BlockCompressionType type = BlockCompressionType::NONE;
+        uint64_t coldCheckpointThreshold = 0;
+        deserializer.deserializeValue(type);
+        deserializer.deserializeValue(coldCheckpointThreshold);
+        extraInfo = std::make_unique<BoundExtraSetCompressionInfo>(type, coldCheckpointThreshold);
+    } break;
+    case AlterType::SET_NEIGHBOR_ORDER: {
+        bool sortedByNeighbor = false;
+        deserializer.deserializeValue(sortedByNeighbor);
+        extraInfo = std::make_unique<BoundExtraSetNeighborOrderInfo>(sortedByNeighbor);
+    } break;
     case AlterType::RENAME: {
         std::string newName;
         deserializer.deserializeValue(newName);
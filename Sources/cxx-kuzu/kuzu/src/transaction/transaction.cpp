@@ -193,6 +193,10 @@ void Transaction::pushVectorUpdateInfo(storage::UpdateInfo& updateInfo,
     undoBuffer->createVectorUpdateInfo(&updateInfo, vectorIdx, &vectorUpdateInfo);
 }
 
+void Transaction::pushIndexUpdateInfo(storage::Index& index) const {
+    undoBuffer->createIndexUpdateInfo(&index, ID);
+}
+
 Transaction::~Transaction() = default;
 
 common::offset_t Transaction::getMinUncommittedNodeOffset(common::table_id_t tableID) const {
@@ -24,6 +24,36 @@ final class ConnectionTests: XCTestCase {
         super.tearDown()
     }
 
+    // Returns the count returned by a query whose result is a single INT64.
+    private func count(_ conn: Connection, _ query: String) throws -> Int64 {
+        let result = try conn.query(query)
+        return try result.getNext()!.getValue(0) as! Int64
+    }
+
+    // Creates a node table with the given schema, creates the given node for each i in
+    // [0, numRows) and checkpoints, so that the column chunks are compressed on disk.
+    private func createCheckpointedTable(
+        _ conn: Connection, schema: String, node: String, numRows: Int = 10000
+    ) throws {
+        _ = try conn.query("CREATE NODE TABLE \(schema);")
+        _ = try conn.query("UNWIND RANGE(0, \(numRows - 1)) AS i CREATE \(node);")
+        _ = try conn.query("CHECKPOINT;")
+    }
+
+    // Returns the compression of the column chunks of a table that match the predicate.
+    private func compressions(
+        _ conn: Connection, _ table: String, where predicate: String
+    ) throws -> [String] {
+        let result = try conn.query(
+            "CALL storage_info('\(table)') WHERE \(predicate) RETURN compression;"
+        )
+        var compressions: [String] = []
+        while result.hasNext() {
+            compressions.append(try result.getNext()!.getValue(0) as! String)
+        }
+        return compressions
+    }
+
     func testOpenConnection() throws {
         _ = try Connection(db)
     }
@@ -157,4 +187,710 @@ final class ConnectionTests: XCTestCase {
             XCTFail("Unexpected error type")
         }
     }
+
+    func testOrderedIndex() throws {
+        let conn = try Connection(db)
+        _ = try conn.query(
+            "CREATE NODE TABLE Person(id INT64, age INT64, PRIMARY KEY(id));"
+        )
+        _ = try conn.query(
+            "UNWIND RANGE(1, 100) AS i CREATE (:Person {id: i, age: i % 50});"
+        )
+        _ = try conn.query("CALL CREATE_INDEX('Person', 'age_idx', 'age');")
+
+        XCTAssertEqual(try count(conn, "MATCH (p:Person) WHERE p.age = 30 RETURN count(*);"), 2)
+        XCTAssertEqual(
+            try count(conn, "MATCH (p:Person) WHERE p.age > 20 AND p.age <= 40 RETURN count(*);"),
+            40
+        )
+
+        _ = try conn.query("MATCH (p:Person) WHERE p.id = 30 SET p.age = 45;")
+        _ = try conn.query("MATCH (p:Person) WHERE p.id = 80 DELETE p;")
+        _ = try conn.query("CREATE (:Person {id: 101, age: 30});")
+        XCTAssertEqual(try count(conn, "MATCH (p:Person) WHERE p.age = 30 RETURN count(*);"), 1)
+        XCTAssertEqual(try count(conn, "MATCH (p:Person) WHERE p.age = 45 RETURN count(*);"), 3)
+
+        _ = try conn.query("CALL DROP_INDEX('Person', 'age_idx');")
+        XCTAssertEqual(try count(conn, "MATCH (p:Person) WHERE p.age = 30 RETURN count(*);"), 1)
+    }
+
+    func testOrderedIndexAfterCopyAndRollback() throws {
+        let conn = try Connection(db)
+        let csvPath = NSTemporaryDirectory() + "kuzu_swift_test_" + UUID().uuidString + ".csv"
+        defer { try? FileManager.default.removeItem(atPath: csvPath) }
+        let rows = (0..<10000).map { "\($0),\($0 % 100)" }
+        try rows.joined(separator: "\n").write(toFile: csvPath, atomically: true, encoding: .utf8)
+
+        _ = try conn.query("CREATE NODE TABLE Person(id INT64, age INT64, PRIMARY KEY(id));")
+        _ = try conn.query("CALL CREATE_INDEX('Person', 'age_idx', 'age');")
+        // Copied rows are indexed by the copy itself.
+        _ = try conn.query("COPY Person FROM '\(csvPath)' (HEADER=false);")
+        XCTAssertEqual(
+            try count(conn, "MATCH (p:Person) WHERE p.age >= 10 AND p.age < 20 RETURN count(*);"),
+            1000
+        )
+
+        // A failed copy leaves no entries behind.
+        XCTAssertThrowsError(try conn.query("COPY Person FROM '\(csvPath)' (HEADER=false);"))
+        XCTAssertEqual(try count(conn, "MATCH (p:Person) WHERE p.age = 42 RETURN count(*);"), 100)
+
+        let explain = try conn.query("EXPLAIN MATCH (p:Person) WHERE p.age = 42 RETURN count(*);")
+        let plan = try explain.getNext()!.getValue(0) as! String
+        XCTAssertTrue(plan.contains("SECONDARY_INDEX_SCAN_NODE_TABLE"), plan)
+
+        // The entry of a rolled back update is removed, so the index scan no longer returns it.
+        // The scan is checked directly, as the filter on top of it would hide a stale entry.
+        _ = try conn.query("BEGIN TRANSACTION;")
+        _ = try conn.query("MATCH (p:Person) WHERE p.id = 42 SET p.age = 1000;")
+        _ = try conn.query("ROLLBACK;")
+        func numIndexScanOutputTuples(_ query: String) throws -> Int? {
+            let result = try conn.query("PROFILE " + query)
+            let plan = try result.getNext()!.getValue(0) as! String
+            let regex = try NSRegularExpression(
+                pattern: "SECONDARY_INDEX_SCAN_NODE_TABLE.*?NumOutputTuples: ([0-9]+)",
+                options: .dotMatchesLineSeparators
+            )
+            let range = NSRange(plan.startIndex..., in: plan)
+            guard let match = regex.firstMatch(in: plan, range: range) else {
+                return nil
+            }
+            return Int(plan[Range(match.range(at: 1), in: plan)!])
+        }
+        XCTAssertEqual(
+            try numIndexScanOutputTuples(
+                "MATCH (p:Person) WHERE p.age >= 100 AND p.age < 2000 RETURN count(*);"
+            ),
+            0
+        )
+        XCTAssertEqual(
+            try numIndexScanOutputTuples("MATCH (p:Person) WHERE p.age = 42 RETURN count(*);"),
+            100
+        )
+    }
+
+    func testMergeAndCreateOverUnFlatInput() throws {
+        let conn = try Connection(db)
+        _ = try conn.query(
+            "CREATE NODE TABLE Item(id INT64, hits INT64, PRIMARY KEY(id));"
+        )
+        _ = try conn.query(
+            "UNWIND RANGE(0, 4999) AS i CREATE (:Item {id: i * 2, hits: 0});"
+        )
+        // Half of the keys exist, and every key appears twice within a batch of vectors.
+        let merged = try count(
+            conn,
+            """
+            UNWIND RANGE(0, 9999) AS i
+            MERGE (n:Item {id: i % 5000 + 2500})
+            ON CREATE SET n.hits = 1
+            ON MATCH SET n.hits = 2
+            RETURN count(*);
+            """
+        )
+        XCTAssertEqual(merged, 10000)
+
+        XCTAssertEqual(try count(conn, "MATCH (n:Item) RETURN count(*);"), 7500)
+        // The second occurrence of a created key matches the node created by the first one.
+        XCTAssertEqual(try count(conn, "MATCH (n:Item) WHERE n.hits = 2 RETURN count(*);"), 5000)
+        XCTAssertEqual(try count(conn, "MATCH (n:Item) WHERE n.hits = 0 RETURN count(*);"), 2500)
+
+        // A batch with a constant property, and one that repeats a key within the batch.
+        _ = try conn.query("UNWIND RANGE(1, 2000) AS i CREATE (:Item {id: -i, hits: 7});")
+        XCTAssertEqual(try count(conn, "MATCH (n:Item) WHERE n.hits = 7 RETURN count(*);"), 2000)
+        XCTAssertThrowsError(
+            try conn.query("UNWIND [-3000, -3001, -3000] AS i CREATE (:Item {id: i, hits: 0});")
+        )
+        XCTAssertEqual(try count(conn, "MATCH (n:Item) RETURN count(*);"), 9500)
+    }
+
+    func testDeltaAndRunLengthEncoding() throws {
+        let conn = try Connection(db)
+        try createCheckpointedTable(
+            conn,
+            schema: "Reading(id INT64, ts INT64, sensor INT64, PRIMARY KEY(id))",
+            node: "(:Reading {id: i, ts: 1700000000 + i * 7, sensor: i / 1000})"
+        )
+
+        let tsCompressions = try compressions(conn, "Reading", where: "column_name = 'ts'")
+        XCTAssertTrue(tsCompressions.first!.hasPrefix("DELTA_BITPACKING"))
+        let sensorCompressions = try compressions(conn, "Reading", where: "column_name = 'sensor'")
+        XCTAssertTrue(sensorCompressions.first!.hasPrefix("RLE"))
+
+        var result = try conn.query("MATCH (r:Reading) RETURN sum(r.ts), sum(r.sensor);")
+        var tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 17_000_349_965_000)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 45000)
+        result = try conn.query("MATCH (r:Reading) WHERE r.id = 4321 RETURN r.ts, r.sensor;")
+        tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 1_700_030_247)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 4)
+
+        // Updates rewrite the encoded chunks out of place.
+        _ = try conn.query("MATCH (r:Reading) WHERE r.id = 4321 SET r.ts = 0, r.sensor = 99;")
+        _ = try conn.query("CHECKPOINT;")
+        result = try conn.query(
+            """
+            MATCH (r:Reading) WHERE r.id >= 4320 AND r.id <= 4322
+            RETURN r.ts, r.sensor ORDER BY r.id;
+            """
+        )
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1_700_030_240)
+        tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 0)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 99)
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1_700_030_254)
+    }
+
+    func testFSSTStringCompression() throws {
+        let conn = try Connection(db)
+        try createCheckpointedTable(
+            conn,
+            schema: "Page(id INT64, url STRING, PRIMARY KEY(id))",
+            node: "(:Page {id: i, url: 'https://www.example.com/articles/' + CAST(i, 'STRING')})"
+        )
+
+        let urlCompressions = try compressions(conn, "Page", where: "column_name = 'url_data'")
+        XCTAssertTrue(urlCompressions.first!.hasPrefix("FSST"))
+
+        var result = try conn.query("MATCH (p:Page) WHERE p.id = 4321 RETURN p.url;")
+        XCTAssertEqual(
+            try result.getNext()!.getValue(0) as! String,
+            "https://www.example.com/articles/4321"
+        )
+        XCTAssertEqual(
+            try count(conn, "MATCH (p:Page) WHERE p.url ENDS WITH '/9999' RETURN count(*);"),
+            1
+        )
+
+        // Updated strings are encoded with the symbol table of the chunk.
+        _ = try conn.query("MATCH (p:Page) WHERE p.id = 4321 SET p.url = 'https://kuzudb.com';")
+        _ = try conn.query("CHECKPOINT;")
+        result = try conn.query(
+            "MATCH (p:Page) WHERE p.id >= 4320 AND p.id <= 4321 RETURN p.url ORDER BY p.id;"
+        )
+        XCTAssertEqual(
+            try result.getNext()!.getValue(0) as! String,
+            "https://www.example.com/articles/4320"
+        )
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! String, "https://kuzudb.com")
+    }
+
+    func testColdNodeGroupBlockCompression() throws {
+        let conn = try Connection(db)
+        try createCheckpointedTable(
+            conn,
+            schema: "Log(id INT64, msg STRING, PRIMARY KEY(id))",
+            node: "(:Log {id: i, msg: 'request ' + CAST(i % 10, 'STRING') + ' served'})"
+        )
+        _ = try conn.query("CALL SET_TABLE_COMPRESSION('Log', 'zstd', 1);")
+        // The node group becomes cold after two checkpoints without changes.
+        _ = try conn.query("CHECKPOINT;")
+        _ = try conn.query("CHECKPOINT;")
+
+        let isZSTD = "compression CONTAINS 'ZSTD'"
+        XCTAssertFalse(try compressions(conn, "Log", where: isZSTD).isEmpty)
+
+        var result = try conn.query("MATCH (l:Log) RETURN sum(l.id), count(l.msg);")
+        var tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 49_995_000)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 10000)
+        result = try conn.query("MATCH (l:Log) WHERE l.id = 4321 RETURN l.msg;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! String, "request 1 served")
+
+        // Modified node groups are decompressed when they are checkpointed.
+        _ = try conn.query("MATCH (l:Log) WHERE l.id = 4321 SET l.msg = 'updated';")
+        _ = try conn.query("CHECKPOINT;")
+        XCTAssertTrue(try compressions(conn, "Log", where: isZSTD).isEmpty)
+        result = try conn.query(
+            "MATCH (l:Log) WHERE l.id >= 4320 AND l.id <= 4321 RETURN l.msg ORDER BY l.id;"
+        )
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! String, "request 0 served")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! String, "updated")
+    }
+
+    func testParallelCopyPrimaryKeyIndex() throws {
+        let conn = try Connection(db)
+        let csvPath = NSTemporaryDirectory() + "kuzu_swift_test_" + UUID().uuidString + ".csv"
+        defer { try? FileManager.default.removeItem(atPath: csvPath) }
+        let rows = (0..<50000).map { "key-\($0),\($0)" }
+        try rows.joined(separator: "\n").write(toFile: csvPath, atomically: true, encoding: .utf8)
+
+        _ = try conn.query("CREATE NODE TABLE Account(id STRING, balance INT64, PRIMARY KEY(id));")
+        _ = try conn.query("COPY Account FROM '\(csvPath)' (HEADER=false, PARALLEL=true);")
+
+        var result = try conn.query("MATCH (a:Account) RETURN count(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 50000)
+        result = try conn.query("MATCH (a:Account) WHERE a.id = 'key-43210' RETURN a.balance;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 43210)
+
+        // Keys copied by different threads are checked against each other.
+        do {
+            _ = try conn.query("COPY Account FROM '\(csvPath)' (HEADER=false, PARALLEL=true);")
+            XCTFail("Expected error")
+        } catch let error as KuzuError {
+            XCTAssertTrue(error.message.contains("duplicated primary key"))
+        }
+    }
+
+    func testLargeTransactionPrimaryKeyCheckpoint() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE User(name STRING, age INT64, PRIMARY KEY(name));")
+        _ = try conn.query("CREATE (:User {name: 'existing', age: -1});")
+        _ = try conn.query("CHECKPOINT;")
+        // Large enough for the index merge to be sorted in parallel.
+        _ = try conn.query(
+            """
+            UNWIND RANGE(0, 99999) AS i
+            CREATE (:User {name: 'user-' + CAST(i, 'STRING'), age: i});
+            """
+        )
+        _ = try conn.query("CHECKPOINT;")
+
+        var result = try conn.query("MATCH (u:User) RETURN count(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 100_001)
+        for (name, age) in [("existing", -1), ("user-0", 0), ("user-54321", 54321)] {
+            result = try conn.query("MATCH (u:User) WHERE u.name = '\(name)' RETURN u.age;")
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, Int64(age))
+        }
+        do {
+            _ = try conn.query("CREATE (:User {name: 'user-99999', age: 0});")
+            XCTFail("Expected error")
+        } catch let error as KuzuError {
+            XCTAssertTrue(error.message.contains("duplicated primary key"))
+        }
+    }
+
+    func testLargeTransactionFlushesLocalNodeGroups() throws {
+        // A small buffer pool, so that the transaction's local node groups are flushed.
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 64 * 1024 * 1024,
+            maxNumThreads: 4,
+            enableCompression: true,
+            readOnly: false,
+            autoCheckpoint: true,
+            checkpointThreshold: UInt64.max
+        )
+        let dbPath = NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        let smallDB = try Database(dbPath, systemConfig)
+        let conn = try Connection(smallDB)
+        _ = try conn.query(
+            "CREATE NODE TABLE Event(id INT64, payload STRING, PRIMARY KEY(id));"
+        )
+
+        _ = try conn.query("BEGIN TRANSACTION;")
+        for batch in 0..<4 {
+            _ = try conn.query(
+                """
+                UNWIND RANGE(\(batch * 200_000), \(batch * 200_000 + 199_999)) AS i
+                CREATE (:Event {id: i, payload: 'event payload number ' + CAST(i, 'STRING')});
+                """
+            )
+        }
+        var result = try conn.query("MATCH (e:Event) RETURN count(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 800_000)
+        result = try conn.query("MATCH (e:Event) WHERE e.id = 12345 RETURN e.payload;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! String, "event payload number 12345")
+        _ = try conn.query("MATCH (e:Event) WHERE e.id = 7 SET e.payload = 'updated';")
+        _ = try conn.query("MATCH (e:Event) WHERE e.id = 8 DELETE e;")
+        _ = try conn.query("COMMIT;")
+
+        // Flushed node groups are committed together with their pages, so they are on disk
+        // before any checkpoint.
+        result = try conn.query(
+            """
+            CALL storage_info('Event') WHERE residency = 'ON_DISK'
+            RETURN count(DISTINCT node_group_id);
+            """
+        )
+        XCTAssertGreaterThan(try result.getNext()!.getValue(0) as! Int64, 0)
+        result = try conn.query("MATCH (e:Event) RETURN count(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 799_999)
+        result = try conn.query("MATCH (e:Event) WHERE e.id >= 6 AND e.id <= 9 RETURN e.payload;")
+        var payloads: [String] = []
+        while result.hasNext() {
+            payloads.append(try result.getNext()!.getValue(0) as! String)
+        }
+        XCTAssertEqual(
+            payloads.sorted(),
+            ["event payload number 6", "event payload number 9", "updated"]
+        )
+        result = try conn.query("MATCH (e:Event) WHERE e.id = 654321 RETURN e.payload;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! String, "event payload number 654321")
+    }
+
+    func testSortedRelNeighborOrder() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Person(id INT64, PRIMARY KEY(id));")
+        _ = try conn.query("CREATE REL TABLE Knows(FROM Person TO Person, since INT64);")
+        _ = try conn.query("UNWIND RANGE(0, 20) AS i CREATE (:Person {id: i});")
+        _ = try conn.query("CALL SET_REL_NEIGHBOR_ORDER('Knows', true);")
+
+        func neighborsOfZero() throws -> [Int64] {
+            let result = try conn.query(
+                "MATCH (a:Person)-[:Knows]->(b) WHERE a.id = 0 RETURN b.id;"
+            )
+            var ids: [Int64] = []
+            while result.hasNext() {
+                ids.append(try result.getNext()!.getValue(0) as! Int64)
+            }
+            return ids
+        }
+        // Rels are inserted in descending neighbor order, even neighbors first.
+        for parity in [0, 1] {
+            _ = try conn.query(
+                """
+                UNWIND RANGE(0, 9) AS i
+                MATCH (a:Person), (b:Person) WHERE a.id = 0 AND b.id = 20 - \(parity) - 2 * i
+                CREATE (a)-[:Knows]->(b);
+                """
+            )
+            _ = try conn.query("CHECKPOINT;")
+        }
+        XCTAssertEqual(try neighborsOfZero(), Array(1...20))
+
+        // Rels to update or delete are binary searched for in the sorted lists.
+        _ = try conn.query(
+            "MATCH (a:Person)-[k:Knows]->(b:Person) WHERE a.id = 0 AND b.id = 7 SET k.since = 2020;"
+        )
+        _ = try conn.query(
+            "MATCH (a:Person)-[k:Knows]->(b:Person) WHERE a.id = 0 AND b.id = 12 DELETE k;"
+        )
+        var result = try conn.query(
+            "MATCH (a:Person)-[k:Knows]->(b:Person) WHERE k.since = 2020 RETURN a.id, b.id;"
+        )
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 0)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, 7)
+        XCTAssertFalse(result.hasNext())
+        XCTAssertEqual(try neighborsOfZero(), Array(1...11) + Array(13...20))
+
+        _ = try conn.query(
+            """
+            MATCH (a:Person), (b:Person) WHERE a.id > 0 AND a.id < 20 AND b.id = a.id + 1
+            CREATE (a)-[:Knows]->(b);
+            """
+        )
+        result = try conn.query(
+            "MATCH (a:Person)-[:Knows]->(b:Person)-[:Knows]->(c:Person), (a)-[:Knows]->(c) "
+                + "RETURN count(*);"
+        )
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 17)
+
+        do {
+            _ = try conn.query("CALL SET_REL_NEIGHBOR_ORDER('Person', true);")
+            XCTFail("Expected error")
+        } catch let error as KuzuError {
+            XCTAssertTrue(error.message.contains("Person is not of type REL."))
+        }
+    }
+
+    func testScanPrefetch() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Reading(id INT64, label STRING, PRIMARY KEY(id));")
+        _ = try conn.query(
+            """
+            UNWIND RANGE(0, 199999) AS i
+            CREATE (:Reading {id: i, label: 'sensor-' + CAST(i * 7919 % 200003, 'STRING')});
+            """
+        )
+        // Checkpointed pages are written to the file directly, so the scan below reads them cold.
+        _ = try conn.query("CHECKPOINT;")
+        var result = try conn.query("MATCH (r:Reading) RETURN sum(r.id), count(r.label);")
+        let sums = try result.getNext()!
+        XCTAssertEqual(try sums.getValue(0) as! Int64, 19_999_900_000)
+        XCTAssertEqual(try sums.getValue(1) as! Int64, 200_000)
+
+        result = try conn.query("CALL bm_info() RETURN prefetched_pages, prefetch_hits;")
+        let stats = try result.getNext()!
+        let prefetchedPages = try stats.getValue(0) as! UInt64
+        XCTAssertGreaterThan(prefetchedPages, 0)
+        XCTAssertLessThanOrEqual(try stats.getValue(1) as! UInt64, prefetchedPages)
+
+        _ = try conn.query("CALL scan_prefetch_depth=0;")
+        result = try conn.query("CALL current_setting('scan_prefetch_depth') RETURN *;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! String, "0")
+        result = try conn.query("MATCH (r:Reading) WHERE r.id = 4242 RETURN r.label;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! String, "sensor-191897")
+    }
+
+    func testScanResistantEviction() throws {
+        // A buffer pool about the size of the scanned table, so that the scan has to evict pages.
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 64 * 1024 * 1024,
+            maxNumThreads: 4,
+            enableCompression: true,
+            readOnly: false,
+            autoCheckpoint: true,
+            checkpointThreshold: UInt64.max
+        )
+        let dbPath = NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        let smallDB = try Database(dbPath, systemConfig)
+        let conn = try Connection(smallDB)
+        _ = try conn.query("CALL eviction_policy='scan_resistant';")
+        var result = try conn.query("CALL current_setting('eviction_policy') RETURN *;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! String, "scan_resistant")
+
+        _ = try conn.query("CREATE NODE TABLE Event(id INT64, score DOUBLE, PRIMARY KEY(id));")
+        _ = try conn.query("CREATE NODE TABLE Log(id SERIAL, line STRING, PRIMARY KEY(id));")
+        _ = try conn.query(
+            "UNWIND RANGE(0, 99999) AS i CREATE (:Event {id: i, score: CAST(i % 100, 'DOUBLE')});"
+        )
+        for _ in 0..<4 {
+            _ = try conn.query(
+                """
+                UNWIND RANGE(0, 249999) AS i
+                CREATE (:Log {
+                    line: 'log line ' + CAST(i, 'STRING') + ' of a table that is scanned once '
+                        + 'while point lookups run'
+                });
+                """
+            )
+        }
+        _ = try conn.query("CHECKPOINT;")
+
+        func lookUpEvents() throws {
+            for id in [42, 4242, 42424] {
+                let result = try conn.query("MATCH (e:Event) WHERE e.id = \(id) RETURN e.score;")
+                XCTAssertEqual(try result.getNext()!.getValue(0) as! Double, Double(id % 100))
+            }
+        }
+        func numPageMisses() throws -> UInt64 {
+            let result = try conn.query("CALL bm_info() RETURN sum(page_misses);")
+            return try result.getNext()!.getValue(0) as! UInt64
+        }
+        // The pages of point lookups stay cached while a scan cycles through the buffer pool.
+        try lookUpEvents()
+        result = try conn.query("MATCH (l:Log) RETURN count(*), sum(size(l.line));")
+        let sums = try result.getNext()!
+        XCTAssertEqual(try sums.getValue(0) as! Int64, 1_000_000)
+        XCTAssertGreaterThan(try sums.getValue(1) as! Int64, 60_000_000)
+        let numMissesAfterScans = try numPageMisses()
+        XCTAssertGreaterThan(numMissesAfterScans, 0)
+        try lookUpEvents()
+        XCTAssertEqual(try numPageMisses(), numMissesAfterScans)
+
+        do {
+            _ = try conn.query("CALL eviction_policy='lru';")
+            XCTFail("Expected error")
+        } catch let error as KuzuError {
+            XCTAssertTrue(error.message.contains("Unknown eviction policy lru."))
+        } catch {
+            XCTFail("Unexpected error type")
+        }
+    }
+
+    func testParallelCheckpoint() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Account(id INT64, balance INT64, PRIMARY KEY(id));")
+        _ = try conn.query("CREATE NODE TABLE Branch(name STRING, PRIMARY KEY(name));")
+        _ = try conn.query("CREATE REL TABLE HeldAt(FROM Account TO Branch);")
+        _ = try conn.query(
+            "UNWIND RANGE(1, 8) AS i CREATE (:Branch {name: 'b' + CAST(i, 'STRING')});"
+        )
+        // Spans several node groups, so they are checkpointed by parallel tasks.
+        _ = try conn.query(
+            "UNWIND RANGE(0, 299999) AS i CREATE (:Account {id: i, balance: i % 1000});"
+        )
+        _ = try conn.query(
+            """
+            MATCH (a:Account), (b:Branch)
+            WHERE a.id < 4000 AND b.name = 'b' + CAST(a.id % 8 + 1, 'STRING')
+            CREATE (a)-[:HeldAt]->(b);
+            """
+        )
+        _ = try conn.query("CHECKPOINT;")
+
+        var result = try conn.query("CALL checkpoint_info() RETURN phase;")
+        var phases: [String] = []
+        while result.hasNext() {
+            phases.append(try result.getNext()!.getValue(0) as! String)
+        }
+        XCTAssertEqual(phases, ["storage", "catalog_and_metadata", "shadow_pages", "finalize"])
+
+        result = try conn.query("MATCH (a:Account) RETURN count(*), sum(a.balance);")
+        let totals = try result.getNext()!
+        XCTAssertEqual(try totals.getValue(0) as! Int64, 300_000)
+        XCTAssertEqual(try totals.getValue(1) as! Int64, 149_850_000)
+        result = try conn.query("MATCH (a:Account {id: 123456}) RETURN a.balance;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 456)
+        result = try conn.query(
+            "MATCH (:Account)-[:HeldAt]->(b:Branch {name: 'b3'}) RETURN count(*);"
+        )
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 500)
+    }
+
+    func testMemoryManagerAllocatorMetrics() throws {
+        let conn = try Connection(db)
+        // Aggregating and ordering strings allocates both temp pages and small overflow blocks.
+        var result = try conn.query(
+            """
+            UNWIND RANGE(1, 50000) AS i
+            WITH 'customer-group-' + CAST(i % 500, 'STRING') AS g, i
+            RETURN g, count(*) AS c ORDER BY g LIMIT 1;
+            """
+        )
+        let row = try result.getNext()!
+        XCTAssertEqual(try row.getValue(0) as! String, "customer-group-0")
+        XCTAssertEqual(try row.getValue(1) as! Int64, 100)
+
+        result = try conn.query("CALL mm_info() RETURN metric, value;")
+        var metrics: [String: UInt64] = [:]
+        while result.hasNext() {
+            let metric = try result.getNext()!
+            metrics[try metric.getValue(0) as! String] = try metric.getValue(1) as? UInt64
+        }
+        XCTAssertEqual(
+            Set(metrics.keys),
+            [
+                "page_allocations", "page_cache_hits", "global_pool_refills",
+                "global_pool_returns", "small_allocations", "small_allocation_cache_hits",
+                "lock_contentions",
+            ]
+        )
+        XCTAssertGreaterThan(metrics["page_allocations"]!, 0)
+        XCTAssertGreaterThan(metrics["small_allocations"]!, 0)
+        XCTAssertLessThanOrEqual(metrics["page_cache_hits"]!, metrics["page_allocations"]!)
+        // Each refill moves at least one page, so refills can't outnumber the cache misses.
+        XCTAssertLessThanOrEqual(
+            metrics["global_pool_refills"]!,
+            metrics["page_allocations"]! - metrics["page_cache_hits"]!
+        )
+        XCTAssertLessThanOrEqual(
+            metrics["small_allocation_cache_hits"]!, metrics["small_allocations"]!
+        )
+    }
+
+    func testProfileReportsMemoryAccessCounters() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Sensor(id INT64, reading DOUBLE, PRIMARY KEY(id));")
+        _ = try conn.query(
+            "UNWIND RANGE(1, 20000) AS i CREATE (:Sensor {id: i, reading: i * 0.5});"
+        )
+        let result = try conn.query("PROFILE MATCH (s:Sensor) RETURN sum(s.reading);")
+        let plan = try result.getNext()!.getValue(0) as! String
+        func counterValues(_ name: String) throws -> [String] {
+            let regex = try NSRegularExpression(pattern: name + ": ([^ │\\n]*)")
+            let range = NSRange(plan.startIndex..., in: plan)
+            return regex.matches(in: plan, range: range).map {
+                String(plan[Range($0.range(at: 1), in: plan)!])
+            }
+        }
+        // Every operator reports both counters as non-negative integers.
+        let numOperators = try counterValues("ExecutionTime").count
+        XCTAssertGreaterThan(numOperators, 0)
+        for name in ["PageFaults", "TLBMisses"] {
+            let values = try counterValues(name)
+            XCTAssertEqual(values.count, numOperators)
+            for value in values {
+                XCTAssertNotNil(UInt64(value), "\(name): \(value)")
+            }
+        }
+    }
+
+    func testQueryMemoryLimitFailsOnlyThatQuery() throws {
+        let conn = try Connection(db)
+        let otherConn = try Connection(db)
+        let heavyQuery = "UNWIND RANGE(1, 1000000) AS i RETURN count(DISTINCT i);"
+        conn.setQueryMemoryLimit(1024 * 1024, policy: .fail)
+        XCTAssertThrowsError(try conn.query(heavyQuery)) { error in
+            XCTAssertTrue((error as! KuzuError).message.contains("query memory limit"))
+        }
+        // Other connections don't share the limit, and light queries still fit into it.
+        var result = try otherConn.query(heavyQuery)
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1_000_000)
+        result = try conn.query("RETURN 1 + 1;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 2)
+
+        conn.setQueryMemoryLimit(0)
+        conn.setConnectionMemoryLimit(1024 * 1024)
+        XCTAssertThrowsError(try conn.query(heavyQuery)) { error in
+            XCTAssertTrue((error as! KuzuError).message.contains("connection memory limit"))
+        }
+        conn.setConnectionMemoryLimit(0)
+        _ = try conn.query("CALL admission_memory_budget=268435456;")
+        defer { _ = try? conn.query("CALL admission_memory_budget=0;") }
+        result = try conn.query(heavyQuery)
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1_000_000)
+    }
+
+    func testWaitingQueryResumesOnceMemoryIsReleased() throws {
+        let conn = try Connection(db)
+        // A query over its own limit can't be helped by waiting, so it fails right away.
+        conn.setQueryMemoryLimit(1024 * 1024, policy: .wait)
+        let start = Date()
+        XCTAssertThrowsError(
+            try conn.query("UNWIND RANGE(1, 1000000) AS i RETURN count(DISTINCT i);")
+        ) { error in
+            XCTAssertTrue((error as! KuzuError).message.contains("query memory limit"))
+        }
+        XCTAssertLessThan(Date().timeIntervalSince(start), 5)
+
+        // The unreleased result keeps the connection over its limit until it is dropped.
+        conn.setQueryMemoryLimit(0, policy: .wait)
+        var heldResult: QueryResult? = try conn.query("UNWIND RANGE(1, 1000000) AS i RETURN i;")
+        XCTAssertNotNil(heldResult)
+        conn.setConnectionMemoryLimit(4 * 1024 * 1024)
+        defer { conn.setConnectionMemoryLimit(0) }
+        // The result is released on another thread while the query below waits, so the lock
+        // orders the release with the check that follows the query.
+        let heldResultLock = NSLock()
+        DispatchQueue.global().asyncAfter(deadline: .now() + 0.2) {
+            heldResultLock.lock()
+            heldResult = nil
+            heldResultLock.unlock()
+        }
+        let result = try conn.query("UNWIND RANGE(1, 1000) AS i RETURN sum(i);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 500_500)
+        heldResultLock.lock()
+        XCTAssertNil(heldResult)
+        heldResultLock.unlock()
+    }
+
+    // Data the tables own once it is committed isn't charged to the connection, so an in-memory
+    // database can grow past the connection's limit over many small transactions.
+    func testCommittedDataIsNotChargedToConnection() throws {
+        let memoryDB = try Database(":memory:", SystemConfig(bufferPoolSize: 256 * 1024 * 1024))
+        let conn = try Connection(memoryDB)
+        _ = try conn.query("CREATE NODE TABLE Meter(id INT64, reading INT64, PRIMARY KEY(id));")
+        conn.setConnectionMemoryLimit(8 * 1024 * 1024)
+        defer { conn.setConnectionMemoryLimit(0) }
+        for batch in 0..<20 {
+            let start = batch * 50_000
+            _ = try conn.query(
+                """
+                UNWIND RANGE(\(start), \(start + 49_999)) AS i
+                CREATE (:Meter {id: i, reading: i});
+                """
+            )
+        }
+        for reading in 1...5 {
+            _ = try conn.query("MATCH (m:Meter) WHERE m.id < 200000 SET m.reading = \(reading);")
+        }
+        let result = try conn.query("MATCH (m:Meter) RETURN count(*), sum(m.reading);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, 1_000_000)
+        let expectedSum = (200_000..<1_000_000).reduce(0, +) + 200_000 * 5
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, Int64(expectedSum))
+    }
+
+    func testSpillPolicyKeepsCopyUnderQueryLimit() throws {
+        let conn = try Connection(db)
+        _ = try conn.query("CREATE NODE TABLE Station(id INT64, PRIMARY KEY(id));")
+        _ = try conn.query("CREATE REL TABLE Route(FROM Station TO Station);")
+        _ = try conn.query("UNWIND RANGE(0, 999) AS i CREATE (:Station {id: i});")
+        let copyQuery =
+            "COPY Route FROM (UNWIND RANGE(0, 999999) AS i RETURN i % 1000, (i * 7) % 1000);"
+        conn.setQueryMemoryLimit(16 * 1024 * 1024, policy: .fail)
+        XCTAssertThrowsError(try conn.query(copyQuery)) { error in
+            XCTAssertTrue((error as! KuzuError).message.contains("query memory limit"))
+        }
+        // The copy spills the relationships it has partitioned to stay under its limit.
+        conn.setQueryMemoryLimit(16 * 1024 * 1024, policy: .spill)
+        _ = try conn.query(copyQuery)
+        conn.setQueryMemoryLimit(0)
+        let result = try conn.query("MATCH ()-[r:Route]->() RETURN count(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 1_000_000)
+    }
 }
@@ -9,7 +9,46 @@ import XCTest
 
 @testable import Kuzu
 
+private let numItems = 100_000
+
 final class DatabaseTests: XCTestCase {
+    // Returns the path of a new database, which the caller removes.
+    private func newDatabasePath() -> String {
+        return NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+    }
+
+    // Creates the Item table with numItems items, where the price of item i is i % 97.
+    private func createItems(_ conn: Connection) throws {
+        _ = try conn.query("CREATE NODE TABLE Item(id INT64, price INT64, PRIMARY KEY(id));")
+        _ = try conn.query(
+            "UNWIND RANGE(1, \(numItems)) AS i CREATE (:Item {id: i, price: i % 97});"
+        )
+    }
+
+    // Returns the sum of the prices of the given items. Every tenth item costs updatedPrice instead
+    // if it is given.
+    private func expectedPriceSum(
+        ids: ClosedRange<Int> = 1...numItems, updatedPrice: Int64? = nil
+    ) -> Int64 {
+        return ids.reduce(Int64(0)) { sum, id in
+            if let updatedPrice, id % 10 == 0 {
+                return sum + updatedPrice
+            }
+            return sum + Int64(id % 97)
+        }
+    }
+
+    // Checks the number of items and the sum of their prices.
+    private func assertItems(
+        _ conn: Connection, count: Int = numItems, priceSum: Int64,
+        file: StaticString = #filePath, line: UInt = #line
+    ) throws {
+        let result = try conn.query("MATCH (i:Item) RETURN count(*), sum(i.price);")
+        let tuple = try result.getNext()!
+        XCTAssertEqual(try tuple.getValue(0) as! Int64, Int64(count), file: file, line: line)
+        XCTAssertEqual(try tuple.getValue(1) as! Int64, priceSum, file: file, line: line)
+    }
+
     func testOpenDatabaseWithDefaultConfig() throws {
         let dbPath =
             NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
@@ -60,6 +99,14 @@ final class DatabaseTests: XCTestCase {
         XCTAssertEqual(values2[1] as! Int64, 40)
 
         XCTAssertFalse(result.hasNext())
+
+        // No file is read through the buffer pool, but the pool itself is still reported.
+        let bmInfo = try conn.query("CALL bm_info() RETURN mem_limit, mem_usage, file_path;")
+        let stats = try bmInfo.getNext()!
+        XCTAssertGreaterThan(try stats.getValue(0) as! UInt64, 0)
+        XCTAssertGreaterThan(try stats.getValue(1) as! UInt64, 0)
+        XCTAssertNil(try stats.getValue(2))
+        XCTAssertFalse(bmInfo.hasNext())
     }
 
     func testGetVersion() {
@@ -115,4 +162,250 @@ final class DatabaseTests: XCTestCase {
             XCTAssertFalse(result.hasNext())
         }
     #endif
+
+    func testOpenDatabaseWithDirectIO() throws {
+        let dbPath = newDatabasePath()
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 64 * 1024 * 1024,
+            maxNumThreads: 2,
+            enableDirectIO: true
+        )
+        do {
+            let db = try Database(dbPath, systemConfig)
+            let conn = try Connection(db)
+            try createItems(conn)
+            _ = try conn.query("CHECKPOINT;")
+            _ = try conn.query("MATCH (i:Item) WHERE i.id % 10 = 0 SET i.price = 1000;")
+            _ = try conn.query("CHECKPOINT;")
+
+            let result = try conn.query(
+                "CALL bm_info() WHERE file_path = '\(dbPath)' RETURN direct_io;"
+            )
+            let row = try result.getNext()!
+            XCTAssertNotNil(try row.getValue(0) as? Bool)
+            #if !os(Linux)
+                // Linux falls back to buffered I/O on file systems without O_DIRECT, e.g. tmpfs.
+                XCTAssertTrue(try row.getValue(0) as! Bool)
+            #endif
+        }
+        let db = try Database(dbPath, systemConfig)
+        try assertItems(Connection(db), priceSum: expectedPriceSum(updatedPrice: 1000))
+    }
+
+    // Huge pages and NUMA binding only take effect on Linux, and are ignored elsewhere or when the
+    // kernel rejects them, so the database must work either way.
+    func testOpenDatabaseWithHugePagesAndNumaBinding() throws {
+        let dbPath = newDatabasePath()
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 64 * 1024 * 1024,
+            maxNumThreads: 2,
+            enableHugePages: true,
+            bindBufferPoolToNumaNodes: true
+        )
+        do {
+            let db = try Database(dbPath, systemConfig)
+            let conn = try Connection(db)
+            try createItems(conn)
+            _ = try conn.query("CHECKPOINT;")
+            try assertItems(conn, priceSum: expectedPriceSum())
+        }
+        let db = try Database(dbPath, systemConfig)
+        try assertItems(Connection(db), priceSum: expectedPriceSum())
+    }
+
+    func testReopenDatabaseWithBufferPoolWarmup() throws {
+        let dbPath = newDatabasePath()
+        defer {
+            try? FileManager.default.removeItem(atPath: dbPath)
+            try? FileManager.default.removeItem(atPath: dbPath + ".warmup")
+        }
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 64 * 1024 * 1024,
+            maxNumThreads: 2,
+            enableBufferPoolWarmup: true
+        )
+        do {
+            let db = try Database(dbPath, systemConfig)
+            let conn = try Connection(db)
+            try createItems(conn)
+            _ = try conn.query("CHECKPOINT;")
+            _ = try conn.query("MATCH (i:Item) RETURN sum(i.price);")
+        }
+        XCTAssertTrue(FileManager.default.fileExists(atPath: dbPath + ".warmup"))
+
+        do {
+            let db = try Database(dbPath, systemConfig)
+            let conn = try Connection(db)
+            // Pages are reloaded in the background after the database is opened.
+            var numWarmedPages: UInt64 = 0
+            for _ in 0..<100 where numWarmedPages == 0 {
+                let result = try conn.query("CALL bm_info() RETURN warmed_pages LIMIT 1;")
+                numWarmedPages = try result.getNext()!.getValue(0) as! UInt64
+                if numWarmedPages == 0 {
+                    Thread.sleep(forTimeInterval: 0.05)
+                }
+            }
+            XCTAssertGreaterThan(numWarmedPages, 0)
+            try assertItems(conn, priceSum: expectedPriceSum())
+        }
+
+        // Pages a checkpoint rewrites while the pool is still being warmed aren't cached stale.
+        let updatedSum = expectedPriceSum(updatedPrice: 1000)
+        do {
+            let db = try Database(dbPath, systemConfig)
+            let conn = try Connection(db)
+            _ = try conn.query("MATCH (i:Item) WHERE i.id % 10 = 0 SET i.price = 1000;")
+            _ = try conn.query("CHECKPOINT;")
+            try assertItems(conn, priceSum: updatedSum)
+        }
+        let db = try Database(dbPath, systemConfig)
+        try assertItems(Connection(db), priceSum: updatedSum)
+    }
+
+    func testBufferPoolWarmupFileIsOnlyTrustedWhenIntact() throws {
+        let dbPath = newDatabasePath()
+        let warmupPath = dbPath + ".warmup"
+        defer {
+            try? FileManager.default.removeItem(atPath: dbPath)
+            try? FileManager.default.removeItem(atPath: warmupPath)
+        }
+        do {
+            let db = try Database(
+                dbPath,
+                SystemConfig(bufferPoolSize: 64 * 1024 * 1024, enableBufferPoolWarmup: true)
+            )
+            let conn = try Connection(db)
+            try createItems(conn)
+            _ = try conn.query("CHECKPOINT;")
+            _ = try conn.query("MATCH (i:Item) RETURN sum(i.price);")
+        }
+        let recording = try Data(contentsOf: URL(fileURLWithPath: warmupPath))
+
+        // Read-only opens reload the recorded pages, but never rewrite the recording.
+        do {
+            let db = try Database(
+                dbPath,
+                SystemConfig(
+                    bufferPoolSize: 64 * 1024 * 1024,
+                    readOnly: true,
+                    enableBufferPoolWarmup: true
+                )
+            )
+            try assertItems(Connection(db), priceSum: expectedPriceSum())
+        }
+        XCTAssertEqual(try Data(contentsOf: URL(fileURLWithPath: warmupPath)), recording)
+
+        // A recording that doesn't match its checksum isn't reloaded.
+        var corrupted = recording
+        corrupted[corrupted.count - 1] ^= 0xFF
+        try corrupted.write(to: URL(fileURLWithPath: warmupPath))
+        let db = try Database(
+            dbPath,
+            SystemConfig(bufferPoolSize: 64 * 1024 * 1024, enableBufferPoolWarmup: true)
+        )
+        let conn = try Connection(db)
+        Thread.sleep(forTimeInterval: 0.2)
+        let result = try conn.query("CALL bm_info() RETURN warmed_pages LIMIT 1;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! UInt64, 0)
+        try assertItems(conn, priceSum: expectedPriceSum())
+    }
+
+    func testOpenReadOnlyDatabaseWithMemoryMappedReads() throws {
+        let dbPath = newDatabasePath()
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        do {
+            let db = try Database(dbPath)
+            try createItems(Connection(db))
+        }
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 64 * 1024 * 1024,
+            maxNumThreads: 2,
+            readOnly: true,
+            enableMemoryMappedReads: true
+        )
+        let db = try Database(dbPath, systemConfig)
+        let conn = try Connection(db)
+        let result = try conn.query(
+            "CALL bm_info() WHERE file_path = '\(dbPath)' RETURN memory_mapped;"
+        )
+        XCTAssertTrue(try result.getNext()!.getValue(0) as! Bool)
+        try assertItems(conn, priceSum: expectedPriceSum())
+
+        // Point lookups from several connections read the same mapped pages concurrently.
+        DispatchQueue.concurrentPerform(iterations: 4) { worker in
+            let conn = try! Connection(db)
+            for id in stride(from: worker + 1, through: numItems, by: 997) {
+                let result = try! conn.query("MATCH (i:Item {id: \(id)}) RETURN i.price;")
+                XCTAssertEqual(try! result.getNext()!.getValue(0) as! Int64, Int64(id % 97))
+            }
+        }
+    }
+
+    func testCompactDatabaseShrinksDataFile() throws {
+        let dbPath = newDatabasePath()
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        let fileSize = {
+            try FileManager.default.attributesOfItem(atPath: dbPath)[.size] as! UInt64
+        }
+        let systemConfig = SystemConfig(bufferPoolSize: 256 * 1024 * 1024, maxNumThreads: 2)
+        var sizeBeforeCompaction: UInt64 = 0
+        do {
+            let db = try Database(dbPath, systemConfig)
+            let conn = try Connection(db)
+            _ = try conn.query(
+                "CREATE NODE TABLE Filler(id INT64, payload STRING, PRIMARY KEY(id));"
+            )
+            _ = try conn.query(
+                "UNWIND RANGE(1, 200000) AS i "
+                    + "CREATE (:Filler {id: i, payload: 'filler-' + CAST(i, 'STRING')});"
+            )
+            _ = try conn.query("CHECKPOINT;")
+            try createItems(conn)
+            _ = try conn.query("CHECKPOINT;")
+            // The filler's pages become free space in front of the items.
+            _ = try conn.query("DROP TABLE Filler;")
+            _ = try conn.query("CHECKPOINT;")
+            sizeBeforeCompaction = try fileSize()
+            _ = try conn.query("CALL compact_database();")
+            XCTAssertLessThan(try fileSize(), sizeBeforeCompaction)
+            // The primary key index still finds moved rows and rejects duplicates.
+            let result = try conn.query("MATCH (i:Item {id: 4242}) RETURN i.price;")
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 4242 % 97)
+            XCTAssertThrowsError(try conn.query("CREATE (:Item {id: 7, price: 0});"))
+        }
+
+        do {
+            let db = try Database(dbPath, systemConfig)
+            let conn = try Connection(db)
+            XCTAssertLessThan(try fileSize(), sizeBeforeCompaction)
+            try assertItems(conn, priceSum: expectedPriceSum())
+            let result = try conn.query("MATCH (i:Item {id: 99999}) RETURN i.price;")
+            XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 99999 % 97)
+            // New data must go to pages that are free in the truncated file, not on top of the
+            // moved items.
+            _ = try conn.query(
+                "CREATE NODE TABLE Extra(id INT64, payload STRING, PRIMARY KEY(id));"
+            )
+            _ = try conn.query(
+                "UNWIND RANGE(1, 50000) AS i "
+                    + "CREATE (:Extra {id: i, payload: 'extra-' + CAST(i, 'STRING')});"
+            )
+            _ = try conn.query(
+                "UNWIND RANGE(100001, 110000) AS i CREATE (:Item {id: i, price: i % 97});"
+            )
+            _ = try conn.query("CHECKPOINT;")
+        }
+
+        let db = try Database(dbPath, systemConfig)
+        let conn = try Connection(db)
+        try assertItems(conn, count: 110_000, priceSum: expectedPriceSum(ids: 1...110_000))
+        var result = try conn.query("MATCH (i:Item {id: 4242}) RETURN i.price;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 4242 % 97)
+        result = try conn.query("MATCH (e:Extra) RETURN count(*);")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! Int64, 50_000)
+        result = try conn.query("MATCH (e:Extra {id: 31337}) RETURN e.payload;")
+        XCTAssertEqual(try result.getNext()!.getValue(0) as! String, "extra-31337")
+    }
 }
@@ -10,14 +10,14 @@ import XCTest
 @testable import Kuzu
 
 final class ExtensionTests: XCTestCase {
-    func testGds() async throws {
-        func normalize(_ rows: [[String]]) -> [[String]] {
-            return
-                rows
-                .map { $0.sorted() }
-                .sorted { $0.lexicographicallyPrecedes($1) }
-        }
+    private func normalize(_ rows: [[String]]) -> [[String]] {
+        return
+            rows
+            .map { $0.sorted() }
+            .sorted { $0.lexicographicallyPrecedes($1) }
+    }
 
+    private func createGraph() throws -> (Database, Connection) {
         let systemConfig = SystemConfig(
             bufferPoolSize: 256 * 1024 * 1024,
             maxNumThreads: 4,
@@ -56,6 +56,11 @@ final class ExtensionTests: XCTestCase {
             """
         )
         _ = try conn.query("CALL project_graph('Graph', ['Node'], ['Edge']);")
+        return (db, conn)
+    }
+
+    func testGds() async throws {
+        let (_, conn) = try createGraph()
         let result = try conn.query(
             "CALL weakly_connected_components('Graph') RETURN group_id, collect(node.id);"
         )
@@ -69,4 +74,113 @@ final class ExtensionTests: XCTestCase {
         ]
         XCTAssertEqual(normalize(groundTruth), normalize(rows))
     }
+
+    func testPersonalizedPageRank() async throws {
+        let (_, conn) = try createGraph()
+        let result = try conn.query(
+            """
+            CALL page_rank('Graph', sources := 'n.id = "G"', floatPrecision := true)
+            WHERE rank > 0 RETURN node.id ORDER BY rank DESC;
+            """
+        )
+        var ids: [String] = []
+        for row in result {
+            ids.append(try row.getValue(0) as! String)
+        }
+        XCTAssertEqual(ids.first, "G")
+        XCTAssertEqual(ids.sorted(), ["E", "F", "G", "H"])
+    }
+
+    func testTriangleCount() async throws {
+        let (_, conn) = try createGraph()
+        let result = try conn.query(
+            """
+            CALL triangle_count('Graph') WHERE triangle_count > 0
+            RETURN node.id, triangle_count, global_triangle_count ORDER BY node.id;
+            """
+        )
+        var rows: [[String]] = []
+        for row in result {
+            let id = try row.getValue(0) as! String
+            let count = try row.getValue(1) as! Int64
+            let globalCount = try row.getValue(2) as! Int64
+            rows.append([id, String(count), String(globalCount)])
+        }
+        XCTAssertEqual(
+            rows, [["E", "2", "2"], ["F", "1", "2"], ["G", "2", "2"], ["H", "1", "2"]])
+    }
+
+    func testLocalClusteringCoefficient() async throws {
+        let (_, conn) = try createGraph()
+        let result = try conn.query(
+            """
+            CALL local_clustering_coefficient('Graph')
+            RETURN node.id, local_clustering_coefficient ORDER BY node.id;
+            """
+        )
+        var coefficients: [String: Double] = [:]
+        for row in result {
+            let id = try row.getValue(0) as! String
+            coefficients[id] = try row.getValue(1) as? Double
+        }
+        XCTAssertEqual(coefficients["A"], 0)
+        XCTAssertEqual(coefficients["B"], 0)
+        XCTAssertEqual(coefficients["E"]!, 2.0 / 3.0, accuracy: 1e-9)
+        XCTAssertEqual(coefficients["F"], 1)
+        XCTAssertEqual(coefficients["G"]!, 2.0 / 3.0, accuracy: 1e-9)
+        XCTAssertEqual(coefficients["H"], 1)
+    }
+
+    // A shortest path search over a binary tree keeps its frontier below the sparse frontier
+    // threshold for the first levels, so those iterations must run on the sparse frontier.
+    func testShortestPathUsesSparseFrontier() throws {
+        let (_, conn) = try createGraph()
+        _ = try conn.query("CREATE NODE TABLE Tree(id INT64 PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Child(FROM Tree TO Tree);")
+        _ = try conn.query("UNWIND range(0, 4094) AS i CREATE (:Tree {id: i});")
+        _ = try conn.query(
+            """
+            UNWIND range(1, 4094) AS i
+            MATCH (a:Tree {id: (i - 1) / 2}), (b:Tree {id: i})
+            CREATE (a)-[:Child]->(b);
+            """
+        )
+        let query = "MATCH (a:Tree {id: 0})-[:Child* SHORTEST 1..30]->(b:Tree) RETURN count(*);"
+        func sparseIterations() throws -> UInt64 {
+            let result = try conn.query("PROFILE " + query)
+            let plan = try result.getNext()!.getValue(0) as! String
+            let regex = try NSRegularExpression(pattern: "SparseIterations: ([0-9]+)")
+            let match = try XCTUnwrap(
+                regex.firstMatch(in: plan, range: NSRange(plan.startIndex..., in: plan))
+            )
+            return UInt64(plan[Range(match.range(at: 1), in: plan)!])!
+        }
+        func count() throws -> Int64 {
+            return try conn.query(query).getNext()!.getValue(0) as! Int64
+        }
+        XCTAssertEqual(try count(), 4094)
+        let numSparseIterations = try sparseIterations()
+        XCTAssertGreaterThan(numSparseIterations, 1)
+
+        // With a threshold of zero, the frontier switches to dense after the source's iteration.
+        _ = try conn.query("CALL sparse_frontier_threshold=0;")
+        XCTAssertEqual(try count(), 4094)
+        XCTAssertEqual(try sparseIterations(), 1)
+    }
+
+    func testLeiden() async throws {
+        let (_, conn) = try createGraph()
+        let result = try conn.query(
+            "CALL leiden('Graph', resolution := 1.0) RETURN leiden_id, collect(node.id);"
+        )
+        var rows: [[String]] = []
+        for row in result {
+            let rowValue = try row.getValue(1) as! [String]
+            rows.append(rowValue)
+        }
+        let groundTruth: [[String]] = [
+            ["I"], ["D"], ["B", "C", "A"], ["G", "F", "H", "E"],
+        ]
+        XCTAssertEqual(normalize(groundTruth), normalize(rows))
+    }
 }
@@ -0,0 +1,101 @@
+//
+//  kuzu-swift
+//  https://github.com/kuzudb/kuzu-swift
+//
+//  Copyright © 2023 - 2025 Kùzu Inc.
+//  This code is licensed under MIT license (see LICENSE for details)
+import Foundation
+import XCTest
+
+@testable import Kuzu
+
+// Benchmarks that take too long for the unit tests. They are skipped unless KUZU_SWIFT_BENCHMARKS
+// is set, e.g. KUZU_SWIFT_BENCHMARKS=1 swift test -c release --filter ScanBenchmarks.
+final class ScanBenchmarks: XCTestCase {
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+        try XCTSkipIf(
+            ProcessInfo.processInfo.environment["KUZU_SWIFT_BENCHMARKS"] == nil,
+            "Set KUZU_SWIFT_BENCHMARKS to run the benchmarks."
+        )
+    }
+
+    // Scans a table several times larger than the buffer pool, so that pages are evicted and read
+    // again on every run. Compare the two measurements to see the cost of bypassing the page cache.
+    private func measureScanUnderMemoryPressure(enableDirectIO: Bool) throws {
+        let dbPath =
+            NSTemporaryDirectory() + "kuzu_swift_test_db_" + UUID().uuidString
+        defer { try? FileManager.default.removeItem(atPath: dbPath) }
+        do {
+            let db = try Database(
+                dbPath,
+                SystemConfig(bufferPoolSize: 512 * 1024 * 1024, enableCompression: false)
+            )
+            let conn = try Connection(db)
+            _ = try conn.query(
+                "CREATE NODE TABLE Reading(id INT64, a INT64, b INT64, PRIMARY KEY(id));"
+            )
+            _ = try conn.query(
+                "UNWIND RANGE(1, 2000000) AS i CREATE (:Reading {id: i, a: i % 7, b: i % 11});"
+            )
+        }
+        let systemConfig = SystemConfig(
+            bufferPoolSize: 16 * 1024 * 1024,
+            maxNumThreads: 2,
+            enableCompression: false,
+            enableDirectIO: enableDirectIO
+        )
+        let db = try Database(dbPath, systemConfig)
+        let conn = try Connection(db)
+        measure {
+            let result = try! conn.query("MATCH (r:Reading) RETURN sum(r.a), sum(r.b);")
+            let tuple = try! result.getNext()!
+            XCTAssertEqual(try! tuple.getValue(0) as! Int64, 5_999_997)
+            XCTAssertEqual(try! tuple.getValue(1) as! Int64, 9_999_993)
+        }
+    }
+
+    func testBufferedIOScanPerformance() throws {
+        try measureScanUnderMemoryPressure(enableDirectIO: false)
+    }
+
+    func testDirectIOScanPerformance() throws {
+        try measureScanUnderMemoryPressure(enableDirectIO: true)
+    }
+
+    // Measures a shortest path search over a binary tree, which keeps its frontier small for most
+    // iterations. Compare the two measurements to see the cost of scanning a dense frontier.
+    private func measureShortestPath(sparseFrontierThreshold: Int) throws {
+        let db = try Database(":memory:", SystemConfig(bufferPoolSize: 256 * 1024 * 1024))
+        let conn = try Connection(db)
+        _ = try conn.query("CALL sparse_frontier_threshold=\(sparseFrontierThreshold);")
+        _ = try conn.query("CREATE NODE TABLE Tree(id INT64 PRIMARY KEY);")
+        _ = try conn.query("CREATE REL TABLE Child(FROM Tree TO Tree);")
+        _ = try conn.query("UNWIND range(0, 4094) AS i CREATE (:Tree {id: i});")
+        _ = try conn.query(
+            """
+            UNWIND range(1, 4094) AS i
+            MATCH (a:Tree {id: (i - 1) / 2}), (b:Tree {id: i})
+            CREATE (a)-[:Child]->(b);
+            """
+        )
+        measure {
+            let result = try! conn.query(
+                """
+                MATCH (a:Tree {id: 0})-[:Child* SHORTEST 1..30]->(b:Tree)
+                RETURN count(*);
+                """
+            )
+            let count = try! result.getNext()!.getValue(0) as! Int64
+            XCTAssertEqual(count, 4094)
+        }
+    }
+
+    func testSparseFrontierPerformance() throws {
+        try measureShortestPath(sparseFrontierThreshold: 1000)
+    }
+
+    func testDenseFrontierPerformance() throws {
+        try measureShortestPath(sparseFrontierThreshold: 0)
+    }
+}